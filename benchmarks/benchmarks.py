@@ -0,0 +1,352 @@
+"""
+This script times a suite of representative VICE calculations and writes the
+results to a JSON file tagged with the commit they were measured at, such that
+performance can be compared across commits and releases.
+
+Usage: python benchmarks.py [--quick] [--repeat N] [--group GROUP] [--output
+FILE]
+"""
+
+from __future__ import division, print_function
+try:
+	ModuleNotFoundError
+except NameError:
+	ModuleNotFoundError = ImportError
+try:
+	import vice
+except ModuleNotFoundError:
+	raise ModuleNotFoundError("Could not import VICE.")
+import subprocess
+import platform
+import argparse
+import tempfile
+import warnings
+import shutil
+import json
+import time
+import sys
+import os
+warnings.filterwarnings("ignore")
+
+_GROUPS_ = ["singlezone", "multizone", "output", "dataframe"]
+_HERE_ = os.path.dirname(os.path.abspath(__file__))
+
+
+# ------------------------------- TIMING ------------------------------- #
+class benchmark:
+
+	"""
+	A single timed case in the benchmark suite.
+
+	Parameters
+	==========
+	group :: str
+		The group of cases this one belongs to (e.g. "singlezone").
+	name :: str
+		A name for this case, unique within its group.
+	parameters :: dict
+		The parameters which distinguish this case from others in its group.
+		These are recorded in the output alongside the timing.
+	function :: <function>
+		Accepts no arguments, and performs the calculation to be timed.
+	setup :: <function> [default : None]
+		Accepts no arguments, and is called before each repetition of
+		``function`` without being timed.
+	"""
+
+	def __init__(self, group, name, parameters, function, setup = None):
+		self.group = group
+		self.name = name
+		self.parameters = parameters
+		self.function = function
+		self.setup = setup
+
+	def __call__(self, repeat):
+		"""
+		Time the case some number of times.
+
+		Parameters
+		==========
+		repeat :: int
+			The number of times to time the calculation.
+
+		Returns
+		=======
+		result :: dict
+			The group, name, and parameters of this case, along with the
+			wall-clock time of each repetition and their minimum and median
+			in seconds.
+		"""
+		times = []
+		for i in range(repeat):
+			if self.setup is not None: self.setup()
+			start = time.perf_counter()
+			self.function()
+			times.append(time.perf_counter() - start)
+		ordered = sorted(times)
+		return {
+			"group": self.group,
+			"name": self.name,
+			"parameters": self.parameters,
+			"times": times,
+			"min": ordered[0],
+			"median": ordered[len(ordered) // 2]
+		}
+
+
+# ------------------------------ SINGLEZONE ------------------------------ #
+def singlezone_case(name, parameters, quick, yields = None, mlr = None,
+	**kwargs):
+	"""
+	Construct a benchmark for a singlezone simulation.
+
+	Parameters
+	==========
+	name :: str
+		The name of the case.
+	parameters :: dict
+		The parameters to record in the output.
+	quick :: bool
+		Whether or not to run a shorter simulation.
+	yields :: <function> or real number [default : None]
+		If not None, the core collapse supernova yield of every element is
+		set to this value for the duration of the simulation.
+	mlr :: str [default : None]
+		If not None, the mass-lifetime relation to adopt.
+	kwargs :: varying types
+		Attributes of the singlezone object.
+	"""
+	endtime = 2 if quick else 10
+	output_times = [0.05 * i for i in range(int(endtime / 0.05) + 1)]
+	def function():
+		sz = vice.singlezone(name = "benchmark", **kwargs)
+		previous_mlr = vice.mlr.setting
+		previous_yields = dict([(elem, vice.yields.ccsne.settings[elem]) for
+			elem in sz.elements])
+		if mlr is not None: vice.mlr.setting = mlr
+		if yields is not None:
+			for elem in sz.elements: vice.yields.ccsne.settings[elem] = yields
+		try:
+			sz.run(output_times, overwrite = True)
+		finally:
+			vice.mlr.setting = previous_mlr
+			for elem in sz.elements:
+				vice.yields.ccsne.settings[elem] = previous_yields[elem]
+	return benchmark("singlezone", name, parameters, function)
+
+
+def singlezone_cases(quick):
+	"""
+	The singlezone benchmarks, varying the timestep size, the number of
+	elements, the smoothing time, the mass-lifetime relation, and functional
+	versus constant yields.
+	"""
+	cases = []
+	for dt in ([0.01, 0.005] if quick else [0.02, 0.01, 0.005, 0.001]):
+		cases.append(singlezone_case("dt=%g" % (dt), {"dt": dt}, quick,
+			dt = dt))
+	elements = vice.elements.recognized
+	for n in ([1, 3, 10] if quick else [1, 3, 10, 30, len(elements)]):
+		cases.append(singlezone_case("n_elements=%d" % (n),
+			{"n_elements": n}, quick, elements = elements[:n]))
+	for smoothing in [0, 0.5, 2]:
+		cases.append(singlezone_case("smoothing=%g" % (smoothing),
+			{"smoothing": smoothing}, quick, smoothing = smoothing))
+	for mlr in vice.mlr.recognized:
+		cases.append(singlezone_case("mlr=%s" % (mlr), {"mlr": mlr}, quick,
+			mlr = mlr))
+	cases.append(singlezone_case("yields=constant", {"yields": "constant"},
+		quick, yields = 0.001))
+	cases.append(singlezone_case("yields=callback", {"yields": "callback"},
+		quick, yields = lambda z: 0.001 * (1 + z)))
+	return cases
+
+
+# ------------------------------ MULTIZONE ------------------------------ #
+def multizone_case(name, parameters, quick, n_zones = 10, n_stars = 1,
+	migration = "none"):
+	"""
+	Construct a benchmark for a multizone simulation.
+
+	Parameters
+	==========
+	name :: str
+		The name of the case.
+	parameters :: dict
+		The parameters to record in the output.
+	quick :: bool
+		Whether or not to run a shorter simulation.
+	n_zones :: int [default : 10]
+		The number of zones.
+	n_stars :: int [default : 1]
+		The number of stellar populations per zone per timestep.
+	migration :: str [default : "none"]
+		The type of migration: "none", "gas" for a constant gas migration
+		matrix between neighbouring zones, or "stars" for stellar migration
+		to the next zone outward, evaluated through python.
+	"""
+	endtime = 2 if quick else 10
+	output_times = [0.05 * i for i in range(int(endtime / 0.05) + 1)]
+	def function():
+		mz = vice.multizone(name = "benchmark", n_zones = n_zones,
+			n_stars = n_stars)
+		for i in range(n_zones):
+			mz.zones[i].elements = ["fe", "o"]
+			mz.zones[i].dt = 0.01
+		if migration == "gas":
+			for i in range(n_zones - 1):
+				mz.migration.gas[i][i + 1] = 0.01
+				mz.migration.gas[i + 1][i] = 0.01
+		elif migration == "stars":
+			mz.migration.stars = lambda zone, tform, time: (
+				min(zone + 1, n_zones - 1) if time > tform + 1 else zone)
+		else: pass
+		mz.run(output_times, overwrite = True)
+	return benchmark("multizone", name, parameters, function)
+
+
+def multizone_cases(quick):
+	"""
+	The multizone benchmarks, varying the number of zones, the number of
+	stellar populations per zone per timestep, and the type of migration.
+	"""
+	cases = []
+	for n_zones in ([2, 10] if quick else [2, 10, 30, 100]):
+		cases.append(multizone_case("n_zones=%d" % (n_zones),
+			{"n_zones": n_zones}, quick, n_zones = n_zones))
+	for n_stars in ([1, 4] if quick else [1, 4, 16]):
+		cases.append(multizone_case("n_stars=%d" % (n_stars),
+			{"n_stars": n_stars}, quick, n_stars = n_stars))
+	for migration in ["none", "gas", "stars"]:
+		cases.append(multizone_case("migration=%s" % (migration),
+			{"migration": migration}, quick, migration = migration))
+	return cases
+
+
+# --------------------------- OUTPUT AND DATAFRAME --------------------------- #
+def output_cases(quick):
+	"""
+	The benchmarks for reading simulation output, using the output of a
+	singlezone and a multizone simulation run beforehand.
+	"""
+	elements = vice.elements.recognized[:3 if quick else 10]
+	output_times = [0.01 * i for i in range(1001)]
+	vice.singlezone(name = "benchmark_output", elements = elements).run(
+		output_times, overwrite = True)
+	mz = vice.multizone(name = "benchmark_output_mz", n_zones = 10)
+	for i in range(mz.n_zones): mz.zones[i].elements = elements
+	mz.run(output_times, overwrite = True)
+	parameters = {"n_elements": len(elements), "n_outputs": len(output_times)}
+	return [
+		benchmark("output", "output", parameters,
+			lambda: vice.output("benchmark_output")),
+		benchmark("output", "history", parameters,
+			lambda: vice.history("benchmark_output")["mgas"]),
+		benchmark("output", "mdf", parameters,
+			lambda: vice.mdf("benchmark_output")["bin_edge_left"]),
+		benchmark("output", "multioutput", dict(parameters, n_zones = 10),
+			lambda: vice.output("benchmark_output_mz").zones["zone0"]),
+		benchmark("output", "stars", dict(parameters, n_zones = 10),
+			lambda: vice.stars("benchmark_output_mz")["mass"])
+	]
+
+
+def dataframe_cases(quick):
+	"""
+	The benchmarks for constructing, indexing, and filtering dataframes.
+	"""
+	n = 1000 if quick else 100000
+	keys = ["x%d" % (i) for i in range(10)]
+	columns = dict([(key, [float(i) for i in range(n)]) for key in keys])
+	frame = vice.dataframe(columns)
+	def rows():
+		for i in range(0, n, max(n // 1000, 1)): frame[i]
+	parameters = {"n_rows": n, "n_columns": len(keys)}
+	return [
+		benchmark("dataframe", "construct", parameters,
+			lambda: vice.dataframe(columns)),
+		benchmark("dataframe", "column", parameters,
+			lambda: [frame[key] for key in keys]),
+		benchmark("dataframe", "row", parameters, rows),
+		benchmark("dataframe", "filter", parameters,
+			lambda: frame.filter(keys[0], '>', n / 2))
+	]
+
+
+# ------------------------------- DRIVER ------------------------------- #
+def commit():
+	"""
+	Determine the commit of the source tree being benchmarked.
+
+	Returns
+	=======
+	commit :: str
+		The full hash of the current git commit, with the suffix "-dirty" if
+		the working tree has uncommitted changes, or "unknown" if git or the
+		repository is unavailable.
+	"""
+	try:
+		sha = subprocess.check_output(["git", "rev-parse", "HEAD"],
+			cwd = _HERE_, stderr = subprocess.DEVNULL).decode().strip()
+		dirty = subprocess.call(["git", "diff", "--quiet", "HEAD"],
+			cwd = _HERE_, stderr = subprocess.DEVNULL)
+		return sha + ("-dirty" if dirty else "")
+	except (OSError, subprocess.CalledProcessError):
+		return "unknown"
+
+
+def main():
+	parser = argparse.ArgumentParser(description = "Run VICE's benchmarks.")
+	parser.add_argument("--quick", action = "store_true",
+		help = "Run shorter simulations and fewer cases.")
+	parser.add_argument("--repeat", type = int, default = 3,
+		help = "The number of times to time each case (default: 3).")
+	parser.add_argument("--group", action = "append", choices = _GROUPS_,
+		help = "Run only this group of cases. May be given more than once.")
+	parser.add_argument("--output", default = None,
+		help = "The JSON file to write (default: benchmarks_<commit>.json).")
+	args = parser.parse_args()
+
+	sha = commit()
+	output = os.path.abspath(args.output if args.output is not None else
+		"benchmarks_%s.json" % (sha[:12]))
+	generators = {
+		"singlezone": singlezone_cases,
+		"multizone": multizone_cases,
+		"output": output_cases,
+		"dataframe": dataframe_cases
+	}
+
+	# simulation output is written to, and removed with, a scratch directory
+	cwd = os.getcwd()
+	scratch = tempfile.mkdtemp(prefix = "vice_benchmarks_")
+	os.chdir(scratch)
+	results = []
+	try:
+		for group in (args.group if args.group is not None else _GROUPS_):
+			for case in generators[group](args.quick):
+				result = case(args.repeat)
+				print("%-12s %-24s %10.4f s" % (result["group"], result["name"],
+					result["min"]))
+				results.append(result)
+	finally:
+		os.chdir(cwd)
+		shutil.rmtree(scratch, ignore_errors = True)
+
+	with open(output, 'w') as out:
+		json.dump({
+			"commit": sha,
+			"vice_version": vice.__version__,
+			"python": platform.python_version(),
+			"platform": platform.platform(),
+			"date": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+			"quick": args.quick,
+			"repeat": args.repeat,
+			"results": results
+		}, out, indent = 4)
+	print("Results written to: %s" % (output))
+
+
+if __name__ == "__main__":
+	main()
+
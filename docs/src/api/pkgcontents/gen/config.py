@@ -68,6 +68,8 @@ _CONFIG_ = {
 			vice.output,
 			vice.multioutput,
 			vice.stars,
+			vice.response,
+			vice.sensitivities,
 			vice.mirror,
 			vice.toolkit,
 			vice.dataframe,
@@ -461,6 +463,7 @@ _CONFIG_ = {
 		"header": 		"vice.yields.ccsne",
 		"subs": 		[
 			vice.yields.ccsne.fractional,
+			vice.yields.ccsne.fractional_batch,
 			vice.yields.ccsne.table,
 			vice.yields.ccsne.settings,
 			vice.yields.ccsne.engines,
@@ -477,6 +480,11 @@ _CONFIG_ = {
 		"header": 		"vice.yields.ccsne.fractional",
 		"subs": 		[]
 	},
+	vice.yields.ccsne.fractional_batch: {
+		"filename": 	"vice.yields.ccsne.fractional_batch.rst",
+		"header": 		"vice.yields.ccsne.fractional_batch",
+		"subs": 		[]
+	},
 	vice.yields.ccsne.table: {
 		"filename": 	"vice.yields.ccsne.table.rst",
 		"header": 		"vice.yields.ccsne.table",
@@ -1478,6 +1486,35 @@ _CONFIG_ = {
 		"header": 		"vice.stars",
 		"subs": 		[]
 	},
+	vice.response: {
+		"filename": 	"vice.response.rst",
+		"header": 		"vice.response",
+		"subs": 		[
+			vice.response.name,
+			vice.response.elements,
+			vice.response.defaults
+		]
+	},
+	vice.response.name: {
+		"filename": 	"vice.response.name.rst",
+		"header": 		"vice.response.name",
+		"subs": 		[]
+	},
+	vice.response.elements: {
+		"filename": 	"vice.response.elements.rst",
+		"header": 		"vice.response.elements",
+		"subs": 		[]
+	},
+	vice.response.defaults: {
+		"filename": 	"vice.response.defaults.rst",
+		"header": 		"vice.response.defaults",
+		"subs": 		[]
+	},
+	vice.sensitivities: {
+		"filename": 	"vice.sensitivities.rst",
+		"header": 		"vice.sensitivities",
+		"subs": 		[]
+	},
 	vice.mirror: {
 		"filename": 	"vice.mirror.rst",
 		"header": 		"vice.mirror",
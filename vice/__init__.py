@@ -36,6 +36,8 @@ singlezone : ``object``
 	Simulate a single-zone galactic chemical evolution model
 multizone : ``object``
 	Simulate a multi-zone galactic chemical evolution model
+ensemble : ``object``
+	Simulate many single-zone models with shared setup across threads
 milkyway : ``object``
 	A ``multizone`` object optimized for modeling the Milky Way.
 output : ``object``
@@ -68,6 +70,12 @@ history : <function>
 	Reads in time-evolution of interstellar medium from singlezone simulation.
 mdf : <function>
 	Reads in stellar metallicity distribution from singlezone simulation.
+response : <class>
+	Re-evaluates a singlezone simulation for new yields from its linear
+	response.
+sensitivities : <function>
+	Reads in derivatives with respect to parameters from singlezone
+	simulation.
 stars : <function>
 	Read in stellar population abundances from a multizone simulation output.
 toolkit : <module>
@@ -14,12 +14,17 @@ _CFILES_ = {
 	"vice.core._cutils": [
 		"./vice/src/objects/callback_1arg.c",
 		"./vice/src/objects/callback_2arg.c",
+		"./vice/src/toolkit/interp_scheme_1d.c",
+		"./vice/src/toolkit/interp_scheme_2d.c",
+		"./vice/src/toolkit/J21_sf_law.c",
 		"./vice/src/io/progressbar.c",
+		"./vice/src/profile.c",
 		"./vice/src/utils.c"
 	],
 	"vice.core._mlr": [
 		"./vice/src/ssp/mlr",
 		"./vice/src/ssp/mlr.c",
+		"./vice/src/objects/context.c",
 		"./vice/src/objects/interp_scheme_1d.c",
 		"./vice/src/objects/interp_scheme_2d.c",
 		"./vice/src/toolkit/interp_scheme_1d.c",
@@ -68,6 +73,18 @@ _CFILES_ = {
 		"./vice/src/utils.c"
 	],
 	"vice.core.dataframe._yield_settings": [],
+	"vice.core.ensemble._ensemble": [
+		"./vice/src/ensemble",
+		"./vice/src/io",
+		"./vice/src/multizone",
+		"./vice/src/objects",
+		"./vice/src/singlezone",
+		"./vice/src/ssp",
+		"./vice/src/ssp/mlr",
+		"./vice/src/toolkit",
+		"./vice/src/yields",
+		"./vice/src"
+	],
 	"vice.core.multizone._migration": [
 		"./vice/src/io",
 		"./vice/src/multizone",
@@ -79,6 +96,9 @@ _CFILES_ = {
 		"./vice/src/yields",
 		"./vice/src"
 	],
+	"vice.core.multizone._milkyway": [
+		"./vice/src/multizone/milkyway.c"
+	],
 	"vice.core.multizone._multizone": [
 		"./vice/src/io",
 		"./vice/src/multizone",
@@ -193,7 +213,16 @@ _CFILES_ = {
 		"./vice/src/objects/multizone.c",
 		"./vice/src/objects/migration.c",
 		"./vice/src/objects/tracer.c",
-		"./vice/src/objects/tests/multizone.c"
+		"./vice/src/objects/context.c",
+		"./vice/src/objects/interp_scheme_1d.c",
+		"./vice/src/objects/interp_scheme_2d.c",
+		"./vice/src/objects/tests/multizone.c",
+		"./vice/src/ssp/mlr",
+		"./vice/src/ssp/mlr.c",
+		"./vice/src/toolkit/interp_scheme_1d.c",
+		"./vice/src/toolkit/interp_scheme_2d.c",
+		"./vice/src/io/utils.c",
+		"./vice/src/utils.c"
 	],
 	"vice.core.objects.tests._singlezone": [
 		"./vice/src/io",
@@ -229,6 +258,8 @@ _CFILES_ = {
 	"vice.core.outputs._mdf": [],
 	"vice.core.outputs._multioutput": [],
 	"vice.core.outputs._output": [],
+	"vice.core.outputs._response": [],
+	"vice.core.outputs._sensitivities": [],
 	"vice.core.outputs._tracers": [],
 	"vice.core.singlezone._singlezone": [
 		"./vice/src/io",
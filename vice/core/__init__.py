@@ -28,6 +28,9 @@ if not __VICE_SETUP__:
 	from .singlezone import singlezone
 	from .mirror import mirror
 	from .mlr import mlr
+	from . import ensemble
+	__all__.extend(ensemble.__all__)
+	from .ensemble import *
 	from . import multizone
 	__all__.extend(multizone.__all__)
 	from .multizone import *
@@ -41,6 +44,7 @@ if not __VICE_SETUP__:
 
 	from ..testing import moduletest
 	from .dataframe import test as test_dataframe
+	from .ensemble import test as test_ensemble
 	from .multizone import test as test_multizone
 	from .objects import test as test_objects
 	from .outputs import test as test_outputs
@@ -53,6 +57,7 @@ if not __VICE_SETUP__:
 		return ["vice.core",
 			[
 				test_dataframe(run = False),
+				test_ensemble(run = False),
 				test_multizone(run = False),
 				test_objects(run = False),
 				test_outputs(run = False),
@@ -4,6 +4,7 @@ from __future__ import absolute_import
 from .objects._imf cimport IMF_
 from .objects._callback_1arg cimport CALLBACK_1ARG
 from .objects._callback_2arg cimport CALLBACK_2ARG
+from .objects._profile cimport PROFILE
 
 cdef extern from "../src/io/progressbar.h":
 	ctypedef struct PROGRESSBAR:
@@ -37,20 +38,47 @@ cdef extern from "../src/utils.h":
 
 
 cdef extern from "../src/objects.h":
+	ctypedef struct J21_SF_LAW:
+		double area
+		double present_day_molecular
+		double molecular_index
+		double Sigma_g1
+		double Sigma_g2
+		double index1
+		double index2
+		unsigned short sfr_mode
+
 	CALLBACK_1ARG *callback_1arg_initialize()
 	void callback_1arg_free(CALLBACK_1ARG *cb1)
 	CALLBACK_2ARG *callback_2arg_initialize()
 	void callback_2arg_free(CALLBACK_2ARG *cb2)
 
 
+cdef extern from "../src/toolkit/interp_scheme_1d.h":
+	double interp_scheme_1d_callback(double x, void *is1d)
+	double interp_scheme_1d_callback_positive(double x, void *is1d)
+
+
+cdef extern from "../src/toolkit/interp_scheme_2d.h":
+	double interp_scheme_2d_callback(double x, double y, void *is2d)
+	double interp_scheme_2d_callback_positive(double x, double y, void *is2d)
+
+
+cdef extern from "../src/toolkit/J21_sf_law.h":
+	double J21_sf_law_callback(double time, double arg2, void *law)
+
+
 cdef void callback_1arg_setup(CALLBACK_1ARG *cb1, value) except *
 cdef void callback_2arg_setup(CALLBACK_2ARG *cb2, value) except *
-cdef double callback_1arg(double x, void *f)
-cdef double callback_2arg(double x, double y, void *f)
+cdef double callback_1arg(double x, void *f) with gil
+cdef double callback_2arg(double x, double y, void *f) with gil
+cdef object native_interp_scheme(value, n_args)
+cdef J21_SF_LAW *native_J21_sf_law(value) except *
 cdef void setup_imf(IMF_ *imf, IMF) except *
 cdef void set_string(char *dest, pystr) except *
 cdef int *ordinals(pystr) except *
 cdef double *copy_pylist(pylist) except *
 cdef double **copy_2Dpylist(pylist) except *
 cdef double *map_pyfunc_over_array(pyfunc, pyarray) except *
+cdef dict profile_phases(PROFILE *p)
 
@@ -13,6 +13,7 @@ from .._globals import _VERSION_ERROR_
 from .._globals import _RECOGNIZED_IMFS_
 from .._globals import ScienceWarning
 from . import _pyutils
+from . import callback
 from ..yields import agb
 from ..yields import ccsne
 from ..yields import sneia
@@ -29,6 +30,8 @@ else:
 
 from libc.stdlib cimport malloc, free
 from libc.string cimport strlen
+from cpython.pycapsule cimport PyCapsule_GetPointer
+from .objects cimport _profile
 from . cimport _cutils
 
 
@@ -377,18 +380,41 @@ cdef void callback_1arg_setup(CALLBACK_1ARG *cb1, value) except *:
 		-	``value`` is neither a number nor callable
 		-	``value`` is callable and does not accept exactly one positional
 			argument
-			
+
+	Notes
+	-----
+	If ``value`` is an instance of
+	``vice.toolkit.interpolation.interp_scheme_1d``, or one of the callback1
+	classes wrapping one, the callback object evaluates the underlying C
+	object directly, and the simulation never calls python to evaluate it.
+	As in the callback1 classes, non-numerical values are replaced by 0, and
+	non-positive values by 1e-12 where the callback1 class requires a
+	positive value, though without a ``ScienceWarning``.
+
 	.. seealso:: vice/core/callback.py
 	"""
 	if callable(value):
 		if _pyutils.arg_count(value) == 1:
-			cb1[0].callback = &callback_1arg
-			cb1[0].user_func = <void *> value
+			native = native_interp_scheme(value, 1)
+			if native is None:
+				cb1[0].callback = &callback_1arg
+				cb1[0].user_func = <void *> value
+				cb1[0].native = 0
+			else:
+				if isinstance(value, (callback.callback1_nan_positive,
+					callback.callback1_nan_inf_positive)):
+					cb1[0].callback = &interp_scheme_1d_callback_positive
+				else:
+					cb1[0].callback = &interp_scheme_1d_callback
+				cb1[0].user_func = PyCapsule_GetPointer(native,
+					"INTERP_SCHEME_1D")
+				cb1[0].native = 1
 		else:
 			raise TypeError("""Function must accept exactly one positional \
 argument.""")
 	elif isinstance(value, numbers.Number):
 		cb1[0].user_func = NULL
+		cb1[0].native = 0
 		cb1[0].assumed_constant = <double> value
 	else:
 		raise TypeError("""Must be either a real number or a callable object. \
@@ -419,24 +445,62 @@ cdef void callback_2arg_setup(CALLBACK_2ARG *cb2, value) except *:
 		-	``value`` is callable and does not accept exactly two positional
 			arguments
 
+	Notes
+	-----
+	If ``value`` is an instance of
+	``vice.toolkit.interpolation.interp_scheme_2d``, or one of the callback2
+	classes wrapping one, the callback object evaluates the underlying C
+	object directly, and the simulation never calls python to evaluate it.
+	As in the callback2 classes, non-numerical values are replaced by 0, and
+	non-positive values by 1e-12 where the callback2 class requires a
+	positive value, though without a ``ScienceWarning``.
+
+	Instances of ``vice.toolkit.J21_sf_law`` are likewise evaluated in C, from
+	a copy of their attributes taken here which the callback object owns.
+
 	.. seealso:: vice/core/callback.py
 	"""
+	cdef J21_SF_LAW *law
+	if cb2[0].owns_user_func:
+		# the copy of a star formation law from a previous setup
+		free(cb2[0].user_func)
+		cb2[0].owns_user_func = 0
+	else: pass
 	if callable(value):
 		if _pyutils.arg_count(value) == 2:
-			cb2[0].callback = &callback_2arg
-			cb2[0].user_func = <void *> value
+			native = native_interp_scheme(value, 2)
+			law = native_J21_sf_law(value)
+			if native is not None:
+				if isinstance(value, (callback.callback2_nan_positive,
+					callback.callback2_nan_inf_positive)):
+					cb2[0].callback = &interp_scheme_2d_callback_positive
+				else:
+					cb2[0].callback = &interp_scheme_2d_callback
+				cb2[0].user_func = PyCapsule_GetPointer(native,
+					"INTERP_SCHEME_2D")
+				cb2[0].native = 1
+			elif law is not NULL:
+				cb2[0].callback = &J21_sf_law_callback
+				cb2[0].user_func = <void *> law
+				cb2[0].native = 1
+				cb2[0].owns_user_func = 1
+			else:
+				cb2[0].callback = &callback_2arg
+				cb2[0].user_func = <void *> value
+				cb2[0].native = 0
 		else:
 			raise TypeError("""Function must accept exactly two positional \
 arguments.""")
 	elif isinstance(value, numbers.Number):
 		cb2[0].user_func = NULL
+		cb2[0].native = 0
 		cb2[0].assumed_constant = <double> value
 	else:
 		raise TypeError("Function must be a callable object. Got: %s" % (
 			type(value)))
 
 
-cdef double callback_1arg(double x, void *f):
+cdef double callback_1arg(double x, void *f) with gil:
 	r"""
 	Call a function of one numerical value defined in Python from C.
 
@@ -461,13 +525,19 @@ cdef double callback_1arg(double x, void *f):
 		-	A non-numerical value is returned from the function, forcing it to
 			assume a default value of zero.
 
+	Notes
+	-----
+	Simulations are integrated with the global interpreter lock released.
+	This function reacquires it for the duration of the call to the user's
+	function only.
+
 	.. seealso:: vice/core/callback.py
 	"""
 	# pythonic callback objects handle errors
 	return <double> (<object> f)(x)
 
 
-cdef double callback_2arg(double x, double y, void *f):
+cdef double callback_2arg(double x, double y, void *f) with gil:
 	r"""
 	Call a function of two numerical values defined in Python from C.
 
@@ -493,12 +563,106 @@ cdef double callback_2arg(double x, double y, void *f):
 		-	A non-numerical value is returned from the function, forcing it to
 			assume a default value of zero.
 
+	Notes
+	-----
+	Simulations are integrated with the global interpreter lock released.
+	This function reacquires it for the duration of the call to the user's
+	function only.
+
 	.. seealso:: vice/core/callback.py
 	"""
 	# pythonic callback objects handle errors
 	return <double> (<object> f)(x, y)
 
 
+cdef object native_interp_scheme(value, n_args):
+	r"""
+	Obtain the C object underlying an interpolation scheme passed as a
+	function.
+
+	Parameters
+	----------
+	value : <function>
+		The function, either as passed by the user or wrapped by one of the
+		callback1 or callback2 classes.
+	n_args : ``int``
+		The number of arguments ``value`` accepts, either 1 or 2.
+
+	Returns
+	-------
+	native : ``PyCapsule`` or ``None``
+		The capsule holding a pointer to the ``INTERP_SCHEME_1D`` or
+		``INTERP_SCHEME_2D`` object underlying ``value``, or ``None`` if
+		``value`` is not an instance of
+		``vice.toolkit.interpolation.interp_scheme_1d`` or ``interp_scheme_2d``
+		with its own ``__call__`` function.
+
+	Notes
+	-----
+	Instances of subclasses which override ``__call__`` are called through
+	python, as they may not evaluate the interpolation scheme itself.
+	"""
+	# imported here, as vice.toolkit itself depends on this module
+	from ..toolkit.interpolation import interp_scheme_1d, interp_scheme_2d
+	if isinstance(value, (callback.callback1, callback.callback2)):
+		value = value.function
+	else: pass
+	scheme = interp_scheme_1d if n_args == 1 else interp_scheme_2d
+	if isinstance(value, scheme) and type(value).__call__ is scheme.__call__:
+		return value._native
+	else:
+		return None
+
+
+cdef J21_SF_LAW *native_J21_sf_law(value) except *:
+	r"""
+	Copy the parameters of a star formation law passed as a function of time
+	and gas supply or star formation rate into a C object.
+
+	Parameters
+	----------
+	value : <function>
+		The function, either as passed by the user or wrapped by the
+		callback2_nan_positive class, as is the ``tau_star`` attribute of
+		the ``singlezone`` object.
+
+	Returns
+	-------
+	law : ``J21_SF_LAW *``
+		A pointer to a newly allocated copy of the parameters of ``value``,
+		which the caller is responsible for freeing, or NULL if ``value`` is
+		not an instance of ``vice.toolkit.J21_sf_law`` with its own
+		``__call__`` and ``molecular`` functions.
+
+	Notes
+	-----
+	Later changes to the attributes of ``value`` do not affect the copy, but
+	simulations set up their callback objects immediately before running.
+	"""
+	# imported here, as vice.toolkit itself depends on this module
+	from ..toolkit.J21_sf_law import J21_sf_law
+	cdef J21_SF_LAW *law
+	if isinstance(value, callback.callback2_nan_positive):
+		value = value.function
+	else: pass
+	if (isinstance(value, J21_sf_law) and
+		type(value).__call__ is J21_sf_law.__call__ and
+		type(value).molecular is J21_sf_law.molecular):
+		law = <J21_SF_LAW *> malloc(sizeof(J21_SF_LAW))
+		law[0].area = value.area
+		law[0].present_day_molecular = value.present_day_molecular
+		law[0].molecular_index = value.molecular_index
+		law[0].Sigma_g1 = value.Sigma_g1
+		law[0].Sigma_g2 = value.Sigma_g2
+		# the indices of tau_star, rather than of the Kennicutt-Schmidt law
+		law[0].index1 = value._index1
+		law[0].index2 = value._index2
+		law[0].sfr_mode = int(value.mode == "sfr")
+		return law
+	else:
+		return NULL
+
+
 cdef void setup_imf(IMF_ *imf, IMF) except *:
 	r"""
 	Setup an IMF_ object.
@@ -688,3 +852,32 @@ cdef double *map_pyfunc_over_array(pyfunc, pyarray) except *:
 			raise TypeError("Non-numerical value detected.")
 	return mapped
 
+
+cdef dict profile_phases(PROFILE *p):
+	r"""
+	Obtain the time spent in each phase of a profiled simulation.
+
+	Parameters
+	----------
+	p : PROFILE *
+		A pointer to the profile of the simulation
+
+	Returns
+	-------
+	phases : dict
+		The total time in seconds and the number of times each phase was
+		entered, under the keys "seconds" and "calls", for every phase entered
+		at least once. The phases are keyed by their names (see
+		vice/src/profile.c).
+	"""
+	cdef unsigned short i
+	phases = {}
+	for i in range(_profile.PROFILE_N_PHASES):
+		if p[0].calls[i]:
+			phases[_profile.profile_phase_name(i).decode("latin-1")] = {
+				"seconds": p[0].seconds[i],
+				"calls": p[0].calls[i]
+			}
+		else: pass
+	return phases
+
@@ -0,0 +1,105 @@
+r"""
+Asynchronous Simulations
+========================
+
+.. warning:: User access of this module is discouraged
+
+Runs VICE's simulations on a background thread, handing the caller a future
+which reports the progress of the integration. The global interpreter lock
+is released while the simulations integrate and reacquired only to evaluate
+user-defined functions, so the calling thread (e.g. a Jupyter kernel) and
+other asynchronous runs are free to proceed in the meantime.
+"""
+
+from __future__ import absolute_import
+from concurrent.futures import Future
+import threading
+import numbers
+
+
+class simulation_future(Future):
+
+	r"""
+	A ``concurrent.futures.Future`` for a simulation running on a background
+	thread.
+
+	Attributes
+	----------
+	progress : ``float``
+		The fraction of the integration which has been completed.
+
+	All other functionality is inherited from ``concurrent.futures.Future``.
+	The result of the future is the return value of the simulation's ``run``
+	function, and any exception it raises is set as the exception of the
+	future.
+	"""
+
+	def __init__(self, simulation, final_time):
+		super(simulation_future, self).__init__()
+		self._simulation = simulation
+		self._final_time = final_time
+
+	@property
+	def progress(self):
+		r"""
+		Type : ``float``
+
+		The fraction of the integration which has been completed, as
+		determined by the current time of the simulation relative to the
+		largest output time. Always 1 once the simulation has finished.
+		"""
+		if self.done():
+			return 1.
+		elif self.running() and self._final_time > 0:
+			frac = self._simulation.current_time / self._final_time
+			return min(max(frac, 0.), 1.)
+		else:
+			return 0.
+
+
+def submit(run, simulation, output_times, **kwargs):
+	r"""
+	Run a simulation on a background thread.
+
+	Parameters
+	----------
+	run : <function>
+		The function which runs the simulation (e.g. ``singlezone.run``).
+	simulation : ``c_singlezone`` or ``c_multizone``
+		The cython object whose ``current_time`` attribute tracks the
+		progress of the integration.
+	output_times : array-like
+		The output times to pass to ``run``.
+	kwargs : varying types
+		Any keyword arguments to pass to ``run``.
+
+	Returns
+	-------
+	future : ``simulation_future``
+		The future which will hold the result of the simulation.
+
+	Notes
+	-----
+	Invalid output times are passed on to ``run`` as they are, so that the
+	exception it raises is set as the exception of the future.
+	"""
+	try:
+		output_times = list(output_times)
+		final_time = max(output_times)
+		if not isinstance(final_time, numbers.Number): final_time = 0
+	except (TypeError, ValueError):
+		final_time = 0
+	future = simulation_future(simulation, final_time)
+
+	def target():
+		if future.set_running_or_notify_cancel():
+			try:
+				result = run(output_times, **kwargs)
+			except BaseException as exc:
+				future.set_exception(exc)
+			else:
+				future.set_result(result)
+		else: pass
+
+	threading.Thread(target = target).start()
+	return future
@@ -13,6 +13,7 @@ elif sys.version_info[:2] >= (3, 5):
 	strcomp = str
 else:
 	_VERSION_ERROR_()
+from .objects cimport _context
 from . cimport _mlr
 
 
@@ -43,21 +44,19 @@ cdef class _mlr_linker:
 
 	# Not using a @property object for setting here b/c it would get overridden
 	# by the subclass in mlr.py -> these names will persist in the subclass
-	# even when setting is @property'd.
+	# even when setting is @property'd. The setting is stored in python rather
+	# than C; each simulation copies it into its own context when it runs.
 
 	@staticmethod
 	def _get_setting():
 		# see docstring in vice/core/mlr.py
-		return _mlr_linker.__HASHCODES__[_mlr.get_mlr_hashcode()]
+		return _SETTING[0]
 
 	@staticmethod
 	def _set_setting(value):
 		if isinstance(value, strcomp):
 			if value.lower() in _mlr_linker.__NAMES__.keys():
-				if _mlr.set_mlr_hashcode(
-					<unsigned short> _mlr_linker.__NAMES__[value.lower()]):
-					raise SystemError("Internal Error.")
-				else: pass
+				_SETTING[0] = value.lower()
 			else:
 				raise ValueError("Unrecognized MLR setting: %s" % (value))
 		else:
@@ -65,6 +64,10 @@ cdef class _mlr_linker:
 				type(value)))
 
 
+# The current mass-lifetime relation setting -> default is Larson (1974)
+_SETTING = ["larson1974"]
+
+
 cdef class _powerlaw:
 
 	r"""
@@ -78,10 +81,10 @@ cdef class _powerlaw:
 		else:
 			if which.lower() == "mass":
 				return _mlr.powerlaw_lifetime(<double> qty, <double> postMS,
-					0.014)
+					0.014, NULL)
 			else:
 				return _mlr.powerlaw_turnoffmass(<double> qty, <double> postMS,
-					0.014)
+					0.014, NULL)
 
 
 cdef class _vincenzo2016:
@@ -90,13 +93,12 @@ cdef class _vincenzo2016:
 	See mlr.vincenzo2016 property docstring
 	"""
 
-	def __init__(self):
+	def __cinit__(self):
+		self._ctx = _context.context_initialize()
 		self._imported = 0
 
 	def __dealloc__(self):
-		if self._imported:
-			_mlr.vincenzo2016_free()
-		else: pass
+		_context.context_free(self._ctx)
 
 	def __call__(self, qty, Z = 0.014, which = "mass"):
 		if not self._imported: self.__import()
@@ -105,14 +107,15 @@ cdef class _vincenzo2016:
 			return float("inf")
 		else:
 			if which.lower() == "mass":
-				return _mlr.vincenzo2016_lifetime(<double> qty, 0.0, <double> Z)
+				return _mlr.vincenzo2016_lifetime(<double> qty, 0.0, <double> Z,
+					self._ctx)
 			else:
 				return _mlr.vincenzo2016_turnoffmass(<double> qty, 0.0,
-					<double> Z)
+					<double> Z, self._ctx)
 
 	def __import(self):
 		path = "%ssrc/ssp/mlr/vincenzo2016.dat" % (_DIRECTORY_)
-		if _mlr.vincenzo2016_import(path.encode("latin-1")):
+		if _mlr.vincenzo2016_import(self._ctx, path.encode("latin-1")):
 			raise SystemError("Internal Error.")
 		else:
 			self._imported = 1
@@ -124,13 +127,12 @@ cdef class _hpt2000:
 	See mlr.hpt2000 property docstring
 	"""
 
-	def __init__(self):
+	def __cinit__(self):
+		self._ctx = _context.context_initialize()
 		self._imported = 0
 
 	def __dealloc__(self):
-		if self._imported:
-			_mlr.hpt2000_free()
-		else: pass
+		_context.context_free(self._ctx)
 
 	def __call__(self, qty, postMS = 0.1, Z = 0.014, which = "mass"):
 		if not self._imported: self.__import()
@@ -140,14 +142,14 @@ cdef class _hpt2000:
 		else:
 			if which.lower() == "mass":
 				return _mlr.hpt2000_lifetime(<double> qty, <double> postMS,
-					<double> Z)
+					<double> Z, self._ctx)
 			else:
 				return _mlr.hpt2000_turnoffmass(<double> qty, <double> postMS,
-					<double> Z)
+					<double> Z, self._ctx)
 
 	def __import(self):
 		path = "%ssrc/ssp/mlr/hpt2000.dat" % (_DIRECTORY_)
-		if _mlr.hpt2000_import(path.encode("latin-1")):
+		if _mlr.hpt2000_import(self._ctx, path.encode("latin-1")):
 			raise SystemError("Internal Error.")
 		else:
 			self._imported = 1
@@ -159,13 +161,12 @@ cdef class _ka1997:
 	See mlr.ka1997 property docstring
 	"""
 
-	def __init__(self):
+	def __cinit__(self):
+		self._ctx = _context.context_initialize()
 		self._imported = 0
 
 	def __dealloc__(self):
-		if self._imported:
-			_mlr.ka1997_free()
-		else: pass
+		_context.context_free(self._ctx)
 
 	def __call__(self, qty, Z = 0.014, which = "mass"):
 		if not self._imported: self.__import()
@@ -174,13 +175,15 @@ cdef class _ka1997:
 			return float("inf")
 		else:
 			if which.lower() == "mass":
-				return _mlr.ka1997_lifetime(<double> qty, 0.0, <double> Z)
+				return _mlr.ka1997_lifetime(<double> qty, 0.0, <double> Z,
+					self._ctx)
 			else:
-				return _mlr.ka1997_turnoffmass(<double> qty, 0.0, <double> Z)
+				return _mlr.ka1997_turnoffmass(<double> qty, 0.0, <double> Z,
+					self._ctx)
 
 	def __import(self):
 		path = "%ssrc/ssp/mlr/ka1997.dat" % (_DIRECTORY_)
-		if _mlr.ka1997_import(path.encode("latin-1")):
+		if _mlr.ka1997_import(self._ctx, path.encode("latin-1")):
 			raise SystemError("Internal Error.")
 		else:
 			self._imported = 1
@@ -199,10 +202,10 @@ cdef class _pm1993:
 		else:
 			if which.lower() == "mass":
 				return _mlr.pm1993_lifetime(<double> qty, <double> postMS,
-					<double> 0.014)
+					<double> 0.014, NULL)
 			else:
 				return _mlr.pm1993_turnoffmass(<double> qty, <double> postMS,
-					<double> 0.014)
+					<double> 0.014, NULL)
 
 cdef class _mm1989:
 
@@ -217,10 +220,10 @@ cdef class _mm1989:
 		else:
 			if which.lower() == "mass":
 				return _mlr.mm1989_lifetime(<double> qty, <double> postMS,
-					0.014)
+					0.014, NULL)
 			else:
 				return _mlr.mm1989_turnoffmass(<double> qty, <double> postMS,
-					0.014)
+					0.014, NULL)
 
 
 cdef class _larson1974:
@@ -236,10 +239,10 @@ cdef class _larson1974:
 		else:
 			if which.lower() == "mass":
 				return _mlr.larson1974_lifetime(<double> qty, <double> postMS,
-					0.014)
+					0.014, NULL)
 			else:
 				return _mlr.larson1974_turnoffmass(<double> qty,
-					<double> postMS, 0.014)
+					<double> postMS, 0.014, NULL)
 
 
 def mlr_error_handling(qty, postMS = 0.1, Z = 0.014, which = "mass"):
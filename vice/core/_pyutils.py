@@ -305,3 +305,27 @@ def format_time(seconds):
 	else:
 		raise TypeError("Must be a real number. Got: %s" % (type(seconds)))
 
+
+def format_bytes(n):
+	r"""
+	Convert a number of bytes into a human-readable string.
+
+	Parameters
+	----------
+	n : real number
+		A number of bytes.
+
+	Returns
+	-------
+	formatted : str
+		The number of bytes in the largest unit (B, kB, MB, GB, TB) in which
+		it is at least 1, to one decimal place.
+	"""
+	if isinstance(n, numbers.Number):
+		for unit in ["B", "kB", "MB", "GB"]:
+			if abs(n) < 1024: return "%.1f %s" % (n, unit)
+			n /= 1024
+		return "%.1f TB" % (n)
+	else:
+		raise TypeError("Must be a real number. Got: %s" % (type(n)))
+
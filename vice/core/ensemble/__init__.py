@@ -0,0 +1,17 @@
+"""
+This package implements the python wrapper of the ensemble object. Source
+code can be found at vice/src/ensemble.h and accompanying files.
+"""
+
+from __future__ import absolute_import
+try:
+	__VICE_SETUP__
+except NameError:
+	__VICE_SETUP__ = False
+
+if not __VICE_SETUP__:
+	__all__ = ["ensemble", "test"]
+	from .ensemble import ensemble
+	from .tests import test
+else:
+	pass
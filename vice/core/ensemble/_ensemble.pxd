@@ -0,0 +1,17 @@
+# cython: language_level = 3, boundscheck = False
+
+from __future__ import absolute_import
+from ..objects._ensemble cimport ENSEMBLE
+from ..objects._ensemble cimport ensemble_initialize
+from ..objects._ensemble cimport ensemble_free
+from ..objects._ensemble cimport link_member
+from ..objects._ensemble cimport ensemble_evolve
+from ..objects._ensemble cimport ensemble_cancel
+from ..objects._ensemble cimport ensemble_calls_python
+
+
+cdef class c_ensemble:
+	cdef ENSEMBLE *_ens
+	cdef object _members
+	cdef object _overrides
+
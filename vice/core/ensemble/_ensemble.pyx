@@ -0,0 +1,421 @@
+# cython: language_level = 3, boundscheck = False
+
+# Python imports
+from __future__ import absolute_import
+from ..._globals import _VERSION_ERROR_
+from ..._globals import VisibleRuntimeWarning
+from ..singlezone import singlezone
+from ..pickles import jar
+from .. import _pyutils
+import itertools
+import warnings
+import numbers
+import time
+import sys
+import os
+if sys.version_info[:2] == (2, 7):
+	strcomp = basestring
+	input = raw_input
+elif sys.version_info[:2] >= (3, 5):
+	strcomp = str
+else:
+	_VERSION_ERROR_()
+from libc.string cimport strlen
+from .._cutils cimport set_string
+from .._cutils cimport copy_pylist
+from . cimport _ensemble
+
+"""
+NOTES
+=====
+cdef class objects do not transfer the docstrings of class attributes to the
+compiled output, leaving out the internal documentation. For this reason,
+wrapping of the ensemble object has two layers -> a python class and a
+C class. In the python class, there is only one attribute: the C version of
+the wrapper. The docstrings are written there, and each function/setter
+only calls the C version of the wrapper.
+"""
+
+cdef class c_ensemble:
+
+	"""
+	Wrapping of the C version of the ensemble object.
+	"""
+
+	# cdef ENSEMBLE *_ens
+	# cdef object _members
+	# cdef object _overrides
+
+	def __cinit__(self, overrides,
+		name = "ensemblemodel",
+		n_threads = 1,
+		verbose = False,
+		**kwargs):
+
+		self._overrides = self.expand_overrides(overrides)
+		self._ens = _ensemble.ensemble_initialize(len(self._overrides))
+		self._members = []
+		for i in range(len(self._overrides)):
+			attrs = dict(kwargs)
+			attrs.update(self._overrides[i])
+			attrs["verbose"] = False
+			self._members.append(singlezone(**attrs))
+			_ensemble.link_member(
+				self._ens,
+				self._members[i]._singlezone__zone_object_address(),
+				i)
+
+
+	def __init__(self, overrides,
+		name = "ensemblemodel",
+		n_threads = 1,
+		verbose = False,
+		**kwargs):
+
+		self.name = name
+		self.n_threads = n_threads
+		self.verbose = verbose
+
+
+	def __dealloc__(self):
+		_ensemble.ensemble_free(self._ens)
+
+
+	@staticmethod
+	def expand_overrides(overrides):
+		"""
+		Obtain the parameters of each member of the ensemble.
+
+		Parameters
+		==========
+		overrides :: list or dict
+			The user's specification. Either a list of dictionaries, one per
+			member, or a dictionary of lists, in which case every combination
+			of their values is a member.
+
+		Returns
+		=======
+		A list of dictionaries, one per member, mapping singlezone attributes
+		to their values.
+
+		Raises
+		======
+		TypeError ::
+			:: overrides is neither a list of dictionaries nor a dictionary
+			   of lists
+			:: Any of the keys are not strings
+		ValueError ::
+			:: There are no members
+		"""
+		if isinstance(overrides, dict):
+			keys = list(overrides.keys())
+			for key in keys:
+				if not isinstance(overrides[key], (list, tuple)):
+					raise TypeError("""Grid of overrides must map attribute \
+names to lists of values. Got: %s""" % (type(overrides[key])))
+				else: pass
+			expanded = [dict(zip(keys, values)) for values in
+				itertools.product(*[overrides[key] for key in keys])]
+		elif isinstance(overrides, (list, tuple)):
+			for i in overrides:
+				if not isinstance(i, dict):
+					raise TypeError("""Each element of a list of overrides \
+must be a dictionary. Got: %s""" % (type(i)))
+				else: pass
+			expanded = [dict(i) for i in overrides]
+		else:
+			raise TypeError("""Overrides must be either a list of dictionaries \
+or a dictionary of lists. Got: %s""" % (type(overrides)))
+		for i in expanded:
+			for key in i.keys():
+				if not isinstance(key, strcomp):
+					raise TypeError("""Override keys must be attribute names. \
+Got: %s""" % (type(key)))
+				elif key in ["name", "verbose"]:
+					raise ValueError("""Attribute '%s' cannot be overridden \
+for individual ensemble members.""" % (key))
+				else: pass
+		if len(expanded) == 0:
+			raise ValueError("Ensemble must have at least one member.")
+		else: pass
+		return expanded
+
+
+	@property
+	def name(self):
+		# docstring in python version
+		return "".join([chr(self._ens[0].name[i]) for i in range(
+			strlen(self._ens[0].name))])[:-5]
+
+	@name.setter
+	def name(self, value):
+		"""
+		Name of the simulation, also the directory that the output is written
+		to.
+
+		Allowed Types
+		=============
+		str
+
+		Allows Values
+		=============
+		Simple strings, or those of the format 'path/to/dir'
+
+		All values will pass the setter except for empty strings. Those that
+		are not valid directory names will fail at runtime when self.run() is
+		called.
+		"""
+		if isinstance(value, strcomp):
+			if _pyutils.is_ascii(value):
+				if len(value) == 0:
+					raise ValueError("""Attribute 'name' must not be an \
+empty string.""")
+				else:
+					pass
+				while value[-1] == '/':
+					# remove any '/' that the user puts on
+					value = value[:-1]
+				if value.lower().endswith(".vice"):
+					# force the .vice extension to lower-case
+					value = "%s.vice" % (value[:-5])
+				else:
+					value = "%s.vice" % (value)
+				set_string(self._ens[0].name, value)
+			else:
+				raise ValueError("String must be ascii. Got: %s" % (value))
+		else:
+			raise TypeError("Attribute 'name' must be of type str. Got: %s" % (
+				type(value)))
+
+	@property
+	def members(self):
+		# docstring in python version
+		return tuple(self._members)
+
+	@property
+	def overrides(self):
+		# docstring in python version
+		return [dict(i) for i in self._overrides]
+
+	@property
+	def n_members(self):
+		# docstring in python version
+		return self._ens[0].n_members
+
+	@property
+	def n_threads(self):
+		# docstring in python version
+		return self._ens[0].n_threads
+
+	@n_threads.setter
+	def n_threads(self, value):
+		"""
+		The number of threads to integrate the members across
+
+		Allowed Types
+		=============
+		real number
+
+		Allowed Values
+		==============
+		Positive integers
+		"""
+		if isinstance(value, numbers.Number):
+			if value % 1 == 0:
+				if value > 0:
+					self._ens[0].n_threads = <unsigned int> value
+				else:
+					raise ValueError("""Attribute 'n_threads' must be \
+positive. Got: %d""" % (value))
+			else:
+				raise ValueError("""Attribute 'n_threads' must be interpreted \
+as an integer. Got: %g""" % (value))
+		else:
+			raise TypeError("""Attribute 'n_threads' must be an integer. Got: \
+%s""" % (type(value)))
+
+	@property
+	def verbose(self):
+		# docstring in python version
+		return bool(self._ens[0].verbose)
+
+	@verbose.setter
+	def verbose(self, value):
+		"""
+		Whether or not to print a progressbar as the simulation runs
+
+		Allowed Types
+		=============
+		bool
+		"""
+		if isinstance(value, numbers.Number) or isinstance(value, bool):
+			if value:
+				self._ens[0].verbose = 1
+			else:
+				self._ens[0].verbose = 0
+		else:
+			raise TypeError("""Attribute 'verbose' must be interpreted as a \
+boolean. Got: %s""" % (type(value)))
+
+
+	def run(self, output_times, overwrite = False, pickle = True):
+		"""
+		See docstring in python version of this class.
+		"""
+		self.prep(output_times)
+		cdef int enrichment
+		if self.outfile_check(overwrite):
+			os.system("mkdir %s.vice" % (self.name))
+			start = time.time()
+
+			# warn the user about r-process elements, bad solar calibrations,
+			# and mass-lifetime relation effects
+			self._members[0]._singlezone__c_version.nsns_warning()
+			self._members[0]._singlezone__c_version.solar_z_warning()
+			self._members[0]._singlezone__c_version.mlr_warnings()
+			if (self.n_threads > 1 and
+				_ensemble.ensemble_calls_python(self._ens[0])):
+				warnings.warn("""\
+At least one ensemble member has nucleosynthetic yields or a star formation \
+efficiency timescale which call python functions. The members will be \
+integrated on a single thread.""", VisibleRuntimeWarning)
+			else: pass
+
+			# take the current mass-lifetime relation setting
+			self.import_mlr_data()
+			with nogil:
+				enrichment = _ensemble.ensemble_evolve(self._ens)
+			if pickle: self.pickle()
+			self.free_mlr_data()
+			canceled = False
+		else:
+			_ensemble.ensemble_cancel(self._ens)
+			enrichment = 0
+			canceled = True
+
+		stop = time.time()
+		if enrichment == 1:
+			raise SystemError("Internal Error")
+		elif enrichment == 2:
+			raise IOError("""Could not write ensemble output to directory: \
+%s.vice/""" % (self.name))
+		else:
+			pass
+
+		if self.verbose and not canceled:
+			days, hours, minutes, seconds = _pyutils.format_time(stop - start)
+			if days:
+				sim_time = "%d days %02dh%02dm%02ds" % (days, hours, minutes,
+					int(seconds))
+			else:
+				sim_time = "%02dh%02dm%02ds" % (hours, minutes, int(seconds))
+			print("Simulation Time: %s" % (sim_time))
+		else: pass
+
+
+	def prep(self, output_times):
+		"""
+		Prepares each member of the ensemble to be ran based on their current
+		settings.
+
+		Parameters
+		==========
+		output_times :: array-like
+			The array of values the user passed to run()
+
+		Raises
+		======
+		ValueError ::
+			:: The members do not all track the same elements
+		Other exceptions raised by subroutines
+		"""
+		elements = tuple(self._members[0].elements)
+		for i in range(1, len(self._members)):
+			if tuple(self._members[i].elements) != elements:
+				raise ValueError("""Every ensemble member must track the same \
+elements in the same order. Member %d: %s. Member 0: %s.""" % (i,
+					str(tuple(self._members[i].elements)), str(elements)))
+			else: pass
+		for i in range(self._ens[0].n_members):
+			times = self._members[i]._singlezone__zone_prep(output_times)
+			self._ens[0].members[i][0].output_times = copy_pylist(times)
+			self._ens[0].members[i][0].n_outputs = len(times)
+			self._ens[0].members[i][0].checkpoint_interval = 0
+
+
+	def outfile_check(self, overwrite):
+		"""
+		Determines if any of the output files exist and proceeds according to
+		the user specified overwrite preference.
+
+		Parameters
+		==========
+		overwrite :: bool
+			The user's overwrite spefication - True to force overwrite.
+
+		Returns
+		=======
+		True if the simulation can proceed and run, overwriting any files that
+		may already exist. False if the user wishes to abort.
+		"""
+		if overwrite:
+			if os.path.exists("%s.vice" % (self.name)):
+				os.system("rm -rf %s.vice" % (self.name))
+			else:
+				pass
+			return True
+		else:
+			if os.path.exists("%s.vice" % (self.name)):
+				"""
+				Output directory exists. Ask the user if they'd like to wipe
+				its contents and overwrite.
+				"""
+				answer = input("""\
+Output directory already exists. Overwriting will delete all of its contents, \
+leaving only the results of the current simulation.\nOutput directory: \
+%s.vice\nOverwrite? (y | n) """ % (self.name))
+
+				# be emphatic about it
+				while answer.lower() not in ["yes", "y", "no", "n"]:
+					answer = input("Please enter either 'y' or 'n': ")
+
+				if answer.lower() in ["y", "yes"]:
+					os.system("rm -rf %s.vice" % (self.name))
+					return True
+				else:
+					return False
+			else:
+				return True
+
+
+	def import_mlr_data(self):
+		# take the current mass-lifetime relation setting into the context
+		# of each member along with any data it requires
+		for i in range(len(self._members)):
+			self._members[i]._singlezone__c_version.import_mlr_data()
+
+	def free_mlr_data(self):
+		# frees the mass-lifetime relation data in each member's context
+		for i in range(len(self._members)):
+			self._members[i]._singlezone__c_version.free_mlr_data()
+
+
+	def pickle(self):
+		"""
+		Saves the parameters of this object to the output directory. The
+		attributes of each member are saved as their overrides only, since
+		the remaining attributes are shared.
+
+		See Also
+		========
+		vice.core.pickles
+		"""
+		attrs = {
+			"name": 			self.name,
+			"n_members": 		self.n_members,
+			"n_threads": 		self.n_threads,
+			"verbose": 			self.verbose,
+			"overrides": 		self.overrides
+		}
+		jar(attrs, name = "%s.vice/attributes" % (self.name)).close()
+
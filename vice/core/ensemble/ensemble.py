@@ -0,0 +1,340 @@
+
+from __future__ import absolute_import
+from ._ensemble import c_ensemble
+
+"""
+NOTES
+=====
+cdef class objects do not transfer the docstrings of class attributes to the
+compiled output, leaving out the internal documentation. For this reason,
+wrapping of the ensemble object has two layers -> a python class and a
+C class. In the python class, there is only one attribute: the C version of
+the wrapper. The docstrings are written here, and each function/setter
+only calls the C version of the wrapper. While this is a more complicated
+wrapper, it preserves the internal documentation.
+"""
+
+class ensemble(object):
+
+	r"""
+	An object designed to run many one-zone models of galactic chemical
+	evolution which differ in only some of their parameters. Setup shared
+	between the members is done only once, and the members are integrated
+	across multiple threads.
+
+	**Signature**: vice.ensemble(overrides, name = "ensemblemodel",
+	n_threads = 1, verbose = False, \*\*kwargs)
+
+	.. versionadded:: 1.3.0
+
+	Parameters
+	----------
+	overrides : ``list`` or ``dict``
+		The parameters of each member which differ from those in ``kwargs``.
+		Either a list of dictionaries, each of which maps ``singlezone``
+		attributes to their values for one member, or a dictionary mapping
+		``singlezone`` attributes to lists of values, in which case every
+		combination of those values is a member.
+	name : ``str`` [default : "ensemblemodel"]
+		The attribute ``name``, initialized via keyword argument. See below.
+	n_threads : ``int`` [default : 1]
+		The attribute ``n_threads``, initialized via keyword argument. See
+		below.
+	verbose : ``bool`` [default : False]
+		The attribute ``verbose``, initialized via keyword argument. See below.
+	kwargs : varying types
+		The attributes shared by every member, passed to ``vice.singlezone``.
+
+	Attributes
+	----------
+	name : ``str`` [default : "ensemblemodel"]
+		The name of the simulation. Output will be stored in a directory under
+		this name with a ".vice" extension.
+	members : ``tuple`` [elements are ``singlezone`` objects]
+		The one-zone models making up the ensemble.
+	overrides : ``list`` [elements are ``dict`` objects]
+		The parameters of each member which differ from those shared by all.
+	n_members : ``int``
+		The number of members in the ensemble.
+	n_threads : ``int`` [default : 1]
+		The number of threads to integrate the members across.
+	verbose : ``bool`` [default : False]
+		Whether or not to print a progressbar as the simulation runs.
+
+	Functions
+	---------
+	run : [instancemethod]
+		Run the simulation
+
+	Raises
+	------
+	* TypeError
+		- 	``overrides`` is neither a list of dictionaries nor a dictionary
+			of lists.
+	* ValueError
+		- 	``overrides`` attempts to set the attributes ``name`` or
+			``verbose`` of an individual member.
+		- 	``overrides`` describes no members.
+
+	Other exceptions are raised by ``vice.singlezone``.
+
+	Notes
+	-----
+	The output of every member is written to a single "history.out" and
+	"mdf.out" file in the output directory, with the index of the member in
+	the first column. The rows of each member appear in order of member index
+	and are identical to those of the output a ``singlezone`` object with the
+	same parameters would produce.
+
+	The cumulative return fraction and main sequence mass fraction are
+	computed once for each unique combination of IMF, stellar mass range,
+	post main sequence lifetime, timestep size and final output time among
+	the members, and the SNe Ia rate once for each unique built-in delay-time
+	distribution, e-folding timescale, minimum delay time and timestep size.
+
+	Members whose nucleosynthetic yields or star formation efficiency
+	timescale are python functions can only be integrated on the calling
+	thread. If any member calls python in this way, every member runs on
+	one thread regardless of the attribute ``n_threads``.
+
+	Example Code
+	------------
+	>>> import vice
+	>>> ens = vice.ensemble({"eta": [1, 2, 3], "tau_star": [1, 2]},
+		name = "example", n_threads = 4, elements = ["fe", "o"])
+	>>> ens.n_members
+	6
+	>>> ens.overrides[0]
+	{'eta': 1, 'tau_star': 1}
+	>>> ens.run([0.01 * i for i in range(1001)], overwrite = True)
+	"""
+
+	def __init__(self, overrides, **kwargs):
+		self.__c_version = c_ensemble(overrides, **kwargs)
+
+	def __repr__(self):
+		"""
+		Prints in the format: vice.ensemble{
+			attr1 -----------> value
+			attribute2 ------> value
+		}
+		"""
+		attrs = {
+			"name": 		self.name,
+			"n_members": 	self.n_members,
+			"n_threads": 	self.n_threads,
+			"verbose": 		self.verbose
+		}
+
+		rep = "vice.ensemble{\n"
+		for i in attrs.keys():
+			rep += "    %s " % (i)
+			for j in range(15 - len(i)):
+				rep += '-'
+			rep += "> %s\n" % (str(attrs[i]))
+		rep += '}'
+		return rep
+
+	def __str__(self):
+		"""
+		Returns self.__repr__()
+		"""
+		return self.__repr__()
+
+	def __enter__(self):
+		"""
+		Opens a with statement
+		"""
+		return self
+
+	def __exit__(self, exc_type, exc_value, exc_tb):
+		"""
+		Raises all exceptions inside with statements
+		"""
+		return exc_value is None
+
+	@property
+	def name(self):
+		r"""
+		Type : ``str``
+
+		Default : "ensemblemodel"
+
+		The name of the simulation. The output will be stored in a directory
+		under this name with the extension ".vice". This can also be of the
+		form ``./path/to/directory/name`` and the output will be stored there.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> ens = vice.ensemble([{"eta": 1}, {"eta": 2}])
+		>>> ens.name = "example"
+		"""
+		return self.__c_version.name
+
+	@name.setter
+	def name(self, value):
+		self.__c_version.name = value
+
+	@property
+	def members(self):
+		r"""
+		Type : ``tuple`` [elements are ``singlezone`` objects]
+
+		The one-zone models making up the ensemble, in order of member index.
+		Their attributes can be modified before running the ensemble, but
+		every member must track the same elements in the same order.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> ens = vice.ensemble([{"eta": 1}, {"eta": 2}])
+		>>> ens.members[1].eta
+		2.0
+		"""
+		return self.__c_version.members
+
+	@property
+	def overrides(self):
+		r"""
+		Type : ``list`` [elements are ``dict`` objects]
+
+		The parameters of each member which differ from those shared by all
+		members, in order of member index. If a dictionary of lists was
+		passed at initialization, this is every combination of its values.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> ens = vice.ensemble({"eta": [1, 2], "tau_star": [1, 2]})
+		>>> ens.overrides
+		[{'eta': 1, 'tau_star': 1},
+		 {'eta': 1, 'tau_star': 2},
+		 {'eta': 2, 'tau_star': 1},
+		 {'eta': 2, 'tau_star': 2}]
+		"""
+		return self.__c_version.overrides
+
+	@property
+	def n_members(self):
+		r"""
+		Type : ``int``
+
+		The number of members in the ensemble.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> ens = vice.ensemble({"eta": [1, 2, 3], "tau_star": [1, 2]})
+		>>> ens.n_members
+		6
+		"""
+		return self.__c_version.n_members
+
+	@property
+	def n_threads(self):
+		r"""
+		Type : ``int``
+
+		Default : 1
+
+		The number of threads to integrate the members across.
+
+		.. note:: If any member's nucleosynthetic yields or star formation
+			efficiency timescale are python functions, every member will be
+			integrated on the calling thread regardless of this value.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> ens = vice.ensemble([{"eta": 1}, {"eta": 2}])
+		>>> ens.n_threads = 2
+		"""
+		return self.__c_version.n_threads
+
+	@n_threads.setter
+	def n_threads(self, value):
+		self.__c_version.n_threads = value
+
+	@property
+	def verbose(self):
+		r"""
+		Type : ``bool``
+
+		Default : False
+
+		If True, a progressbar counting finished members will be printed as
+		the simulation runs.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> ens = vice.ensemble([{"eta": 1}, {"eta": 2}])
+		>>> ens.verbose = True
+		"""
+		return self.__c_version.verbose
+
+	@verbose.setter
+	def verbose(self, value):
+		self.__c_version.verbose = value
+
+	def run(self, output_times, overwrite = False, pickle = True):
+		r"""
+		Run the simulation.
+
+		**Signature**: x.run(output_times, overwrite = False, pickle = True)
+
+		Parameters
+		----------
+		x : ``ensemble``
+			An instance of this class.
+		output_times : array-like [elements are real numbers]
+			The times in Gyr at which VICE should record output from each
+			member. These need not be sorted from least to greatest.
+		overwrite : ``bool`` [default : False]
+			If ``True``, will force overwrite any files with the same name as
+			the simulation output files.
+		pickle : ``bool`` [default : True]
+			If ``True``, VICE will save the attributes of this object,
+			including the overrides of each member, with the output.
+
+		Raises
+		------
+		* ValueError
+			- 	The members do not all track the same elements in the same
+				order.
+		* IOError
+			- 	The output files could not be written.
+		* VisibleRuntimeWarning
+			- 	``n_threads > 1`` but at least one member calls python
+				functions as it evolves. The members are integrated on one
+				thread in this case.
+
+		Other exceptions are raised by ``vice.singlezone.run``.
+
+		Notes
+		-----
+		.. note::
+
+			When ``overwrite == False``, and there are files under the same
+			name as the output produced, this acts as a halting function. VICE
+			will wait for the user's approval to overwrite existing files in
+			this case.
+
+		.. note::
+
+			VICE will always write output at the final timestep of each
+			member. This may be one timestep beyond the last element of the
+			specified ``output_times`` array.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> import numpy as np
+		>>> ens = vice.ensemble({"eta": [1, 2, 3]}, n_threads = 3)
+		>>> outtimes = np.linspace(0, 10, 1001)
+		>>> ens.run(outtimes)
+		"""
+		self.__c_version.run(output_times, overwrite = overwrite,
+			pickle = pickle)
+
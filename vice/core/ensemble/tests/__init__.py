@@ -0,0 +1,27 @@
+
+from __future__ import absolute_import
+try:
+	__VICE_SETUP__
+except NameError:
+	__VICE_SETUP__ = False
+
+if not __VICE_SETUP__:
+
+	__all__ = ["test"]
+	from ....testing import moduletest
+	from .members import test_grid, test_members
+
+	@moduletest
+	def test():
+		r"""
+		vice.ensemble module test
+		"""
+		return ["vice.ensemble",
+			[
+				test_grid(),
+				test_members()
+			]
+		]
+
+else:
+	pass
@@ -0,0 +1,67 @@
+
+from __future__ import absolute_import
+__all__ = ["test_grid", "test_members"]
+from ..ensemble import ensemble
+from ...singlezone import singlezone
+from ....testing import unittest
+
+
+def read_rows(filename):
+	r"""
+	Read the lines of an output file, excluding the header.
+	"""
+	with open(filename, 'r') as f:
+		return [line for line in f.readlines() if not line.startswith('#')]
+
+
+@unittest
+def test_grid():
+	r"""
+	vice.ensemble grid of overrides unittest
+	"""
+	def test():
+		try:
+			ens = ensemble({"eta": [1, 2, 3], "tau_star": [1, 2]})
+		except:
+			return False
+		return (ens.n_members == 6 and
+			ens.overrides[1] == {"eta": 1, "tau_star": 2} and
+			ens.members[5].eta == 3 and
+			ens.members[5].tau_star == 2)
+	return ["vice.ensemble [grid]", test]
+
+
+@unittest
+def test_members():
+	r"""
+	vice.ensemble.run unittest
+	"""
+	def test():
+		# Each member's rows should match a singlezone model's output exactly
+		try:
+			outtimes = [0.01 * i for i in range(501)]
+			overrides = [
+				{"eta": 1},
+				{"eta": 2, "IMF": "salpeter"},
+				{"eta": 2, "tau_ia": 3},
+				{"eta": 3}
+			]
+			ens = ensemble(overrides, name = "test", n_threads = 2,
+				elements = ["fe", "o"])
+			ens.run(outtimes, overwrite = True)
+			history = read_rows("test.vice/history.out")
+			mdf = read_rows("test.vice/mdf.out")
+			for i in range(len(overrides)):
+				sz = singlezone(name = "test", elements = ["fe", "o"],
+					**overrides[i])
+				sz.run(outtimes, overwrite = True)
+				for filename, rows in zip(["history.out", "mdf.out"],
+					[history, mdf]):
+					expected = ["%d\t%s" % (i, line) for line in read_rows(
+						"test.vice/%s" % (filename))]
+					if [line for line in rows if line.startswith(
+						"%d\t" % (i))] != expected: return False
+		except:
+			return False
+		return True
+	return ["vice.ensemble.run", test]
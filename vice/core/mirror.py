@@ -84,6 +84,7 @@ def mirror(arg):
 		schmidt_index --> 0.5
 		MgSchmidt ------> 6000000000.0
 		dt -------------> 0.01
+		integrator -----> euler
 		m_upper --------> 100.0
 		m_lower --------> 0.08
 		Z_solar --------> 0.014
@@ -0,0 +1,13 @@
+# cython: language_level = 3, boundscheck = False
+
+from __future__ import absolute_import
+
+cdef extern from "../../src/multizone/milkyway.h":
+	double milkyway_default_evolution(double radius, double time)
+	double milkyway_default_mass_loading(double radius)
+	unsigned long milkyway_n_radial_bins(double min_radius, double max_radius,
+		double zone_width)
+	double *milkyway_radial_bins(double min_radius, double max_radius,
+		double zone_width)
+	double *milkyway_default_specified(double radius, double area,
+		double factor, double dt, unsigned long n_times)
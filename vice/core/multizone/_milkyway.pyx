@@ -0,0 +1,86 @@
+# cython: language_level = 3, boundscheck = False
+r"""
+Milky Way Model Defaults
+========================
+
+.. warning:: User access of this module is discouraged.
+
+Wraps the C implementations of the default parameters of the ``milkyway``
+object, such that models adopting them need not call python to set up each
+zone. See vice/milkyway/milkyway.py for the python-level documentation.
+"""
+
+from __future__ import absolute_import
+from libc.stdlib cimport free
+from . cimport _milkyway
+
+
+def default_evolution(radius, time):
+	r"""
+	The default evolutionary function of the ``milkyway`` object.
+
+	Parameters
+	----------
+	radius : real number
+		Galactocentric radius in kpc.
+	time : real number
+		Simulation time in Gyr.
+
+	Returns
+	-------
+	value : float
+		Always 1.0.
+
+	.. seealso:: vice.milkyway.default_evolution
+	"""
+	return _milkyway.milkyway_default_evolution(<double> radius,
+		<double> time)
+
+
+def default_mass_loading(rgal):
+	r"""
+	The default mass loading factor of the ``milkyway`` object.
+
+	Parameters
+	----------
+	rgal : real number
+		Galactocentric radius in kpc.
+
+	Returns
+	-------
+	eta : float
+		The mass loading factor at that radius.
+
+	.. seealso:: vice.milkyway.default_mass_loading
+	"""
+	return _milkyway.milkyway_default_mass_loading(<double> rgal)
+
+
+def radial_bins(min_radius, max_radius, zone_width):
+	r"""
+	Get the edges of the annuli in a ``milkyway`` model.
+
+	Parameters
+	----------
+	min_radius : real number
+		The inner edge of the innermost annulus in kpc.
+	max_radius : real number
+		The outer edge of the outermost annulus in kpc.
+	zone_width : real number
+		The width of each annulus in kpc. Assumed to be positive.
+
+	Returns
+	-------
+	radii : list
+		The least-to-greatest sorted list of radii that serve as the divisions
+		between annuli.
+	"""
+	cdef unsigned long i
+	cdef unsigned long n = _milkyway.milkyway_n_radial_bins(
+		<double> min_radius, <double> max_radius, <double> zone_width)
+	cdef double *bins = _milkyway.milkyway_radial_bins(<double> min_radius,
+		<double> max_radius, <double> zone_width)
+	radii = [bins[i] for i in range(n)]
+	free(bins)
+	return radii
+
@@ -4,6 +4,8 @@ from __future__ import absolute_import
 from ..objects._multizone cimport MULTIZONE
 from ..objects._multizone cimport multizone_initialize
 from ..objects._multizone cimport multizone_evolve
+from ..objects._multizone cimport multizone_resume
+from ..objects._multizone cimport multizone_extend
 from ..objects._multizone cimport multizone_cancel
 from ..objects._multizone cimport multizone_free
 from ..objects._multizone cimport link_zone
@@ -15,4 +17,6 @@ cdef class c_multizone:
 	cdef MULTIZONE *_mz
 	cdef _zone_array.zone_array _zones
 	cdef _migration.mig_specs _migration
+	cdef object _profile
+	cdef object _memory_budget
 
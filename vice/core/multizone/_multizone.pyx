@@ -5,6 +5,7 @@ from __future__ import absolute_import
 from ..._globals import _VERSION_ERROR_
 from ..._globals import _DIRECTORY_
 from ..._globals import ScienceWarning
+from ..._globals import VisibleRuntimeWarning
 from ...toolkit.hydrodisk import hydrodiskstars
 from ..dataframe._builtin_dataframes import atomic_number
 from ..dataframe._builtin_dataframes import solar_z
@@ -33,7 +34,9 @@ from libc.stdlib cimport malloc, free
 from libc.string cimport strlen
 from .._cutils cimport set_string
 from .._cutils cimport copy_pylist
+from .._cutils cimport profile_phases
 from ..objects cimport _singlezone
+from ..objects cimport _profile
 from ..objects._tracer cimport TRACER
 from .. cimport _mlr
 from . cimport _hydrodiskstars
@@ -241,6 +244,14 @@ Got: %s""" % (type(value)))
 			raise TypeError("""Attribute 'verbose' must be interpretable as \
 a boolean. Got: %s""" % (type(value)))
 
+	@property
+	def current_time(self):
+		"""
+		The time in Gyr that the integration has reached. This is read from
+		another thread to report the progress of asynchronous runs.
+		"""
+		return self._mz[0].zones[0][0].current_time
+
 	@property
 	def simple(self):
 		# docstring in python version
@@ -273,6 +284,72 @@ migration prescriptions built into this model. """, ScienceWarning)
 			raise TypeError("""Attribute 'simple' must be interpretable as \
 a boolean. Got: %s""" % (type(value)))
 
+	@property
+	def merge_age(self):
+		# docstring in python version
+		if self._mz[0].merge_age > 0:
+			return self._mz[0].merge_age
+		else:
+			return None
+
+	@merge_age.setter
+	def merge_age(self, value):
+		"""
+		The age in Gyr beyond which star particles are merged in the
+		enrichment calculations.
+
+		Allowed Types
+		=============
+		real number or None
+
+		Allowed Values
+		==============
+		Positive real numbers. None disables merging.
+		"""
+		if value is None:
+			self._mz[0].merge_age = 0
+		elif isinstance(value, numbers.Number):
+			if value > 0:
+				self._mz[0].merge_age = value
+			else:
+				raise ValueError("""Attribute 'merge_age' must be positive. \
+Got: %g""" % (value))
+		else:
+			raise TypeError("""Attribute 'merge_age' must be a real number or \
+None. Got: %s""" % (type(value)))
+
+	@property
+	def memory_budget(self):
+		# docstring in python version
+		return self._memory_budget
+
+	@memory_budget.setter
+	def memory_budget(self, value):
+		"""
+		The maximum number of bytes the simulation may allocate for its star
+		particles, gas migration matrix, and metallicity distribution
+		functions.
+
+		Allowed Types
+		=============
+		real number or None
+
+		Allowed Values
+		==============
+		Positive real numbers. None disables the check.
+		"""
+		if value is None:
+			self._memory_budget = None
+		elif isinstance(value, numbers.Number):
+			if value > 0:
+				self._memory_budget = value
+			else:
+				raise ValueError("""Attribute 'memory_budget' must be \
+positive. Got: %g""" % (value))
+		else:
+			raise TypeError("""Attribute 'memory_budget' must be a real number \
+or None. Got: %s""" % (type(value)))
+
 	@property
 	def migration(self):
 		# docstring in python version
@@ -303,18 +380,51 @@ migration.specs. Got: %s""" % (type(value)))
 
 
 	def run(self, output_times, capture = False, overwrite = False,
-		pickle = True):
+		pickle = True, checkpoint = None, resume = False, extend = False,
+		profile = False):
 		"""
-		See docstring in python version of this class.
+		See docstring in python version of this class. ``extend = True`` is
+		passed from the extend function.
 		"""
+		cdef _profile.PROFILE *prof = NULL
+		begin = time.perf_counter()
+		phases = {}
+		if extend and self.simple:
+			raise RuntimeError("""\
+Multizone simulations ran in simple mode cannot be extended.""")
+		elif extend and not os.path.exists("%s.vice/checkpoint.bin" % (
+			self.name)):
+			raise IOError("""\
+No completed simulation to extend in output directory: %s.vice/""" % (
+				self.name))
+		else:
+			pass
+		self.memory_budget_check(output_times)
 		self.align_name_attributes()
+		self._profile = {} if profile else None
+		for i in range(self._mz[0].mig[0].n_zones):
+			self._zones[i]._singlezone__c_version.profile_setup(profile)
 		self.prep(output_times)
+		self.checkpoint_setup(checkpoint)
+		phases["prep"] = {"seconds": time.perf_counter() - begin, "calls": 1}
+		resume = ((resume or extend) and not self.simple and
+			os.path.exists("%s.vice/checkpoint.bin" % (self.name)))
 		cdef int enrichment
-		if self.outfile_check(overwrite):
-			os.system("mkdir %s.vice" % (self.name))
-			for i in range(self._mz[0].mig[0].n_zones):
-				os.system("mkdir %s.vice" % (self._zones[i].name))
+		cdef bint resuming = resume
+		cdef bint extending = extend
+		if resume or self.outfile_check(overwrite):
+			if not resume:
+				os.system("mkdir %s.vice" % (self.name))
+				for i in range(self._mz[0].mig[0].n_zones):
+					os.system("mkdir %s.vice" % (self._zones[i].name))
+			else:
+				pass
+			start = time.perf_counter()
 			self.setup_migration() # used to be in self.prep
+			phases["setup_migration"] = {
+				"seconds": time.perf_counter() - start,
+				"calls": 1
+			}
 			start = time.time()
 
 			# warn the user about r-process elements, bad solar calibrations,
@@ -325,10 +435,31 @@ migration.specs. Got: %s""" % (type(value)))
 
 			# take the current mass-lifetime relation setting
 			self.import_mlr_data()
-			_mlr.set_mlr_hashcode(_mlr._mlr_linker.__NAMES__[mlr.setting])
 
 			# just do it #nike
-			enrichment = _multizone.multizone_evolve(self._mz)
+			# The GIL is released for the integration and reacquired by the
+			# callback functions in _cutils only while they call python.
+			# The zones share the profile of the multizone object.
+			if profile:
+				prof = _profile.profile_initialize()
+				self._mz[0].ctx[0].profile = prof
+				for i in range(self._mz[0].mig[0].n_zones):
+					self._mz[0].zones[i][0].ctx[0].profile = prof
+			else: pass
+			with nogil:
+				if extending:
+					enrichment = _multizone.multizone_extend(self._mz)
+				elif resuming:
+					enrichment = _multizone.multizone_resume(self._mz)
+				else:
+					enrichment = _multizone.multizone_evolve(self._mz)
+			if profile:
+				phases.update(profile_phases(prof))
+				self._mz[0].ctx[0].profile = NULL
+				for i in range(self._mz[0].mig[0].n_zones):
+					self._mz[0].zones[i][0].ctx[0].profile = NULL
+				_profile.profile_free(prof)
+			else: pass
 			if pickle: self.pickle()
 			self.free_mlr_data()
 
@@ -352,6 +483,19 @@ migration.specs. Got: %s""" % (type(value)))
 zone and at least one timestep larger than 1.""")
 		elif enrichment == 3:
 			raise IOError("Couldn't save star particle data.")
+		elif enrichment == 4:
+			warnings.warn("""\
+Could not write checkpoint to output directory: %s.vice/""" % (self.name),
+				VisibleRuntimeWarning)
+		elif enrichment == 5:
+			raise IOError("Could not read checkpoint from output directory: \
+%s.vice/" % (self.name))
+		elif enrichment == 6:
+			raise RuntimeError("""\
+Checkpoint in output directory %s.vice/ does not match the current simulation. \
+The number of zones, star particles, and elements, the timestep size, \
+metallicity distribution function bins, and final output time must be the \
+same as when the checkpoint was written.""" % (self.name))
 		else:
 			pass
 
@@ -365,8 +509,193 @@ zone and at least one timestep larger than 1.""")
 			print("Simulation Time: %s" % (sim_time))
 		else: pass
 
-		if capture: return output(self.name)
+		if profile:
+			callbacks = self._profile
+			self._profile = None
+			for i in range(self._mz[0].mig[0].n_zones):
+				zone = self._zones[i]._singlezone__c_version.profile_callbacks()
+				for key in zone.keys():
+					callbacks["zones[%d].%s" % (i, key)] = zone[key]
+			results = {
+				"total": time.perf_counter() - begin,
+				"phases": phases,
+				"callbacks": dict([(key, value) for key, value in
+					callbacks.items() if value > 0])
+			}
+		else:
+			results = None
+
+		if capture and profile:
+			return (output(self.name), results)
+		elif capture:
+			return output(self.name)
+		elif profile:
+			return results
+		else:
+			pass
+
+
+	def profile_count(self, name, n):
+		"""
+		Counts evaluations of a migration prescription when the simulation is
+		being profiled.
+
+		Parameters
+		==========
+		name :: str
+			The name of the prescription
+		n :: int
+			The number of times it was evaluated
+		"""
+		if self._profile is not None:
+			self._profile[name] = self._profile.get(name, 0) + n
+		else: pass
+
+
+
+	def estimate_resources(self, output_times):
+		"""
+		Estimates the memory the simulation will allocate for its largest
+		data structures.
 
+		Parameters
+		==========
+		output_times :: array-like
+			The array of values the user passed to run()
+
+		Returns
+		=======
+		resources :: dict
+			The number of bytes under "bytes", broken down by structure, the
+			number of star particles the simulation will form under
+			"n_tracers", and the number of timesteps it allocates memory for
+			under "n_timesteps".
+
+		Raises
+		======
+		TypeError ::
+			:: output_times is not an array-like object
+			:: Non-numerical value in output_times
+
+		Notes
+		=====
+		This mirrors the allocations in malloc_tracers and
+		malloc_gas_migration (vice/src/multizone), setup_MDF
+		(vice/src/singlezone/mdf.c), and copy_zone_history and
+		setup_tracer_merging. Each zone's elements are taken to be the union
+		of those of every zone, as they will be once the simulation is ran.
+		"""
+		output_times = self._zones[0]._singlezone__c_version.output_times_check(
+			output_times)
+		cdef double dt = self._zones[0].dt
+		cdef double final = output_times[-1]
+		cdef unsigned long n_timesteps = _singlezone.BUFFER + <unsigned long> (
+			final / dt)
+		cdef double current_time = 0
+		cdef unsigned long n_injections = 1
+		while current_time <= final:
+			# tracers are injected at the start and after each timestep
+			n_injections += 1
+			current_time += dt
+		n_allocated = self.n_zones * self.n_tracers * n_timesteps
+
+		elements = []
+		for i in range(self.n_zones):
+			for elem in self._zones[i].elements:
+				if elem not in elements: elements.append(elem)
+		n_distributions = len(elements) + len(elements) * (
+			len(elements) - 1) // 2
+		mdf = 0
+		for i in range(self.n_zones):
+			mdf += n_distributions * (sizeof(double *) + (
+				len(self._zones[i].bins) - 1) * sizeof(double))
+
+		breakdown = {
+			"tracers": n_allocated * (sizeof(TRACER *) + sizeof(TRACER)),
+			"zone_history": n_allocated * n_timesteps * sizeof(int),
+			"gas_migration": n_timesteps * (sizeof(double **) +
+				self.n_zones * sizeof(double *) +
+				self.n_zones**2 * sizeof(double)),
+			"mdf": mdf,
+			"merging": (n_allocated * sizeof(TRACER *) if
+				self.merge_age is not None and not self.simple else 0)
+		}
+		breakdown["total"] = sum(breakdown.values())
+		return {
+			"bytes": breakdown,
+			"n_tracers": self.n_zones * self.n_tracers * n_injections,
+			"n_timesteps": n_timesteps
+		}
+
+
+	def memory_budget_check(self, output_times):
+		"""
+		Ensures that the simulation will not allocate more memory than its
+		budget allows before any of it is allocated.
+
+		Parameters
+		==========
+		output_times :: array-like
+			The array of values the user passed to run()
+
+		Raises
+		======
+		MemoryError ::
+			:: The estimated memory use exceeds the attribute memory_budget
+		"""
+		if self._memory_budget is not None:
+			resources = self.estimate_resources(output_times)
+			if resources["bytes"]["total"] > self._memory_budget:
+				breakdown = ""
+				for key in resources["bytes"].keys():
+					breakdown += "\n    %s " % (key)
+					for i in range(15 - len(key)): breakdown += '-'
+					breakdown += "> %s" % (_pyutils.format_bytes(
+						resources["bytes"][key]))
+				raise MemoryError("""\
+Estimated memory use of multizone simulation %s exceeds the memory budget of \
+%s with %d star particles over %d timesteps:%s""" % (self.name,
+					_pyutils.format_bytes(self._memory_budget),
+					resources["n_tracers"], resources["n_timesteps"],
+					breakdown))
+			else: pass
+		else: pass
+
+
+	def checkpoint_setup(self, checkpoint):
+		"""
+		Sets the time interval between checkpoints of the simulation state.
+
+		Parameters
+		==========
+		checkpoint :: real number or None
+			The user's checkpoint specification. None disables checkpoints.
+
+		Raises
+		======
+		TypeError ::
+			:: checkpoint is neither None nor a real number
+		ValueError ::
+			:: checkpoint is not positive
+
+		Notes
+		=====
+		Checkpoints are written for the multizone model as a whole, and so
+		checkpointing of the individual zones is always disabled here.
+		"""
+		for i in range(self._mz[0].mig[0].n_zones):
+			self._mz[0].zones[i][0].checkpoint_interval = 0
+		if checkpoint is None:
+			self._mz[0].checkpoint_interval = 0
+		elif isinstance(checkpoint, numbers.Number):
+			if checkpoint > 0:
+				self._mz[0].checkpoint_interval = checkpoint
+			else:
+				raise ValueError("""Checkpoint interval must be positive. \
+Got: %g""" % (checkpoint))
+		else:
+			raise TypeError("""Checkpoint interval must be a real number or \
+None. Got: %s""" % (type(checkpoint)))
 
 
 	def prep(self, output_times):
@@ -500,6 +829,7 @@ proceed faster or slower as a function of the timestep size."""
 			
 				elif callable(self.migration.gas[i][j]):
 					arr = list(map(self.migration.gas[i][j], eval_times))
+					self.profile_count("migration.gas", len(arr))
 					if _migration.setup_migration_element(self._mz[0],
 						self._mz[0].mig[0].gas_migration,
 						i, j, copy_pylist(arr)):
@@ -525,6 +855,7 @@ proceed faster or slower as a function of the timestep size."""
 		takes_keyword = True
 		try: # check for an optional keyword argument 'n'
 			self.migration.stars(0, 0, 0, n = 0)
+			self.profile_count("migration.stars", 1)
 		except TypeError:
 			takes_keyword = False
 		_tracer.malloc_tracers(self._mz)
@@ -537,7 +868,7 @@ proceed faster or slower as a function of the timestep size."""
 		# determine if the user is using the hydrodiskstars object
 		if isinstance(self.migration.stars, hydrodiskstars):
 			if self.migration.stars.mode is not None:
-				_hydrodiskstars.set_hydrodiskstars_object(
+				_hydrodiskstars.set_hydrodiskstars_object(self._mz,
 					self.migration.stars._hydrodiskstars__object_address()
 				)
 				using_hydrodisk = True
@@ -577,6 +908,7 @@ None.""" % (self.migration.stars.mode), UserWarning)
 								self.migration.stars(j,
 									i * self._mz[0].zones[0][0].dt,
 									i * self._mz[0].zones[0][0].dt)
+							self.profile_count("migration.stars", 1)
 						else: pass
 						# The index of this tracer particle
 						idx = (i * (self.n_zones * self.n_tracers) +
@@ -709,6 +1041,8 @@ Zone number must always be an integer. Got: %s""" % (type(final)))
 				"""
 				zone_history[-_singlezone.BUFFER + 1:] = (
 					_singlezone.BUFFER - 1) * [zone_history[-_singlezone.BUFFER]]
+			self.profile_count("migration.stars", 2 if self.simple else
+				n_timesteps - _singlezone.BUFFER + 1 - timestep)
 		else:
 			pass
 
@@ -858,6 +1192,7 @@ its time of formation, must equal its zone of origin.""")
 			"m_upper": 		[self._zones[i].m_upper for i in range(n_zones)],
 			"m_lower": 		[self._zones[i].m_lower for i in range(n_zones)],
 			"Z_solar": 		[self._zones[i].Z_solar for i in range(n_zones)],
+			"integrator": 	[self._zones[i].integrator for i in range(n_zones)],
 			"agb_model": 	[self._zones[i].agb_model for i in range(n_zones)]
 		}
 
@@ -891,28 +1226,15 @@ its time of formation, must equal its zone of origin.""")
 
 
 	def import_mlr_data(self):
-		# import the mass-lifetime relation data on this extension
-		if mlr.setting in ["vincenzo2016", "hpt2000", "ka1997"]:
-			func = {
-				"vincenzo2016": _mlr.vincenzo2016_import,
-				"hpt2000": _mlr.hpt2000_import,
-				"ka1997": _mlr.ka1997_import
-			}[mlr.setting]
-			path = "%ssrc/ssp/mlr/%s.dat" % (_DIRECTORY_, mlr.setting)
-			func(path.encode("latin-1"))
-		else: pass
-
+		# take the current mass-lifetime relation setting into the context
+		# of each zone along with any data it requires
+		for i in range(self._mz[0].mig[0].n_zones):
+			self._zones[i]._singlezone__c_version.import_mlr_data()
 
 	def free_mlr_data(self):
-		# frees the mass-lifetime relation data on this extension
-		if mlr.setting in ["vincenzo2016", "hpt2000", "ka1997"]:
-			func = {
-				"vincenzo2016": _mlr.vincenzo2016_free,
-				"hpt2000": _mlr.hpt2000_free,
-				"ka1997": _mlr.ka1997_free
-			}[mlr.setting]
-			func()
-		else: pass
+		# frees the mass-lifetime relation data in each zone's context
+		for i in range(self._mz[0].mig[0].n_zones):
+			self._zones[i]._singlezone__c_version.free_mlr_data()
 
 
 	def pickle(self):
@@ -938,6 +1260,8 @@ its time of formation, must equal its zone of origin.""")
 			"n_zones": 			self.n_zones,
 			"n_stars": 			self.n_tracers,
 			"simple": 			self.simple,
+			"merge_age": 		self.merge_age,
+			"memory_budget": 	self.memory_budget,
 			"verbose": 			self.verbose
 		}
 		attrs["zones"] = dict(zip(
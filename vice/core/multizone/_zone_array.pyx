@@ -104,6 +104,7 @@ integer. Got: %g""" % (key))
 		self._zones[key].eta 				= sz.eta
 		self._zones[key].func 				= sz.func
 		self._zones[key].IMF 				= sz.IMF
+		self._zones[key].integrator 		= sz.integrator
 		self._zones[key].m_lower 			= sz.m_lower
 		self._zones[key].m_upper 			= sz.m_upper
 		self._zones[key].Mg0 				= sz.Mg0
@@ -9,6 +9,7 @@ from ..outputs._output_utils import _get_name
 from ..outputs import multioutput
 from ..outputs import output
 from .. import pickles
+from .. import _futures
 import warnings
 import numbers
 import sys
@@ -91,6 +92,20 @@ class multizone(object):
 	simple : ``bool`` [default : False]
 		If True, each individual zone will be simulated as a one-zone model,
 		ignoring all migration prescriptions.
+	merge_age : real number [default : None]
+		The age in Gyr beyond which star particles sharing a zone of origin,
+		a current zone, and a bin in age are merged in the enrichment
+		calculations. ``None`` disables merging.
+
+		.. versionadded:: 1.3.0
+
+	memory_budget : real number [default : None]
+		The maximum number of bytes the simulation may allocate for its star
+		particles, gas migration matrix, and metallicity distribution
+		functions. ``None`` disables the check.
+
+		.. versionadded:: 1.3.0
+
 	verbose : ``bool`` [default : False]
 		Whether or not to print to the console as the simulation runs.
 
@@ -98,6 +113,10 @@ class multizone(object):
 	---------
 	run : [instancemethod]
 		Run the simulation
+	run_async : [instancemethod]
+		Run the simulation on a background thread.
+	estimate_resources : [instancemethod]
+		Estimate the memory the simulation will require.
 	from_output : [classmethod]
 		Obtain a ``multizone`` object with the parameters of one that produced
 		an output.
@@ -153,6 +172,12 @@ class multizone(object):
 	to ~800 MB of RAM and requires only ~2.5 minutes to fully integrate over
 	~8.5 GB of data. Using 40 zones instead of 200 then requires ~250 MB of RAM
 	and fully integrates inover ~7 GB of total data in ~11 seconds.
+	Setting the attribute ``merge_age`` merges old star particles in the
+	enrichment calculations, such that the cost of each timestep no longer
+	grows in proportion to the number of timesteps. The function
+	``estimate_resources`` gives the memory a simulation will require before
+	it is ran, and the attribute ``memory_budget`` stops simulations which
+	would exceed it before any memory is allocated.
 
 	**Relationship to ``vice.singlezone``** :raw-html:`<br />`
 	This object makes use of composition. At its core, it is simply an array of
@@ -170,6 +195,7 @@ class multizone(object):
 			n_stars --------> 1
 			verbose --------> False
 			simple ---------> False
+			merge_age ------> None
 			zones ----------> ['zone0', 'zone1', 'zone2']
 			migration ------> Stars: <function _DEFAULT_STELLAR_MIGRATION_ at 0x10e2150e0>
 							  ISM:     MigrationMatrix{
@@ -215,6 +241,8 @@ Got: %s""" % (type(n_zones)))
 			"n_stars": 			self.n_stars,
 			"verbose": 			self.verbose,
 			"simple": 			self.simple,
+			"merge_age": 		self.merge_age,
+			"memory_budget": 	self.memory_budget,
 			"zones": 			[self.zones[i].name for i in range(
 									self.n_zones)],
 			"migration": 		self.migration
@@ -315,6 +343,7 @@ Got: %s""" % (type(n_zones)))
 				n_stars --------> 1
 				verbose --------> False
 				simple ---------> False
+				merge_age ------> None
 				zones ----------> ['zone0', 'zone1', 'zone2']
 				migration ------> Stars: <function _DEFAULT_STELLAR_MIGRATION_ at 0x111393f80>
 								  ISM:     MigrationMatrix{
@@ -352,6 +381,10 @@ Got: %s""" % (type(arg)))
 			mz.name = attrs["name"]
 			mz.n_stars = attrs["n_stars"]
 			mz.simple = attrs["simple"]
+			if "merge_age" in attrs: mz.merge_age = attrs["merge_age"]
+			if "memory_budget" in attrs:
+				mz.memory_budget = attrs["memory_budget"]
+			else: pass
 			mz.verbose = attrs["verbose"]
 			for i in range(mz.n_zones):
 				mz.zones[i] = singlezone.from_output("%s/%s.vice" % (dirname,
@@ -483,6 +516,7 @@ simulation was ran.""" % (i, j), UserWarning)
 				schmidt_index --> 0.5
 				MgSchmidt ------> 6000000000.0
 				dt -------------> 0.01
+				integrator -----> euler
 				m_upper --------> 100.0
 				m_lower --------> 0.08
 				postMS ---------> 0.1
@@ -659,12 +693,114 @@ simulation was ran.""" % (i, j), UserWarning)
 	def simple(self, value):
 		self.__c_version.simple = value
 
+	@property
+	def merge_age(self):
+		r"""
+		Type : real number
+
+		Default : ``None``
+
+		The age in Gyr beyond which star particles are merged in the
+		enrichment calculations. ``None`` disables merging.
+
+		.. versionadded:: 1.3.0
+
+		Star particles older than this age which were born in the same zone,
+		currently reside in the same zone, and fall in the same bin of birth
+		time are combined into a single star particle carrying their total
+		mass and their mass-weighted metallicity and abundances. The bins
+		grow in width in proportion to the age of the stars within them,
+		such that the cost of each timestep grows only logarithmically with
+		the number of timesteps beyond this age rather than linearly.
+
+		Raises
+		------
+		* TypeError
+			- Attribute is neither a real number nor ``None``.
+		* ValueError
+			- Attribute is not positive.
+
+		Notes
+		-----
+		Merging applies only to the enrichment from SNe Ia, AGB stars,
+		recycling, and custom enrichment channels. The star particles written
+		to the output and the stellar metallicity distribution functions are
+		unaffected. A merged star particle is treated as a single population
+		born at the centre of its bin, and from then on it follows the zone
+		history of its most massive member. This attribute is ignored if the
+		attribute ``simple`` is ``True``.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> mz = vice.multizone(name = "example")
+		>>> mz.merge_age
+		>>> mz.merge_age = 1
+		>>> mz.merge_age
+			1.0
+		"""
+		return self.__c_version.merge_age
+
+	@merge_age.setter
+	def merge_age(self, value):
+		self.__c_version.merge_age = value
+
+	@property
+	def memory_budget(self):
+		r"""
+		Type : real number
+
+		Default : ``None``
+
+		The maximum number of bytes the simulation may allocate for its star
+		particles, gas migration matrix, and metallicity distribution
+		functions. ``None`` disables the check.
+
+		.. versionadded:: 1.3.0
+
+		When this attribute is not ``None``, the ``run`` function estimates
+		the memory the simulation will require with ``estimate_resources``
+		before setting it up, and raises a ``MemoryError`` with the
+		breakdown by structure if the total exceeds this budget.
+
+		Raises
+		------
+		* TypeError
+			- Attribute is neither a real number nor ``None``.
+		* ValueError
+			- Attribute is not positive.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> mz = vice.multizone(name = "example", n_zones = 100)
+		>>> mz.memory_budget = 2.e8
+		>>> mz.run([0.01 * i for i in range(1001)])
+		Traceback (most recent call last):
+		...
+		MemoryError: Estimated memory use of multizone simulation example \
+exceeds the memory budget of 190.7 MB with 100200 star particles over 1010 \
+timesteps:
+		    tracers --------> 6.2 MB
+		    zone_history ---> 389.1 MB
+		    gas_migration --> 77.8 MB
+		    mdf ------------> 379.7 kB
+		    merging --------> 0.0 B
+		    total ----------> 473.5 MB
+		"""
+		return self.__c_version.memory_budget
+
+	@memory_budget.setter
+	def memory_budget(self, value):
+		self.__c_version.memory_budget = value
+
 	def run(self, output_times, capture = False, overwrite = False,
-		pickle = True):
+		pickle = True, checkpoint = None, resume = False, profile = False):
 		r"""
 		Run the simulation.
 
-		**Signature**: x.run(output_times, capture = False, overwrite = False)
+		**Signature**: x.run(output_times, capture = False, overwrite = False,
+		pickle = True, checkpoint = None, resume = False, profile = False)
 
 		Parameters
 		----------
@@ -682,11 +818,39 @@ simulation was ran.""" % (i, j), UserWarning)
 		pickle : ``bool`` [default : True]
 			If ``True``, VICE will save the attributes of this object with the
 			output. See below.
+		checkpoint : real number [default : None]
+			The time interval in Gyr at which VICE will save the state of the
+			simulation to the output directory, allowing it to be resumed if
+			interrupted. ``None`` disables checkpoints. Ignored if the
+			attribute ``simple`` is ``True``.
+
+			.. versionadded:: 1.3.0
+
+		resume : ``bool`` [default : False]
+			If ``True`` and the output directory contains a checkpoint, the
+			simulation will pick up where the checkpoint left off rather than
+			starting over. If no checkpoint is found, the simulation runs from
+			the beginning as usual.
+
+			.. versionadded:: 1.3.0
+
+		profile : ``bool`` [default : False]
+			If ``True``, VICE will time each phase of the simulation and
+			count the number of times each functional attribute is evaluated,
+			returning the results. See note below.
+
+			.. versionadded:: 1.3.0
 
 		Returns
 		-------
 		out : ``multioutput`` [only returned if ``capture == True``]
 			A ``multioutput`` object produced from this simulation's output.
+		profile : ``dict`` [only returned if ``profile == True``]
+			The wall-clock time in seconds of the entire call, the time spent
+			in each phase of the simulation, and the number of evaluations of
+			each functional attribute, as in ``vice.singlezone.run``. If both
+			``capture`` and ``profile`` are ``True``, the output and the
+			profile are returned as a tuple, in that order.
 
 		Raises
 		------
@@ -695,11 +859,23 @@ simulation was ran.""" % (i, j), UserWarning)
 				current specifications.
 			- 	Any of the zones have duplicate names.
 			- 	The timestep size is not uniform across all zones.
+			- 	``resume == True`` and the checkpoint was written by a
+				simulation with a different number of zones, star particles,
+				elements, timestep size, MDF bins, or final output time.
+		* IOError
+			- 	``resume == True`` and the checkpoint could not be read.
+		* MemoryError
+			- 	The attribute ``memory_budget`` is not ``None`` and the
+				memory the simulation would require exceeds it. See
+				``estimate_resources``.
+		* VisibleRuntimeWarning
+			- 	A checkpoint could not be written. The simulation still runs
+				to completion in this case.
 		* ScienceWarning
 			-	Any of the attributes ``IMF``, ``recycling``, ``delay``,
 				``RIa``, ``schmidt``, ``schmidt_index``, ``MgSchmidt``,
-				``m_upper``, ``m_lower``, or ``Z_solar`` aren't uniform across
-				all zones.
+				``m_upper``, ``m_lower``, ``Z_solar``, or ``integrator`` aren't
+				uniform across all zones.
 
 		Other exceptions are raised by ``vice.singlezone.run``.
 
@@ -748,6 +924,35 @@ simulation was ran.""" % (i, j), UserWarning)
 			storage space required. This will, however, render the
 			vice.multizone.from_output function useless for that output.
 
+		.. note::
+
+			Checkpoints are written to the file ``checkpoint.bin`` in the
+			output directory, and the zone histories of all star particles to
+			``checkpoint_tracers.bin`` once at the start of the simulation.
+			Star particles therefore follow the same paths in a resumed
+			simulation even if their migration is stochastic. The gas
+			migration matrix is recomputed upon resuming, so it should be
+			deterministic for a resumed simulation to reproduce an
+			uninterrupted one exactly.
+
+		.. note::
+
+			Regardless of the ``checkpoint`` keyword argument, VICE always
+			saves the state of the simulation at the final timestep to the
+			``checkpoint.bin`` file, allowing it to be continued to later
+			times with ``extend``.
+
+		.. note::
+
+			With ``profile = True``, the phases of the simulation are timed
+			across all zones, with the additional phases "setup_migration"
+			for the setup of the gas migration matrix and the zone histories
+			of star particles in python, "merging", "migration", "injection",
+			"tracers_MDF", and "write_tracers". The functional attributes of
+			each zone are counted under the keys "zones[i].<attribute>" for
+			the i'th zone, and those of the migration prescriptions under
+			"migration.gas" and "migration.stars".
+
 		Example Code
 		------------
 		>>> import numpy as np
@@ -755,7 +960,214 @@ simulation was ran.""" % (i, j), UserWarning)
 		>>> mz = vice.multizone(name = "example")
 		>>> outtimes = np.linspace(0, 10, 1001)
 		>>> mz.run(outtimes)
+		>>> mz.run(outtimes, overwrite = True, checkpoint = 1)
+		>>> # ... if interrupted, pick up from the most recent checkpoint
+		>>> mz.run(outtimes, checkpoint = 1, resume = True)
+		>>> # ... or timing each phase of the simulation
+		>>> mz.run(outtimes, overwrite = True, profile = True)["phases"].keys()
+		"""
+		return self.__c_version.run(output_times, capture = capture,
+			overwrite = overwrite, pickle = pickle, checkpoint = checkpoint,
+			resume = resume, profile = profile)
+
+	def run_async(self, output_times, capture = False, overwrite = False,
+		pickle = True, checkpoint = None, resume = False, profile = False):
+		r"""
+		Run the simulation on a background thread.
+
+		**Signature**: x.run_async(output_times, capture = False,
+		overwrite = False, pickle = True, checkpoint = None, resume = False,
+		profile = False)
+
+		.. versionadded:: 1.3.0
+
+		Parameters
+		----------
+		x : ``multizone``
+			An instance of this class.
+		output_times : array-like [elements are real numbers]
+			The times in Gyr at which VICE should record output from the
+			simulation. See ``run``.
+
+		All keyword arguments are passed along to ``run``.
+
+		Returns
+		-------
+		future : ``concurrent.futures.Future``
+			A future which holds the return value of ``run`` once the
+			simulation has finished. Its ``progress`` attribute gives the
+			fraction of the integration which has been completed so far.
+
+		Notes
+		-----
+		Exceptions raised by ``run`` are set as the exception of the returned
+		future, and are therefore raised by its ``result`` function.
+
+		VICE releases python's global interpreter lock while integrating
+		simulations, reacquiring it only to evaluate user-defined functions.
+		The calling thread is therefore free to proceed, and several
+		simulations may run concurrently in one python process. Those with
+		functional attributes will still take turns evaluating them.
+
+		.. note::
+
+			When ``overwrite == False`` and there are files under the same
+			name as the output produced, the background thread will wait for
+			the user's approval to overwrite them. Asynchronous runs should
+			therefore specify ``overwrite = True`` in most cases.
+
+		.. note::
+
+			The attributes of this object should not be modified until the
+			simulation has finished.
+
+		Example Code
+		------------
+		>>> import numpy as np
+		>>> import vice
+		>>> mz = vice.multizone(name = "example")
+		>>> future = mz.run_async(np.linspace(0, 10, 1001), overwrite = True)
+		>>> future.progress
+		0.3427
+		>>> future.result() # waits for the simulation to finish
+		"""
+		return _futures.submit(self.run, self.__c_version, output_times,
+			capture = capture, overwrite = overwrite, pickle = pickle,
+			checkpoint = checkpoint, resume = resume, profile = profile)
+
+	def estimate_resources(self, output_times):
+		r"""
+		Estimate the memory the simulation will require.
+
+		**Signature**: x.estimate_resources(output_times)
+
+		.. versionadded:: 1.3.0
+
+		Parameters
+		----------
+		x : ``multizone``
+			An instance of this class.
+		output_times : array-like [elements are real numbers]
+			The times in Gyr at which VICE would record output from the
+			simulation. See ``run``.
+
+		Returns
+		-------
+		resources : ``dict``
+			The estimate, with the following keys:
+
+			- "bytes" : ``dict``
+				The number of bytes allocated for each of VICE's largest data
+				structures: the star particles themselves ("tracers"), the
+				zone number of each star particle at each timestep
+				("zone_history"), the gas migration matrix at each timestep
+				("gas_migration"), the metallicity distribution functions of
+				each zone ("mdf"), and the bookkeeping of merged star
+				particles ("merging"), along with their sum ("total").
+			- "n_tracers" : ``int``
+				The number of star particles the simulation will form.
+			- "n_timesteps" : ``int``
+				The number of timesteps the simulation allocates memory for,
+				including a buffer of 10 beyond the final output time.
+
+		Raises
+		------
+		* TypeError
+			- 	``output_times`` is not an array-like object, or has a
+				non-numerical value.
+
+		Notes
+		-----
+		The estimate depends on the attributes ``n_zones``, ``n_stars``,
+		``merge_age``, and ``simple``, and on the timestep size, the elements,
+		and the bins of each zone. The elements of each zone are taken to be
+		the union of those of every zone, as they are when the simulation
+		runs. VICE allocates memory for the star particles and their zone
+		histories at all timesteps, so the "zone_history" entry grows with
+		the square of the number of timesteps and is usually the largest.
+		The per-timestep arrays of each zone (e.g. the star formation
+		history and the abundances of each element) are comparatively small
+		and not included.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> mz = vice.multizone(name = "example", n_zones = 100)
+		>>> resources = mz.estimate_resources([0.01 * i for i in range(1001)])
+		>>> resources["n_tracers"]
+		100200
+		>>> resources["bytes"]["total"]
+		496508880
+		"""
+		return self.__c_version.estimate_resources(output_times)
+
+	def extend(self, output_times, capture = False, pickle = True,
+		checkpoint = None):
+		r"""
+		Continue a completed simulation to later times.
+
+		**Signature**: x.extend(output_times, capture = False, pickle = True,
+		checkpoint = None)
+
+		.. versionadded:: 1.3.0
+
+		Parameters
+		----------
+		x : ``multizone``
+			An instance of this class.
+		output_times : array-like [elements are real numbers]
+			The times in Gyr at which VICE should record output from the
+			simulation. Those which precede the ending time of the completed
+			simulation are ignored, having already been written to the
+			output.
+		capture : ``bool`` [default : False]
+			If ``True``, an output object containing the results of the
+			simulation will be returned.
+		pickle : ``bool`` [default : True]
+			If ``True``, VICE will save the attributes of this object with the
+			output. See ``run``.
+		checkpoint : real number [default : None]
+			The time interval in Gyr at which VICE will save the state of the
+			simulation to the output directory. See ``run``.
+
+		Returns
+		-------
+		out : ``multioutput`` [only returned if ``capture == True``]
+			A ``multioutput`` object produced from this simulation's output.
+
+		Raises
+		------
+		* IOError
+			- 	The output directory does not contain a completed simulation.
+		* RuntimeError
+			- 	The attribute ``simple`` is ``True``.
+			- 	The completed simulation has a different number of zones, star
+				particles, or elements, timestep size, or MDF bins, or ends
+				after the final element of ``output_times``.
+
+		Other exceptions and warnings are raised by ``run``.
+
+		Notes
+		-----
+		The simulation picks up from the state saved at the final timestep of
+		the completed simulation, computing only the additional timesteps, and
+		appends to the existing output. All attributes other than the output
+		times must be the same as when the completed simulation was ran for
+		the result to be equivalent to running to the new ending time from
+		the start. Star particles follow the zone histories computed from the
+		migration prescription for the extended simulation, so with a
+		stochastic prescription, those which had already formed may take
+		different paths after the original ending time than they otherwise
+		would have.
+
+		Example Code
+		------------
+		>>> import numpy as np
+		>>> import vice
+		>>> mz = vice.multizone(name = "example")
+		>>> mz.run(np.linspace(0, 10, 1001))
+		>>> mz.extend(np.linspace(0, 13.2, 1321))
 		"""
 		return self.__c_version.run(output_times, capture = capture,
-			overwrite = overwrite, pickle = pickle)
+			pickle = pickle, checkpoint = checkpoint, extend = True)
 
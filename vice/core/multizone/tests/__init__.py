@@ -10,6 +10,9 @@ if not __VICE_SETUP__:
 	__all__ = ["test"]
 	from ....testing import moduletest
 	from .from_output import test_from_output
+	from .checkpoint import test_checkpoint, test_extend
+	from .merging import test_merge_age
+	from .resources import test_estimate_resources, test_memory_budget
 	from . import mig_matrix_row
 	from . import mig_matrix
 	from . import mig_specs
@@ -25,6 +28,11 @@ if not __VICE_SETUP__:
 		return ["vice.multizone",
 			[
 				test_from_output(),
+				test_checkpoint(),
+				test_extend(),
+				test_merge_age(),
+				test_estimate_resources(),
+				test_memory_budget(),
 				mig_matrix_row.test(run = False),
 				mig_matrix.test(run = False),
 				mig_specs.test(run = False),
@@ -0,0 +1,60 @@
+
+from __future__ import absolute_import
+__all__ = ["test_checkpoint", "test_extend"]
+from ..multizone import multizone
+from ....testing import unittest
+import os
+
+
+@unittest
+def test_checkpoint():
+	r"""
+	vice.multizone.run checkpoint and resume unittest
+	"""
+	def test():
+		# A resumed simulation should reproduce an uninterrupted one exactly
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			mz = multizone(name = "test", n_zones = 3)
+			for i in range(mz.n_zones):
+				mz.zones[i].elements = ["fe", "o"]
+			mz.run(outtimes, overwrite = True)
+			with open("test.vice/tracers.out", 'r') as f:
+				expected = f.read()
+			mz.run(outtimes, overwrite = True, checkpoint = 3)
+			if not os.path.exists("test.vice/checkpoint.bin"): return False
+			mz.run(outtimes, checkpoint = 3, resume = True)
+			with open("test.vice/tracers.out", 'r') as f:
+				resumed = f.read()
+		except:
+			return False
+		return resumed == expected
+	return ["vice.multizone.run [checkpoint]", test]
+
+
+
+@unittest
+def test_extend():
+	r"""
+	vice.multizone.extend unittest
+	"""
+	def test():
+		# An extended simulation should reproduce a longer one exactly
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			mz = multizone(name = "test", n_zones = 3)
+			for i in range(mz.n_zones):
+				mz.zones[i].elements = ["fe", "o"]
+			mz.migration.stars = lambda zone, tform, time: (
+				zone if time < tform + 1 else (zone + 1) % 3)
+			mz.run(outtimes, overwrite = True)
+			with open("test.vice/tracers.out", 'r') as f:
+				expected = f.read()
+			mz.run(outtimes[:501], overwrite = True)
+			mz.extend(outtimes)
+			with open("test.vice/tracers.out", 'r') as f:
+				extended = f.read()
+		except:
+			return False
+		return extended == expected
+	return ["vice.multizone.extend", test]
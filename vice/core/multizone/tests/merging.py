@@ -0,0 +1,44 @@
+
+from __future__ import absolute_import
+__all__ = ["test_merge_age"]
+from ..multizone import multizone
+from ....testing import unittest
+
+
+@unittest
+def test_merge_age():
+	r"""
+	vice.multizone.merge_age unittest
+	"""
+	def test():
+		# Merging star particles older than 1 Gyr should track the model
+		# without merging closely and write out every star particle
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			history = []
+			n_stars = []
+			for merge_age in [None, 1]:
+				mz = multizone(name = "test", n_zones = 3, n_stars = 2)
+				mz.merge_age = merge_age
+				for i in range(mz.n_zones):
+					mz.zones[i].elements = ["fe", "o"]
+				mz.migration.stars = lambda zone, tform, time: (
+					zone if time < tform + 1 else (zone + 1) % 3)
+				mz.run(outtimes, overwrite = True)
+				with open("test.vice/zone1.vice/history.out", 'r') as f:
+					history.append([[float(i) for i in line.split()] for line
+						in f.readlines() if not line.startswith('#')])
+				with open("test.vice/tracers.out", 'r') as f:
+					n_stars.append(len(f.readlines()))
+			full, merged = history
+			if n_stars[0] != n_stars[1]: return False
+			for i in range(1, len(outtimes)):
+				# ISM mass and the abundance of each element by mass
+				for j in [1, -2, -1]:
+					if abs(merged[i][j] - full[i][j]) > 0.01 * full[i][j]:
+						return False
+		except:
+			return False
+		return True
+	return ["vice.multizone.merge_age", test]
+
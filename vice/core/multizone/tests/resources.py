@@ -0,0 +1,68 @@
+from __future__ import absolute_import
+__all__ = ["test_estimate_resources", "test_memory_budget"]
+from ..multizone import multizone
+from ....testing import unittest
+import os
+
+
+@unittest
+def test_estimate_resources():
+	r"""
+	vice.multizone.estimate_resources unittest
+	"""
+	def test():
+		# The expected number of star particles should match the number
+		# written to the output, and the zone histories should grow with the
+		# square of the number of timesteps.
+		try:
+			outtimes = [0.01 * i for i in range(101)]
+			mz = multizone(name = "test", n_zones = 3, n_stars = 2)
+			for i in range(mz.n_zones): mz.zones[i].elements = ["fe", "o"]
+			resources = mz.estimate_resources(outtimes)
+			mz.run(outtimes, overwrite = True)
+			with open("test.vice/tracers.out", 'r') as f:
+				n_tracers = len([line for line in f.readlines() if not
+					line.startswith('#')])
+			if resources["n_tracers"] != n_tracers: return False
+			breakdown = resources["bytes"]
+			if breakdown["total"] != sum([breakdown[key] for key in
+				breakdown.keys() if key != "total"]): return False
+			if breakdown["merging"]: return False
+			longer = mz.estimate_resources([0.01 * i for i in range(201)])
+			ratio = (longer["bytes"]["zone_history"] /
+				breakdown["zone_history"])
+			expected = (longer["n_timesteps"] / resources["n_timesteps"])**2
+			if abs(ratio - expected) > 1.e-12 * expected: return False
+		except:
+			return False
+		return True
+	return ["vice.multizone.estimate_resources", test]
+
+
+@unittest
+def test_memory_budget():
+	r"""
+	vice.multizone.memory_budget unittest
+	"""
+	def test():
+		# A simulation exceeding its memory budget should fail before it
+		# writes any output, and one within it should run.
+		try:
+			outtimes = [0.01 * i for i in range(101)]
+			if os.path.exists("test_budget.vice"):
+				os.system("rm -rf test_budget.vice")
+			mz = multizone(name = "test_budget", n_zones = 3)
+			total = mz.estimate_resources(outtimes)["bytes"]["total"]
+			mz.memory_budget = total - 1
+			try:
+				mz.run(outtimes, overwrite = True)
+				return False
+			except MemoryError:
+				if os.path.exists("test_budget.vice"): return False
+			mz.memory_budget = total
+			mz.run(outtimes, overwrite = True)
+		except:
+			return False
+		return True
+	return ["vice.multizone.memory_budget", test]
+
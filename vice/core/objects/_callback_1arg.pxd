@@ -6,6 +6,8 @@ cdef extern from "../../src/objects.h":
 		double (*callback)(double, void *)
 		double assumed_constant
 		void *user_func
+		unsigned short native
+		unsigned long *calls
 
 
 cdef extern from "../../src/objects/callback_1arg.h":
@@ -6,4 +6,7 @@ cdef extern from "../../src/objects.h":
 		double (*callback)(double, double, void *)
 		double assumed_constant
 		void *user_func
+		unsigned short native
+		unsigned short owns_user_func
+		unsigned long *calls
 
@@ -0,0 +1,13 @@
+# cython: language_level = 3, boundscheck = False
+
+from ._profile cimport PROFILE
+
+cdef extern from "../../src/objects.h":
+	ctypedef struct CONTEXT:
+		unsigned short mlr
+		PROFILE *profile
+
+
+cdef extern from "../../src/objects/context.h":
+	CONTEXT *context_initialize()
+	void context_free(CONTEXT *ctx)
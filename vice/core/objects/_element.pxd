@@ -18,13 +18,19 @@ cdef extern from "../../src/objects.h":
 		CHANNEL **channels
 		unsigned short n_channels
 		char *symbol
-		double *Z
 		double *Zin
 		double primordial
 		double unretained
 		double mass
 		double solar
 
+	ctypedef struct ELEMENT_STATE:
+		unsigned int n_elements
+		double *Z
+		double *mass
+		unsigned short *helium
+		double solar
+
 cdef extern from "../../src/objects/element.h":
 	ELEMENT *element_initialize()
 	void element_free(ELEMENT *e)
@@ -0,0 +1,26 @@
+
+from __future__ import absolute_import
+from libc.stdio cimport FILE
+from ..singlezone cimport _singlezone
+
+
+cdef extern from "../../src/objects.h":
+	ctypedef struct ENSEMBLE:
+		char *name
+		_singlezone.SINGLEZONE **members
+		unsigned long n_members
+		unsigned int n_threads
+		unsigned short verbose
+		FILE *history_writer
+		FILE *mdf_writer
+
+
+cdef extern from "../../src/ensemble.h":
+	ENSEMBLE *ensemble_initialize(unsigned long n)
+	void ensemble_free(ENSEMBLE *ens)
+	void link_member(ENSEMBLE *ens, unsigned long address,
+		unsigned long index)
+	unsigned short ensemble_evolve(ENSEMBLE *ens) nogil
+	void ensemble_cancel(ENSEMBLE *ens)
+	unsigned short ensemble_calls_python(ENSEMBLE ens)
+
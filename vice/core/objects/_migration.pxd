@@ -14,6 +14,13 @@ cdef extern from "../../src/objects.h":
 		double ***gas_migration
 		_tracer.TRACER **tracers
 		FILE *tracers_output
+		char *tracers_buffer
+		unsigned long tracers_written
+		long tracers_offset
+		_tracer.TRACER **merged
+		unsigned long n_merged
+		unsigned long first_unmerged
+		unsigned long merge_threshold
 
 
 cdef extern from "../../src/objects/migration.h":
@@ -2,6 +2,7 @@
 from __future__ import absolute_import
 from ..singlezone cimport _singlezone
 from . cimport _migration
+from ._context cimport CONTEXT
 
 
 cdef extern from "../../src/objects.h":
@@ -11,6 +12,9 @@ cdef extern from "../../src/objects.h":
 		_migration.MIGRATION *mig
 		unsigned short verbose
 		unsigned short simple
+		double checkpoint_interval
+		double merge_age
+		CONTEXT *ctx
 
 
 cdef extern from "../../src/multizone/multizone.h":
@@ -18,6 +22,8 @@ cdef extern from "../../src/multizone/multizone.h":
 	void multizone_free(MULTIZONE *mz)
 	void link_zone(MULTIZONE *mz, unsigned long address,
 		unsigned int zone_index)
-	unsigned short multizone_evolve(MULTIZONE *mz)
+	unsigned short multizone_evolve(MULTIZONE *mz) nogil
+	unsigned short multizone_resume(MULTIZONE *mz) nogil
+	unsigned short multizone_extend(MULTIZONE *mz) nogil
 	void multizone_cancel(MULTIZONE *mz)
 
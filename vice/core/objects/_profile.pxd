@@ -0,0 +1,17 @@
+# cython: language_level = 3, boundscheck = False
+
+cdef extern from "../../src/objects.h":
+	ctypedef struct PROFILE:
+		double *seconds
+		unsigned long *calls
+
+
+cdef extern from "../../src/objects/profile.h":
+	PROFILE *profile_initialize()
+	void profile_free(PROFILE *p)
+
+
+cdef extern from "../../src/profile.h":
+	unsigned short PROFILE_N_PHASES
+	const char *profile_phase_name(unsigned short phase)
+
@@ -0,0 +1,21 @@
+# cython: language_level = 3, boundscheck = False
+
+from __future__ import absolute_import
+
+cdef extern from "../../src/objects.h":
+	ctypedef struct SENSITIVITY:
+		unsigned short n_params
+		unsigned short *params
+		unsigned int *elements
+
+cdef extern from "../../src/objects/sensitivity.h":
+	SENSITIVITY *sensitivity_initialize(unsigned short n_params)
+	void sensitivity_free(SENSITIVITY *sens)
+
+cdef extern from "../../src/singlezone/sensitivity.h":
+	unsigned short SENSITIVITY_ETA
+	unsigned short SENSITIVITY_TAU_STAR
+	unsigned short SENSITIVITY_TAU_IA
+	unsigned short SENSITIVITY_CCSNE
+	unsigned short SENSITIVITY_SNEIA
+
@@ -2,10 +2,12 @@
 
 from __future__ import absolute_import
 from libc.stdio cimport FILE
-from ._element cimport ELEMENT
+from ._element cimport ELEMENT, ELEMENT_STATE
 from ._ism cimport ISM
 from ._mdf cimport MDF
 from ._ssp cimport SSP
+from ._context cimport CONTEXT
+from ._sensitivity cimport SENSITIVITY
 
 cdef extern from "../../src/objects.h":
 	ctypedef struct SINGLEZONE:
@@ -17,13 +19,26 @@ cdef extern from "../../src/objects.h":
 		double *output_times
 		unsigned long timestep
 		unsigned long n_outputs
+		unsigned long output_index
+		double checkpoint_interval
+		unsigned long step
+		unsigned long trial_step
+		double tolerance
+		unsigned short integrator
+		unsigned short analytic
+		double age_binning
+		double binning_error
+		unsigned short linear_response
 		double Z_solar
 		unsigned int n_elements
 		unsigned short verbose
 		ELEMENT **elements
+		ELEMENT_STATE *state
 		ISM *ism
 		MDF *mdf
 		SSP *ssp
+		CONTEXT *ctx
+		SENSITIVITY *sensitivity
 
 
 cdef extern from "../../src/singlezone.h":
@@ -32,7 +47,9 @@ cdef extern from "../../src/singlezone.h":
 	SINGLEZONE *singlezone_initialize()
 	void singlezone_free(SINGLEZONE *sz)
 	long singlezone_address(SINGLEZONE *sz)
-	unsigned short singlezone_evolve(SINGLEZONE *sz)
+	unsigned short singlezone_evolve(SINGLEZONE *sz) nogil
+	unsigned short singlezone_resume(SINGLEZONE *sz) nogil
+	unsigned short singlezone_extend(SINGLEZONE *sz) nogil
 	void singlezone_cancel(SINGLEZONE *sz)
 	unsigned long n_timesteps(SINGLEZONE sz)
 
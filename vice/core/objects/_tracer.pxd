@@ -7,6 +7,9 @@ cdef extern from "../../src/objects.h":
 		unsigned int zone_origin
 		unsigned int zone_current
 		unsigned long timestep_origin
+		unsigned long width
+		double *abundances
+		double metallicity
 
 
 cdef extern from "../../src/multizone/tracer.h":
@@ -11,6 +11,8 @@ if not __VICE_SETUP__:
 		"mdf",
 		"output",
 		"multioutput",
+		"response",
+		"sensitivities",
 		"stars",
 		"test"
 	]
@@ -18,6 +20,8 @@ if not __VICE_SETUP__:
 	from ._mdf import mdf
 	from .output import output
 	from .multioutput import multioutput
+	from ._response import response
+	from ._sensitivities import sensitivities
 	from ._tracers import tracers as stars
 	from .tests import test
 else:
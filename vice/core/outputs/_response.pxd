@@ -0,0 +1,14 @@
+# cython: language_level = 3, boundscheck = False
+
+from __future__ import absolute_import
+
+cdef class response:
+	cdef object _name
+	cdef object _elements
+	cdef object _time
+	cdef object _mgas
+	cdef object _defaults
+	cdef double *_masses
+	cdef unsigned long _n_outputs
+	cdef unsigned int _n_elements
+
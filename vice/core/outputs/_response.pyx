@@ -0,0 +1,292 @@
+# cython: language_level = 3, boundscheck = False
+"""
+This file implements the response object, which evaluates the time-evolution
+of the interstellar medium for new yields from the linear response recorded
+by a singlezone simulation.
+"""
+
+from __future__ import absolute_import
+from ..._globals import _VERSION_ERROR_
+from . import _output_utils
+from .. import pickles
+import math as m
+import numbers
+import os
+import sys
+if sys.version_info[:2] == (2, 7):
+	strcomp = basestring
+elif sys.version_info[:2] >= (3, 5):
+	strcomp = str
+else:
+	_VERSION_ERROR_()
+from libc.stdlib cimport malloc, free
+from . cimport _response
+
+# The enrichment channels in the order of the columns of response.out
+_CHANNELS_ = ["ccsne", "sneia", "agb", "other"]
+
+
+cdef class response:
+
+	r"""
+	The linear response of the mass of each element in the interstellar medium
+	to its yields, recorded by a singlezone simulation ran with
+	``response = True``.
+
+	**Signature**: vice.response(name)
+
+	.. versionadded:: 1.3.0
+
+	Parameters
+	----------
+	name : ``str``
+		The full or relative path to the output directory. The '.vice'
+		extension is not required.
+
+	Attributes
+	----------
+	name : ``str``
+		The full or relative path to the output directory.
+	elements : ``tuple``
+		The symbols of the elements tracked by the simulation.
+	defaults : ``dict``
+		The yields of each element that the simulation was ran with, stored
+		under the keys "ccsne", "sneia", and "agb". AGB star yields are
+		always 1 (see below).
+
+	Raises
+	------
+	* IOError
+		- Output directory not found.
+		- The simulation was not ran with ``response = True``.
+
+	Calling
+	-------
+	Evaluate the time-evolution of the interstellar medium for new yields.
+
+	**Signature**: x(ccsne = None, sneia = None, agb = None)
+
+	ccsne : ``dict`` [default : None]
+		The IMF-integrated yield of each element from core collapse
+		supernovae, keyed by elemental symbol.
+	sneia : ``dict`` [default : None]
+		The IMF-integrated yield of each element from type Ia supernovae,
+		keyed by elemental symbol.
+	agb : ``dict`` [default : None]
+		The factor by which to scale the asymptotic giant branch star yields
+		that the simulation was ran with, keyed by elemental symbol.
+
+	Elements not included in a dictionary, or all of them if it is ``None``,
+	take the yields from ``defaults``. Calling returns a ``dataframe`` storing
+	the time in Gyr, the ISM gas mass in Msun, and the mass, metallicity by
+	mass, and [X/H] of each element.
+
+	Notes
+	-----
+	For a fixed gas evolution, the mass of each element in the ISM is linear
+	in its yields when they do not depend on metallicity. The simulation
+	therefore records the mass of each element per unit yield from core
+	collapse and type Ia supernovae, its mass from AGB stars, and its mass
+	with every yield set to zero (i.e. from the primordial abundance and the
+	infall). Each evaluation is a weighted sum of these, taking only as long
+	as it takes to write the result.
+
+	.. note:: The mass from AGB stars is that produced by the AGB star yields
+		that the simulation was ran with. As these depend on metallicity in
+		general, scaling them is exact only when the total metallicity is
+		unaffected by the new yields, or for yields which do not depend on
+		metallicity.
+
+	.. note:: Variations in the yields of one element which change the total
+		metallicity of the ISM do not feed back into the lifetimes of AGB
+		stars in this evaluation.
+
+	Example Code
+	------------
+	>>> import numpy as np
+	>>> import vice
+	>>> sz = vice.singlezone(name = "example")
+	>>> sz.run(np.linspace(0, 10, 1001), overwrite = True, response = True)
+	>>> resp = vice.response("example")
+	>>> resp.defaults["ccsne"]
+	{'fe': 0.000246, 'o': 0.00564, 'sr': 1.34e-08}
+	>>> resp()["[fe/h]"][-1]
+	-0.19140281949424323
+	>>> resp(ccsne = {"fe": 0.0005})["[fe/h]"][-1]
+	-0.1508556587783587
+	"""
+
+	def __cinit__(self, name):
+		self._masses = NULL
+
+
+	def __init__(self, name):
+		cdef unsigned long i, j, n
+		self._name = _output_utils._get_name(name)
+		_output_utils._check_singlezone_output(self._name)
+		filename = "%s/response.out" % (self._name)
+		if not os.path.exists(filename): raise IOError("""\
+Simulation was not ran with response = True: %s""" % (self._name))
+
+		# The element symbols from each ccsne(x) column
+		labels = _output_utils._load_column_labels_from_file_header(filename)
+		self._elements = tuple([label[6:-1] for label in labels if
+			label.startswith("ccsne(")])
+		self._n_elements = len(self._elements)
+		with open(filename, 'r') as f:
+			rows = [[float(x) for x in line.split()] for line in f.readlines()
+				if not line.startswith('#')]
+			f.close()
+		self._n_outputs = len(rows)
+		self._time = [row[0] for row in rows]
+		self._mgas = [row[1] for row in rows]
+		n = len(_CHANNELS_) * self._n_elements
+		self._masses = <double *> malloc (self._n_outputs * n * sizeof(double))
+		if self._masses is NULL: raise MemoryError("Could not allocate memory.")
+		for i in range(self._n_outputs):
+			for j in range(n):
+				self._masses[n * i + j] = rows[i][2 + j]
+
+		# The yields the simulation was ran with
+		self._defaults = {}
+		for channel in _CHANNELS_[:2]:
+			yields = pickles.jar.open("%s/yields/%s" % (self._name, channel))
+			self._defaults[channel] = dict([(x, yields[x]) for x in
+				self._elements])
+		self._defaults["agb"] = dict([(x, 1) for x in self._elements])
+
+
+	def __dealloc__(self):
+		if self._masses is not NULL:
+			free(self._masses)
+			self._masses = NULL
+		else: pass
+
+
+	def __repr__(self):
+		return "vice.response{name = %s, elements = %s}" % (self._name,
+			str(self._elements))
+
+
+	def __str__(self):
+		return self.__repr__()
+
+
+	def __call__(self, ccsne = None, sneia = None, agb = None):
+		from ..dataframe import base as dataframe
+		from ..dataframe import solar_z
+		cdef unsigned long i, k
+		cdef unsigned int j, n_channels = len(_CHANNELS_)
+		cdef unsigned int n = n_channels * self._n_elements
+		cdef double y_cc, y_ia, f_agb, solar
+		cdef double *masses = <double *> malloc (self._n_outputs *
+			sizeof(double))
+		if masses is NULL: raise MemoryError("Could not allocate memory.")
+		yields = [self.__yields(channel, value) for channel, value in zip(
+			_CHANNELS_[:3], [ccsne, sneia, agb])]
+		frame = {
+			"time": self._time[:],
+			"mgas": self._mgas[:]
+		}
+		try:
+			for j in range(self._n_elements):
+				element = self._elements[j]
+				y_cc = yields[0][element]
+				y_ia = yields[1][element]
+				f_agb = yields[2][element]
+				solar = solar_z[element]
+				for i in range(self._n_outputs):
+					k = n * i + n_channels * j
+					masses[i] = (y_cc * self._masses[k] +
+						y_ia * self._masses[k + 1] +
+						f_agb * self._masses[k + 2] +
+						self._masses[k + 3])
+				mass = [masses[i] for i in range(self._n_outputs)]
+				z = [x / y if y else 0 for x, y in zip(mass, self._mgas)]
+				frame["mass(%s)" % (element)] = mass
+				frame["z(%s)" % (element)] = z
+				frame["[%s/h]" % (element)] = [
+					m.log10(x / solar) if x > 0 else -float("inf")
+					for x in z]
+		finally:
+			free(masses)
+		return dataframe(frame)
+
+
+	@property
+	def name(self):
+		r"""
+		Type : ``str``
+
+		The full or relative path to the output directory.
+		"""
+		return self._name
+
+
+	@property
+	def elements(self):
+		r"""
+		Type : ``tuple``
+
+		The symbols of the elements tracked by the simulation.
+		"""
+		return self._elements
+
+
+	@property
+	def defaults(self):
+		r"""
+		Type : ``dict``
+
+		The yields of each element that the simulation was ran with, stored
+		under the keys "ccsne", "sneia", and "agb". AGB star yields are
+		always 1, as calling this object scales those that the simulation
+		was ran with.
+		"""
+		return dict([(i, dict(self._defaults[i])) for i in
+			self._defaults.keys()])
+
+
+	def __yields(self, channel, value):
+		"""
+		Obtain the yield of each element from a given enrichment channel.
+
+		Parameters
+		==========
+		channel :: str
+			The name of the enrichment channel
+		value :: dict or None
+			The user's specification
+
+		Returns
+		=======
+		A dictionary of the yield of each element, taking the defaults for
+		those the user did not specify
+
+		Raises
+		======
+		TypeError ::
+			:: value is neither None nor a dictionary
+			:: value stores a yield which is not a real number
+		ValueError ::
+			:: value has a key which is not an element tracked by the
+				simulation
+		"""
+		yields = dict(self._defaults[channel])
+		if value is None:
+			return yields
+		elif isinstance(value, dict):
+			for i in value.keys():
+				if not isinstance(i, strcomp) or i.lower() not in yields.keys():
+					raise ValueError("""Element not tracked by the \
+simulation: %s""" % (str(i)))
+				elif not isinstance(value[i], numbers.Number):
+					raise TypeError("""%s yield must be a real number. \
+Got: %s""" % (channel, type(value[i])))
+				else:
+					yields[i.lower()] = value[i]
+			return yields
+		else:
+			raise TypeError("""%s yields must be specified as a dictionary or \
+None. Got: %s""" % (channel, type(value)))
+
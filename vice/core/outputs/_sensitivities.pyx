@@ -0,0 +1,88 @@
+# cython: language_level = 3, boundscheck = False
+"""
+This file implements the sensitivities function, which returns a fromfile
+object from a singlezone output ran with sensitivities.
+"""
+
+from __future__ import absolute_import
+from . import _output_utils
+from ..dataframe._fromfile cimport fromfile as fromfile_obj
+import os
+
+
+def sensitivities(name):
+	r"""
+	Obtain a ``fromfile`` object from a VICE output containing the derivatives
+	of the ISM mass and the mass of each element with respect to the
+	parameters that it was ran with sensitivities to.
+
+	**Signature**: vice.sensitivities(name)
+
+	.. versionadded:: 1.3.0
+
+	Parameters
+	----------
+	name : ``str``
+		The full or relative path to the output directory. The '.vice'
+		extension is not required.
+
+	Returns
+	-------
+	sens : ``fromfile`` [VICE ``dataframe`` derived class]
+		A subclass of the VICE dataframe designed to handle simulation output.
+		Each derivative is stored under the key "d(mgas)/d(p)" for the ISM
+		mass or "d(mass(x))/d(p)" for the mass of element x, where p is the
+		name of the parameter, alongside the time in Gyr under "time".
+
+	Raises
+	------
+	* IOError
+		- Output directory not found.
+		- The simulation was not ran with sensitivities.
+
+	Notes
+	-----
+	The derivatives are in Msun per unit parameter, with the star formation
+	efficiency timescale and the e-folding timescale of SNe Ia in Gyr. Those
+	of the metallicity by mass and of [X/H] follow from the chain rule with
+	the corresponding ``history`` output:
+
+	.. math:: \frac{\partial Z_x}{\partial p} = \frac{1}{M_g}\left(
+		\frac{\partial M_x}{\partial p} - Z_x\frac{\partial M_g}{\partial p}
+		\right)
+
+	.. note:: For an output under a given name, the derivatives are stored
+		in an ascii text file under name.vice/sensitivities.out. This allows
+		users to open these files without VICE if necessary.
+
+	.. seealso:: vice.singlezone.run
+
+	Example Code
+	------------
+	>>> import numpy as np
+	>>> import vice
+	>>> sz = vice.singlezone(name = "example")
+	>>> sz.run(np.linspace(0, 10, 1001), overwrite = True,
+	... 	sensitivities = ["eta", "ccsne(fe)"])
+	>>> sens = vice.sensitivities("example")
+	>>> sens.keys()
+	['time',
+	 'd(mgas)/d(eta)',
+	 'd(mass(fe))/d(eta)',
+	 'd(mass(o))/d(eta)',
+	 'd(mass(sr))/d(eta)',
+	 'd(mgas)/d(ccsne(fe))',
+	 'd(mass(fe))/d(ccsne(fe))',
+	 'd(mass(o))/d(ccsne(fe))',
+	 'd(mass(sr))/d(ccsne(fe))']
+	"""
+	name = _output_utils._get_name(name)
+	_output_utils._check_singlezone_output(name)
+	filename = "%s/sensitivities.out" % (name)
+	if not os.path.exists(filename): raise IOError("""\
+Simulation was not ran with sensitivities: %s""" % (name))
+	return fromfile_obj(
+		filename = filename,
+		labels = _output_utils._load_column_labels_from_file_header(filename)
+	)
+
@@ -20,4 +20,6 @@ cdef class c_singlezone:
 	cdef object _callback_cc
 	cdef object _callback_ia
 	cdef object _callback_agb
+	cdef object _profile
+	cdef unsigned long *_callback_calls
 
@@ -38,6 +38,7 @@ from ..mlr import mlr
 import math as m
 import warnings
 import numbers
+import time
 import sys
 import os
 if sys.version_info[:2] == (2, 7):
@@ -49,7 +50,7 @@ else:
 	_VERSION_ERROR_()
 
 # C imports
-from libc.stdlib cimport malloc
+from libc.stdlib cimport malloc, free
 from libc.string cimport strlen
 from .._cutils cimport set_string
 from .._cutils cimport copy_pylist
@@ -57,15 +58,20 @@ from .._cutils cimport setup_imf
 from .._cutils cimport callback_1arg_setup
 from .._cutils cimport callback_2arg_setup
 from .._cutils cimport copy_2Dpylist
+from .._cutils cimport profile_phases
+from ..multizone cimport _milkyway
 from ..objects cimport _element
 from ..objects cimport _singlezone
 from ..objects cimport _sneia
 from ..objects cimport _agb
+from ..objects cimport _sensitivity
+from ..objects cimport _profile
 from .. cimport _mlr
 from . cimport _singlezone
 
 _RECOGNIZED_MODES_ = tuple(["ifr", "sfr", "gas"])
 _RECOGNIZED_DTDS_ = tuple(["exp", "plaw"])
+_RECOGNIZED_INTEGRATORS_ = tuple(["euler", "exponential"])
 
 """
 NOTES
@@ -104,6 +110,8 @@ cdef class c_singlezone:
 
 	def __cinit__(self):
 		self._sz = _singlezone.singlezone_initialize()
+		self._callback_calls = NULL
+		self._profile = None
 
 	def __init__(self,
 		name = "onezonemodel",
@@ -124,6 +132,7 @@ cdef class c_singlezone:
 		tau_ia = 1.5,
 		tau_star = 2.0,
 		dt = 0.01,
+		integrator = "euler",
 		schmidt = False,
 		MgSchmidt = 6.0e9,
 		schmidt_index = 0.5,
@@ -160,6 +169,7 @@ cdef class c_singlezone:
 		self.tau_ia = tau_ia
 		self.tau_star = tau_star
 		self.dt = dt
+		self.integrator = integrator
 		self.schmidt = schmidt
 		self.MgSchmidt = MgSchmidt
 		self.schmidt_index = schmidt_index
@@ -173,6 +183,7 @@ cdef class c_singlezone:
 		self._callback_agb = None
 
 	def __dealloc__(self):
+		free(self._callback_calls)
 		_singlezone.singlezone_free(self._sz)
 
 	def object_address(self):
@@ -313,6 +324,19 @@ Got: %s""" % (type(value)))
 			raise TypeError("""Attribute 'verbose' must be interpretable as \
 a boolean. Got: %s""" % (type(value)))
 
+	@property
+	def current_time(self):
+		"""
+		The time in Gyr that the integration has reached. This is read from
+		another thread to report the progress of asynchronous runs.
+		"""
+		return self._sz[0].current_time
+
+	@property
+	def age_binning_error(self):
+		# docstring in python version
+		return self._sz[0].binning_error
+
 	@property
 	def elements(self):
 		# docstring in python version
@@ -981,6 +1005,34 @@ numerical value or a callable function.""")
 			raise TypeError("""Attribute 'dt' must be a numerical value. \
 Got: %s""" % (type(value)))
 
+	@property
+	def integrator(self):
+		# docstring in python version
+		return _RECOGNIZED_INTEGRATORS_[self._sz[0].integrator]
+
+	@integrator.setter
+	def integrator(self, value):
+		"""
+		The integrator for the ISM mass and the mass of each element
+
+		Allowed Types
+		=============
+		str [case-insensitive]
+
+		Allowed Values
+		==============
+		"euler", "exponential"
+		"""
+		if isinstance(value, strcomp):
+			if value.lower() in _RECOGNIZED_INTEGRATORS_:
+				self._sz[0].integrator = _RECOGNIZED_INTEGRATORS_.index(
+					value.lower())
+			else:
+				raise ValueError("Unrecognized integrator: %s" % (value))
+		else:
+			raise TypeError("""Attribute 'integrator' must be of type str. \
+Got: %s""" % (type(value)))
+
 	@property
 	def schmidt(self):
 		# docstring in python version
@@ -1297,15 +1349,40 @@ All elemental yields in the current simulation will be set to the table of \
 
 
 	# ------------------------ RUN THE SIMULATION ------------------------ #
-	def run(self, output_times, capture = False, overwrite = False):
+	def run(self, output_times, capture = False, overwrite = False,
+		checkpoint = None, resume = False, extend = False, adaptive = None,
+		age_binning = None, response = False, sensitivities = None,
+		analytic = True, profile = False):
 		
 		r"""
-		See docstring in singlezone.py.
-		"""
-
+		See docstring in singlezone.py. ``extend = True`` is passed from the
+		extend function.
+		"""
+		cdef _profile.PROFILE *prof = NULL
+		start = time.perf_counter()
+		phases = {}
+		self.profile_setup(profile)
+
+		if extend and not os.path.exists("%s.vice/checkpoint.bin" % (
+			self.name)):
+			raise IOError("""\
+No completed simulation to extend in output directory: %s.vice/""" % (
+				self.name))
+		else:
+			resume = (resume or extend) and os.path.exists(
+				"%s.vice/checkpoint.bin" % (self.name))
 		output_times = self.prep(output_times)
+		self.checkpoint_setup(checkpoint)
+		self.adaptive_setup(adaptive)
+		self.age_binning_setup(age_binning)
+		self.response_setup(response, resume)
+		self.sensitivities_setup(sensitivities, resume)
+		self.analytic_setup(analytic, output_times)
+		prep = time.perf_counter() - start
 		cdef int enrichment
-		if self.open_output_dir(overwrite):
+		cdef bint resuming = resume
+		cdef bint extending = extend
+		if resume or self.open_output_dir(overwrite):
 
 			# warn the user about r-process elements, bad solar calibrations,
 			# and mass-lifetime relation effects
@@ -1315,12 +1392,28 @@ All elemental yields in the current simulation will be set to the table of \
 
 			# take the current mass-lifetime relation setting
 			self.import_mlr_data()
-			_mlr.set_mlr_hashcode(_mlr._mlr_linker.__NAMES__[mlr.setting])
 
 			# just do it #nike
+			# The GIL is released for the integration and reacquired by the
+			# callback functions in _cutils only while they call python.
 			self._sz[0].output_times = copy_pylist(output_times)
 			self._sz[0].n_outputs = len(output_times)
-			enrichment = _singlezone.singlezone_evolve(self._sz)
+			if profile:
+				prof = _profile.profile_initialize()
+				self._sz[0].ctx[0].profile = prof
+			else: pass
+			with nogil:
+				if extending:
+					enrichment = _singlezone.singlezone_extend(self._sz)
+				elif resuming:
+					enrichment = _singlezone.singlezone_resume(self._sz)
+				else:
+					enrichment = _singlezone.singlezone_evolve(self._sz)
+			if profile:
+				phases = profile_phases(prof)
+				self._sz[0].ctx[0].profile = NULL
+				_profile.profile_free(prof)
+			else: pass
 
 			# save yield settings and attributes, free mass-lifetime data
 			self.pickle()
@@ -1335,14 +1428,503 @@ All elemental yields in the current simulation will be set to the table of \
 		else:
 			pass
 
-		if enrichment:
+		if enrichment == 1:
 			raise SystemError("Internal Error")
+		elif enrichment == 2:
+			warnings.warn("""\
+Could not write checkpoint to output directory: %s.vice/""" % (self.name),
+				VisibleRuntimeWarning)
+		elif enrichment == 3:
+			raise IOError("Could not read checkpoint from output directory: \
+%s.vice/" % (self.name))
+		elif enrichment == 4:
+			raise RuntimeError("""\
+Checkpoint in output directory %s.vice/ does not match the current simulation. \
+The number of elements, timestep size, metallicity distribution function bins, \
+and final output time must be the same as when the checkpoint was written.""" % (
+				self.name))
+		else:
+			pass
+
+		if profile:
+			phases["prep"] = {"seconds": prep, "calls": 1}
+			results = {
+				"total": time.perf_counter() - start,
+				"phases": phases,
+				"callbacks": self.profile_callbacks()
+			}
+		else:
+			results = None
+
+		if capture and profile:
+			return (output(self.name), results)
 		elif capture:
 			return output(self.name)
+		elif profile:
+			return results
 		else:
 			pass
 
 
+	def profile_setup(self, profile):
+		"""
+		Prepares the counters of the number of times each function attribute
+		is evaluated when the simulation is profiled.
+
+		Parameters
+		==========
+		profile :: bool
+			Whether or not the simulation is being profiled. If False, any
+			counters left over from a previous call are removed.
+
+		Notes
+		=====
+		Functions mapped across time in python are counted by
+		profile_count. The star formation efficiency timescale as a function
+		of time and gas mass, the IMF, and the nucleosynthetic yields are
+		evaluated in C, and their counters are in _callback_calls:
+		tau_star first, then the IMF, then the core collapse, type Ia, and AGB
+		star yields of each element in turn.
+		"""
+		cdef unsigned long i, n = 2 + 3 * self._sz[0].n_elements
+		self.profile_callbacks()
+		if profile:
+			self._profile = {}
+			self._callback_calls = <unsigned long *> malloc(n *
+				sizeof(unsigned long))
+			for i in range(n):
+				self._callback_calls[i] = 0
+			self._sz[0].ism[0].functional_tau_star[0].calls = (
+				&self._callback_calls[0])
+			self._sz[0].ssp[0].imf[0].custom_imf[0].calls = (
+				&self._callback_calls[1])
+			for i in range(self._sz[0].n_elements):
+				self._sz[0].elements[i][0].ccsne_yields[0].yield_[0].calls = (
+					&self._callback_calls[2 + 3 * i])
+				self._sz[0].elements[i][0].sneia_yields[0].yield_[0].calls = (
+					&self._callback_calls[3 + 3 * i])
+				self._sz[0].elements[i][0].agb_grid[0].custom_yield[0].calls = (
+					&self._callback_calls[4 + 3 * i])
+		else: pass
+
+
+	def profile_count(self, name, n):
+		"""
+		Counts evaluations of a function attribute made from python when the
+		simulation is being profiled.
+
+		Parameters
+		==========
+		name :: str
+			The name of the attribute
+		n :: int
+			The number of times it was evaluated
+		"""
+		if self._profile is not None:
+			self._profile[name] = self._profile.get(name, 0) + n
+		else: pass
+
+
+	def profile_callbacks(self):
+		"""
+		Obtain the number of times each function attribute was evaluated,
+		removing the counters.
+
+		Returns
+		=======
+		callbacks :: dict
+			The number of evaluations of each function attribute evaluated at
+			least once. Nucleosynthetic yields are keyed by "ccsne(x)",
+			"sneia(x)", and "agb(x)" for each element x. Empty if the
+			simulation is not being profiled.
+		"""
+		cdef unsigned long i
+		callbacks = self._profile if self._profile is not None else {}
+		if self._callback_calls is not NULL:
+			counts = [self._callback_calls[i] for i in range(2 + 3 *
+				self._sz[0].n_elements)]
+			names = ["tau_star", "IMF"]
+			for elem in self.elements:
+				names += ["ccsne(%s)" % (elem), "sneia(%s)" % (elem),
+					"agb(%s)" % (elem)]
+			for i in range(len(names)):
+				callbacks[names[i]] = callbacks.get(names[i], 0) + counts[i]
+			self._sz[0].ism[0].functional_tau_star[0].calls = NULL
+			self._sz[0].ssp[0].imf[0].custom_imf[0].calls = NULL
+			for i in range(self._sz[0].n_elements):
+				self._sz[0].elements[i][0].ccsne_yields[0].yield_[0].calls = NULL
+				self._sz[0].elements[i][0].sneia_yields[0].yield_[0].calls = NULL
+				self._sz[0].elements[i][0].agb_grid[0].custom_yield[0].calls = (
+					NULL)
+			free(self._callback_calls)
+			self._callback_calls = NULL
+		else: pass
+		self._profile = None
+		return dict([(key, value) for key, value in callbacks.items() if
+			value > 0])
+
+
+	def checkpoint_setup(self, checkpoint):
+		"""
+		Sets the time interval between checkpoints of the simulation state.
+
+		Parameters
+		==========
+		checkpoint :: real number or None
+			The user's checkpoint specification. None disables checkpoints.
+
+		Raises
+		======
+		TypeError ::
+			:: checkpoint is neither None nor a real number
+		ValueError ::
+			:: checkpoint is not positive
+		"""
+		if checkpoint is None:
+			self._sz[0].checkpoint_interval = 0
+		elif isinstance(checkpoint, numbers.Number):
+			if checkpoint > 0:
+				self._sz[0].checkpoint_interval = checkpoint
+			else:
+				raise ValueError("""Checkpoint interval must be positive. \
+Got: %g""" % (checkpoint))
+		else:
+			raise TypeError("""Checkpoint interval must be a real number or \
+None. Got: %s""" % (type(checkpoint)))
+
+
+	def adaptive_setup(self, adaptive):
+		"""
+		Sets the relative error tolerance of adaptive timestepping.
+
+		Parameters
+		==========
+		adaptive :: real number or None
+			The user's tolerance specification. None disables adaptive
+			timestepping.
+
+		Raises
+		======
+		TypeError ::
+			:: adaptive is neither None nor a real number
+		ValueError ::
+			:: adaptive is not positive
+		"""
+		if adaptive is None:
+			self._sz[0].tolerance = 0
+		elif isinstance(adaptive, numbers.Number):
+			if adaptive > 0:
+				self._sz[0].tolerance = adaptive
+			else:
+				raise ValueError("""Adaptive timestepping tolerance must be \
+positive. Got: %g""" % (adaptive))
+		else:
+			raise TypeError("""Adaptive timestepping tolerance must be a real \
+number or None. Got: %s""" % (type(adaptive)))
+
+
+	def age_binning_setup(self, age_binning):
+		"""
+		Sets the age beyond which stellar populations are binned.
+
+		Parameters
+		==========
+		age_binning :: real number or None
+			The user's threshold age specification in Gyr. None disables age
+			binning.
+
+		Raises
+		======
+		TypeError ::
+			:: age_binning is neither None nor a real number
+		ValueError ::
+			:: age_binning is not positive
+		"""
+		if age_binning is None:
+			self._sz[0].age_binning = 0
+		elif isinstance(age_binning, numbers.Number):
+			if age_binning > 0:
+				self._sz[0].age_binning = age_binning
+			else:
+				raise ValueError("""Age binning threshold must be positive. \
+Got: %g""" % (age_binning))
+		else:
+			raise TypeError("""Age binning threshold must be a real number or \
+None. Got: %s""" % (type(age_binning)))
+
+
+	def response_setup(self, response, resume):
+		"""
+		Sets whether or not the linear response of each element's mass to its
+		yields is recorded.
+
+		Parameters
+		==========
+		response :: bool
+			The user's specification
+		resume :: bool
+			Whether or not the simulation is resuming from a checkpoint or
+			being extended
+
+		Raises
+		======
+		ValueError ::
+			:: response is True and the simulation is resuming, being
+				extended, or running with adaptive timestepping or age binning
+			:: response is True and the CCSN or SN Ia yields of any element
+				are callable
+		"""
+		self._sz[0].linear_response = 0
+		if response:
+			if resume:
+				raise ValueError("""The linear response can only be recorded \
+from the beginning of a simulation.""")
+			elif self._sz[0].tolerance > 0:
+				raise ValueError("""The linear response cannot be recorded \
+with adaptive timestepping.""")
+			elif self._sz[0].age_binning > 0:
+				raise ValueError("""The linear response cannot be recorded \
+with age binning.""")
+			else:
+				for i in self.elements:
+					if (callable(ccsne.settings[i]) or
+						callable(sneia.settings[i])):
+						raise ValueError("""The linear response requires CCSN \
+and SN Ia yields which do not depend on metallicity. Got a function for \
+element: %s""" % (i))
+					else:
+						continue
+				self._sz[0].linear_response = 1
+		else:
+			pass
+
+
+	def sensitivities_setup(self, sensitivities, resume):
+		"""
+		Sets the parameters which the derivatives of the ISM mass and the
+		mass of each element are taken with respect to, if any.
+
+		Parameters
+		==========
+		sensitivities :: list or None
+			The user's specification: the strings "eta", "tau_star",
+			"tau_ia", "ccsne(x)", and "sneia(x)", with x the symbol of an
+			element
+		resume :: bool
+			Whether or not the simulation is resuming from a checkpoint or
+			being extended
+
+		Raises
+		======
+		TypeError ::
+			:: sensitivities is neither None nor an array-like object of
+				strings
+		ValueError ::
+			:: sensitivities is not None and the simulation is resuming,
+				being extended, or running with adaptive timestepping or age
+				binning
+			:: sensitivities is not None and the CCSN or SN Ia yields of any
+				element are callable
+			:: A parameter is not recognized or is not a real number in the
+				current settings
+		"""
+		_sensitivity.sensitivity_free(self._sz[0].sensitivity)
+		self._sz[0].sensitivity = NULL
+		if sensitivities is None: return
+		if not isinstance(sensitivities, list) and not isinstance(
+			sensitivities, tuple):
+			raise TypeError("""Keyword arg 'sensitivities' must be an \
+array-like object of strings or None. Got: %s""" % (type(sensitivities)))
+		elif resume:
+			raise ValueError("""Sensitivities can only be computed from the \
+beginning of a simulation.""")
+		elif self._sz[0].tolerance > 0:
+			raise ValueError("""Sensitivities cannot be computed with \
+adaptive timestepping.""")
+		elif self._sz[0].age_binning > 0:
+			raise ValueError("""Sensitivities cannot be computed with age \
+binning.""")
+		else:
+			for i in self.elements:
+				if callable(ccsne.settings[i]) or callable(sneia.settings[i]):
+					raise ValueError("""Sensitivities require CCSN and SN Ia \
+yields which do not depend on metallicity. Got a function for element: \
+%s""" % (i))
+				else:
+					continue
+
+		# The parameter and element index of each derivative
+		params = []
+		for i in sensitivities:
+			if not isinstance(i, strcomp):
+				raise TypeError("""Sensitivity parameter must be of type \
+str. Got: %s""" % (type(i)))
+			else:
+				params.append(self.__sensitivity_parameter(i.lower()))
+		self._sz[0].sensitivity = _sensitivity.sensitivity_initialize(
+			len(params))
+		for i in range(len(params)):
+			self._sz[0].sensitivity[0].params[i] = params[i][0]
+			self._sz[0].sensitivity[0].elements[i] = params[i][1]
+
+
+	def analytic_setup(self, analytic, output_times):
+		"""
+		Sets whether or not the ISM mass and the mass of each element are
+		evaluated from their closed-form solutions in place of the integrator.
+		This must be called after all other settings are prepared.
+
+		Parameters
+		==========
+		analytic :: bool
+			The user's specification. If True, the closed-form solutions are
+			adopted only when the current settings admit them.
+		output_times :: list
+			The output times of the simulation, as returned by prep
+
+		Notes
+		=====
+		The closed-form solutions require infall mode with a constant or
+		exponential infall rate, a constant mass loading factor, star
+		formation efficiency timescale, and outflow enhancement with no
+		outflow smoothing, instantaneous recycling, an exponential SN Ia
+		delay-time distribution, constant inflow metallicities, CCSN and SN Ia
+		yields which do not depend on metallicity, and no AGB star yields.
+		Adaptive timestepping, age binning, the linear response, and
+		sensitivities all fall back to the integrator.
+		"""
+		self._sz[0].analytic = 0
+		if not analytic: return
+		if (self._sz[0].tolerance > 0 or self._sz[0].age_binning > 0 or
+			self._sz[0].linear_response or
+			self._sz[0].sensitivity is not NULL): return
+		if self.mode != "ifr" or self.schmidt: return
+		for i in [self._tau_star, self._eta, self._enhancement]:
+			if not isinstance(i, numbers.Number): return
+		if not 0 < self._tau_star < float("inf"): return
+		if self.smoothing >= self.dt: return
+		if not isinstance(self.recycling, numbers.Number): return
+		if not isinstance(self._ria, strcomp) or self._ria.lower() != "exp":
+			return
+		if isinstance(self._zin, evolutionary_settings):
+			if not all([isinstance(self._zin[i], numbers.Number) for i in
+				self.elements]): return
+		elif not isinstance(self._zin, numbers.Number):
+			return
+		for i in self.elements:
+			if not isinstance(ccsne.settings[i], numbers.Number): return
+			if not isinstance(sneia.settings[i], numbers.Number): return
+			if not self.__zero_agb_yields(agb.settings[i]): return
+		if self.__exponential_infall(output_times[-1]):
+			self._sz[0].analytic = 1
+
+
+	def __zero_agb_yields(self, setting):
+		"""
+		Determine whether or not an AGB star yield setting is zero at all
+		masses and metallicities, sampling a function on a coarse grid.
+
+		Parameters
+		==========
+		setting :: str or callable
+			The AGB star yield setting of an element
+
+		Returns
+		=======
+		True if the setting is a function which is zero at each sampled mass
+		and metallicity, False otherwise. Built-in tables are never zero.
+		"""
+		if not callable(setting): return False
+		try:
+			return all([setting(mass, z) == 0 for mass in [1, 2, 3, 4, 6, 8]
+				for z in [0, 0.001, 0.01, 0.02, 0.05]])
+		except:
+			return False
+
+
+	def __exponential_infall(self, endtime):
+		"""
+		Determine whether or not the infall rate, already mapped across the
+		timesteps of the simulation, is constant or exponential in time.
+
+		Parameters
+		==========
+		endtime :: real number
+			The final output time of the simulation in Gyr
+
+		Returns
+		=======
+		True if every timestep agrees with the exponential through the first
+		two to a relative precision of 1e-8 (or if the infall rate is zero
+		throughout), False otherwise.
+		"""
+		cdef unsigned long i, n = <unsigned long> (endtime / self.dt) + 1
+		cdef double *infall = self._sz[0].ism[0].specified
+		cdef double expected
+		if n < 2: return False
+		if infall[0] == 0:
+			for i in range(n):
+				if infall[i] != 0: return False
+			return True
+		elif infall[1] <= 0:
+			return False
+		else:
+			for i in range(n):
+				expected = infall[0] * (infall[1] / infall[0])**i
+				if abs(infall[i] - expected) > 1e-8 * expected: return False
+			return True
+
+
+	def __sensitivity_parameter(self, name):
+		"""
+		Obtain the C-level identifier of a parameter which the derivatives can
+		be taken with respect to.
+
+		Parameters
+		==========
+		name :: str
+			The name of the parameter in lower-case
+
+		Returns
+		=======
+		A tuple of the SENSITIVITY_* value and the index of the element, the
+		latter being zero for parameters other than the yields
+
+		Raises
+		======
+		ValueError ::
+			:: The parameter is not recognized
+			:: The parameter is not a real number in the current settings
+		"""
+		if name == "eta":
+			if not isinstance(self.eta, numbers.Number): raise ValueError(
+				"Sensitivity to eta requires a constant mass-loading factor.")
+			return (_sensitivity.SENSITIVITY_ETA, 0)
+		elif name == "tau_star":
+			if not isinstance(self.tau_star, numbers.Number): raise ValueError(
+				"""Sensitivity to tau_star requires a constant star formation \
+efficiency timescale.""")
+			return (_sensitivity.SENSITIVITY_TAU_STAR, 0)
+		elif name == "tau_ia":
+			if self.RIa != "exp": raise ValueError("""Sensitivity to tau_ia \
+requires an exponential SN Ia delay-time distribution.""")
+			return (_sensitivity.SENSITIVITY_TAU_IA, 0)
+		else:
+			for channel, value in zip(["ccsne", "sneia"],
+				[_sensitivity.SENSITIVITY_CCSNE,
+				_sensitivity.SENSITIVITY_SNEIA]):
+				if name.startswith("%s(" % (channel)) and name.endswith(")"):
+					symbol = name[len(channel) + 1:-1]
+					if symbol in self.elements:
+						return (value, self.elements.index(symbol))
+					else:
+						raise ValueError("""Element not tracked by the \
+simulation: %s""" % (symbol))
+				else:
+					continue
+			raise ValueError("Unrecognized sensitivity parameter: %s" % (name))
+
+
 	def prep(self, output_times):
 		"""
 		Prepares the simulation to be ran based on the current settings.
@@ -1406,11 +1988,13 @@ to negative value for at least one timestep.""" % (name))
 			"""
 			if callable(attr):
 				arr = list(map(attr, evaltimes))
+				self.profile_count(name, len(arr))
 				_pyutils.numeric_check(arr, ArithmeticError, """Functional \
 attribute '%s' evaluated to non-numerical value for at least one \
 timestep.""" % (name))
 			else:
-				arr = len(evaltimes) * [attr]
+				# constants need only be checked once
+				arr = [attr]
 			if allow_inf:
 				# only check for NaNs, allowing infs to slip through
 				if any(list(map(m.isnan, arr))):
@@ -1421,7 +2005,7 @@ evaluated to NaN for at least one timestep.""" % (name))
 				_pyutils.inf_nan_check(arr, ArithmeticError, """Functional \
 attribute '%s' evaluated to inf or NaN for at least one timestep.""" % (name))
 				negative_checker(arr, name)
-			return arr
+			return arr if callable(attr) else len(evaltimes) * arr
 
 		# map attributes across time
 		self._sz[0].ism[0].eta = copy_pylist(mapper(self._eta, "eta"))
@@ -1437,7 +2021,14 @@ attribute '%s' evaluated to inf or NaN for at least one timestep.""" % (name))
 			self._sz[0].ism[0].tau_star = copy_pylist(mapper(
 				self._tau_star, "tau_star",
 				allow_inf = self.mode in ["ifr", "gas"]))
-		if self.mode == "gas":
+		if self.milkyway_default_evolution():
+			# evaluated in C, without calling python at each timestep
+			self._sz[0].ism[0].specified = (
+				_milkyway.milkyway_default_specified(self._func.radius,
+					self._func.area, 1 if self.mode == "gas" else 1.e9,
+					self.dt, len(evaltimes))
+			)
+		elif self.mode == "gas":
 			self._sz[0].ism[0].specified = copy_pylist(mapper(
 				self._func, "func"))
 		else:
@@ -1651,6 +2242,25 @@ timestepping.""", VisibleRuntimeWarning)
 					agbfile.encode("latin-1"))
 
 
+	def milkyway_default_evolution(self):
+		"""
+		Determines whether or not the attribute func is the default
+		evolutionary function of a zone in a milkyway model, which can be
+		evaluated in C rather than through python at each timestep.
+
+		Returns
+		=======
+		True if func is a mass_from_surface_density object wrapping
+		vice.milkyway.default_evolution, False otherwise.
+		"""
+		# imported here, as vice.milkyway itself depends on this module
+		from ...milkyway.milkyway import milkyway
+		from ...milkyway.utils import mass_from_surface_density
+		return (isinstance(self._func, mass_from_surface_density) and
+			type(self._func).__call__ is mass_from_surface_density.__call__ and
+			self._func.surface_density is milkyway.default_evolution)
+
+
 	def set_ria(self):
 		"""
 		Maps a custom SNe Ia DTD across the evalutation times of the
@@ -1670,6 +2280,7 @@ timestepping.""", VisibleRuntimeWarning)
 			# Take into account the intrinsic delay
 			if times[i] >= self.delay:
 				ria[i] = self._ria(times[i])
+				self.profile_count("RIa", 1)
 			else:
 				continue
 
@@ -1708,6 +2319,7 @@ negative, NaN, or inf for at least one timestep.""")
 			_pyutils.args(func, """Infall metallicity, when callable, must \
 accept only one numerical parameter.""")
 			arr = list(map(func, evaltimes))
+			self.profile_count("Zin", len(arr))
 			_pyutils.numeric_check(arr, ArithmeticError, """Infall \
 metallicity evaluated to non-numerical value for at least one timestep.""")
 			_pyutils.inf_nan_check(arr, ArithmeticError, """Infall \
@@ -1844,28 +2456,18 @@ timestepping.""" % (names[mlr.setting])
 
 
 	def import_mlr_data(self):
-		# import the mass-lifetime relation data on this extension
-		if mlr.setting in ["vincenzo2016", "hpt2000", "ka1997"]:
-			func = {
-				"vincenzo2016": _mlr.vincenzo2016_import,
-				"hpt2000": _mlr.hpt2000_import,
-				"ka1997": _mlr.ka1997_import
-			}[mlr.setting]
-			path = "%ssrc/ssp/mlr/%s.dat" % (_DIRECTORY_, mlr.setting)
-			func(path.encode("latin-1"))
+		# take the current mass-lifetime relation setting into this
+		# simulation's context along with any data it requires
+		path = "%ssrc/ssp/mlr/%s.dat" % (_DIRECTORY_, mlr.setting)
+		if (_mlr.set_mlr_hashcode(self._sz[0].ctx,
+				_mlr._mlr_linker.__NAMES__[mlr.setting]) or
+			_mlr.import_mlr_data(self._sz[0].ctx, path.encode("latin-1"))):
+			raise SystemError("Internal Error")
 		else: pass
 
-
 	def free_mlr_data(self):
-		# frees the mass-lifetime relation data on this extension
-		if mlr.setting in ["vincenzo2016", "hpt2000", "ka1997"]:
-			func = {
-				"vincenzo2016": _mlr.vincenzo2016_free,
-				"hpt2000": _mlr.hpt2000_free,
-				"ka1997": _mlr.ka1997_free
-			}[mlr.setting]
-			func()
-		else: pass
+		# frees the mass-lifetime relation data in this simulation's context
+		_mlr.free_mlr_data(self._sz[0].ctx)
 
 
 	def pickle(self):
@@ -1912,6 +2514,7 @@ timestepping.""" % (names[mlr.setting])
 			"bins": 				self.bins,
 			"delay": 				self.delay,
 			"dt": 					self.dt,
+			"integrator": 			self.integrator,
 			"RIa": 					self.RIa,
 			"elements": 			self.elements,
 			"enhancement": 			self.enhancement,
@@ -8,6 +8,7 @@ from ..outputs._output_utils import _get_name
 from ..outputs import multioutput
 from ..outputs import output
 from .. import pickles
+from .. import _futures
 import warnings
 import sys
 if sys.version_info[:2] == (2, 7):
@@ -129,6 +130,12 @@ class singlezone:
 
 	dt : real number [default : 0.01]
 		The timestep size in Gyr.
+	integrator : ``str`` [case-insensitive] [default : "euler"]
+		The method by which the ISM mass and the mass of each element are
+		moved forward in time. Either "euler" or "exponential".
+
+		.. versionadded:: 1.3.0
+
 	schmidt : ``bool`` [default : False]
 		A boolean describing whether or not to implement a gas-dependent star
 		formation efficiency. Overridden when the attribute ``tau_star`` is a
@@ -169,10 +176,19 @@ class singlezone:
 			``vice.yields.agb.settings``. Users may specify either a built-in
 			study or a function of stellar mass and metallicity.
 
+	age_binning_error : real number [read-only]
+		The upper bound on the relative error in the enrichment rates
+		introduced by age binning over the most recent run of the simulation.
+		See function ``run``.
+
+		.. versionadded:: 1.3.0
+
 	Functions
 	---------
 	run : [instancemethod]
 		Run the simulation.
+	run_async : [instancemethod]
+		Run the simulation on a background thread.
 	from_output : [classmethod]
 		Obtain a ``singlezone`` object with the parameters of the one
 		that produced an output.
@@ -183,7 +199,8 @@ class singlezone:
 	Notes
 	-----
 	**Implementation** :raw-html:`<br />`
-	VICE uses a forward Euler approach to handle its timestepping. Although
+	VICE uses a forward Euler approach to handle its timestepping by default
+	(see attribute ``integrator`` for an alternative). Although
 	this isn't the highest numerical resolution timestepping method, the
 	dominant source of error in VICE is not in the numerics but in the
 	approximations built into the model itself. Solutions in which the
@@ -237,6 +254,7 @@ class singlezone:
 			schmidt_index --> 0.5
 			MgSchmidt ------> 6000000000.0
 			dt -------------> 0.01
+			integrator -----> euler
 			m_upper --------> 100.0
 			m_lower --------> 0.08
 			postMS ---------> 0.1
@@ -286,6 +304,7 @@ class singlezone:
 			"schmidt_index": 	self.schmidt_index,
 			"MgSchmidt": 		self.MgSchmidt,
 			"dt": 				self.dt,
+			"integrator": 		self.integrator,
 			"m_upper": 			self.m_upper,
 			"m_lower": 			self.m_lower,
 			"postMS": 			self.postMS,
@@ -435,6 +454,7 @@ class singlezone:
 				schmidt_index --> 0.5
 				MgSchmidt ------> 6000000000.0
 				dt -------------> 0.01
+				integrator -----> euler
 				m_upper --------> 100.0
 				m_lower --------> 0.08
 				postMS ---------> 0.1
@@ -1386,6 +1406,59 @@ ran.""" % (i, j), UserWarning)
 	def dt(self, value):
 		self.__c_version.dt = value
 
+	@property
+	def integrator(self):
+		r"""
+		Type : ``str`` [case-insensitive]
+
+		Default : "euler"
+
+		.. versionadded:: 1.3.0
+
+		The method by which the mass of the interstellar medium (ISM) and of
+		each element are moved forward in time.
+
+		Recognized Keywords:
+
+			- "euler"
+				Forward Euler updates of the form
+				:math:`M(t + \Delta t) = M(t) + \dot{M}(t)\Delta t`.
+
+			- "exponential"
+				Depletion by star formation and outflows is integrated
+				exactly over each timestep, holding the depletion rate
+				:math:`\lambda = (\dot{M}_\star + \dot{M}_\text{out})/M_g`
+				and the sources (infall, nucleosynthesis, and recycling)
+				fixed:
+
+				.. math:: M(t + \Delta t) = M(t)e^{-\lambda\Delta t} +
+					S\Delta t\frac{1 - e^{-\lambda\Delta t}}{\lambda\Delta t}
+
+				where :math:`S` is the rate at which mass is added to the
+				reservoir. For :math:`\lambda\Delta t \ll 1` this reduces to
+				forward Euler, but it remains accurate when the depletion time
+				is short compared to the timestep, such as with a short
+				``tau_star`` or a large ``eta``.
+
+		.. note:: In multizone models, each zone may adopt either integrator,
+			though a ``ScienceWarning`` is raised if they differ.
+
+		.. note:: When ``mode == "gas"`` or ``"sfr"``, the ISM mass is not
+			integrated, and this only affects the mass of each element.
+
+		Example Code
+		------------
+		>>> import vice
+		>>> sz = vice.singlezone(name = "example")
+		>>> sz.integrator = "exponential"
+		>>> sz.dt = 0.02
+		"""
+		return self.__c_version.integrator
+
+	@integrator.setter
+	def integrator(self, value):
+		self.__c_version.integrator = value
+
 	@property
 	def schmidt(self):
 		r"""
@@ -1685,11 +1758,49 @@ ran.""" % (i, j), UserWarning)
 	def agb_model(self, value):
 		self.__c_version.agb_model = value
 
-	def run(self, output_times, capture = False, overwrite = False):
+	@property
+	def age_binning_error(self):
+		r"""
+		Type : real number [read-only]
+
+		The upper bound on the relative error in the enrichment rates from
+		type Ia supernovae, AGB stars, and recycling introduced by age binning
+		over the most recent run of the simulation. Zero if the simulation was
+		ran without age binning (see function ``run``).
+
+		.. versionadded:: 1.3.0
+
+		.. note::
+
+			The bound assumes that the SN Ia delay-time distribution and the
+			rates of mass loss and stellar death vary monotonically across
+			each bin, which holds at the ages binned in practice. It does not
+			account for the variation of the metallicity across each bin. If
+			the simulation was resumed from a checkpoint, it includes only
+			the timesteps computed since.
+
+		Example Code
+		------------
+		>>> import numpy as np
+		>>> import vice
+		>>> sz = vice.singlezone(name = "example", dt = 0.001)
+		>>> sz.run(np.linspace(0, 10, 1001), age_binning = 1)
+		>>> sz.age_binning_error
+		0.00017994082079009
+		"""
+		return self.__c_version.age_binning_error
+
+	def run(self, output_times, capture = False, overwrite = False,
+		checkpoint = None, resume = False, adaptive = None,
+		age_binning = None, response = False, sensitivities = None,
+		analytic = True, profile = False):
 		r"""
 		Run the simulation.
 
-		**Signature**: x.run(output_times, capture = False, overwrite = False)
+		**Signature**: x.run(output_times, capture = False, overwrite = False,
+		checkpoint = None, resume = False, adaptive = None,
+		age_binning = None, response = False, sensitivities = None,
+		analytic = True, profile = False)
 
 		Parameters
 		----------
@@ -1704,21 +1815,115 @@ ran.""" % (i, j), UserWarning)
 		overwrite : ``bool`` [default : False]
 			If ``True``, will force overwrite any files with the same name as
 			the simulation output files.
+		checkpoint : real number [default : None]
+			The time interval in Gyr at which VICE will save the state of the
+			simulation to the output directory, allowing it to be resumed if
+			interrupted. ``None`` disables checkpoints.
+
+			.. versionadded:: 1.3.0
+
+		resume : ``bool`` [default : False]
+			If ``True`` and the output directory contains a checkpoint, the
+			simulation will pick up where the checkpoint left off rather than
+			starting over. If no checkpoint is found, the simulation runs from
+			the beginning as usual.
+
+			.. versionadded:: 1.3.0
+
+		adaptive : real number [default : None]
+			The relative error tolerance in the ISM mass and the abundance of
+			each element per step of adaptive timestepping. ``None`` runs the
+			simulation with a fixed timestep of size ``dt``. See note below.
+
+			.. versionadded:: 1.3.0
+
+		age_binning : real number [default : None]
+			The age in Gyr beyond which stellar populations are merged into
+			bins of growing width in the enrichment from type Ia supernovae,
+			AGB stars, and recycling. ``None`` treats stellar populations of
+			all ages at full resolution. See note below.
+
+			.. versionadded:: 1.3.0
+
+		response : ``bool`` [default : False]
+			If ``True``, VICE will also record the linear response of the
+			mass of each element to its yields, allowing the simulation to be
+			re-evaluated for new yields with ``vice.response``. See note
+			below.
+
+			.. versionadded:: 1.3.0
+
+		sensitivities : array-like [elements of type ``str``] [default : None]
+			The parameters which VICE will also compute the derivatives of the
+			ISM mass and the mass of each element with respect to, allowing
+			the Jacobian to be read with ``vice.sensitivities``. Recognized
+			parameters are "eta", "tau_star", "tau_ia", "ccsne(x)", and
+			"sneia(x)", where x is the symbol of a tracked element. ``None``
+			computes no derivatives. See note below.
+
+			.. versionadded:: 1.3.0
+
+		analytic : ``bool`` [default : True]
+			If ``True``, VICE will evaluate the ISM mass and the mass of each
+			element from their closed-form solutions whenever the current
+			settings admit them. ``False`` always runs the numerical
+			integrator. See note below.
+
+			.. versionadded:: 1.3.0
+
+		profile : ``bool`` [default : False]
+			If ``True``, VICE will time each phase of the simulation and
+			count the number of times each functional attribute is evaluated,
+			returning the results. See note below.
+
+			.. versionadded:: 1.3.0
 
 		Returns
 		-------
 		out : ``output`` [only returned if ``capture == True``]
 			An ``output`` object produced from this simulation's output.
+		profile : ``dict`` [only returned if ``profile == True``]
+			The wall-clock time in seconds of the entire call under the key
+			"total", the time spent in and number of entries into each phase
+			of the simulation under "phases", and the number of evaluations
+			of each functional attribute under "callbacks". If both
+			``capture`` and ``profile`` are ``True``, the output and the
+			profile are returned as a tuple, in that order.
 
 		Raises
 		------
 		* TypeError
 			- 	Any functional attribute evaluates to a non-numerical value.
+			- 	``checkpoint`` is neither ``None`` nor a real number.
+			- 	``adaptive`` is neither ``None`` nor a real number.
+			- 	``age_binning`` is neither ``None`` nor a real number.
+			- 	``sensitivities`` is neither ``None`` nor an array-like
+				object of strings.
 		* ValueError
 			- 	Any element of output_times is negative.
 			- 	An inflow metallicity evaluates to a negative value.
+			- 	``checkpoint`` is not positive.
+			- 	``adaptive`` is not positive.
+			- 	``age_binning`` is not positive.
+			- 	``response == True`` and the simulation is resuming from a
+				checkpoint or running with adaptive timestepping or age
+				binning.
+			- 	``response == True`` and the core collapse or type Ia
+				supernova yields of any element are callable.
+			- 	``sensitivities`` is not ``None`` under any of the above
+				conditions for ``response``.
+			- 	``sensitivities`` includes an unrecognized parameter, or one
+				which is not a real number in the current settings (e.g.
+				"eta" with a functional ``eta``, or "tau_ia" with a
+				delay-time distribution other than "exp").
 		* ArithmeticError
 			- 	Any functional attribute evaluates to NaN or inf.
+		* IOError
+			- 	``resume == True`` and the checkpoint could not be read.
+		* RuntimeError
+			- 	``resume == True`` and the checkpoint was written by a
+				simulation with a different number of elements, timestep size,
+				MDF bins, or final output time.
 		* UserWarning
 			- 	Any yield settings or class attributes are callable and the
 				user does not have dill_ installed.
@@ -1735,6 +1940,8 @@ ran.""" % (i, j), UserWarning)
 			- 	The model is running with a mass-lifetime relation which
 				requires numerical solutions to the inverse function (i.e.
 				mass as a function of lifetime).
+			- 	A checkpoint could not be written. The simulation still runs
+				to completion in this case.
 
 		Notes
 		-----
@@ -1767,6 +1974,111 @@ ran.""" % (i, j), UserWarning)
 			simulation. This may be one timestep beyond the last element of
 			the specified ``output_times`` array.
 
+		.. note::
+
+			Checkpoints are written to the file ``checkpoint.bin`` in the
+			output directory. A resumed simulation produces the same output as
+			one which ran uninterrupted, provided that it is ran with the same
+			parameters and output times. Checkpoints are stored in the
+			machine's native binary format and are not portable between
+			machines.
+
+		.. note::
+
+			Regardless of the ``checkpoint`` keyword argument, VICE always
+			saves the state of the simulation at the final timestep to the
+			``checkpoint.bin`` file, allowing it to be continued to later
+			times with ``extend``.
+
+		.. note::
+
+			With adaptive timestepping, the attribute ``dt`` is the smallest
+			step the simulation will take. Each step spans a whole number of
+			timesteps of size ``dt``, up to 128 of them, and its size is
+			chosen by step doubling: the simulation compares a single step
+			with two steps of half the size, halving the step size until the
+			two agree to within the tolerance and doubling it again once they
+			agree closely. The star formation history and the abundances at
+			the timesteps within each step are linearly interpolated, as is
+			the output at any output times falling within them. Models with
+			long quiescent periods (e.g. those with starbursts) therefore
+			take many fewer steps, while features in the evolutionary
+			parameters which are shorter than a single step may be smoothed
+			over. Multizone models always run with a fixed timestep.
+
+		.. note::
+
+			With age binning, the star formation history older than the
+			threshold age is merged into bins whose width is at most their
+			age times ``dt`` divided by the threshold age, and each bin
+			enriches the ISM through the average of the SN Ia delay-time
+			distribution and the rates of mass loss and stellar death over
+			the ages it spans. The cost of each timestep then grows with the
+			logarithm of the number of previous timesteps rather than the
+			number itself, which speeds up long simulations with small
+			timesteps. The resulting upper bound on the relative error in
+			these enrichment rates is stored in the attribute
+			``age_binning_error``. With adaptive timestepping, the threshold
+			age is at least 64 timesteps. Multizone models always treat
+			stellar populations at full resolution.
+
+		.. note::
+
+			With ``response = True``, VICE evolves a copy of each element
+			for each enrichment channel alongside it: one with a core
+			collapse supernova yield of 1, one with a type Ia supernova yield
+			of 1, one with only its AGB star yields, and one with every yield
+			set to zero. Their masses are written to the file
+			``response.out`` in the output directory. When the yields do not
+			depend on metallicity, the mass of each element is a weighted sum
+			of these for any yields, which ``vice.response`` evaluates
+			without running the simulation again. The cost of each timestep
+			is roughly that of a simulation with five times as many elements.
+
+		.. note::
+
+			With ``sensitivities``, VICE carries the derivative of the ISM
+			mass and the mass of each element with respect to each parameter
+			forward alongside the integration, differentiating each update
+			in exactly the form that it is taken. These are written to the
+			file ``sensitivities.out`` in the output directory, giving the
+			full Jacobian from a single simulation in place of one with each
+			parameter perturbed in either direction. The dependence of the
+			AGB star yields and the stellar lifetimes on metallicity is not
+			differentiated. The cost of each timestep is roughly that of a
+			simulation with one more set of elements per parameter.
+
+		.. note::
+
+			When the simulation runs in infall mode with a constant or
+			exponential infall rate, constant ``eta``, ``tau_star``,
+			``enhancement``, and ``Zin``, no outflow smoothing or
+			star formation law, instantaneous recycling, an exponential SN Ia
+			delay-time distribution, CCSN and SN Ia yields which do not
+			depend on metallicity, and AGB star yields of zero, the ISM mass
+			and the mass of each element have closed-form solutions (see
+			VICE's science documentation). With ``analytic = True``, VICE
+			detects this case and evaluates them directly at each timestep
+			rather than integrating, such that the results carry no
+			numerical error from the timestep size. Adaptive timestepping,
+			age binning, ``response``, and ``sensitivities`` all run the
+			numerical integrator.
+
+		.. note::
+
+			With ``profile = True``, the entry "phases" maps the name of
+			each phase of the simulation (e.g. "gas", "enrichment", "MDF",
+			"write_history", "checkpoint") to a dictionary of the time spent
+			in it in seconds under "seconds" and the number of times it was
+			entered under "calls". Only phases entered at least once are
+			included, and "prep" is the time spent setting up the simulation
+			in python. The entry "callbacks" maps the name of each functional
+			attribute (e.g. "func", "eta", "tau_star", "Zin") to the number
+			of times it was evaluated, with nucleosynthetic yields keyed by
+			"ccsne(x)", "sneia(x)", and "agb(x)" for each element x.
+			Attributes which VICE evaluates without calling python are not
+			counted. The timers add negligible overhead to the simulation.
+
 		Example Code
 		------------
 		>>> import numpy as np
@@ -1774,7 +2086,166 @@ ran.""" % (i, j), UserWarning)
 		>>> sz = vice.singlezone(name = "example")
 		>>> outtimes = np.linspace(0, 10, 1001)
 		>>> sz.run(outtimes)
+		>>> sz.run(outtimes, overwrite = True, checkpoint = 1)
+		>>> # ... if interrupted, pick up from the most recent checkpoint
+		>>> sz.run(outtimes, checkpoint = 1, resume = True)
+		>>> # ... or with adaptive timestepping
+		>>> sz.run(outtimes, overwrite = True, adaptive = 1.e-3)
+		>>> # ... or binning stellar populations older than 1 Gyr
+		>>> sz.run(outtimes, overwrite = True, age_binning = 1)
+		>>> # ... or recording the response of each element to its yields
+		>>> sz.run(outtimes, overwrite = True, response = True)
+		>>> # ... or computing derivatives with respect to eta and tau_star
+		>>> sz.run(outtimes, overwrite = True, sensitivities = ["eta",
+		... 	"tau_star"])
+		>>> # ... or forcing the numerical integrator
+		>>> sz.run(outtimes, overwrite = True, analytic = False)
+		>>> # ... or timing each phase of the simulation
+		>>> sz.run(outtimes, overwrite = True, profile = True)["phases"]["gas"]
+		{'seconds': 0.0021, 'calls': 1000}
+		"""
+		return self.__c_version.run(output_times, capture = capture,
+			overwrite = overwrite, checkpoint = checkpoint, resume = resume,
+			adaptive = adaptive, age_binning = age_binning,
+			response = response, sensitivities = sensitivities,
+			analytic = analytic, profile = profile)
+
+	def run_async(self, output_times, capture = False, overwrite = False,
+		checkpoint = None, resume = False, adaptive = None,
+		age_binning = None, response = False, sensitivities = None,
+		analytic = True, profile = False):
+		r"""
+		Run the simulation on a background thread.
+
+		**Signature**: x.run_async(output_times, capture = False,
+		overwrite = False, checkpoint = None, resume = False, adaptive = None,
+		age_binning = None, response = False, sensitivities = None,
+		analytic = True, profile = False)
+
+		.. versionadded:: 1.3.0
+
+		Parameters
+		----------
+		x : ``singlezone``
+			An instance of this class.
+		output_times : array-like [elements are real numbers]
+			The times in Gyr at which VICE should record output from the
+			simulation. See ``run``.
+
+		All keyword arguments are passed along to ``run``.
+
+		Returns
+		-------
+		future : ``concurrent.futures.Future``
+			A future which holds the return value of ``run`` once the
+			simulation has finished. Its ``progress`` attribute gives the
+			fraction of the integration which has been completed so far.
+
+		Notes
+		-----
+		Exceptions raised by ``run`` are set as the exception of the returned
+		future, and are therefore raised by its ``result`` function.
+
+		VICE releases python's global interpreter lock while integrating
+		simulations, reacquiring it only to evaluate user-defined functions.
+		The calling thread is therefore free to proceed, and several
+		simulations may run concurrently in one python process. Those with
+		functional attributes will still take turns evaluating them.
+
+		.. note::
+
+			When ``overwrite == False`` and there are files under the same
+			name as the output produced, the background thread will wait for
+			the user's approval to overwrite them. Asynchronous runs should
+			therefore specify ``overwrite = True`` in most cases.
+
+		.. note::
+
+			The attributes of this object should not be modified until the
+			simulation has finished.
+
+		Example Code
+		------------
+		>>> import numpy as np
+		>>> import vice
+		>>> sz = vice.singlezone(name = "example")
+		>>> future = sz.run_async(np.linspace(0, 10, 1001), overwrite = True)
+		>>> future.progress
+		0.3427
+		>>> future.result() # waits for the simulation to finish
+		"""
+		return _futures.submit(self.run, self.__c_version, output_times,
+			capture = capture, overwrite = overwrite, checkpoint = checkpoint,
+			resume = resume, adaptive = adaptive, age_binning = age_binning,
+			response = response, sensitivities = sensitivities,
+			analytic = analytic, profile = profile)
+
+	def extend(self, output_times, capture = False, checkpoint = None,
+		adaptive = None, age_binning = None):
+		r"""
+		Continue a completed simulation to later times.
+
+		**Signature**: x.extend(output_times, capture = False,
+		checkpoint = None, adaptive = None, age_binning = None)
+
+		.. versionadded:: 1.3.0
+
+		Parameters
+		----------
+		x : ``singlezone``
+			An instance of this class.
+		output_times : array-like [elements are real numbers]
+			The times in Gyr at which VICE should record output from the
+			simulation. Those which precede the ending time of the completed
+			simulation are ignored, having already been written to the
+			output.
+		capture : ``bool`` [default : False]
+			If ``True``, an output object containing the results of the
+			simulation will be returned.
+		checkpoint : real number [default : None]
+			The time interval in Gyr at which VICE will save the state of the
+			simulation to the output directory. See ``run``.
+		adaptive : real number [default : None]
+			The relative error tolerance of adaptive timestepping. See
+			``run``.
+		age_binning : real number [default : None]
+			The age in Gyr beyond which stellar populations are binned. See
+			``run``.
+
+		Returns
+		-------
+		out : ``output`` [only returned if ``capture == True``]
+			An ``output`` object produced from this simulation's output.
+
+		Raises
+		------
+		* IOError
+			- 	The output directory does not contain a completed simulation.
+		* RuntimeError
+			- 	The completed simulation has a different number of elements,
+				timestep size, or MDF bins, or ends after the final element
+				of ``output_times``.
+
+		Other exceptions and warnings are raised by ``run``.
+
+		Notes
+		-----
+		The simulation picks up from the state saved at the final timestep of
+		the completed simulation, computing only the additional timesteps, and
+		appends to the existing output. All attributes other than the output
+		times must be the same as when the completed simulation was ran for
+		the result to be equivalent to running to the new ending time from
+		the start.
+
+		Example Code
+		------------
+		>>> import numpy as np
+		>>> import vice
+		>>> sz = vice.singlezone(name = "example")
+		>>> sz.run(np.linspace(0, 10, 1001))
+		>>> sz.extend(np.linspace(0, 13.2, 1321))
 		"""
 		return self.__c_version.run(output_times, capture = capture,
-			overwrite = overwrite)
+			checkpoint = checkpoint, extend = True, adaptive = adaptive,
+			age_binning = age_binning)
 
@@ -12,6 +12,15 @@ if not __VICE_SETUP__:
 	from . import _singlezone
 	from . import trials
 	from .from_output import test_from_output
+	from .checkpoint import test_checkpoint, test_extend
+	from .run_async import test_run_async
+	from .adaptive import test_adaptive
+	from .integrator import test_integrator
+	from .agebinning import test_age_binning
+	from .response import test_response
+	from .sensitivity import test_sensitivities
+	from .analytic import test_analytic
+	from .profile import test_profile
 	from ....src.singlezone.tests import test as src_test
 
 	@moduletest
@@ -22,6 +31,16 @@ if not __VICE_SETUP__:
 		return ["vice.singlezone",
 			[
 				test_from_output(),
+				test_checkpoint(),
+				test_extend(),
+				test_run_async(),
+				test_adaptive(),
+				test_integrator(),
+				test_age_binning(),
+				test_response(),
+				test_sensitivities(),
+				test_analytic(),
+				test_profile(),
 				_singlezone.test(run = False),
 				trials.test(run = False),
 				src_test(run = False)
@@ -0,0 +1,39 @@
+from __future__ import absolute_import
+__all__ = ["test_adaptive"]
+from ..singlezone import singlezone
+from ....testing import unittest
+
+
+@unittest
+def test_adaptive():
+	r"""
+	vice.singlezone.run adaptive timestepping unittest
+	"""
+	def test():
+		# A starburst model ran with adaptive timestepping should write output
+		# at the same times as one with a fixed timestep and track it closely
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			def ifr(t):
+				return 9.1 + (100 if 5 <= t < 5.05 else 0)
+			results = []
+			for tolerance in [None, 1.e-3]:
+				sz = singlezone(name = "test", elements = ["fe", "o"],
+					func = ifr, mode = "ifr", dt = 0.005)
+				sz.run(outtimes, overwrite = True, adaptive = tolerance)
+				with open("test.vice/history.out", 'r') as f:
+					results.append([[float(i) for i in line.split()] for line in
+						f.readlines() if not line.startswith('#')])
+			fixed, adaptive = results
+			if len(adaptive) < len(outtimes): return False
+			for i in range(1, len(outtimes)):
+				if abs(adaptive[i][0] - fixed[i][0]) > 1.e-6: return False
+				# ISM mass and the abundance of each element by mass
+				for j in [1, -2, -1]:
+					if abs(adaptive[i][j] - fixed[i][j]) > 0.05 * fixed[i][j]:
+						return False
+		except:
+			return False
+		return True
+	return ["vice.singlezone.run [adaptive]", test]
+
@@ -0,0 +1,36 @@
+
+from __future__ import absolute_import
+__all__ = ["test_age_binning"]
+from ..singlezone import singlezone
+from ....testing import unittest
+
+
+@unittest
+def test_age_binning():
+	r"""
+	vice.singlezone.run age binning unittest
+	"""
+	def test():
+		# Binning stellar populations older than 1 Gyr should track the model
+		# at full resolution closely and report a small nonzero error bound
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			results = []
+			for age_binning in [None, 1]:
+				sz = singlezone(name = "test", elements = ["fe", "o"],
+					dt = 0.005)
+				sz.run(outtimes, overwrite = True, age_binning = age_binning)
+				with open("test.vice/history.out", 'r') as f:
+					results.append([[float(i) for i in line.split()] for line in
+						f.readlines() if not line.startswith('#')])
+			full, binned = results
+			if not 0 < sz.age_binning_error < 0.05: return False
+			for i in range(1, len(outtimes)):
+				# ISM mass and the abundance of each element by mass
+				for j in [1, -2, -1]:
+					if abs(binned[i][j] - full[i][j]) > 0.01 * full[i][j]:
+						return False
+		except:
+			return False
+		return True
+	return ["vice.singlezone.run [age binning]", test]
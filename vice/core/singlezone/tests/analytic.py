@@ -0,0 +1,49 @@
+from __future__ import absolute_import
+__all__ = ["test_analytic"]
+from ..singlezone import singlezone
+from ....yields import agb
+from ....testing import unittest
+import math as m
+
+
+@unittest
+def test_analytic():
+	r"""
+	vice.singlezone.run analytic unittest
+	"""
+	def test():
+		# The ISM mass should follow its closed-form solution, and the
+		# numerical integrator should agree closely. AGB star yields are
+		# turned off, as the closed-form solutions do not admit them.
+		agb_settings = dict([(i, agb.settings[i]) for i in ["fe", "o"]])
+		try:
+			for i in agb_settings.keys(): agb.settings[i] = lambda m, z: 0
+			outtimes = [0.01 * i for i in range(1001)]
+			sz = singlezone(name = "test", elements = ["fe", "o"],
+				func = lambda t: 9.1 * m.exp(-t / 6), recycling = 0.4,
+				RIa = "exp")
+			histories = []
+			for analytic in [True, False]:
+				sz.run(outtimes, overwrite = True, analytic = analytic)
+				with open("test.vice/history.out", 'r') as f:
+					histories.append([[float(i) for i in line.split()] for
+						line in f.readlines() if not line.startswith('#')])
+			a = 1 / 6
+			b = (1 + sz.eta - sz.recycling) / sz.tau_star
+			for i in range(len(outtimes)):
+				t = histories[0][i][0]
+				expected = sz.Mg0 * m.exp(-b * t) + 9.1e9 * (m.exp(-a * t) -
+					m.exp(-b * t)) / (b - a)
+				if abs(histories[0][i][1] - expected) > 1.e-5 * expected:
+					return False
+				for j in [1, -2, -1]:
+					if abs(histories[0][i][j] - histories[1][i][j]) > (
+						0.02 * abs(histories[1][i][j]) +
+						1.e-6 * abs(histories[1][-1][j])): return False
+		except:
+			return False
+		finally:
+			for i in agb_settings.keys(): agb.settings[i] = agb_settings[i]
+		return True
+	return ["vice.singlezone.run [analytic]", test]
+
@@ -0,0 +1,54 @@
+
+from __future__ import absolute_import
+__all__ = ["test_checkpoint", "test_extend"]
+from ..singlezone import singlezone
+from ....testing import unittest
+import os
+
+
+@unittest
+def test_checkpoint():
+	r"""
+	vice.singlezone.run checkpoint and resume unittest
+	"""
+	def test():
+		# A resumed simulation should reproduce an uninterrupted one exactly
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			sz = singlezone(name = "test", elements = ["fe", "o"])
+			sz.run(outtimes, overwrite = True)
+			with open("test.vice/history.out", 'r') as f:
+				expected = f.read()
+			sz.run(outtimes, overwrite = True, checkpoint = 3)
+			if not os.path.exists("test.vice/checkpoint.bin"): return False
+			sz.run(outtimes, checkpoint = 3, resume = True)
+			with open("test.vice/history.out", 'r') as f:
+				resumed = f.read()
+		except:
+			return False
+		return resumed == expected
+	return ["vice.singlezone.run [checkpoint]", test]
+
+
+
+@unittest
+def test_extend():
+	r"""
+	vice.singlezone.extend unittest
+	"""
+	def test():
+		# An extended simulation should reproduce a longer one exactly
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			sz = singlezone(name = "test", elements = ["fe", "o"])
+			sz.run(outtimes, overwrite = True)
+			with open("test.vice/history.out", 'r') as f:
+				expected = f.read()
+			sz.run(outtimes[:501], overwrite = True)
+			sz.extend(outtimes)
+			with open("test.vice/history.out", 'r') as f:
+				extended = f.read()
+		except:
+			return False
+		return extended == expected
+	return ["vice.singlezone.extend", test]
@@ -0,0 +1,36 @@
+from __future__ import absolute_import
+__all__ = ["test_integrator"]
+from ..singlezone import singlezone
+from ....testing import unittest
+
+
+@unittest
+def test_integrator():
+	r"""
+	vice.singlezone.integrator unittest
+	"""
+	def test():
+		# With a short depletion time, the exponential integrator at a coarse
+		# timestep should track a fine-timestep solution more closely than
+		# forward Euler at the same coarse timestep
+		try:
+			outtimes = [0.1 * i for i in range(51)]
+			results = []
+			for integrator, dt in [("exponential", 0.002),
+				("exponential", 0.02), ("euler", 0.02)]:
+				sz = singlezone(name = "test", elements = ["o"], eta = 10,
+					tau_star = 0.3, integrator = integrator, dt = dt)
+				sz.run(outtimes, overwrite = True)
+				with open("test.vice/history.out", 'r') as f:
+					results.append([[float(i) for i in line.split()] for line in
+						f.readlines() if not line.startswith('#')])
+			# The abundance of oxygen by mass following the initial transient
+			Z = [[row[-1] / row[1] for row in result[5:len(outtimes)]] for
+				result in results]
+			error = [max([abs(a - b) / b for a, b in zip(Z[i], Z[0])]) for i in
+				range(1, 3)]
+			return error[0] < 0.01 and error[0] < error[1]
+		except:
+			return False
+	return ["vice.singlezone.integrator", test]
+
@@ -0,0 +1,44 @@
+from __future__ import absolute_import
+__all__ = ["test_profile"]
+from ..singlezone import singlezone
+from ....yields import ccsne
+from ....testing import unittest
+
+
+@unittest
+def test_profile():
+	r"""
+	vice.singlezone.run profile unittest
+	"""
+	def test():
+		# Each phase should be timed, and the functional attributes counted
+		# whether they are mapped across time in python or evaluated in C.
+		previous = ccsne.settings["fe"]
+		try:
+			ccsne.settings["fe"] = lambda z: 0.0012
+			outtimes = [0.01 * i for i in range(101)]
+			sz = singlezone(name = "test", elements = ["fe", "o"],
+				eta = lambda t: 2.5)
+			out, profile = sz.run(outtimes, overwrite = True, capture = True,
+				profile = True)
+			if sorted(profile.keys()) != ["callbacks", "phases", "total"]:
+				return False
+			for phase in ["prep", "gas", "enrichment", "MDF",
+				"write_history"]:
+				if profile["phases"][phase]["seconds"] < 0: return False
+				if profile["phases"][phase]["calls"] < 1: return False
+			if profile["phases"]["gas"]["calls"] != 100: return False
+			if sum([profile["phases"][i]["seconds"] for i in
+				profile["phases"].keys()]) > profile["total"]: return False
+			callbacks = profile["callbacks"]
+			if callbacks["func"] != callbacks["eta"]: return False
+			if callbacks["ccsne(fe)"] < 100: return False
+			if "ccsne(o)" in callbacks.keys(): return False
+			if sz.run(outtimes, overwrite = True) is not None: return False
+		except:
+			return False
+		finally:
+			ccsne.settings["fe"] = previous
+		return True
+	return ["vice.singlezone.run [profile]", test]
+
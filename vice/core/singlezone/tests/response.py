@@ -0,0 +1,50 @@
+
+from __future__ import absolute_import
+__all__ = ["test_response"]
+from ..singlezone import singlezone
+from ...outputs import response
+from ....yields import ccsne
+from ....testing import unittest
+
+
+@unittest
+def test_response():
+	r"""
+	vice.singlezone.run linear response unittest
+	"""
+	def test():
+		# The response at the yields the simulation was ran with should
+		# reproduce its output, and at new yields should track a simulation
+		# ran with them closely
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			sz = singlezone(name = "test", elements = ["fe", "o"])
+			sz.run(outtimes, overwrite = True, response = True)
+			resp = response("test")
+			with open("test.vice/history.out", 'r') as f:
+				history = [[float(i) for i in line.split()] for line in
+					f.readlines() if not line.startswith('#')]
+			evaluated = resp()
+			for i in range(1, len(outtimes)):
+				for j, elem in zip([-2, -1], sz.elements):
+					mass = evaluated["mass(%s)" % (elem)][i]
+					if abs(mass - history[i][j]) > 1.e-5 * history[i][j]:
+						return False
+			original = ccsne.settings["fe"]
+			ccsne.settings["fe"] = 2 * original
+			try:
+				sz.run(outtimes, overwrite = True)
+			finally:
+				ccsne.settings["fe"] = original
+			with open("test.vice/history.out", 'r') as f:
+				history = [[float(i) for i in line.split()] for line in
+					f.readlines() if not line.startswith('#')]
+			evaluated = resp(ccsne = {"fe": 2 * original})
+			for i in range(1, len(outtimes)):
+				if abs(evaluated["mass(fe)"][i] - history[i][-2]) > (
+					0.01 * history[i][-2]): return False
+		except:
+			return False
+		return True
+	return ["vice.singlezone.run [linear response]", test]
+
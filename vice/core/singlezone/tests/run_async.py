@@ -0,0 +1,37 @@
+from __future__ import absolute_import
+__all__ = ["test_run_async"]
+from ..singlezone import singlezone
+from ....testing import unittest
+
+
+@unittest
+def test_run_async():
+	r"""
+	vice.singlezone.run_async unittest
+	"""
+	def test():
+		# Concurrent asynchronous runs, one of which calls a python function,
+		# should each reproduce a synchronous run exactly
+		try:
+			outtimes = [0.01 * i for i in range(1001)]
+			expected = []
+			for i in range(2):
+				sz = singlezone(name = "test%d" % (i), elements = ["fe", "o"])
+				if i: sz.tau_star = lambda t: 2 + 0.1 * t
+				sz.run(outtimes, overwrite = True)
+				with open("test%d.vice/history.out" % (i), 'r') as f:
+					expected.append(f.read())
+			futures = []
+			for i in range(2):
+				sz = singlezone(name = "test%d" % (i), elements = ["fe", "o"])
+				if i: sz.tau_star = lambda t: 2 + 0.1 * t
+				futures.append(sz.run_async(outtimes, overwrite = True))
+			for i in range(2):
+				futures[i].result()
+				if futures[i].progress != 1: return False
+				with open("test%d.vice/history.out" % (i), 'r') as f:
+					if f.read() != expected[i]: return False
+		except:
+			return False
+		return True
+	return ["vice.singlezone.run_async", test]
@@ -0,0 +1,67 @@
+from __future__ import absolute_import
+__all__ = ["test_sensitivities"]
+from ..singlezone import singlezone
+from ...outputs import sensitivities
+from ....yields import agb
+from ....yields import ccsne
+from ....testing import unittest
+
+
+@unittest
+def test_sensitivities():
+	r"""
+	vice.singlezone.run sensitivities unittest
+	"""
+	def test():
+		# The derivatives should track central finite differences closely.
+		# AGB star yields are turned off as their metallicity dependence is
+		# not differentiated.
+		agb_settings = dict([(i, agb.settings[i]) for i in ["fe", "o"]])
+		try:
+			for i in agb_settings.keys(): agb.settings[i] = lambda m, z: 0
+			outtimes = [0.01 * i for i in range(1001)]
+			sz = singlezone(name = "test", elements = ["fe", "o"])
+			sz.run(outtimes, overwrite = True,
+				sensitivities = ["eta", "tau_star", "ccsne(fe)"])
+			sens = sensitivities("test")
+			steps = {
+				"eta": 0.01 * sz.eta,
+				"tau_star": 0.01 * sz.tau_star,
+				"ccsne(fe)": 0.01 * ccsne.settings["fe"]
+			}
+			for param in steps.keys():
+				histories = []
+				for sign in [1, -1]:
+					if param == "ccsne(fe)":
+						original = ccsne.settings["fe"]
+						ccsne.settings["fe"] += sign * steps[param]
+						try:
+							sz.run(outtimes, overwrite = True)
+						finally:
+							ccsne.settings["fe"] = original
+					else:
+						original = getattr(sz, param)
+						setattr(sz, param, original + sign * steps[param])
+						try:
+							sz.run(outtimes, overwrite = True)
+						finally:
+							setattr(sz, param, original)
+					with open("test.vice/history.out", 'r') as f:
+						histories.append([[float(i) for i in line.split()]
+							for line in f.readlines() if not line.startswith(
+								'#')])
+				for i in range(1, len(outtimes)):
+					for j, label in zip([1, -2, -1],
+						["mgas", "mass(fe)", "mass(o)"]):
+						fd = (histories[0][i][j] - histories[1][i][j]) / (
+							2 * steps[param])
+						value = sens["d(%s)/d(%s)" % (label, param)][i]
+						if abs(value - fd) > 0.01 * abs(fd) + 1.e-6 * abs(
+							histories[0][i][j] / steps[param]): return False
+		except:
+			return False
+		finally:
+			for i in agb_settings.keys(): agb.settings[i] = agb_settings[i]
+		return True
+	return ["vice.singlezone.run [sensitivities]", test]
+
@@ -21,6 +21,9 @@ else:
 from .._cutils cimport setup_imf
 from .._cutils cimport set_string
 from ..objects._ssp cimport SSP
+from ..objects._context cimport CONTEXT
+from ..objects._context cimport context_initialize
+from ..objects._context cimport context_free
 from .. cimport _mlr
 from . cimport _ssp
 
@@ -130,17 +133,14 @@ def cumulative_return_fraction(age, IMF = "kroupa", m_upper = 100,
 		_ssp_utils._msmf_crf_value_checks(m_upper = m_upper,
 			m_lower = m_lower, postMS = postMS)
 
-	# Set up any mass-lifetime relation data on this extension
-	# other forms don't have required data
-	_mlr.set_mlr_hashcode(_mlr._mlr_linker.__NAMES__[mlr.setting])
-	if mlr.setting in ["vincenzo2016", "hpt2000", "ka1997"]:
-		func = {
-			"vincenzo2016": _mlr.vincenzo2016_import,
-			"hpt2000": _mlr.hpt2000_import,
-			"ka1997": _mlr.ka1997_import
-		}[mlr.setting]
-		path = "%ssrc/ssp/mlr/%s.dat" % (_DIRECTORY_, mlr.setting)
-		func(path.encode("latin-1"))
+	# Set up a context holding the mass-lifetime relation setting and any
+	# data it requires; other forms don't have required data
+	cdef CONTEXT *ctx = context_initialize()
+	path = "%ssrc/ssp/mlr/%s.dat" % (_DIRECTORY_, mlr.setting)
+	if (_mlr.set_mlr_hashcode(ctx, _mlr._mlr_linker.__NAMES__[mlr.setting])
+		or _mlr.import_mlr_data(ctx, path.encode("latin-1"))):
+		context_free(ctx)
+		raise SystemError("Internal Error")
 	else: pass
 
 	# necessary for the C subroutines
@@ -151,20 +151,13 @@ def cumulative_return_fraction(age, IMF = "kroupa", m_upper = 100,
 
 	try:
 		setup_imf(ssp[0].imf, IMF)
-		x = _ssp.CRF(ssp[0], age)
+		x = _ssp.CRF(ssp[0], age, ctx)
 	finally:
 		# always free the memory
 		_ssp.ssp_free(ssp)
 
-		# take down mass-lifetime relation data
-		if mlr.setting in ["vincenzo2016", "hpt2000", "ka1997"]:
-			func = {
-				"vincenzo2016": _mlr.vincenzo2016_free,
-				"hpt2000": _mlr.hpt2000_free,
-				"ka1997": _mlr.ka1997_free
-			}[mlr.setting]
-			func()
-		else: pass
+		# take down the context and any mass-lifetime relation data
+		context_free(ctx)
 
 	return x
 
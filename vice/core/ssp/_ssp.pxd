@@ -5,11 +5,13 @@ from ..objects._element cimport ELEMENT
 from ..objects._ssp cimport SSP
 from ..objects._ssp cimport ssp_initialize
 from ..objects._ssp cimport ssp_free
+from ..objects._context cimport CONTEXT
 
 
 cdef extern from "../../src/ssp.h":
 	double *single_population_enrichment(SSP *ssp, ELEMENT *e,
-		double Z, double *times, unsigned long n_times, double mstar)
-	double CRF(SSP ssp, double time)
-	double MSMF(SSP ssp, double time)
+		double Z, double *times, unsigned long n_times, double mstar,
+		CONTEXT *ctx)
+	double CRF(SSP ssp, double time, CONTEXT *ctx)
+	double MSMF(SSP ssp, double time, CONTEXT *ctx)
 
@@ -40,6 +40,9 @@ from .._cutils cimport setup_imf
 from .._cutils cimport binspace
 from ..objects._element cimport ELEMENT
 from ..objects._ssp cimport SSP
+from ..objects._context cimport CONTEXT
+from ..objects._context cimport context_initialize
+from ..objects._context cimport context_free
 from ..objects cimport _element
 from ..objects cimport _sneia
 from ..objects cimport _agb
@@ -299,17 +302,14 @@ This feature will be removed in a future release of VICE.
 	else:
 		setup_imf(ssp[0].imf, IMF)
 
-	# Set up any mass-lifetime relation data on this extension
-	# other forms don't have required data
-	_mlr.set_mlr_hashcode(_mlr._mlr_linker.__NAMES__[mlr.setting])
-	if mlr.setting in ["vincenzo2016", "hpt2000", "ka1997"]:
-		func = {
-			"vincenzo2016": _mlr.vincenzo2016_import,
-			"hpt2000": _mlr.hpt2000_import,
-			"ka1997": _mlr.ka1997_import
-		}[mlr.setting]
-		path = "%ssrc/ssp/mlr/%s.dat" % (_DIRECTORY_, mlr.setting)
-		func(path.encode("latin-1"))
+	# Set up a context holding the mass-lifetime relation setting and any
+	# data it requires; other forms don't have required data
+	cdef CONTEXT *ctx = context_initialize()
+	path = "%ssrc/ssp/mlr/%s.dat" % (_DIRECTORY_, mlr.setting)
+	if (_mlr.set_mlr_hashcode(ctx, _mlr._mlr_linker.__NAMES__[mlr.setting])
+		or _mlr.import_mlr_data(ctx, path.encode("latin-1"))):
+		context_free(ctx)
+		raise SystemError("Internal Error")
 	else: pass
 
 	# patch note (versions >= 1.2.1): long(time / dt) + 10l used to be +11l.
@@ -323,7 +323,8 @@ This feature will be removed in a future release of VICE.
 		Z,
 		evaltimes,
 		long(time / dt) + 10l,
-		mstar)
+		mstar,
+		ctx)
 	if cresults is NULL:
 		raise MemoryError("Internal Error")
 	else:
@@ -340,16 +341,8 @@ This feature will be removed in a future release of VICE.
 		free(cresults)
 		free(evaltimes)
 
-		# take down mass-lifetime relation data
-		# other forms don't have required data
-		if mlr.setting in ["vincenzo2016", "hpt2000", "ka1997"]:
-			func = {
-				"vincenzo2016": _mlr.vincenzo2016_free,
-				"hpt2000": _mlr.hpt2000_free,
-				"ka1997": _mlr.ka1997_free
-			}[mlr.setting]
-			func()
-		else: pass
+		# take down the context and any mass-lifetime relation data
+		context_free(ctx)
 
 	return [pyresults, times]
 
@@ -4,3 +4,6 @@ cdef extern from "../../../src/ssp/tests/crf.h":
 	unsigned short test_CRF()
 	unsigned short test_setup_CRF()
 
+cdef extern from "../../../src/ssp/tests/cache.h":
+	unsigned short test_SSP_table_cache()
+
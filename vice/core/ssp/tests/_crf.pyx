@@ -28,6 +28,7 @@ def test():
 	for i in mlr.recognized: tests.append(mlr_generator(mlr = i)())
 	tests.append(test_cumulative_return_fraction())
 	tests.append(test_setup_cumulative_return_fraction())
+	tests.append(test_ssp_table_cache())
 	return ["vice.core.cumulative_return_fraction", tests]
 
 
@@ -101,3 +102,12 @@ def test_setup_cumulative_return_fraction():
 	"""
 	return ["vice.src.ssp.crf.setup_CRF", _crf.test_setup_CRF]
 
+
+@unittest
+def test_ssp_table_cache():
+	"""
+	Test the sharing of the cumulative return fraction and main sequence mass
+	fraction between singlezone simulations at vice/src/ssp/cache.h
+	"""
+	return ["vice.src.ssp.cache", _crf.test_SSP_table_cache]
+
@@ -8,6 +8,9 @@ from ...testing import moduletest
 from ...testing import unittest
 from .._cutils import progressbar
 from .utils import dummy1, dummy2, dummy3
+from ..callback import callback1_nan_inf_positive
+from ..callback import callback2_nan_inf
+from ..callback import callback2_nan_positive
 import random
 import sys
 import os
@@ -320,6 +323,18 @@ def test_callback_1arg_setup():
 			return False
 		status &= cb[0].user_func is NULL
 		status &= cb[0].assumed_constant == 1
+		# interpolation schemes are evaluated without calling python
+		from ...toolkit.interpolation import interp_scheme_1d
+		scheme = interp_scheme_1d([0, 50, 100], [-10, 40, 20])
+		try:
+			callback_1arg_setup(cb, callback1_nan_inf_positive(scheme))
+		except:
+			_cutils.callback_1arg_free(cb)
+			return False
+		status &= cb[0].native == 1
+		for i in range(100):
+			status &= cb[0].callback(<double> i, cb[0].user_func) == max(
+				scheme(i), 1e-12)
 		_cutils.callback_1arg_free(cb)
 		return status
 	return ["vice.core._cutils.callback_1arg_setup", test]
@@ -352,6 +367,40 @@ def test_callback_2arg_setup():
 			return False
 		status &= cb[0].user_func is NULL
 		status &= cb[0].assumed_constant == 1
+		# interpolation schemes are evaluated without calling python
+		from ...toolkit.interpolation import interp_scheme_2d
+		scheme = interp_scheme_2d([0, 100], [0, 100], [[0, 1], [2, 3]])
+		try:
+			callback_2arg_setup(cb, callback2_nan_inf(scheme))
+		except:
+			_cutils.callback_2arg_free(cb)
+			return False
+		status &= cb[0].native == 1
+		for i in range(100):
+			for j in range(100):
+				status &= (
+					cb[0].callback(<double> i, <double> j, cb[0].user_func) ==
+					scheme(i, j)
+				)
+		# as is the star formation law of the milkyway object
+		from ...toolkit.J21_sf_law import J21_sf_law
+		for mode in ["ifr", "sfr"]:
+			law = J21_sf_law(10, mode = mode)
+			try:
+				callback_2arg_setup(cb, callback2_nan_positive(law))
+			except:
+				_cutils.callback_2arg_free(cb)
+				return False
+			status &= cb[0].native == 1
+			status &= cb[0].owns_user_func == 1
+			scale = 1 if mode == "ifr" else 1.e-8
+			for i in range(14):
+				for j in range(41):
+					x = 0 if j == 40 else scale * 10**(j / 4)
+					status &= (
+						cb[0].callback(<double> i, <double> x,
+							cb[0].user_func) == law(i, x)
+					)
 		_cutils.callback_2arg_free(cb)
 		return status
 	return ["vice.core._cutils.callback_2arg_setup", test]
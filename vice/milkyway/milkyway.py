@@ -3,8 +3,8 @@ from __future__ import absolute_import
 __all__ = ["milkyway"]
 from .._globals import _RECOGNIZED_ELEMENTS_
 from ..core.multizone import multizone
+from ..core.multizone import _milkyway
 from ..core.dataframe._builtin_dataframes import solar_z
-from ..core import _pyutils
 from ..toolkit.hydrodisk import hydrodiskstars
 from ..toolkit.J21_sf_law import J21_sf_law
 from .. import yields
@@ -240,6 +240,8 @@ class milkyway(multizone):
 			"n_stars": 			self.n_stars,
 			"verbose": 			self.verbose,
 			"simple": 			self.simple,
+			"merge_age": 		self.merge_age,
+			"memory_budget": 	self.memory_budget,
 			"annuli": 			self.annuli,
 			"evolution": 		self.evolution,
 			"mode": 			self.mode,
@@ -421,7 +423,7 @@ object.""")
 		>>> vice.milkyway.default_evolution(5, 4)
 		1.0
 		"""
-		return 1.0
+		return _milkyway.default_evolution(radius, time)
 
 	@property
 	def mode(self):
@@ -689,7 +691,7 @@ object. Got: %s""" % (type(value)))
 		.. [2] Johnson & Weinberg (2020), MNRAS, 498, 1364
 		.. [3] Johnson et al. (2021), arxiv:2103.09838
 		"""
-		return 0.015 / 0.00572 * (10**(0.08 * (rgal - 4) - 0.3)) - 0.6
+		return _milkyway.default_mass_loading(rgal)
 
 	@property
 	def dt(self):
@@ -1072,7 +1074,7 @@ def _get_radial_bins(zone_width):
 		if zone_width > _MAX_RADIUS_ - _MIN_RADIUS_:
 			return [_MIN_RADIUS_, _MAX_RADIUS_]
 		elif zone_width > 0:
-			return _pyutils.range_(_MIN_RADIUS_, _MAX_RADIUS_, zone_width)
+			return _milkyway.radial_bins(_MIN_RADIUS_, _MAX_RADIUS_, zone_width)
 		else:
 			raise ValueError("Zone width must be positive. Got: %g" % (
 				zone_width))
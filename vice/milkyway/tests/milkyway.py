@@ -3,11 +3,13 @@ from __future__ import absolute_import
 __all__ = ["test"]
 from ..milkyway import milkyway, mass_from_surface_density
 from ..milkyway import _MAX_RADIUS_, _MAX_SF_RADIUS_
+from ..milkyway import _MIN_RADIUS_, _get_radial_bins
 from ...toolkit.J21_sf_law import J21_sf_law
 from ...toolkit.hydrodisk import hydrodiskstars
 from ...toolkit.hydrodisk.data.download import _h277_exists
 from ...testing import moduletest
 from ...testing import unittest
+from ...core import _pyutils
 from ...core.singlezone._singlezone import _RECOGNIZED_MODES_
 from ..._globals import _RECOGNIZED_ELEMENTS_
 import math as m
@@ -31,6 +33,7 @@ def test():
 			test_elements(),
 			test_IMF(),
 			test_mass_loading(),
+			test_defaults(),
 			test_dt(),
 			test_bins(),
 			test_delay(),
@@ -198,6 +201,25 @@ def test_mass_loading():
 	return ["vice.milkyway.mass_loading", test]
 
 
+@unittest
+def test_defaults():
+	r"""
+	vice.milkyway default parameters unit test
+	"""
+	def test():
+		# the C implementations against the python formulae they replace
+		status = milkyway.default_evolution(5, 4) == 1.0
+		for i in range(41):
+			rgal = 0.5 * i
+			status &= milkyway.default_mass_loading(rgal) == (
+				0.015 / 0.00572 * (10**(0.08 * (rgal - 4) - 0.3)) - 0.6)
+		for width in [0.1, 0.2, 0.25, 0.3, 0.5, 0.7, 1.0, 3.0]:
+			status &= _get_radial_bins(width) == _pyutils.range_(
+				_MIN_RADIUS_, _MAX_RADIUS_, width)
+		return status
+	return ["vice.milkyway defaults", test]
+
+
 @unittest
 def test_dt():
 	r"""
@@ -22,6 +22,7 @@
 extern double callback_1arg_evaluate(CALLBACK_1ARG cb1, double x) {
 
 	if (cb1.user_func != NULL) {
+		if (cb1.calls != NULL) (*cb1.calls)++;
 		return cb1.callback(x, cb1.user_func);
 	} else {
 		return cb1.assumed_constant;
@@ -48,6 +49,7 @@ extern double callback_1arg_evaluate(CALLBACK_1ARG cb1, double x) {
 extern double callback_2arg_evaluate(CALLBACK_2ARG cb2, double x, double y) {
 
 	if (cb2.user_func != NULL) {
+		if (cb2.calls != NULL) (*cb2.calls)++;
 		return cb2.callback(x, y, cb2.user_func);
 	} else {
 		return cb2.assumed_constant;
@@ -55,3 +57,47 @@ extern double callback_2arg_evaluate(CALLBACK_2ARG cb2, double x, double y) {
 
 }
 
+
+/*
+ * Determine whether or not evaluating a callback object calls a function
+ * constructed in python, and thereby requires the global interpreter lock.
+ *
+ * Parameters
+ * ==========
+ * cb1: 		The callback object
+ *
+ * Returns
+ * =======
+ * 1 if the callback object holds a python function, 0 if it holds a real
+ * number or a C object evaluated natively.
+ *
+ * header: callback.h
+ */
+extern unsigned short callback_1arg_calls_python(CALLBACK_1ARG cb1) {
+
+	return cb1.user_func != NULL && !cb1.native;
+
+}
+
+
+/*
+ * Determine whether or not evaluating a callback object calls a function
+ * constructed in python, and thereby requires the global interpreter lock.
+ *
+ * Parameters
+ * ==========
+ * cb2: 		The callback object
+ *
+ * Returns
+ * =======
+ * 1 if the callback object holds a python function, 0 if it holds a real
+ * number or a C object evaluated natively.
+ *
+ * header: callback.h
+ */
+extern unsigned short callback_2arg_calls_python(CALLBACK_2ARG cb2) {
+
+	return cb2.user_func != NULL && !cb2.native;
+
+}
+
@@ -41,6 +41,40 @@ extern double callback_1arg_evaluate(CALLBACK_1ARG cb1, double x);
  */
 extern double callback_2arg_evaluate(CALLBACK_2ARG cb2, double x, double y);
 
+/*
+ * Determine whether or not evaluating a callback object calls a function
+ * constructed in python, and thereby requires the global interpreter lock.
+ *
+ * Parameters
+ * ==========
+ * cb1: 		The callback object
+ *
+ * Returns
+ * =======
+ * 1 if the callback object holds a python function, 0 if it holds a real
+ * number or a C object evaluated natively.
+ *
+ * source: callback.c
+ */
+extern unsigned short callback_1arg_calls_python(CALLBACK_1ARG cb1);
+
+/*
+ * Determine whether or not evaluating a callback object calls a function
+ * constructed in python, and thereby requires the global interpreter lock.
+ *
+ * Parameters
+ * ==========
+ * cb2: 		The callback object
+ *
+ * Returns
+ * =======
+ * 1 if the callback object holds a python function, 0 if it holds a real
+ * number or a C object evaluated natively.
+ *
+ * source: callback.c
+ */
+extern unsigned short callback_2arg_calls_python(CALLBACK_2ARG cb2);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -10,6 +10,23 @@
 extern "C" {
 #endif
 
+/* The index of each channel in the entrainment fractions of an ELEMENT_STATE */
+#ifndef ENTRAINMENT_CCSNE
+#define ENTRAINMENT_CCSNE 0u
+#endif /* ENTRAINMENT_CCSNE */
+
+#ifndef ENTRAINMENT_SNEIA
+#define ENTRAINMENT_SNEIA 1u
+#endif /* ENTRAINMENT_SNEIA */
+
+#ifndef ENTRAINMENT_AGB
+#define ENTRAINMENT_AGB 2u
+#endif /* ENTRAINMENT_AGB */
+
+#ifndef ENTRAINMENT_CHANNELS
+#define ENTRAINMENT_CHANNELS 3u
+#endif /* ENTRAINMENT_CHANNELS */
+
 #include "objects.h"
 #include "singlezone/element.h"
 #include "multizone/element.h"
@@ -0,0 +1,18 @@
+
+#ifndef ENSEMBLE_H
+#define ENSEMBLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "objects.h"
+#include "objects/ensemble.h"
+#include "ensemble/ensemble.h"
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ENSEMBLE_H */
+
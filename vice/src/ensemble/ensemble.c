@@ -0,0 +1,542 @@
+/*
+ * This file implements the time evolution of an ensemble of singlezone
+ * models. Single stellar population quantities which depend on only a handful
+ * of parameters are computed once for each unique combination of them and
+ * shared between members, the cumulative return fraction and main sequence
+ * mass fraction by way of the cache in ../ssp/cache.c. The members are then
+ * integrated across a pool of threads, each writing its output to temporary
+ * files which are copied to the ensemble's output files in order of member
+ * index.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "../ensemble.h"
+#include "../singlezone.h"
+#include "../sneia.h"
+#include "../ssp.h"
+#include "../io.h"
+#include "../utils.h"
+#include "../callback.h"
+#include "ensemble.h"
+
+typedef struct ensemble_schedule {
+
+	/*
+	 * The state of an ensemble simulation shared between threads. Every
+	 * field below the mutex is only modified while it is locked.
+	 *
+	 * ens: The ensemble object being ran
+	 * ria_owners: The first member with each unique SNe Ia delay-time
+	 * 		distribution and timestep
+	 * ria: The SNe Ia rate of each element computed for each of ria_owners
+	 * n_ria: The number of unique SNe Ia rates
+	 * lock: Serializes the following fields between threads
+	 * next_member: The index of the next member to integrate
+	 * next_commit: The index of the next member whose output is to be copied
+	 * 		to the ensemble's output files
+	 * finished: Whether or not each member has been integrated
+	 * failed: 0 if every member has succeeded so far, otherwise the return
+	 * 		value of ensemble_evolve
+	 * pb: The progressbar to print if the ensemble is verbose
+	 */
+
+	ENSEMBLE *ens;
+	SINGLEZONE **ria_owners;
+	double ***ria;
+	unsigned long n_ria;
+	pthread_mutex_t lock;
+	unsigned long next_member;
+	unsigned long next_commit;
+	unsigned short *finished;
+	unsigned short failed;
+	PROGRESSBAR *pb;
+
+} ENSEMBLE_SCHEDULE;
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static ENSEMBLE_SCHEDULE *schedule_initialize(ENSEMBLE *ens);
+static void schedule_free(ENSEMBLE_SCHEDULE *s);
+static unsigned short setup_shared_tables(ENSEMBLE_SCHEDULE *s);
+static unsigned short ria_tables_match(SINGLEZONE a, SINGLEZONE b);
+static void release_shared_tables(SINGLEZONE *sz);
+static void ensemble_integrate(ENSEMBLE_SCHEDULE *s);
+static void *ensemble_worker(void *schedule);
+static unsigned long next_member(ENSEMBLE_SCHEDULE *s);
+static void evolve_member(ENSEMBLE_SCHEDULE *s, unsigned long index);
+static void commit_member(ENSEMBLE_SCHEDULE *s, unsigned long index,
+	unsigned short failed);
+
+
+/*
+ * Link a singlezone object to an ensemble as one of its members.
+ *
+ * Parameters
+ * ==========
+ * ens: 		A pointer to the ensemble object
+ * address: 	The memory address of the singlezone object
+ * index: 		The index of the member
+ *
+ * header: ensemble.h
+ */
+extern void link_member(ENSEMBLE *ens, unsigned long address,
+	unsigned long index) {
+
+	ens -> members[index] = (SINGLEZONE *) address;
+
+}
+
+
+/*
+ * Runs every member of an ensemble under their current settings.
+ *
+ * Parameters
+ * ==========
+ * ens: 	A pointer to the ensemble object to run
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on setup failure, 2 on file I/O error
+ *
+ * header: ensemble.h
+ */
+extern unsigned short ensemble_evolve(ENSEMBLE *ens) {
+
+	if (ensemble_open_files(ens)) {
+		ensemble_cancel(ens);
+		return 2u;
+	} else {
+		write_ensemble_history_header(*ens);
+		write_ensemble_mdf_header(*ens);
+	}
+
+	/*
+	 * The shared tables are computed on the calling thread; the functions
+	 * which do so are not safe to call from multiple threads at once.
+	 */
+	unsigned short x;
+	ENSEMBLE_SCHEDULE *s = schedule_initialize(ens);
+	if (setup_shared_tables(s)) {
+		unsigned long i;
+		for (i = 0ul; i < (*ens).n_members; i++) {
+			release_shared_tables(ens -> members[i]);
+			singlezone_clean(ens -> members[i]);
+		}
+		x = 1u;
+	} else {
+		ensemble_integrate(s);
+		x = (*s).failed;
+	}
+
+	schedule_free(s);
+	ensemble_close_files(ens);
+	return x;
+
+}
+
+
+/*
+ * Frees the memory allocated by python for each member of an ensemble when
+ * the user cancels the simulation.
+ *
+ * Parameters
+ * ==========
+ * ens: 	A pointer to the ensemble object
+ *
+ * header: ensemble.h
+ */
+extern void ensemble_cancel(ENSEMBLE *ens) {
+
+	unsigned long i;
+	for (i = 0ul; i < (*ens).n_members; i++) {
+		singlezone_cancel(ens -> members[i]);
+		free(ens -> members[i] -> output_times);
+		ens -> members[i] -> output_times = NULL;
+	}
+
+}
+
+
+/*
+ * Determine whether or not any member of an ensemble calls functions
+ * constructed in python as it evolves.
+ *
+ * Parameters
+ * ==========
+ * ens: 	The ensemble object
+ *
+ * Returns
+ * =======
+ * 1 if any member's nucleosynthetic yields or star formation efficiency
+ * timescale are python functions, 0 otherwise. Interpolation schemes are
+ * evaluated natively, and do not count as python functions.
+ *
+ * header: ensemble.h
+ */
+extern unsigned short ensemble_calls_python(ENSEMBLE ens) {
+
+	unsigned long i;
+	unsigned int j, k;
+	for (i = 0ul; i < ens.n_members; i++) {
+		SINGLEZONE sz = *ens.members[i];
+		if (callback_2arg_calls_python(*(*sz.ism).functional_tau_star)) {
+			return 1u;
+		} else {}
+		for (j = 0u; j < sz.n_elements; j++) {
+			ELEMENT e = *sz.elements[j];
+			if (callback_1arg_calls_python(*(*e.ccsne_yields).yield_) ||
+				callback_1arg_calls_python(*(*e.sneia_yields).yield_) ||
+				callback_2arg_calls_python(*(*e.agb_grid).custom_yield)) {
+				return 1u;
+			} else {}
+			for (k = 0u; k < e.n_channels; k++) {
+				if (callback_1arg_calls_python(*(*e.channels[k]).yield_)) {
+					return 1u;
+				} else {}
+			}
+		}
+	}
+	return 0u;
+
+}
+
+
+/*
+ * Allocate memory for and initialize the shared state of an ensemble
+ * simulation.
+ *
+ * Parameters
+ * ==========
+ * ens: 	A pointer to the ensemble object to run
+ *
+ * Returns
+ * =======
+ * A pointer to the schedule, with no shared tables computed and no members
+ * integrated.
+ */
+static ENSEMBLE_SCHEDULE *schedule_initialize(ENSEMBLE *ens) {
+
+	/*
+	 * There can be no more unique tables than there are members, so the
+	 * arrays of them are allocated at that length.
+	 */
+	ENSEMBLE_SCHEDULE *s = (ENSEMBLE_SCHEDULE *) malloc (
+		sizeof(ENSEMBLE_SCHEDULE));
+	s -> ens = ens;
+	s -> ria_owners = (SINGLEZONE **) malloc ((*ens).n_members *
+		sizeof(SINGLEZONE *));
+	s -> ria = (double ***) malloc ((*ens).n_members * sizeof(double **));
+	s -> n_ria = 0ul;
+	pthread_mutex_init(&(s -> lock), NULL);
+	s -> next_member = 0ul;
+	s -> next_commit = 0ul;
+	s -> finished = (unsigned short *) malloc ((*ens).n_members *
+		sizeof(unsigned short));
+	unsigned long i;
+	for (i = 0ul; i < (*ens).n_members; i++) s -> finished[i] = 0u;
+	s -> failed = 0u;
+	if ((*ens).verbose) {
+		s -> pb = progressbar_initialize((*ens).n_members);
+	} else {
+		s -> pb = NULL;
+	}
+	return s;
+
+}
+
+
+/*
+ * Free up the memory stored in the shared state of an ensemble simulation,
+ * including the tables shared between members.
+ *
+ * Parameters
+ * ==========
+ * s: 		The schedule to free
+ */
+static void schedule_free(ENSEMBLE_SCHEDULE *s) {
+
+	unsigned long i;
+	unsigned int j;
+	for (i = 0ul; i < (*s).n_ria; i++) {
+		for (j = 0u; j < (*(*s).ria_owners[i]).n_elements; j++) {
+			free(s -> ria[i][j]);
+		}
+		free(s -> ria[i]);
+	}
+	free(s -> ria_owners);
+	free(s -> ria);
+	free(s -> finished);
+	if ((*s).pb != NULL) {
+		progressbar_finish(s -> pb);
+		progressbar_free(s -> pb);
+	} else {}
+	pthread_mutex_destroy(&(s -> lock));
+	free(s);
+
+}
+
+
+/*
+ * Setup the cumulative return fraction, main sequence mass fraction, and
+ * SNe Ia rates for each member of an ensemble, computing each only once for
+ * every unique combination of the parameters they depend on.
+ *
+ * Parameters
+ * ==========
+ * s: 		The schedule for the ensemble simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * Notes
+ * =====
+ * SNe Ia rates from custom delay-time distributions are mapped by python for
+ * each member separately, so they are normalized in place rather than shared.
+ */
+static unsigned short setup_shared_tables(ENSEMBLE_SCHEDULE *s) {
+
+	unsigned long i, j;
+	unsigned int k;
+	for (i = 0ul; i < (*(*s).ens).n_members; i++) {
+		SINGLEZONE *sz = s -> ens -> members[i];
+		if (acquire_SSP_tables(sz)) return 1u;
+
+		if (checksum((*(*(*sz).elements[0]).sneia_yields).dtd) == CUSTOM) {
+			if (setup_RIa(sz)) return 1u;
+			continue;
+		} else {}
+		for (j = 0ul; j < (*s).n_ria; j++) {
+			if (ria_tables_match(*sz, *(*s).ria_owners[j])) break;
+		}
+		if (j < (*s).n_ria) {
+			for (k = 0u; k < (*sz).n_elements; k++) {
+				sz -> elements[k] -> sneia_yields -> RIa = (*s).ria[j][k];
+			}
+		} else {
+			if (setup_RIa(sz)) return 1u;
+			s -> ria[j] = (double **) malloc ((*sz).n_elements *
+				sizeof(double *));
+			for (k = 0u; k < (*sz).n_elements; k++) {
+				s -> ria[j][k] = (*(*(*sz).elements[k]).sneia_yields).RIa;
+			}
+			s -> ria_owners[j] = sz;
+			s -> n_ria++;
+		}
+	}
+
+	return 0u;
+
+}
+
+
+/*
+ * Determine whether or not two singlezone objects have the same SNe Ia
+ * rates.
+ *
+ * Parameters
+ * ==========
+ * a: 		The first singlezone object
+ * b: 		The second singlezone object
+ *
+ * Returns
+ * =======
+ * 1 if they have the same built-in delay-time distribution, e-folding
+ * timescale, minimum delay time, timestep size, and number of elements, 0
+ * otherwise.
+ *
+ * Notes
+ * =====
+ * The delay-time distribution is a property of the singlezone object in
+ * python, so the first element describes all of them.
+ */
+static unsigned short ria_tables_match(SINGLEZONE a, SINGLEZONE b) {
+
+	SNEIA_YIELD_SPECS ia_a = *(*a.elements[0]).sneia_yields;
+	SNEIA_YIELD_SPECS ia_b = *(*b.elements[0]).sneia_yields;
+	return (a.dt == b.dt &&
+		a.n_elements == b.n_elements &&
+		ia_a.tau_ia == ia_b.tau_ia &&
+		ia_a.t_d == ia_b.t_d &&
+		!strcmp(ia_a.dtd, ia_b.dtd));
+
+}
+
+
+/*
+ * Point a member of an ensemble away from the SNe Ia rates it shares with
+ * other members, such that singlezone_clean does not free them. The
+ * cumulative return fraction and main sequence mass fraction are given back
+ * to the cache by singlezone_clean itself.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the member
+ */
+static void release_shared_tables(SINGLEZONE *sz) {
+
+	if (checksum((*(*(*sz).elements[0]).sneia_yields).dtd) != CUSTOM) {
+		unsigned int i;
+		for (i = 0u; i < (*sz).n_elements; i++) {
+			sz -> elements[i] -> sneia_yields -> RIa = NULL;
+		}
+	} else {}
+
+}
+
+
+/*
+ * Integrate every member of an ensemble across the number of threads
+ * specified by the ensemble object.
+ *
+ * Parameters
+ * ==========
+ * s: 		The schedule for the ensemble simulation, with the shared tables
+ * 			already computed
+ *
+ * Notes
+ * =====
+ * Members whose yields or star formation efficiency call python functions
+ * can only be evaluated on the calling thread, which holds python's global
+ * interpreter lock. If any thread can't be created, the ones which were
+ * share the work, and if none could be, the calling thread does all of it.
+ */
+static void ensemble_integrate(ENSEMBLE_SCHEDULE *s) {
+
+	unsigned int i, n_started = 0u, n_threads = (*(*s).ens).n_threads;
+	if (ensemble_calls_python(*(*s).ens)) n_threads = 1u;
+	if (n_threads > (*(*s).ens).n_members) {
+		n_threads = (unsigned int) (*(*s).ens).n_members;
+	} else {}
+
+	if (n_threads > 1u) {
+		pthread_t *threads = (pthread_t *) malloc (n_threads *
+			sizeof(pthread_t));
+		for (i = 0u; i < n_threads; i++) {
+			if (pthread_create(&threads[i], NULL, ensemble_worker, s)) break;
+			n_started++;
+		}
+		for (i = 0u; i < n_started; i++) pthread_join(threads[i], NULL);
+		free(threads);
+	} else {}
+
+	/* Does nothing if the threads have already integrated every member */
+	ensemble_worker(s);
+
+}
+
+
+/*
+ * Integrate members of an ensemble until there are none left.
+ *
+ * Parameters
+ * ==========
+ * schedule: 	A pointer to the ENSEMBLE_SCHEDULE for the simulation
+ *
+ * Returns
+ * =======
+ * NULL, as required by pthread_create
+ */
+static void *ensemble_worker(void *schedule) {
+
+	ENSEMBLE_SCHEDULE *s = (ENSEMBLE_SCHEDULE *) schedule;
+	unsigned long index = next_member(s);
+	while (index < (*(*s).ens).n_members) {
+		evolve_member(s, index);
+		index = next_member(s);
+	}
+	return NULL;
+
+}
+
+
+/*
+ * Claim the next member of an ensemble to integrate.
+ *
+ * Parameters
+ * ==========
+ * s: 		The schedule for the ensemble simulation
+ *
+ * Returns
+ * =======
+ * The index of the member, which is at least the number of members if
+ * there are none left.
+ */
+static unsigned long next_member(ENSEMBLE_SCHEDULE *s) {
+
+	pthread_mutex_lock(&(s -> lock));
+	unsigned long index = s -> next_member++;
+	pthread_mutex_unlock(&(s -> lock));
+	return index;
+
+}
+
+
+/*
+ * Integrate one member of an ensemble, writing its output to temporary files
+ * and freeing its memory once finished.
+ *
+ * Parameters
+ * ==========
+ * s: 		The schedule for the ensemble simulation
+ * index: 	The index of the member to integrate
+ */
+static void evolve_member(ENSEMBLE_SCHEDULE *s, unsigned long index) {
+
+	SINGLEZONE *sz = s -> ens -> members[index];
+	unsigned short x = 0u;
+	sz -> history_writer = tmpfile();
+	sz -> mdf_writer = tmpfile();
+	if ((*sz).history_writer == NULL || (*sz).mdf_writer == NULL) {
+		x = 2u;
+	} else if (singlezone_setup_evolution(sz)) {
+		x = 1u;
+	} else {
+		singlezone_evolve_no_setup_no_clean(sz);
+		normalize_MDF(sz);
+		write_mdf_output(*sz);
+	}
+	release_shared_tables(sz);
+	singlezone_clean(sz);
+	commit_member(s, index, x);
+
+}
+
+
+/*
+ * Mark a member of an ensemble as finished, and copy the output of every
+ * finished member not preceded by an unfinished one to the ensemble's output
+ * files.
+ *
+ * Parameters
+ * ==========
+ * s: 		The schedule for the ensemble simulation
+ * index: 	The index of the member which just finished
+ * failed: 	0 if the member was integrated successfully, otherwise the
+ * 			return value of ensemble_evolve describing the failure
+ */
+static void commit_member(ENSEMBLE_SCHEDULE *s, unsigned long index,
+	unsigned short failed) {
+
+	pthread_mutex_lock(&(s -> lock));
+	s -> finished[index] = 1u;
+	if (!(*s).failed) s -> failed = failed;
+	while ((*s).next_commit < (*(*s).ens).n_members &&
+		(*s).finished[(*s).next_commit]) {
+		SINGLEZONE *sz = s -> ens -> members[(*s).next_commit];
+		if (!(*s).failed) {
+			if (append_member_output((*(*s).ens).history_writer,
+				(*sz).history_writer, (*s).next_commit) ||
+				append_member_output((*(*s).ens).mdf_writer,
+				(*sz).mdf_writer, (*s).next_commit)) s -> failed = 2u;
+		} else {}
+		singlezone_close_files(sz);
+		s -> next_commit++;
+		if ((*s).pb != NULL) progressbar_update(s -> pb, (*s).next_commit);
+	}
+	pthread_mutex_unlock(&(s -> lock));
+
+}
+
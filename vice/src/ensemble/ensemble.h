@@ -0,0 +1,84 @@
+
+#ifndef ENSEMBLE_ENSEMBLE_H
+#define ENSEMBLE_ENSEMBLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "../objects.h"
+
+/*
+ * Link a singlezone object to an ensemble as one of its members.
+ *
+ * Parameters
+ * ==========
+ * ens: 		A pointer to the ensemble object
+ * address: 	The memory address of the singlezone object
+ * index: 		The index of the member
+ *
+ * source: ensemble.c
+ */
+extern void link_member(ENSEMBLE *ens, unsigned long address,
+	unsigned long index);
+
+/*
+ * Runs every member of an ensemble under their current settings.
+ *
+ * Parameters
+ * ==========
+ * ens: 	A pointer to the ensemble object to run
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on setup failure, 2 on file I/O error
+ *
+ * Notes
+ * =====
+ * The cumulative return fraction, main sequence mass fraction, and SNe Ia
+ * rates are computed once for each unique combination of the parameters
+ * they depend on and shared between members. The members are then
+ * integrated across the number of threads specified by the ensemble object,
+ * and their output is written in order of member index regardless.
+ *
+ * source: ensemble.c
+ */
+extern unsigned short ensemble_evolve(ENSEMBLE *ens);
+
+/*
+ * Frees the memory allocated by python for each member of an ensemble when
+ * the user cancels the simulation.
+ *
+ * Parameters
+ * ==========
+ * ens: 	A pointer to the ensemble object
+ *
+ * source: ensemble.c
+ */
+extern void ensemble_cancel(ENSEMBLE *ens);
+
+/*
+ * Determine whether or not any member of an ensemble calls functions
+ * constructed in python as it evolves.
+ *
+ * Parameters
+ * ==========
+ * ens: 	The ensemble object
+ *
+ * Returns
+ * =======
+ * 1 if any member's nucleosynthetic yields or star formation efficiency
+ * timescale are python functions, 0 otherwise. In the former case, the
+ * members are integrated on the calling thread only. Interpolation schemes
+ * are evaluated natively, and do not count as python functions.
+ *
+ * source: ensemble.c
+ */
+extern unsigned short ensemble_calls_python(ENSEMBLE ens);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ENSEMBLE_ENSEMBLE_H */
+
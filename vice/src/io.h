@@ -18,6 +18,8 @@ extern "C" {
 #include "objects.h"
 #include "io/agb.h"
 #include "io/ccsne.h"
+#include "io/checkpoint.h"
+#include "io/ensemble.h"
 #include "io/multizone.h"
 #include "io/progressbar.h"
 #include "io/sneia.h"
@@ -0,0 +1,597 @@
+/*
+ * This file implements checkpointing of singlezone and multizone simulations.
+ * Checkpoints store the time-evolving state of each zone in a binary file
+ * within the simulation's output directory, along with the positions in the
+ * history.out and mdf.out files at which the simulation left off. Resuming
+ * from a checkpoint truncates these files back to those positions, such that
+ * a resumed simulation produces the same output as one which ran without
+ * interruption.
+ *
+ * Notes
+ * =====
+ * Checkpoints are written in the machine's native binary format, and are not
+ * intended to be portable between machines.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include "../io.h"
+#include "../singlezone.h"
+#include "../multizone.h"
+#include "checkpoint.h"
+
+/* The first bytes of every checkpoint file */
+static const char CHECKPOINT_MAGIC[8] = {'V', 'I', 'C', 'E', 'C', 'K', 'P', 'T'};
+static const unsigned short CHECKPOINT_VERSION = 3u;
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static void checkpoint_filename(char *filename, char *dir, char *basename);
+static FILE *checkpoint_open_write(char *dir, char *basename);
+static unsigned short checkpoint_close_write(FILE *out, char *dir,
+	char *basename);
+static unsigned short write_header(FILE *out, unsigned int n_zones);
+static unsigned short read_header(FILE *in, unsigned int n_zones);
+static unsigned short write_zone_state(FILE *out, SINGLEZONE *sz);
+static unsigned short read_zone_state(FILE *in, SINGLEZONE *sz);
+static unsigned short reopen_output_file(FILE **writer, char *dir,
+	char *basename, long offset);
+
+
+/*
+ * Determine whether or not a checkpoint is due at the current timestep.
+ *
+ * Parameters
+ * ==========
+ * interval: 	The time between checkpoints in Gyr. Zero disables checkpoints.
+ * dt: 			The timestep size in Gyr
+ * previous: 	The timestep number before the most recent update
+ * timestep: 	The current timestep number
+ *
+ * Returns
+ * =======
+ * 1 if a checkpoint should be written, 0 otherwise
+ *
+ * header: checkpoint.h
+ */
+extern unsigned short checkpoint_due(double interval, double dt,
+	unsigned long previous, unsigned long timestep) {
+
+	if (interval > 0) {
+		/* Never checkpoint more frequently than once per timestep */
+		unsigned long every = (unsigned long) round(interval / dt);
+		if (!every) every = 1ul;
+		/*
+		 * Adaptive timestepping can move forward multiple timesteps at once,
+		 * so a checkpoint is due if one was scheduled at any of them.
+		 */
+		return timestep / every > previous / every;
+	} else {
+		return 0u;
+	}
+
+}
+
+
+/*
+ * Write the current state of a singlezone simulation to its checkpoint file.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: checkpoint.h
+ */
+extern unsigned short singlezone_write_checkpoint(SINGLEZONE *sz) {
+
+	FILE *out = checkpoint_open_write((*sz).name, CHECKPOINT_FILE);
+	if (out == NULL) return 1u;
+	unsigned short x = write_header(out, 1u);
+	if (!x) x = write_zone_state(out, sz);
+	if (x) {
+		fclose(out);
+		return 1u;
+	} else {
+		return checkpoint_close_write(out, (*sz).name, CHECKPOINT_FILE);
+	}
+
+}
+
+
+/*
+ * Restore the state of a singlezone simulation from its checkpoint file and
+ * reopen its output files where they were left off.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object, already set up for simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on file I/O error, 2 if the checkpoint does not describe
+ * the current simulation
+ *
+ * header: checkpoint.h
+ */
+extern unsigned short singlezone_read_checkpoint(SINGLEZONE *sz) {
+
+	char filename[MAX_FILENAME_SIZE];
+	checkpoint_filename(filename, (*sz).name, CHECKPOINT_FILE);
+	FILE *in = fopen(filename, "rb");
+	if (in == NULL) return 1u;
+	unsigned short x = read_header(in, 1u);
+	if (!x) x = read_zone_state(in, sz);
+	fclose(in);
+	return x;
+
+}
+
+
+/*
+ * Write the current state of a multizone simulation to its checkpoint file.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: checkpoint.h
+ */
+extern unsigned short multizone_write_checkpoint(MULTIZONE *mz) {
+
+	FILE *out = checkpoint_open_write((*mz).name, CHECKPOINT_FILE);
+	if (out == NULL) return 1u;
+	unsigned short x = write_header(out, (*(*mz).mig).n_zones);
+	unsigned int i;
+	for (i = 0u; i < (*(*mz).mig).n_zones && !x; i++) {
+		x = write_zone_state(out, mz -> zones[i]);
+	}
+
+	/*
+	 * Only the tracer particles which have already formed carry any state
+	 * beyond their zone histories, which are written once at the start of
+	 * the simulation by multizone_write_tracer_checkpoint.
+	 */
+	if (!x) x = fwrite(&(*(*mz).mig).tracer_count, sizeof(unsigned long), 1,
+		out) != 1;
+	unsigned long j;
+	for (j = 0ul; j < (*(*mz).mig).tracer_count && !x; j++) {
+		TRACER *t = (*(*mz).mig).tracers[j];
+		x |= fwrite(&(*t).mass, sizeof(double), 1, out) != 1;
+		x |= fwrite(&(*t).zone_current, sizeof(unsigned int), 1, out) != 1;
+	}
+
+	if (x) {
+		fclose(out);
+		return 1u;
+	} else {
+		return checkpoint_close_write(out, (*mz).name, CHECKPOINT_FILE);
+	}
+
+}
+
+
+/*
+ * Write the zone histories of every star particle in a multizone simulation
+ * to a file, allowing them to be restored exactly upon resuming even if the
+ * stellar migration prescription is stochastic.
+ *
+ * Parameters
+ * ==========
+ * mz: 		The multizone object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: checkpoint.h
+ */
+extern unsigned short multizone_write_tracer_checkpoint(MULTIZONE mz) {
+
+	FILE *out = checkpoint_open_write(mz.name, TRACER_CHECKPOINT_FILE);
+	if (out == NULL) return 1u;
+	unsigned long i, length = n_timesteps(*mz.zones[0]);
+	unsigned long n = (*mz.mig).n_zones * (*mz.mig).n_tracers * length;
+	unsigned short x = write_header(out, (*mz.mig).n_zones);
+	if (!x) x = fwrite(&n, sizeof(unsigned long), 1, out) != 1;
+	for (i = 0ul; i < n && !x; i++) {
+		TRACER *t = (*mz.mig).tracers[i];
+		x |= fwrite(&(*t).zone_origin, sizeof(unsigned int), 1, out) != 1;
+		x |= fwrite(&(*t).timestep_origin, sizeof(unsigned long), 1,
+			out) != 1;
+		x |= fwrite((*t).zone_history, sizeof(int), length, out) != length;
+	}
+
+	if (x) {
+		fclose(out);
+		return 1u;
+	} else {
+		return checkpoint_close_write(out, mz.name, TRACER_CHECKPOINT_FILE);
+	}
+
+}
+
+
+/*
+ * Restore the state of a multizone simulation from its checkpoint file and
+ * reopen each zone's output files where they were left off.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object, already set up for simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on file I/O error, 2 if the checkpoint does not describe
+ * the current simulation
+ *
+ * header: checkpoint.h
+ */
+extern unsigned short multizone_read_checkpoint(MULTIZONE *mz) {
+
+	char filename[MAX_FILENAME_SIZE];
+	unsigned long i, n = (*(*mz).mig).n_zones * (*(*mz).mig).n_tracers *
+		n_timesteps(*(*mz).zones[0]);
+	checkpoint_filename(filename, (*mz).name, CHECKPOINT_FILE);
+	FILE *in = fopen(filename, "rb");
+	if (in == NULL) return 1u;
+	unsigned short x = read_header(in, (*(*mz).mig).n_zones);
+	unsigned int j;
+	for (j = 0u; j < (*(*mz).mig).n_zones && !x; j++) {
+		x = read_zone_state(in, mz -> zones[j]);
+	}
+	if (!x) x = fread(&(mz -> mig -> tracer_count), sizeof(unsigned long), 1,
+		in) != 1;
+	if (!x && (*(*mz).mig).tracer_count > n) x = 2u;
+	for (i = 0ul; i < (*(*mz).mig).tracer_count && !x; i++) {
+		TRACER *t = mz -> mig -> tracers[i];
+		x |= fread(&(t -> mass), sizeof(double), 1, in) != 1;
+		x |= fread(&(t -> zone_current), sizeof(unsigned int), 1, in) != 1;
+	}
+	fclose(in);
+	return x;
+
+}
+
+
+/*
+ * Restore the zone histories of every star particle in a multizone
+ * simulation from the file written by multizone_write_tracer_checkpoint.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object, already set up for simulation
+ *
+ * Returns
+ * =======
+ * 0 on success or if the file does not exist, 1 on file I/O error, 2 if the
+ * file does not describe the current simulation
+ *
+ * header: checkpoint.h
+ */
+extern unsigned short multizone_read_tracer_checkpoint(MULTIZONE *mz) {
+
+	char filename[MAX_FILENAME_SIZE];
+	unsigned long i, n, length = n_timesteps(*(*mz).zones[0]);
+	checkpoint_filename(filename, (*mz).name, TRACER_CHECKPOINT_FILE);
+	FILE *in = fopen(filename, "rb");
+	if (in == NULL) return 0u;
+	unsigned short x = read_header(in, (*(*mz).mig).n_zones);
+	if (!x) x = fread(&n, sizeof(unsigned long), 1, in) != 1;
+	if (!x && n != (*(*mz).mig).n_zones * (*(*mz).mig).n_tracers * length) {
+		x = 2u;
+	} else {}
+	for (i = 0ul; i < n && !x; i++) {
+		TRACER *t = mz -> mig -> tracers[i];
+		x |= fread(&(t -> zone_origin), sizeof(unsigned int), 1, in) != 1;
+		x |= fread(&(t -> timestep_origin), sizeof(unsigned long), 1,
+			in) != 1;
+		x |= fread(t -> zone_history, sizeof(int), length, in) != length;
+	}
+	fclose(in);
+	return x;
+
+}
+
+
+/*
+ * Determine the full path to a checkpoint file.
+ *
+ * Parameters
+ * ==========
+ * filename: 	The string to store the path in
+ * dir: 		The output directory of the simulation
+ * basename: 	The name of the file within the output directory
+ */
+static void checkpoint_filename(char *filename, char *dir, char *basename) {
+
+	strcpy(filename, dir);
+	strcat(filename, "/");
+	strcat(filename, basename);
+
+}
+
+
+/*
+ * Open a temporary file to write a checkpoint to. Checkpoints are written to
+ * a temporary file and renamed once complete, such that a simulation which
+ * is interrupted while writing a checkpoint leaves the previous one intact.
+ *
+ * Parameters
+ * ==========
+ * dir: 		The output directory of the simulation
+ * basename: 	The name of the checkpoint file within the output directory
+ *
+ * Returns
+ * =======
+ * The file pointer, NULL on failure
+ */
+static FILE *checkpoint_open_write(char *dir, char *basename) {
+
+	char filename[MAX_FILENAME_SIZE];
+	checkpoint_filename(filename, dir, basename);
+	strcat(filename, ".tmp");
+	return fopen(filename, "wb");
+
+}
+
+
+/*
+ * Close a checkpoint file opened with checkpoint_open_write and move it into
+ * place.
+ *
+ * Parameters
+ * ==========
+ * out: 		The file pointer to the temporary checkpoint file
+ * dir: 		The output directory of the simulation
+ * basename: 	The name of the checkpoint file within the output directory
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ */
+static unsigned short checkpoint_close_write(FILE *out, char *dir,
+	char *basename) {
+
+	char filename[MAX_FILENAME_SIZE], tmpname[MAX_FILENAME_SIZE];
+	checkpoint_filename(filename, dir, basename);
+	strcpy(tmpname, filename);
+	strcat(tmpname, ".tmp");
+	if (fclose(out)) return 1u;
+	return rename(tmpname, filename) != 0;
+
+}
+
+
+/*
+ * Write the header of a checkpoint file.
+ *
+ * Parameters
+ * ==========
+ * out: 		The file pointer to write to
+ * n_zones: 	The number of zones in the simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ */
+static unsigned short write_header(FILE *out, unsigned int n_zones) {
+
+	unsigned short x = 0u;
+	x |= fwrite(CHECKPOINT_MAGIC, sizeof(char), 8, out) != 8;
+	x |= fwrite(&CHECKPOINT_VERSION, sizeof(unsigned short), 1, out) != 1;
+	x |= fwrite(&n_zones, sizeof(unsigned int), 1, out) != 1;
+	return x;
+
+}
+
+
+/*
+ * Read and verify the header of a checkpoint file.
+ *
+ * Parameters
+ * ==========
+ * in: 			The file pointer to read from
+ * n_zones: 	The number of zones in the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on read failure, 2 if the file is not a checkpoint of this
+ * version or has a different number of zones.
+ */
+static unsigned short read_header(FILE *in, unsigned int n_zones) {
+
+	char magic[8];
+	unsigned short version;
+	unsigned int n;
+	if (fread(magic, sizeof(char), 8, in) != 8 ||
+		fread(&version, sizeof(unsigned short), 1, in) != 1 ||
+		fread(&n, sizeof(unsigned int), 1, in) != 1) {
+		return 1u;
+	} else if (memcmp(magic, CHECKPOINT_MAGIC, 8) ||
+		version != CHECKPOINT_VERSION || n != n_zones) {
+		return 2u;
+	} else {
+		return 0u;
+	}
+
+}
+
+
+/*
+ * Write the time-evolving state of a single zone to a checkpoint file.
+ *
+ * Parameters
+ * ==========
+ * out: 	The file pointer to write to
+ * sz: 		A pointer to the singlezone object to write the state of
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ */
+static unsigned short write_zone_state(FILE *out, SINGLEZONE *sz) {
+
+	/*
+	 * Flush the output files first such that the recorded positions mark
+	 * the end of everything written so far.
+	 */
+	if (fflush((*sz).history_writer) || fflush((*sz).mdf_writer)) return 1u;
+	long history_offset = ftell((*sz).history_writer);
+	long mdf_offset = ftell((*sz).mdf_writer);
+	if (history_offset < 0l || mdf_offset < 0l) return 1u;
+
+	unsigned int i;
+	unsigned long n = (*sz).timestep + 1ul;
+	unsigned long n_ratios = (unsigned long) (
+		(*sz).n_elements * ((*sz).n_elements - 1u) / 2u);
+	unsigned short x = 0u;
+	x |= fwrite(&(*sz).n_elements, sizeof(unsigned int), 1, out) != 1;
+	x |= fwrite(&(*(*sz).mdf).n_bins, sizeof(unsigned long), 1, out) != 1;
+	x |= fwrite(&(*sz).dt, sizeof(double), 1, out) != 1;
+	x |= fwrite(&(*sz).current_time, sizeof(double), 1, out) != 1;
+	x |= fwrite(&(*sz).timestep, sizeof(unsigned long), 1, out) != 1;
+	x |= fwrite(&(*sz).output_index, sizeof(unsigned long), 1, out) != 1;
+	x |= fwrite(&(*sz).trial_step, sizeof(unsigned long), 1, out) != 1;
+	x |= fwrite(&history_offset, sizeof(long), 1, out) != 1;
+	x |= fwrite(&mdf_offset, sizeof(long), 1, out) != 1;
+	x |= fwrite(&(*(*sz).ism).mass, sizeof(double), 1, out) != 1;
+	x |= fwrite(&(*(*sz).ism).star_formation_rate, sizeof(double), 1,
+		out) != 1;
+	x |= fwrite(&(*(*sz).ism).infall_rate, sizeof(double), 1, out) != 1;
+	x |= fwrite((*(*sz).ism).star_formation_history, sizeof(double), n,
+		out) != n;
+	for (i = 0u; i < (*sz).n_elements; i++) {
+		ELEMENT *e = (*sz).elements[i];
+		x |= fwrite(&(*e).mass, sizeof(double), 1, out) != 1;
+		x |= fwrite(&(*e).unretained, sizeof(double), 1, out) != 1;
+		x |= fwrite((*(*sz).mdf).abundance_distributions[i], sizeof(double),
+			(*(*sz).mdf).n_bins, out) != (*(*sz).mdf).n_bins;
+	}
+	unsigned long j;
+	for (j = 0ul; j < n_ratios; j++) {
+		x |= fwrite((*(*sz).mdf).ratio_distributions[j], sizeof(double),
+			(*(*sz).mdf).n_bins, out) != (*(*sz).mdf).n_bins;
+	}
+	/* The metallicity of every element at each timestep, in one block */
+	n *= (*sz).n_elements;
+	x |= fwrite((*(*sz).state).Z, sizeof(double), n, out) != n;
+	return x;
+
+}
+
+
+/*
+ * Read the time-evolving state of a single zone from a checkpoint file and
+ * reopen its output files at the positions recorded in the checkpoint.
+ *
+ * Parameters
+ * ==========
+ * in: 		The file pointer to read from
+ * sz: 		A pointer to the singlezone object to restore the state of
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure, 2 if the checkpoint does not describe this zone
+ */
+static unsigned short read_zone_state(FILE *in, SINGLEZONE *sz) {
+
+	unsigned int n_elements;
+	unsigned long n_bins, timestep;
+	double dt;
+	if (fread(&n_elements, sizeof(unsigned int), 1, in) != 1 ||
+		fread(&n_bins, sizeof(unsigned long), 1, in) != 1 ||
+		fread(&dt, sizeof(double), 1, in) != 1) {
+		return 1u;
+	} else if (n_elements != (*sz).n_elements ||
+		n_bins != (*(*sz).mdf).n_bins || dt != (*sz).dt) {
+		return 2u;
+	} else {}
+
+	long history_offset, mdf_offset;
+	unsigned short x = 0u;
+	x |= fread(&(sz -> current_time), sizeof(double), 1, in) != 1;
+	x |= fread(&timestep, sizeof(unsigned long), 1, in) != 1;
+	if (x) return 1u;
+	/* The checkpoint must lie within the allocated time interval */
+	if (timestep + 1ul >= n_timesteps(*sz)) return 2u;
+	sz -> timestep = timestep;
+
+	unsigned int i;
+	unsigned long n = timestep + 1ul;
+	unsigned long n_ratios = (unsigned long) (
+		(*sz).n_elements * ((*sz).n_elements - 1u) / 2u);
+	x |= fread(&(sz -> output_index), sizeof(unsigned long), 1, in) != 1;
+	x |= fread(&(sz -> trial_step), sizeof(unsigned long), 1, in) != 1;
+	x |= fread(&history_offset, sizeof(long), 1, in) != 1;
+	x |= fread(&mdf_offset, sizeof(long), 1, in) != 1;
+	x |= fread(&(sz -> ism -> mass), sizeof(double), 1, in) != 1;
+	x |= fread(&(sz -> ism -> star_formation_rate), sizeof(double), 1,
+		in) != 1;
+	x |= fread(&(sz -> ism -> infall_rate), sizeof(double), 1, in) != 1;
+	x |= fread(sz -> ism -> star_formation_history, sizeof(double), n,
+		in) != n;
+	for (i = 0u; i < (*sz).n_elements; i++) {
+		ELEMENT *e = sz -> elements[i];
+		x |= fread(&(e -> mass), sizeof(double), 1, in) != 1;
+		x |= fread(&(e -> unretained), sizeof(double), 1, in) != 1;
+		x |= fread(sz -> mdf -> abundance_distributions[i], sizeof(double),
+			n_bins, in) != n_bins;
+	}
+	unsigned long j;
+	for (j = 0ul; j < n_ratios; j++) {
+		x |= fread(sz -> mdf -> ratio_distributions[j], sizeof(double),
+			n_bins, in) != n_bins;
+	}
+	n *= (*sz).n_elements;
+	x |= fread(sz -> state -> Z, sizeof(double), n, in) != n;
+	if (x) return 1u;
+
+	if (reopen_output_file(&(sz -> history_writer), (*sz).name,
+		"history.out", history_offset)) return 1u;
+	if (reopen_output_file(&(sz -> mdf_writer), (*sz).name, "mdf.out",
+		mdf_offset)) return 1u;
+	return 0u;
+
+}
+
+
+/*
+ * Discard everything written to an output file after a given position and
+ * open it for appending.
+ *
+ * Parameters
+ * ==========
+ * writer: 		A pointer to the FILE pointer to reopen
+ * dir: 		The output directory of the simulation
+ * basename: 	The name of the output file within the directory
+ * offset: 		The position in bytes to truncate the file at
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ */
+static unsigned short reopen_output_file(FILE **writer, char *dir,
+	char *basename, long offset) {
+
+	char filename[MAX_FILENAME_SIZE];
+	checkpoint_filename(filename, dir, basename);
+	if (*writer != NULL) {
+		fclose(*writer);
+		*writer = NULL;
+	} else {}
+	if (truncate(filename, (off_t) offset)) return 1u;
+	*writer = fopen(filename, "a");
+	return *writer == NULL;
+
+}
+
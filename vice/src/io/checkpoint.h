@@ -0,0 +1,143 @@
+
+#ifndef IO_CHECKPOINT_H
+#define IO_CHECKPOINT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* The name of the checkpoint file within a simulation's output directory */
+#ifndef CHECKPOINT_FILE
+#define CHECKPOINT_FILE "checkpoint.bin"
+#endif /* CHECKPOINT_FILE */
+
+/* The name of the star particle zone history file for multizone models */
+#ifndef TRACER_CHECKPOINT_FILE
+#define TRACER_CHECKPOINT_FILE "checkpoint_tracers.bin"
+#endif /* TRACER_CHECKPOINT_FILE */
+
+#include "../objects.h"
+
+/*
+ * Determine whether or not a checkpoint is due at the current timestep.
+ *
+ * Parameters
+ * ==========
+ * interval: 	The time between checkpoints in Gyr. Zero disables checkpoints.
+ * dt: 			The timestep size in Gyr
+ * previous: 	The timestep number before the most recent update
+ * timestep: 	The current timestep number
+ *
+ * Returns
+ * =======
+ * 1 if a checkpoint should be written, 0 otherwise
+ *
+ * source: checkpoint.c
+ */
+extern unsigned short checkpoint_due(double interval, double dt,
+	unsigned long previous, unsigned long timestep);
+
+/*
+ * Write the current state of a singlezone simulation to its checkpoint file.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: checkpoint.c
+ */
+extern unsigned short singlezone_write_checkpoint(SINGLEZONE *sz);
+
+/*
+ * Restore the state of a singlezone simulation from its checkpoint file and
+ * reopen its output files where they were left off.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object, already set up for simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on file I/O error, 2 if the checkpoint does not describe
+ * the current simulation
+ *
+ * source: checkpoint.c
+ */
+extern unsigned short singlezone_read_checkpoint(SINGLEZONE *sz);
+
+/*
+ * Write the current state of a multizone simulation to its checkpoint file.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: checkpoint.c
+ */
+extern unsigned short multizone_write_checkpoint(MULTIZONE *mz);
+
+/*
+ * Write the zone histories of every star particle in a multizone simulation
+ * to a file, allowing them to be restored exactly upon resuming even if the
+ * stellar migration prescription is stochastic.
+ *
+ * Parameters
+ * ==========
+ * mz: 		The multizone object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: checkpoint.c
+ */
+extern unsigned short multizone_write_tracer_checkpoint(MULTIZONE mz);
+
+/*
+ * Restore the state of a multizone simulation from its checkpoint file and
+ * reopen each zone's output files where they were left off.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object, already set up for simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on file I/O error, 2 if the checkpoint does not describe
+ * the current simulation
+ *
+ * source: checkpoint.c
+ */
+extern unsigned short multizone_read_checkpoint(MULTIZONE *mz);
+
+/*
+ * Restore the zone histories of every star particle in a multizone
+ * simulation from the file written by multizone_write_tracer_checkpoint.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object, already set up for simulation
+ *
+ * Returns
+ * =======
+ * 0 on success or if the file does not exist, 1 on file I/O error, 2 if the
+ * file does not describe the current simulation
+ *
+ * source: checkpoint.c
+ */
+extern unsigned short multizone_read_tracer_checkpoint(MULTIZONE *mz);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* IO_CHECKPOINT_H */
+
@@ -0,0 +1,182 @@
+/*
+ * This file implements file I/O for the ensemble object. The output of every
+ * member is written to a single history.out and mdf.out file, with the index
+ * of the member in the first column.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "../io.h"
+#include "ensemble.h"
+
+/*
+ * Open the history.out and mdf.out output files associated with an ensemble
+ * object.
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: ensemble.h
+ */
+extern unsigned short ensemble_open_files(ENSEMBLE *ens) {
+
+	char *history_file = (char *) malloc (MAX_FILENAME_SIZE * sizeof(char));
+	char *mdf_file = (char *) malloc (MAX_FILENAME_SIZE * sizeof(char));
+
+	strcpy(history_file, (*ens).name);
+	strcpy(mdf_file, (*ens).name);
+	strcat(history_file, "/history.out");
+	strcat(mdf_file, "/mdf.out");
+
+	ens -> history_writer = fopen(history_file, "w");
+	ens -> mdf_writer = fopen(mdf_file, "w");
+
+	free(history_file);
+	free(mdf_file);
+
+	if ((*ens).history_writer == NULL || (*ens).mdf_writer == NULL) {
+		ensemble_close_files(ens);
+		return 1;
+	} else {
+		return 0;
+	}
+
+}
+
+/*
+ * Close the history.out and mdf.out output files associated with an
+ * ensemble object and set their values back to NULL.
+ *
+ * header: ensemble.h
+ */
+extern void ensemble_close_files(ENSEMBLE *ens) {
+
+	if ((*ens).history_writer != NULL) {
+		fclose(ens -> history_writer);
+		ens -> history_writer = NULL;
+	} else {}
+	if ((*ens).mdf_writer != NULL) {
+		fclose(ens -> mdf_writer);
+		ens -> mdf_writer = NULL;
+	} else {}
+
+}
+
+/*
+ * Writes the header to the history file of an ensemble.
+ *
+ * Parameters
+ * ==========
+ * ens: 	The ENSEMBLE object for the current simulation
+ *
+ * header: ensemble.h
+ */
+extern void write_ensemble_history_header(ENSEMBLE ens) {
+
+	/*
+	 * The columns are those of the singlezone object's history.out file,
+	 * shifted by one to make room for the member index. Every member tracks
+	 * the same elements, so the first determines the column labels.
+	 */
+	SINGLEZONE sz = *ens.members[0];
+	fprintf(ens.history_writer, "# COLUMN NUMBERS: \n");
+	fprintf(ens.history_writer, "#\t0: member\t\t\tEnsemble member index\n");
+	fprintf(ens.history_writer, "#\t1: time [Gyr]\n");
+	fprintf(ens.history_writer, "#\t2: mgas [Msun]\t\t\tISM gas mass\n");
+	fprintf(ens.history_writer, "#\t3: mstar [Msun]\t\t\tStellar mass\n");
+	fprintf(ens.history_writer, "#\t4: sfr [Msun/yr]\t\tStar formation rate\n");
+	fprintf(ens.history_writer, "#\t5: ifr [Msun/yr]\t\tInfall rate\n");
+	fprintf(ens.history_writer, "#\t6: ofr [Msun/yr]\t\tOutfow rate\n");
+	fprintf(ens.history_writer, "#\t7: eta_0\t\t\tMass-loading factor\n");
+	fprintf(ens.history_writer, "#\t8: r_eff\t\t\tEffective recycilng rate\n");
+
+	unsigned int i, n = 9;
+	for (i = 0; i < sz.n_elements; i++) {
+		/* Inflow metallicity for each element */
+		fprintf(ens.history_writer,
+			"#\t%d: z_in(%s)\t\t\tInflow %s metallicity\n",
+			n, (*sz.elements[i]).symbol, (*sz.elements[i]).symbol);
+		n++;
+	}
+	for (i = 0; i < sz.n_elements; i++) {
+		/* Outflow metallicity for each element */
+		fprintf(ens.history_writer,
+			"#\t%d: z_out(%s)\t\t\tOutflow %s metallicity\n",
+			n, (*sz.elements[i]).symbol, (*sz.elements[i]).symbol);
+		n++;
+	}
+	for (i = 0; i < sz.n_elements; i++) {
+		/* ISM mass of each element in Msun */
+		fprintf(ens.history_writer,
+			"#\t%d: mass(%s) [Msun]\t\tmass of element %s in ISM\n",
+			n, (*sz.elements[i]).symbol, (*sz.elements[i]).symbol);
+		n++;
+	}
+
+}
+
+/*
+ * Writes the header to the mdf output file of an ensemble.
+ *
+ * Parameters
+ * ==========
+ * ens: 	The ENSEMBLE object for the current simulation
+ *
+ * header: ensemble.h
+ */
+extern void write_ensemble_mdf_header(ENSEMBLE ens) {
+
+	unsigned int i, j;
+	SINGLEZONE sz = *ens.members[0];
+	fprintf(ens.mdf_writer, "# member\tbin_edge_left\tbin_edge_right\t");
+	for (i = 0; i < sz.n_elements; i++) {
+		fprintf(ens.mdf_writer, "dN/d[%s/H]\t", (*sz.elements[i]).symbol);
+	}
+	for (i = 1; i < sz.n_elements; i++) {
+		for (j = 0; j < i; j++) {
+			fprintf(ens.mdf_writer, "dN/d[%s/%s]\t",
+				(*sz.elements[i]).symbol, (*sz.elements[j]).symbol);
+		}
+	}
+	fprintf(ens.mdf_writer, "\n");
+
+}
+
+/*
+ * Copy the output of one member of an ensemble to one of the ensemble's
+ * output files, prefixing each line with the index of the member.
+ *
+ * Parameters
+ * ==========
+ * out: 		The ensemble's output file
+ * in: 			The file holding the member's output
+ * member: 		The index of the member
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: ensemble.h
+ */
+extern unsigned short append_member_output(FILE *out, FILE *in,
+	unsigned long member) {
+
+	/*
+	 * Lines longer than the buffer are copied in pieces, in which case only
+	 * the first piece receives the member index.
+	 */
+	char *line = (char *) malloc (LINESIZE * sizeof(char));
+	unsigned short x = 0u, start_of_line = 1u;
+	rewind(in);
+	while (!x && fgets(line, LINESIZE, in) != NULL) {
+		if (start_of_line) fprintf(out, "%lu\t", member);
+		x = fputs(line, out) == EOF;
+		start_of_line = line[strlen(line) - 1ul] == '\n';
+	}
+	free(line);
+	return x || ferror(in);
+
+}
+
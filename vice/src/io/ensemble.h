@@ -0,0 +1,77 @@
+
+#ifndef IO_ENSEMBLE_H
+#define IO_ENSEMBLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "../objects.h"
+
+/*
+ * Open the history.out and mdf.out output files associated with an ensemble
+ * object.
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: ensemble.c
+ */
+extern unsigned short ensemble_open_files(ENSEMBLE *ens);
+
+/*
+ * Close the history.out and mdf.out output files associated with an
+ * ensemble object and set their values back to NULL.
+ *
+ * source: ensemble.c
+ */
+extern void ensemble_close_files(ENSEMBLE *ens);
+
+/*
+ * Writes the header to the history file of an ensemble.
+ *
+ * Parameters
+ * ==========
+ * ens: 	The ENSEMBLE object for the current simulation
+ *
+ * source: ensemble.c
+ */
+extern void write_ensemble_history_header(ENSEMBLE ens);
+
+/*
+ * Writes the header to the mdf output file of an ensemble.
+ *
+ * Parameters
+ * ==========
+ * ens: 	The ENSEMBLE object for the current simulation
+ *
+ * source: ensemble.c
+ */
+extern void write_ensemble_mdf_header(ENSEMBLE ens);
+
+/*
+ * Copy the output of one member of an ensemble to one of the ensemble's
+ * output files, prefixing each line with the index of the member.
+ *
+ * Parameters
+ * ==========
+ * out: 		The ensemble's output file
+ * in: 			The file holding the member's output
+ * member: 		The index of the member
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: ensemble.c
+ */
+extern unsigned short append_member_output(FILE *out, FILE *in,
+	unsigned long member);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* IO_ENSEMBLE_H */
+
@@ -12,6 +12,11 @@
 #include "multizone.h"
 #include "progressbar.h"
 
+/* ---------- Static function comment headers not duplicated here ---------- */
+static void write_tracer(MULTIZONE mz, TRACER t, unsigned short width);
+static void update_tracer_zones(MULTIZONE mz, PROGRESSBAR *pb);
+static unsigned short tracers_zone_width(MIGRATION mig);
+
 /*
  * Writes history output for each zone in a multizone simulation
  *
@@ -55,7 +60,8 @@ extern void write_multizone_mdf(MULTIZONE mz) {
 }
 
 /*
- * Opens the tracers output file at the end of a multizone simulation.
+ * Opens the tracers output file of a multizone simulation. Star particle
+ * data is written to it in large buffered writes as the simulation evolves.
  *
  * Parameters
  * ==========
@@ -73,15 +79,27 @@ extern unsigned short multizone_open_tracer_file(MULTIZONE *mz) {
 		char filename[MAX_FILENAME_SIZE];
 		strcpy(filename, (*mz).name);
 		strcat(filename, "/tracers.out");
-		mz -> mig -> tracers_output = fopen(filename, "w");
+
+		/*
+		 * Opened for updating so that the final zones of the star particles
+		 * can be filled in once the simulation is over.
+		 */
+		mz -> mig -> tracers_output = fopen(filename, "w+");
+		if ((*(*mz).mig).tracers_output != NULL) {
+			mz -> mig -> tracers_buffer = (char *) malloc (
+				TRACERS_BUFFER_SIZE * sizeof(char));
+			setvbuf(mz -> mig -> tracers_output, mz -> mig -> tracers_buffer,
+				_IOFBF, TRACERS_BUFFER_SIZE);
+			mz -> mig -> tracers_written = 0ul;
+			mz -> mig -> tracers_offset = 0l;
+		} else {}
 	} else {}
 	return (*(*mz).mig).tracers_output == NULL;
 
 }
 
 /*
- * Writes the header to the tracers output file at the end of a multizone
- * simulation
+ * Writes the header to the tracers output file of a multizone simulation
  *
  * Parameters
  * ==========
@@ -111,12 +129,42 @@ extern void write_tracers_header(MULTIZONE mz) {
 			(*(*mz.zones[0]).elements[i]).symbol);
 		n++;
 	}
+	mz.mig -> tracers_offset = ftell((*mz.mig).tracers_output);
 
 }
 
 /*
- * Writes the tracer data to the output file at the end of a multizone
- * simulation
+ * Writes the data of the tracer particles injected since the previous call
+ * to the output file. The formation time, zone of origin, mass, and
+ * metallicity of a tracer particle do not change once it is injected, so
+ * they are written while the simulation evolves. Its final zone is written
+ * as its current zone, and corrected at the end of the simulation by
+ * write_tracers_output.
+ *
+ * Parameters
+ * ==========
+ * mz: 			The multizone object
+ *
+ * header: multizone.h
+ */
+extern void write_tracer_cohorts(MULTIZONE mz) {
+
+	if ((*mz.mig).tracers_output != NULL) {
+		unsigned short width = tracers_zone_width(*mz.mig);
+		unsigned long i;
+		for (i = (*mz.mig).tracers_written; i < (*mz.mig).tracer_count; i++) {
+			write_tracer(mz, *(*mz.mig).tracers[i], width);
+		}
+		mz.mig -> tracers_written = (*mz.mig).tracer_count;
+	} else {}
+
+}
+
+/*
+ * Completes the tracer data in the output file at the end of a multizone
+ * simulation. The final zones of the tracer particles written while the
+ * simulation evolved are updated in place, and any tracer particles not
+ * yet written are appended.
  *
  * Parameters
  * ==========
@@ -132,47 +180,26 @@ extern void write_tracers_output(MULTIZONE mz) {
 	 * Tracer output expanded to contain the mass and metallicity of each
 	 * tracer particle along with the formation time and initial and final
 	 * zone numbers.
+	 *
+	 * Version 1.3.0: Tracer particles are written as they are injected,
+	 * leaving only their final zones to be written at the end.
 	 */
 
-	PROGRESSBAR *pb;
+	PROGRESSBAR *pb = NULL;
 	if (mz.verbose) {
 		printf("Saving star particle data....\n");
 		pb = progressbar_initialize((*mz.mig).tracer_count);
 	} else {}
-	unsigned long i;
-	for (i = 0l; i < (*mz.mig).tracer_count; i++) {
-		FILE *out = (*mz.mig).tracers_output;
-		TRACER t = *(*mz.mig).tracers[i];
-		SINGLEZONE origin = *(mz.zones[t.zone_origin]);
-
-		/*
-		 * If the tracer particle formed **before** the user's specified
-		 * final output time.
-		 */
-		if (t.timestep_origin * origin.dt <=
-			origin.output_times[origin.n_outputs - 1l]) {
-
-			/* Formation time, final and origin zones, and mass in Msun */
-			fprintf(out, "%e\t", t.timestep_origin * origin.dt);
-			fprintf(out, "%u\t", t.zone_origin);
-			fprintf(out, "%u\t", t.zone_current);
-			fprintf(out, "%e\t", t.mass);
-
-			/* Metallicity by mass of each element in the simulation */
-			unsigned int j;
-			for (j = 0; j < origin.n_elements; j++) {
-				fprintf(out, "%e\t",
-					(*origin.elements[j]).Z[t.timestep_origin]);
-			}
-			fprintf(out, "\n");
-
-		/*
-		 * Otherwise don't include it in the output.
-		 */
-		} else {}
+	update_tracer_zones(mz, pb);
 
+	unsigned short width = tracers_zone_width(*mz.mig);
+	unsigned long i;
+	fseek((*mz.mig).tracers_output, 0l, SEEK_END);
+	for (i = (*mz.mig).tracers_written; i < (*mz.mig).tracer_count; i++) {
+		write_tracer(mz, *(*mz.mig).tracers[i], width);
 		if (mz.verbose) progressbar_update(pb, i + 1ul);
 	}
+	mz.mig -> tracers_written = (*mz.mig).tracer_count;
 	if (mz.verbose) {
 		progressbar_finish(pb);
 		progressbar_free(pb);
@@ -180,6 +207,126 @@ extern void write_tracers_output(MULTIZONE mz) {
 
 }
 
+/*
+ * Writes the data of one tracer particle to the output file.
+ *
+ * Parameters
+ * ==========
+ * mz: 			The multizone object
+ * t: 			The tracer particle
+ * width: 		The width of the final zone field, in characters
+ */
+static void write_tracer(MULTIZONE mz, TRACER t, unsigned short width) {
+
+	FILE *out = (*mz.mig).tracers_output;
+	SINGLEZONE origin = *(mz.zones[t.zone_origin]);
+
+	/*
+	 * If the tracer particle formed **before** the user's specified final
+	 * output time.
+	 */
+	if (t.timestep_origin * origin.dt <=
+		origin.output_times[origin.n_outputs - 1l]) {
+
+		/* Formation time, final and origin zones, and mass in Msun */
+		fprintf(out, "%e\t%u\t%*u\t%e\t", t.timestep_origin * origin.dt,
+			t.zone_origin, (int) width, t.zone_current, t.mass);
+
+		/* Metallicity by mass of each element in the simulation */
+		unsigned int j;
+		for (j = 0; j < origin.n_elements; j++) {
+			fprintf(out, "%e\t", (*origin.state).Z[t.timestep_origin *
+				origin.n_elements + j]);
+		}
+		fprintf(out, "\n");
+
+	/*
+	 * Otherwise don't include it in the output.
+	 */
+	} else {}
+
+}
+
+/*
+ * Updates the final zones of the tracer particles already written to the
+ * output file to their current zones. The file is read and written back in
+ * large chunks, overwriting only the third column of each line, which was
+ * written with a fixed width.
+ *
+ * Parameters
+ * ==========
+ * mz: 			The multizone object
+ * pb: 			The progressbar to update, or NULL for none
+ */
+static void update_tracer_zones(MULTIZONE mz, PROGRESSBAR *pb) {
+
+	if (!(*mz.mig).tracers_written) return;
+	FILE *out = (*mz.mig).tracers_output;
+	unsigned short width = tracers_zone_width(*mz.mig);
+	char *chunk = (char *) malloc (TRACERS_BUFFER_SIZE * sizeof(char));
+	char zone[12];
+	long position = (*mz.mig).tracers_offset;
+	unsigned long row = 0ul;
+	unsigned short tabs = 0u, remaining = 0u;
+	fflush(out);
+
+	/*
+	 * Rows are in the same order as the tracer particles. Tracer particles
+	 * formed after the final output time are never written, and they are
+	 * always the last ones injected.
+	 */
+	while (row < (*mz.mig).tracers_written) {
+		fseek(out, position, SEEK_SET);
+		size_t i, size = fread(chunk, sizeof(char), TRACERS_BUFFER_SIZE, out);
+		if (!size) break;
+		for (i = 0; i < size && row < (*mz.mig).tracers_written; i++) {
+			if (remaining) {
+				chunk[i] = zone[width - remaining];
+				remaining--;
+			} else if (chunk[i] == '\t') {
+				/* The final zone follows the second tab on each line */
+				if (++tabs == 2u) {
+					sprintf(zone, "%*u", (int) width,
+						(*(*mz.mig).tracers[row]).zone_current);
+					remaining = width;
+				} else {}
+			} else if (chunk[i] == '\n') {
+				tabs = 0u;
+				row++;
+			} else {}
+		}
+		fseek(out, position, SEEK_SET);
+		fwrite(chunk, sizeof(char), size, out);
+		position += (long) size;
+		if (pb != NULL) progressbar_update(pb, row);
+	}
+	free(chunk);
+
+}
+
+/*
+ * Determine the width of the final zone column in the tracers output file.
+ *
+ * Parameters
+ * ==========
+ * mig: 		The migration settings of the multizone object
+ *
+ * Returns
+ * =======
+ * The number of digits in the largest zone number.
+ */
+static unsigned short tracers_zone_width(MIGRATION mig) {
+
+	unsigned short width = 1u;
+	unsigned int n = mig.n_zones - 1u;
+	while (n >= 10u) {
+		n /= 10u;
+		width++;
+	}
+	return width;
+
+}
+
 /*
  * Closes the tracer output file at the end of a multizone simulation
  *
@@ -195,6 +342,8 @@ extern void multizone_close_tracer_file(MULTIZONE *mz) {
 		fclose(mz -> mig -> tracers_output);
 		mz -> mig -> tracers_output = NULL;
 	} else {}
+	free(mz -> mig -> tracers_buffer);
+	mz -> mig -> tracers_buffer = NULL;
 
 }
 
@@ -8,6 +8,11 @@ extern "C" {
 
 #include "../objects.h"
 
+/* The size of the buffer for writes to the tracers output file in bytes */
+#ifndef TRACERS_BUFFER_SIZE
+#define TRACERS_BUFFER_SIZE 4194304ul
+#endif /* TRACERS_BUFFER_SIZE */
+
 /*
  * Writes history output for each zone in a multizone simulation
  *
@@ -31,7 +36,8 @@ extern void write_multizone_history(MULTIZONE mz);
 extern void write_multizone_mdf(MULTIZONE mz);
 
 /*
- * Opens the tracers output file at the end of a multizone simulation.
+ * Opens the tracers output file of a multizone simulation. Star particle
+ * data is written to it in large buffered writes as the simulation evolves.
  *
  * Parameters
  * ==========
@@ -46,8 +52,7 @@ extern void write_multizone_mdf(MULTIZONE mz);
 extern unsigned short multizone_open_tracer_file(MULTIZONE *mz);
 
 /*
- * Writes the header to the tracers output file at the end of a multizone
- * simulation
+ * Writes the header to the tracers output file of a multizone simulation
  *
  * Parameters
  * ==========
@@ -58,8 +63,26 @@ extern unsigned short multizone_open_tracer_file(MULTIZONE *mz);
 extern void write_tracers_header(MULTIZONE mz);
 
 /*
- * Writes the tracer data to the output file at the end of a multizone
- * simulation
+ * Writes the data of the tracer particles injected since the previous call
+ * to the output file. The formation time, zone of origin, mass, and
+ * metallicity of a tracer particle do not change once it is injected, so
+ * they are written while the simulation evolves. Its final zone is written
+ * as its current zone, and corrected at the end of the simulation by
+ * write_tracers_output.
+ *
+ * Parameters
+ * ==========
+ * mz: 			The multizone object
+ *
+ * source: multizone.c
+ */
+extern void write_tracer_cohorts(MULTIZONE mz);
+
+/*
+ * Completes the tracer data in the output file at the end of a multizone
+ * simulation. The final zones of the tracer particles written while the
+ * simulation evolved are updated in place, and any tracer particles not
+ * yet written are appended.
  *
  * Parameters
  * ==========
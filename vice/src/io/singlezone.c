@@ -65,6 +65,124 @@ extern void singlezone_close_files(SINGLEZONE *sz) {
 
 }
 
+/*
+ * Open the response.out output file associated with a SINGLEZONE object
+ * recording the linear response of each element's mass to its yields, and
+ * write its header.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the SINGLEZONE object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: singlezone.h
+ */
+extern unsigned short open_response_file(SINGLEZONE *sz) {
+
+	char *response_file = (char *) malloc (MAX_FILENAME_SIZE * sizeof(char));
+	strcpy(response_file, (*sz).name);
+	strcat(response_file, "/response.out");
+	sz -> response -> writer = fopen(response_file, "w");
+	free(response_file);
+	if ((*(*sz).response).writer == NULL) return 1u;
+
+	FILE *writer = (*(*sz).response).writer;
+	fprintf(writer, "# COLUMN NUMBERS: \n");
+	fprintf(writer, "#\t0: time [Gyr]\n");
+	fprintf(writer, "#\t1: mgas [Msun]\t\t\tISM gas mass\n");
+	unsigned int i, n = 2;
+	for (i = 0; i < (*sz).n_elements; i++) {
+		char *symbol = (*(*sz).elements[i]).symbol;
+		fprintf(writer,
+			"#\t%d: ccsne(%s) [Msun]\t\tmass of %s per unit CCSN yield\n",
+			n++, symbol, symbol);
+		fprintf(writer,
+			"#\t%d: sneia(%s) [Msun]\t\tmass of %s per unit SN Ia yield\n",
+			n++, symbol, symbol);
+		fprintf(writer,
+			"#\t%d: agb(%s) [Msun]\t\tmass of %s from AGB stars\n",
+			n++, symbol, symbol);
+		fprintf(writer,
+			"#\t%d: other(%s) [Msun]\t\tmass of %s with zero yields\n",
+			n++, symbol, symbol);
+	}
+	return 0u;
+
+}
+
+/*
+ * Open the sensitivities.out output file associated with a SINGLEZONE object
+ * recording the derivatives of the ISM mass and the mass of each element
+ * with respect to the parameters selected by the user, and write its header.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the SINGLEZONE object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: singlezone.h
+ */
+extern unsigned short open_sensitivity_file(SINGLEZONE *sz) {
+
+	char *sensitivity_file = (char *) malloc (MAX_FILENAME_SIZE *
+		sizeof(char));
+	strcpy(sensitivity_file, (*sz).name);
+	strcat(sensitivity_file, "/sensitivities.out");
+	sz -> sensitivity -> writer = fopen(sensitivity_file, "w");
+	free(sensitivity_file);
+	if ((*(*sz).sensitivity).writer == NULL) return 1u;
+
+	/* Each derivative is labeled d(quantity)/d(parameter) */
+	SENSITIVITY sens = *(*sz).sensitivity;
+	FILE *writer = sens.writer;
+	fprintf(writer, "# COLUMN NUMBERS: \n");
+	fprintf(writer, "#\t0: time [Gyr]\n");
+	unsigned int i, n = 1;
+	unsigned short k;
+	for (k = 0u; k < sens.n_params; k++) {
+		char *param = (char *) malloc (MAX_FILENAME_SIZE * sizeof(char));
+		char *units;
+		switch (sens.params[k]) {
+			case SENSITIVITY_ETA:
+				strcpy(param, "eta");
+				units = "Msun";
+				break;
+			case SENSITIVITY_TAU_STAR:
+				strcpy(param, "tau_star");
+				units = "Msun/Gyr";
+				break;
+			case SENSITIVITY_TAU_IA:
+				strcpy(param, "tau_ia");
+				units = "Msun/Gyr";
+				break;
+			case SENSITIVITY_CCSNE:
+				sprintf(param, "ccsne(%s)",
+					(*(*sz).elements[sens.elements[k]]).symbol);
+				units = "Msun";
+				break;
+			default:
+				sprintf(param, "sneia(%s)",
+					(*(*sz).elements[sens.elements[k]]).symbol);
+				units = "Msun";
+				break;
+		}
+		fprintf(writer, "#\t%d: d(mgas)/d(%s) [%s]\n", n++, param, units);
+		for (i = 0; i < (*sz).n_elements; i++) {
+			fprintf(writer, "#\t%d: d(mass(%s))/d(%s) [%s]\n", n++,
+				(*(*sz).elements[i]).symbol, param, units);
+		}
+		free(param);
+	}
+	return 0u;
+
+}
+
 /*
  * Writes the header to the history file
  *
@@ -140,6 +258,8 @@ extern void write_singlezone_history(SINGLEZONE sz) {
 	write_zone_history(sz, singlezone_stellar_mass(sz), mass_recycled(sz, NULL),
 		unretained);
 	free(unretained);
+	if (sz.response != NULL) write_response_output(sz);
+	if (sz.sensitivity != NULL) write_sensitivity_output(sz);
 
 }
 
@@ -216,10 +336,11 @@ extern void write_zone_history(SINGLEZONE sz, double mstar,
 			fprintf(sz.history_writer, "%e\t",
 				(*sz.elements[i]).Zin[sz.timestep]);
 		}
+		double *Z = (*sz.state).Z + sz.timestep * sz.n_elements;
 		for (i = 0; i < sz.n_elements; i++) {
 			/* outflow metallicity = enhancement factor x ISM metallicity */
 			fprintf(sz.history_writer, "%e\t",
-				((*sz.ism).enh[sz.timestep] * (*sz.elements[i]).Z[sz.timestep] *
+				((*sz.ism).enh[sz.timestep] * Z[i] *
 					get_outflow_rate(sz) + unretained[i]) /
 				(get_outflow_rate(sz) + sum(unretained, sz.n_elements)));
 		}
@@ -233,6 +354,60 @@ extern void write_zone_history(SINGLEZONE sz, double mstar,
 
 }
 
+/*
+ * Write output to the response.out file at the current timestep.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE struct for the current simulation
+ *
+ * header: singlezone.h
+ */
+extern void write_response_output(SINGLEZONE sz) {
+
+	/* Only within the output times, exactly as in the history.out file */
+	if (sz.current_time < sz.output_times[sz.n_outputs - 1l] + sz.dt) {
+		unsigned long i;
+		fprintf((*sz.response).writer, "%e\t", sz.current_time);
+		fprintf((*sz.response).writer, "%e\t", (*sz.ism).mass);
+		for (i = 0ul; i < RESPONSE_CHANNELS * sz.n_elements; i++) {
+			fprintf((*sz.response).writer, "%e\t",
+				(*(*sz.response).elements[i]).mass);
+		}
+		fprintf((*sz.response).writer, "\n");
+	} else {}
+
+}
+
+/*
+ * Write output to the sensitivities.out file at the current timestep.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE struct for the current simulation
+ *
+ * header: singlezone.h
+ */
+extern void write_sensitivity_output(SINGLEZONE sz) {
+
+	/* Only within the output times, exactly as in the history.out file */
+	if (sz.current_time < sz.output_times[sz.n_outputs - 1l] + sz.dt) {
+		SENSITIVITY sens = *sz.sensitivity;
+		unsigned short k;
+		unsigned int i;
+		fprintf(sens.writer, "%e\t", sz.current_time);
+		for (k = 0u; k < sens.n_params; k++) {
+			fprintf(sens.writer, "%e\t", sens.mass[k]);
+			for (i = 0u; i < sens.n_elements; i++) {
+				fprintf(sens.writer, "%e\t",
+					sens.element_mass[k * sens.n_elements + i]);
+			}
+		}
+		fprintf(sens.writer, "\n");
+	} else {}
+
+}
+
 /*
  * Writes the header to the mdf output file.
  *
@@ -28,6 +28,40 @@ extern unsigned short singlezone_open_files(SINGLEZONE *sz);
  */
 extern void singlezone_close_files(SINGLEZONE *sz);
 
+/*
+ * Open the response.out output file associated with a SINGLEZONE object
+ * recording the linear response of each element's mass to its yields, and
+ * write its header.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the SINGLEZONE object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: singlezone.c
+ */
+extern unsigned short open_response_file(SINGLEZONE *sz);
+
+/*
+ * Open the sensitivities.out output file associated with a SINGLEZONE object
+ * recording the derivatives of the ISM mass and the mass of each element
+ * with respect to the parameters selected by the user, and write its header.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the SINGLEZONE object for the current simulation
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: singlezone.c
+ */
+extern unsigned short open_sensitivity_file(SINGLEZONE *sz);
+
 /*
  * Writes the header to the history file
  *
@@ -67,6 +101,28 @@ extern void write_singlezone_history(SINGLEZONE sz);
 extern void write_zone_history(SINGLEZONE sz, double mstar,
 	double mass_recycled, double *unretained);
 
+/*
+ * Write output to the response.out file at the current timestep.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE struct for the current simulation
+ *
+ * source: singlezone.c
+ */
+extern void write_response_output(SINGLEZONE sz);
+
+/*
+ * Write output to the sensitivities.out file at the current timestep.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE struct for the current simulation
+ *
+ * source: singlezone.c
+ */
+extern void write_sensitivity_output(SINGLEZONE sz);
+
 /*
  * Writes the header to the mdf output file.
  *
@@ -13,6 +13,7 @@ extern "C"{
 #include "multizone/element.h"
 #include "multizone/ism.h"
 #include "multizone/mdf.h"
+#include "multizone/merging.h"
 #include "multizone/migration.h"
 #include "multizone/multizone.h"
 #include "multizone/recycling.h"
@@ -10,6 +10,7 @@
 #include "../ssp.h"
 #include "agb.h"
 #include "tracer.h"
+#include "merging.h"
 
 /*
  * Determine the mass of a given element produced by AGB stars in each
@@ -34,7 +35,7 @@ extern double *m_AGB_from_tracers(MULTIZONE mz, unsigned short index) {
 	for (i = 0l; i < (*mz.mig).n_zones; i++) {
 		mass[i] = 0;
 	}
-	for (i = 0l; i < (*mz.mig).tracer_count; i++) {
+	for (i = 0l; i < n_enriching_tracers(*mz.mig); i++) {
 		/*
 		 * Get the tracer particle's current zone and metallicity. Use the SSP
 		 * evolutionary parameters from the zone in which the tracer particle
@@ -42,14 +43,15 @@ extern double *m_AGB_from_tracers(MULTIZONE mz, unsigned short index) {
 		 *
 		 * n: The number of timesteps ago the tracer particle formed.
 		 */
-		TRACER *t = mz.mig -> tracers[i];
+		TRACER *t = enriching_tracer(*mz.mig, i);
 		SINGLEZONE *sz = mz.zones[(*t).zone_current];
 		SSP *ssp = mz.zones[(*t).zone_origin] -> ssp;
 		double Z = tracer_metallicity(mz, *t);
 		unsigned long n = timestep - (*t).timestep_origin;
 		mass[(*t).zone_current] += (
 			get_AGB_yield( *(*mz.zones[(*t).zone_origin]).elements[index],
-				Z, dying_star_mass(n * (*sz).dt, (*ssp).postMS, Z)) *
+				Z, dying_star_mass(n * (*sz).dt, (*ssp).postMS, Z,
+					(*mz.zones[(*t).zone_origin]).ctx)) *
 			(*t).mass *
 			((*ssp).msmf[n] - (*ssp).msmf[n + 1l])
 		);
@@ -7,6 +7,7 @@
 #include "../singlezone.h"
 #include "channel.h"
 #include "tracer.h"
+#include "merging.h"
 
 
 /*
@@ -22,8 +23,8 @@
 extern void from_tracers(MULTIZONE *mz) {
 
 	unsigned long i, timestep = (*(*mz).zones[0]).timestep;
-	for (i = 0lu; i < (*(*mz).mig).tracer_count; i++) {
-		TRACER *t = mz -> mig -> tracers[i];
+	for (i = 0lu; i < n_enriching_tracers(*(*mz).mig); i++) {
+		TRACER *t = enriching_tracer(*(*mz).mig, i);
 		unsigned int j;
 		/*
 		 * Enrich the j'th element in the tracer particle's current zone from
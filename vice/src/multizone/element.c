@@ -4,9 +4,9 @@
  */
 
 #include <stdlib.h>
-#include <string.h>
 #include "../multizone.h"
 #include "../singlezone.h"
+#include "../element.h"
 #include "element.h"
 
 
@@ -22,45 +22,86 @@
  */
 extern void update_elements(MULTIZONE *mz) {
 
+	/*
+	 * Change Notes
+	 * ============
+	 * The instantaneous pieces used to be applied one element at a time.
+	 * The depletion terms are the same for every element in a zone up to
+	 * its mass and whether or not it is helium, so they are now computed
+	 * once per zone, and all of its elements are moved forward in a single
+	 * loop over the contiguous arrays in the zone's ELEMENT_STATE.
+	 */
 	unsigned int i, j;
 	for (i = 0u; i < (*(*mz).mig).n_zones; i++) {
 		SINGLEZONE *sz = mz -> zones[i];
-		for (j = 0u; j < (*(*mz).zones[i]).n_elements; j++) {
-			ELEMENT *e = sz -> elements[j];
-			/*
-			 * Instantaneous pieces that don't require tracer particles:
-			 *
-			 * Enrichment from core collapse supernovae
-			 * depletion from star formation
-			 * depletion from outflows
-			 * metal-rich infall
-			 */
+		ELEMENT_STATE *state = (*sz).state;
+		unsigned int n = (*sz).n_elements;
+		double *mass = (*state).mass;
+		double *sources = (*state).sources;
+		double *infall = (*state).infall;
+		unsigned short *helium = (*state).helium;
+		double *ent_cc = (*state).entrainment + ENTRAINMENT_CCSNE * n;
 
-			e -> unretained = 0;
+		/*
+		 * Instantaneous pieces that don't require tracer particles:
+		 *
+		 * Enrichment from core collapse supernovae
+		 * depletion from star formation
+		 * depletion from outflows
+		 * metal-rich infall
+		 */
+		for (j = 0u; j < n; j++) {
+			ELEMENT *e = sz -> elements[j];
 			double m_cc = mdot_ccsne(*sz, *e) * (*sz).dt;
-			e -> mass += (*(*e).ccsne_yields).entrainment * m_cc;
-			e -> unretained += (1 - (*(*e).ccsne_yields).entrainment) * m_cc;
+			e -> unretained = 0;
+			e -> unretained += (1 - ent_cc[j]) * m_cc;
+			sources[j] = ent_cc[j] * m_cc;
+			infall[j] = ((*(*sz).ism).infall_rate * (*sz).dt *
+				(*e).Zin[(*sz).timestep]);
+			mass[j] = (*e).mass;
+		}
 
-			e -> mass -= (
-				(*(*sz).ism).star_formation_rate * (*sz).dt *
-				(*e).mass / (*(*sz).ism).mass
-			);
-			if (strcmp((*e).symbol, "he")) {
-				e -> mass -= (
-					(*(*sz).ism).enh[(*sz).timestep] * get_outflow_rate(*sz) *
-					(*sz).dt * (*e).mass / (*(*sz).ism).mass
-				);
-			} else {
-				e -> mass -= (
-					get_outflow_rate(*sz) * (*sz).dt * (*e).mass /
-					(*(*sz).ism).mass
-				);
+		/*
+		 * Helium is not ejected at an enhanced metallicity, so each
+		 * depletion term takes one of two values, indexed by the helium
+		 * mask.
+		 */
+		double ism = (*(*sz).ism).mass;
+		double sfr = (*(*sz).ism).star_formation_rate;
+		double outflow = get_outflow_rate(*sz);
+		double enh = (*(*sz).ism).enh[(*sz).timestep];
+		if ((*sz).integrator == EXPONENTIAL && ism > 0) {
+			/*
+			 * With the exponential integrator, the depletion is applied at
+			 * a fixed rate over the timestep to the mass at its beginning
+			 * and to the mass added by CCSNe and infall.
+			 */
+			double decay[2], weight[2];
+			unsigned short k;
+			for (k = 0u; k < 2u; k++) {
+				double rate = sfr + outflow * (k ? 1 : enh);
+				decay[k] = exponential_update(1, 0, rate / ism, (*sz).dt);
+				weight[k] = exponential_update(0, 1, rate / ism, (*sz).dt);
+			}
+			for (j = 0u; j < n; j++) {
+				mass[j] = mass[j] * decay[helium[j]] + (
+					sources[j] + infall[j]) * weight[helium[j]];
+			}
+		} else {
+			double depletion[2] = {
+				enh * outflow * (*sz).dt,
+				outflow * (*sz).dt
+			};
+			sfr *= (*sz).dt;
+			for (j = 0u; j < n; j++) {
+				double m = mass[j] + sources[j];
+				m -= sfr * m / ism;
+				m -= depletion[helium[j]] * m / ism;
+				mass[j] = m + infall[j];
 			}
-			e -> mass += (
-				(*(*sz).ism).infall_rate * (*sz).dt * (*e).Zin[(*sz).timestep]
-			);
-
 		}
+
+		for (j = 0u; j < n; j++) sz -> elements[j] -> mass = mass[j];
 	}
 
 	/*
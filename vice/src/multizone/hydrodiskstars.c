@@ -10,16 +10,15 @@
 #include "../utils.h"
 #include "../singlezone.h"
 
-/* The hydrodiskstars object that drives this module */
-static HYDRODISKSTARS *HDS;
-
 
 /*
- * Set the hydrodiskstars object globally.
+ * Set the hydrodiskstars object which drives the migration of star particles
+ * in a multizone simulation.
  *
  * Parameters
  * ==========
- * address: The address of the hydrodiskstars object
+ * mz: 			A pointer to the multizone object
+ * address: 	The address of the hydrodiskstars object
  *
  * Notes
  * =====
@@ -29,9 +28,10 @@ static HYDRODISKSTARS *HDS;
  *
  * header: hydrodiskstars.h
  */
-extern void set_hydrodiskstars_object(unsigned long address) {
+extern void set_hydrodiskstars_object(MULTIZONE *mz,
+	unsigned long address) {
 
-	HDS = (HYDRODISKSTARS *) ((void *) address);
+	mz -> ctx -> hds = (HYDRODISKSTARS *) ((void *) address);
 
 }
 
@@ -42,8 +42,8 @@ extern void set_hydrodiskstars_object(unsigned long address) {
  *
  * Parameters
  * ==========
- * mz: 				The multizone object
- * hds: 			The hydrodiskstars object
+ * mz: 				The multizone object, whose context holds the
+ * 					hydrodiskstars object
  * t: 				A pointer to the tracer object being set up
  * birth_zone: 		The zone of birth
  * birth_timestep: 	The timestep of birth
@@ -59,10 +59,11 @@ extern unsigned short setup_hydrodisk_tracer(MULTIZONE mz, TRACER *t,
 	unsigned int birth_zone, unsigned long birth_timestep, long analog_index) {
 
 	/* The timestep size plus time and radius at which the star is born */
+	HYDRODISKSTARS *hds = (*mz.ctx).hds;
 	double dt = (*mz.zones[0]).dt;
 	double birth_time = birth_timestep * dt;
 	double birth_radius = (
-		((*HDS).rad_bins[birth_zone] + (*HDS).rad_bins[birth_zone + 1u]) / 2
+		((*hds).rad_bins[birth_zone] + (*hds).rad_bins[birth_zone + 1u]) / 2
 	);
 
 	/* In case of sudden migration, this can't be done in the for-loop */
@@ -115,21 +116,21 @@ extern unsigned short setup_hydrodisk_tracer(MULTIZONE mz, TRACER *t,
 			 * number.
 			 */
 
-			switch(checksum((*HDS).mode)) {
+			switch(checksum((*hds).mode)) {
 
 				case LINEAR_MIGRATION:
-					t -> zone_history[i] = (int) calczone_linear(*HDS,
+					t -> zone_history[i] = (int) calczone_linear(*hds,
 						birth_time, birth_radius, HYDRODISK_END_TIME,
 						analog_index, i * dt);
 					break;
 
 				case SUDDEN_MIGRATION:
-					t -> zone_history[i] = (int) calczone_sudden(*HDS,
+					t -> zone_history[i] = (int) calczone_sudden(*hds,
 						migration_time, birth_radius, analog_index, i * dt);
 					break;
 
 				case DIFFUSION_MIGRATION:
-					t -> zone_history[i] = (int) calczone_diffusive(*HDS,
+					t -> zone_history[i] = (int) calczone_diffusive(*hds,
 						birth_time, birth_radius, HYDRODISK_END_TIME,
 						analog_index, i * dt);
 					break;
@@ -24,11 +24,13 @@ extern "C" {
 #endif /* DIFFUSION_MIGRATION */
 
 /*
- * Set the hydrodiskstars object globally.
+ * Set the hydrodiskstars object which drives the migration of star particles
+ * in a multizone simulation.
  *
  * Parameters
  * ==========
- * address: The address of the hydrodiskstars object
+ * mz: 			A pointer to the multizone object
+ * address: 	The address of the hydrodiskstars object
  *
  * Notes
  * =====
@@ -38,7 +40,8 @@ extern "C" {
  *
  * source: hydrodiskstars.c
  */
-extern void set_hydrodiskstars_object(unsigned long address);
+extern void set_hydrodiskstars_object(MULTIZONE *mz,
+	unsigned long address);
 
 /*
  * Setup the zone history for a single tracer object born in a given zone and
@@ -46,8 +49,8 @@ extern void set_hydrodiskstars_object(unsigned long address);
  *
  * Parameters
  * ==========
- * mz: 				The multizone object
- * hds: 			The hydrodiskstars object
+ * mz: 				The multizone object, whose context holds the
+ * 					hydrodiskstars object
  * t: 				A pointer to the tracer object being set up
  * birth_zone: 		The zone of birth
  * birth_timestep: 	The timestep of birth
@@ -62,11 +62,20 @@ extern unsigned short update_zone_evolution(MULTIZONE *mz) {
 				break;
 
 			case IFR:
-				sz -> ism -> mass += (
-					((*(*sz).ism).infall_rate -
-						(*(*sz).ism).star_formation_rate -
-						get_outflow_rate(*sz)) * (*sz).dt + mass_recycled[i]
-				);
+				if ((*sz).integrator == EXPONENTIAL &&
+					(*(*sz).ism).mass > 0) {
+					sz -> ism -> mass = exponential_update((*(*sz).ism).mass,
+						(*(*sz).ism).infall_rate * (*sz).dt + mass_recycled[i],
+						((*(*sz).ism).star_formation_rate +
+							get_outflow_rate(*sz)) / (*(*sz).ism).mass,
+						(*sz).dt);
+				} else {
+					sz -> ism -> mass += (
+						((*(*sz).ism).infall_rate -
+							(*(*sz).ism).star_formation_rate -
+							get_outflow_rate(*sz)) * (*sz).dt + mass_recycled[i]
+					);
+				}
 				sz -> ism -> infall_rate = (
 					*(*sz).ism).specified[(*sz).timestep + 1l];
 				sz -> ism -> star_formation_rate = (
@@ -69,6 +69,7 @@ static void update_MDF_from_tracer(MULTIZONE *mz, TRACER t) {
 
 	SINGLEZONE *origin = (*mz).zones[t.zone_origin];
 	SINGLEZONE *final = (*mz).zones[t.zone_current];
+	double *Z = (*(*origin).state).Z + t.timestep_origin * (*origin).n_elements;
 
 	unsigned int i;
 	/* --------------------- for each tracked element --------------------- */
@@ -82,8 +83,7 @@ static void update_MDF_from_tracer(MULTIZONE *mz, TRACER t) {
 		 */
 		double onH_ = log10(
 			/* trailing underscore to not override function in element.h */
-			(*(*origin).elements[i]).Z[t.timestep_origin] /
-			(*(*origin).elements[i]).solar
+			Z[i] / (*(*origin).elements[i]).solar
 		);
 
 		long bin = get_bin_number(
@@ -103,12 +103,10 @@ static void update_MDF_from_tracer(MULTIZONE *mz, TRACER t) {
 		unsigned int j;
 		for (j = 0; j < i; j++) {
 			double onH1 = log10(
-				(*(*origin).elements[i]).Z[t.timestep_origin] /
-				(*(*origin).elements[i]).solar
+				Z[i] / (*(*origin).elements[i]).solar
 			);
 			double onH2 = log10(
-				(*(*origin).elements[j]).Z[t.timestep_origin] /
-				(*(*origin).elements[j]).solar
+				Z[j] / (*(*origin).elements[j]).solar
 			);
 			long bin = get_bin_number(
 				(*(*final).mdf).bins,
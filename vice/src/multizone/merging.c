@@ -0,0 +1,454 @@
+/*
+ * This file implements the merging of aged tracer particles in VICE's
+ * multizone simulations.
+ *
+ * Notes
+ * =====
+ * Every tracer particle enriches its current zone at every timestep, so the
+ * cost of each timestep grows with the number of tracer particles formed so
+ * far. As in the age binning of singlezone simulations, tracer particles
+ * older than a threshold age are merged into bins of birth time whose widths
+ * grow in proportion to their age. Within a bin, the particles sharing a
+ * zone of origin and a current zone become one particle, which reduces the
+ * number of particles enriching the zones from the number of timesteps to
+ * roughly the threshold age in timesteps times the logarithm of the number
+ * of timesteps for each pair of zones.
+ *
+ * A merged particle carries the total mass and the mass-weighted abundances
+ * of its members, which enrich the zones as a single stellar population born
+ * at the centre of its bin. From then on, it follows the zone history of its
+ * most massive member. The tracer particles themselves are left untouched,
+ * and the star particle output and the stellar metallicity distribution
+ * functions are computed from them as usual.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../multizone.h"
+#include "../singlezone.h"
+#include "../tracer.h"
+#include "../utils.h"
+#include "merging.h"
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static void merge_at_timestep(MULTIZONE *mz, unsigned long timestep);
+static TRACER *absorb_tracer(MULTIZONE mz, TRACER t, unsigned long timestep);
+static unsigned long bin_end(MIGRATION mig, unsigned long index);
+static unsigned long bin_start(TRACER t);
+static unsigned short can_merge(MIGRATION mig, unsigned long index,
+	unsigned long next, unsigned long timestep);
+static unsigned long combine_particles(MIGRATION *mig, unsigned long first,
+	unsigned long last, unsigned int n_elements);
+static int particle_cmp(const void *a, const void *b);
+static void merged_tracer_free(TRACER *t);
+
+
+/*
+ * Setup the merging of aged tracer particles in preparation for a multizone
+ * simulation. This does nothing if the simulation is not running with
+ * merging.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object that is about to be ran
+ *
+ * header: merging.h
+ */
+extern void setup_tracer_merging(MULTIZONE *mz) {
+
+	free_merged_tracers(mz -> mig);
+	mz -> mig -> merge_threshold = 0ul;
+	if ((*mz).merge_age <= 0) return;
+
+	SINGLEZONE sz = *(*mz).zones[0];
+	unsigned long timestep, n = (
+		(*(*mz).mig).n_zones * (*(*mz).mig).n_tracers * n_timesteps(sz)
+	);
+	mz -> mig -> merged = (TRACER **) malloc (n * sizeof(TRACER *));
+	mz -> mig -> merge_threshold = (unsigned long) round(
+		(*mz).merge_age / sz.dt);
+	if (!(*(*mz).mig).merge_threshold) mz -> mig -> merge_threshold = 1ul;
+
+	for (timestep = 0ul; timestep < sz.timestep; timestep++) {
+		merge_at_timestep(mz, timestep);
+	}
+
+}
+
+
+/*
+ * Free up the memory stored by the merged tracer particles.
+ *
+ * Parameters
+ * ==========
+ * mig: 	A pointer to the migration settings holding the merged particles
+ *
+ * header: merging.h
+ */
+extern void free_merged_tracers(MIGRATION *mig) {
+
+	if ((*mig).merged != NULL) {
+		unsigned long i;
+		for (i = 0ul; i < (*mig).n_merged; i++) {
+			merged_tracer_free(mig -> merged[i]);
+		}
+		free(mig -> merged);
+		mig -> merged = NULL;
+	} else {}
+	mig -> n_merged = 0ul;
+	mig -> first_unmerged = 0ul;
+
+}
+
+
+/*
+ * Merge the tracer particles older than the threshold age at the current
+ * timestep. Those sharing a zone of origin, a current zone, and a bin in age
+ * become a single particle with their total mass and their mass-weighted
+ * abundances.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object for the current simulation
+ *
+ * header: merging.h
+ */
+extern void merge_tracers(MULTIZONE *mz) {
+
+	if ((*(*mz).mig).merge_threshold) {
+		merge_at_timestep(mz, (*(*mz).zones[0]).timestep);
+	} else {}
+
+}
+
+
+/*
+ * Determine the number of particles which enrich the zones at the current
+ * timestep: the merged particles and the tracer particles which have not
+ * been merged.
+ *
+ * Parameters
+ * ==========
+ * mig: 	The migration settings for the current simulation
+ *
+ * Returns
+ * =======
+ * The number of particles to loop over in the enrichment
+ *
+ * header: merging.h
+ */
+extern unsigned long n_enriching_tracers(MIGRATION mig) {
+
+	return mig.n_merged + mig.tracer_count - mig.first_unmerged;
+
+}
+
+
+/*
+ * Obtain a particle which enriches the zones at the current timestep.
+ *
+ * Parameters
+ * ==========
+ * mig: 	The migration settings for the current simulation
+ * index: 	The index of the particle, less than n_enriching_tracers(mig)
+ *
+ * Returns
+ * =======
+ * A pointer to the merged particle of this index, or to the unmerged tracer
+ * particle following them.
+ *
+ * header: merging.h
+ */
+extern TRACER *enriching_tracer(MIGRATION mig, unsigned long index) {
+
+	if (index < mig.n_merged) {
+		return mig.merged[index];
+	} else {
+		return mig.tracers[mig.first_unmerged + index - mig.n_merged];
+	}
+
+}
+
+
+/*
+ * Merge the tracer particles older than the threshold age at a given
+ * timestep.
+ *
+ * Parameters
+ * ==========
+ * mz: 			A pointer to the multizone object for the current simulation
+ * timestep: 	The timestep number to merge the tracer particles at
+ */
+static void merge_at_timestep(MULTIZONE *mz, unsigned long timestep) {
+
+	MIGRATION *mig = mz -> mig;
+	unsigned int n_elements = (*(*mz).zones[0]).n_elements;
+	unsigned long i;
+
+	/* Merged particles are in the zone of their most massive member */
+	for (i = 0ul; i < (*mig).n_merged; i++) {
+		mig -> merged[i] -> zone_current = (unsigned) (
+			(*(*mig).merged[i]).zone_history[timestep]);
+	}
+
+	/*
+	 * Move the tracer particles born at each timestep older than the
+	 * threshold age into a bin of width 1.
+	 */
+	while ((*mig).first_unmerged < (*mig).tracer_count &&
+		(*(*mig).tracers[(*mig).first_unmerged]).timestep_origin +
+		(*mig).merge_threshold <= timestep) {
+		unsigned long first = (*mig).n_merged;
+		unsigned long origin = (
+			*(*mig).tracers[(*mig).first_unmerged]).timestep_origin;
+		while ((*mig).first_unmerged < (*mig).tracer_count &&
+			(*(*mig).tracers[(*mig).first_unmerged]).timestep_origin ==
+			origin) {
+			mig -> merged[(*mig).n_merged++] = absorb_tracer(*mz,
+				*(*mig).tracers[(*mig).first_unmerged], timestep);
+			mig -> first_unmerged++;
+		}
+		combine_particles(mig, first, (*mig).n_merged, n_elements);
+	}
+
+	/*
+	 * Merging two bins of width w allows the bins of width 2w to merge, so
+	 * keep going until there are no more.
+	 */
+	unsigned short merged;
+	do {
+		merged = 0u;
+		i = 0ul;
+		while (i < (*mig).n_merged) {
+			unsigned long next = bin_end(*mig, i);
+			if (can_merge(*mig, i, next, timestep)) {
+				unsigned long j, last = bin_end(*mig, next);
+				unsigned long start = bin_start(*(*mig).merged[i]);
+				unsigned long width = 2ul * (*(*mig).merged[i]).width;
+				for (j = i; j < last; j++) {
+					mig -> merged[j] -> width = width;
+					mig -> merged[j] -> timestep_origin = start + width / 2ul;
+				}
+				i = combine_particles(mig, i, last, n_elements);
+				merged = 1u;
+			} else {
+				i = next;
+			}
+		}
+	} while (merged);
+
+}
+
+
+/*
+ * Obtain a merged particle in a bin of width 1 holding a tracer particle.
+ *
+ * Parameters
+ * ==========
+ * mz: 			The multizone object for the current simulation
+ * t: 			The tracer particle to copy
+ * timestep: 	The current timestep number
+ *
+ * Returns
+ * =======
+ * A pointer to a new merged particle with the tracer particle's mass, zone
+ * history, and abundances at birth.
+ */
+static TRACER *absorb_tracer(MULTIZONE mz, TRACER t, unsigned long timestep) {
+
+	SINGLEZONE origin = *mz.zones[t.zone_origin];
+	TRACER *merged = tracer_initialize();
+	unsigned int j;
+	merged -> mass = t.mass;
+	merged -> zone_history = t.zone_history;
+	merged -> zone_origin = t.zone_origin;
+	merged -> zone_current = (unsigned) t.zone_history[timestep];
+	merged -> timestep_origin = t.timestep_origin;
+	merged -> width = 1ul;
+	merged -> abundances = (double *) malloc (origin.n_elements *
+		sizeof(double));
+	for (j = 0u; j < origin.n_elements; j++) {
+		merged -> abundances[j] = (*origin.state).Z[t.timestep_origin *
+			origin.n_elements + j];
+	}
+	merged -> metallicity = scale_metallicity(origin, t.timestep_origin);
+	return merged;
+
+}
+
+
+/*
+ * Find the end of the bin containing a given merged particle.
+ *
+ * Parameters
+ * ==========
+ * mig: 	The migration settings for the current simulation
+ * index: 	The index of the merged particle
+ *
+ * Returns
+ * =======
+ * The index of the first merged particle in the next bin, or the number of
+ * merged particles if this bin is the youngest.
+ */
+static unsigned long bin_end(MIGRATION mig, unsigned long index) {
+
+	unsigned long i = index;
+	while (i < mig.n_merged &&
+		(*mig.merged[i]).timestep_origin ==
+			(*mig.merged[index]).timestep_origin &&
+		(*mig.merged[i]).width == (*mig.merged[index]).width) {
+		i++;
+	}
+	return i;
+
+}
+
+
+/*
+ * Determine the first timestep spanned by the bin of a merged particle.
+ *
+ * Parameters
+ * ==========
+ * t: 		The merged particle
+ *
+ * Returns
+ * =======
+ * The timestep number at which the bin begins
+ */
+static unsigned long bin_start(TRACER t) {
+
+	return t.timestep_origin - t.width / 2ul;
+
+}
+
+
+/*
+ * Determine whether or not a bin of merged particles can be merged with the
+ * next bin.
+ *
+ * Parameters
+ * ==========
+ * mig: 		The migration settings for the current simulation
+ * index: 		The index of the first particle in the older bin
+ * next: 		The index of the first particle in the younger bin
+ * timestep: 	The current timestep number
+ *
+ * Returns
+ * =======
+ * 1 if the two bins have the same width, the older of them begins at a
+ * timestep divisible by twice that width, and the youngest age within them
+ * is at least the threshold age times twice that width. 0 otherwise.
+ */
+static unsigned short can_merge(MIGRATION mig, unsigned long index,
+	unsigned long next, unsigned long timestep) {
+
+	if (next >= mig.n_merged) return 0u;
+	unsigned long w = (*mig.merged[index]).width;
+	unsigned long start = bin_start(*mig.merged[index]);
+	return ((*mig.merged[next]).width == w &&
+		bin_start(*mig.merged[next]) == start + w &&
+		!(start % (2ul * w)) &&
+		timestep - (start + 2ul * w - 1ul) >= 2ul * w * mig.merge_threshold);
+
+}
+
+
+/*
+ * Combine the merged particles in a bin which share a zone of origin and a
+ * current zone, then close the gap left in the merged particles.
+ *
+ * Parameters
+ * ==========
+ * mig: 		A pointer to the migration settings for the current simulation
+ * first: 		The index of the first particle in the bin
+ * last: 		The index following the last particle in the bin
+ * n_elements: 	The number of elements tracked by the simulation
+ *
+ * Returns
+ * =======
+ * The index following the last particle in the bin once they're combined
+ */
+static unsigned long combine_particles(MIGRATION *mig, unsigned long first,
+	unsigned long last, unsigned int n_elements) {
+
+	unsigned long i, n = first;
+	qsort(mig -> merged + first, last - first, sizeof(TRACER *),
+		particle_cmp);
+	for (i = first; i < last; i++) {
+		TRACER *t = (*mig).merged[i];
+		if (n > first &&
+			(*(*mig).merged[n - 1ul]).zone_origin == (*t).zone_origin &&
+			(*(*mig).merged[n - 1ul]).zone_current == (*t).zone_current) {
+			TRACER *into = (*mig).merged[n - 1ul];
+			double mass = (*into).mass + (*t).mass;
+			if (mass > 0) {
+				unsigned int j;
+				for (j = 0u; j < n_elements; j++) {
+					into -> abundances[j] = ((*into).mass *
+						(*into).abundances[j] + (*t).mass *
+						(*t).abundances[j]) / mass;
+				}
+				into -> metallicity = ((*into).mass * (*into).metallicity +
+					(*t).mass * (*t).metallicity) / mass;
+			} else {}
+			if ((*t).mass > (*into).mass) {
+				into -> zone_history = (*t).zone_history;
+			} else {}
+			into -> mass = mass;
+			merged_tracer_free(t);
+		} else {
+			mig -> merged[n++] = t;
+		}
+	}
+
+	memmove(mig -> merged + n, (*mig).merged + last,
+		((*mig).n_merged - last) * sizeof(TRACER *));
+	mig -> n_merged -= last - n;
+	return n;
+
+}
+
+
+/*
+ * Order merged particles by their zone of origin and their current zone.
+ *
+ * Parameters
+ * ==========
+ * a: 		A pointer to the first particle's pointer
+ * b: 		A pointer to the second particle's pointer
+ *
+ * Returns
+ * =======
+ * Negative, zero, or positive as the first particle comes before, alongside,
+ * or after the second.
+ */
+static int particle_cmp(const void *a, const void *b) {
+
+	TRACER t1 = **(TRACER * const *) a;
+	TRACER t2 = **(TRACER * const *) b;
+	if (t1.zone_origin != t2.zone_origin) {
+		return t1.zone_origin < t2.zone_origin ? -1 : 1;
+	} else if (t1.zone_current != t2.zone_current) {
+		return t1.zone_current < t2.zone_current ? -1 : 1;
+	} else {
+		return 0;
+	}
+
+}
+
+
+/*
+ * Free up the memory stored by a merged particle, which does not own its
+ * zone history.
+ *
+ * Parameters
+ * ==========
+ * t: 		A pointer to the merged particle
+ */
+static void merged_tracer_free(TRACER *t) {
+
+	t -> zone_history = NULL;
+	tracer_free(t);
+
+}
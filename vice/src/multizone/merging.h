@@ -0,0 +1,99 @@
+#ifndef MULTIZONE_MERGING_H
+#define MULTIZONE_MERGING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "../objects.h"
+
+/*
+ * Setup the merging of aged tracer particles in preparation for a multizone
+ * simulation. This does nothing if the simulation is not running with
+ * merging.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object that is about to be ran
+ *
+ * Notes
+ * =====
+ * Simulations resumed from a checkpoint or extended rebuild the merged
+ * particles by repeating the merging at each previous timestep.
+ *
+ * source: merging.c
+ */
+extern void setup_tracer_merging(MULTIZONE *mz);
+
+/*
+ * Free up the memory stored by the merged tracer particles.
+ *
+ * Parameters
+ * ==========
+ * mig: 	A pointer to the migration settings holding the merged particles
+ *
+ * source: merging.c
+ */
+extern void free_merged_tracers(MIGRATION *mig);
+
+/*
+ * Merge the tracer particles older than the threshold age at the current
+ * timestep. Those sharing a zone of origin, a current zone, and a bin in age
+ * become a single particle with their total mass and their mass-weighted
+ * abundances.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object for the current simulation
+ *
+ * Notes
+ * =====
+ * As in the age binning of singlezone simulations, a bin of width 2w is
+ * formed from the two bins of width w which begin at timesteps divisible by
+ * 2w and w once the youngest age within them is at least 2w times the
+ * threshold age. The merged particles at a given timestep therefore depend
+ * only on the tracer particles and their zone histories.
+ *
+ * source: merging.c
+ */
+extern void merge_tracers(MULTIZONE *mz);
+
+/*
+ * Determine the number of particles which enrich the zones at the current
+ * timestep: the merged particles and the tracer particles which have not
+ * been merged.
+ *
+ * Parameters
+ * ==========
+ * mig: 	The migration settings for the current simulation
+ *
+ * Returns
+ * =======
+ * The number of particles to loop over in the enrichment
+ *
+ * source: merging.c
+ */
+extern unsigned long n_enriching_tracers(MIGRATION mig);
+
+/*
+ * Obtain a particle which enriches the zones at the current timestep.
+ *
+ * Parameters
+ * ==========
+ * mig: 	The migration settings for the current simulation
+ * index: 	The index of the particle, less than n_enriching_tracers(mig)
+ *
+ * Returns
+ * =======
+ * A pointer to the merged particle of this index, or to the unmerged tracer
+ * particle following them.
+ *
+ * source: merging.c
+ */
+extern TRACER *enriching_tracer(MIGRATION mig, unsigned long index);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* MULTIZONE_MERGING_H */
@@ -0,0 +1,155 @@
+/*
+ * This file implements the default parameters of the milkyway object, such
+ * that models adopting them need not call python to set up each zone. See
+ * vice/milkyway/milkyway.py for further details.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "milkyway.h"
+
+
+/*
+ * The default evolutionary function of the milkyway object.
+ *
+ * Parameters
+ * ==========
+ * radius: 		Galactocentric radius in kpc
+ * time: 		Simulation time in Gyr
+ *
+ * Returns
+ * =======
+ * Always 1.0, interpreted according to the mode of the milkyway object (a
+ * surface density of infall of 1 Msun yr^-1 kpc^-2 by default).
+ *
+ * header: milkyway.h
+ */
+extern double milkyway_default_evolution(double radius, double time) {
+
+	return 1.0;
+
+}
+
+
+/*
+ * The default mass loading factor of the milkyway object.
+ *
+ * Parameters
+ * ==========
+ * radius: 		Galactocentric radius in kpc
+ *
+ * Returns
+ * =======
+ * eta(r) = y_O^CC / Z_O^sun 10^(0.08 (r - 4 kpc) - 0.3) - 0.6, with
+ * y_O^CC = 0.015 and Z_O^sun = 0.00572.
+ *
+ * header: milkyway.h
+ */
+extern double milkyway_default_mass_loading(double radius) {
+
+	return 0.015 / 0.00572 * pow(10, 0.08 * (radius - 4) - 0.3) - 0.6;
+
+}
+
+
+/*
+ * Determine the number of edges of the annuli of a milkyway model.
+ *
+ * Parameters
+ * ==========
+ * min_radius: 	The inner edge of the innermost annulus in kpc
+ * max_radius: 	The outer edge of the outermost annulus in kpc
+ * zone_width: 	The width of each annulus in kpc
+ *
+ * Returns
+ * =======
+ * The number of elements in the array returned by milkyway_radial_bins
+ *
+ * header: milkyway.h
+ */
+extern unsigned long milkyway_n_radial_bins(double min_radius,
+	double max_radius, double zone_width) {
+
+	if (zone_width > max_radius - min_radius) return 2ul;
+	unsigned long n = (unsigned long) ((max_radius - min_radius) / zone_width
+		+ 1);
+	/* round-off may leave the last edge short of the maximum radius */
+	if (min_radius + (n - 1ul) * zone_width < max_radius) n++;
+	return n;
+
+}
+
+
+/*
+ * Determine the edges of the annuli of a milkyway model.
+ *
+ * Parameters
+ * ==========
+ * min_radius: 	The inner edge of the innermost annulus in kpc
+ * max_radius: 	The outer edge of the outermost annulus in kpc
+ * zone_width: 	The width of each annulus in kpc
+ *
+ * Returns
+ * =======
+ * The edges of the annuli, sorted from least to greatest, with
+ * milkyway_n_radial_bins elements. If zone_width exceeds the difference
+ * between the maximum and minimum radii, these are the only two elements.
+ *
+ * Notes
+ * =====
+ * The edges are min_radius + i * zone_width, as in the range_ function in
+ * vice/core/_pyutils.py.
+ *
+ * header: milkyway.h
+ */
+extern double *milkyway_radial_bins(double min_radius, double max_radius,
+	double zone_width) {
+
+	unsigned long i, n = milkyway_n_radial_bins(min_radius, max_radius,
+		zone_width);
+	double *bins = (double *) malloc (n * sizeof(double));
+	if (zone_width > max_radius - min_radius) {
+		bins[0] = min_radius;
+		bins[1] = max_radius;
+	} else {
+		for (i = 0ul; i < n; i++) bins[i] = min_radius + i * zone_width;
+	}
+	return bins;
+
+}
+
+
+/*
+ * Evaluate the default evolutionary function of the milkyway object at each
+ * timestep of a zone's simulation.
+ *
+ * Parameters
+ * ==========
+ * radius: 		The galactocentric radius of the zone in kpc
+ * area: 		The area of the zone in kpc^2
+ * factor: 		A factor to multiply each value by (1e9 to convert rates in
+ * 				Msun yr^-1 to Msun Gyr^-1, 1 for a gas supply)
+ * dt: 			The timestep size in Gyr
+ * n_times: 	The number of timesteps to evaluate at
+ *
+ * Returns
+ * =======
+ * The mass or rate specified for the zone at each timestep, for use as the
+ * specified field of its ISM.
+ *
+ * header: milkyway.h
+ */
+extern double *milkyway_default_specified(double radius, double area,
+	double factor, double dt, unsigned long n_times) {
+
+	unsigned long i;
+	double *specified = (double *) malloc (n_times * sizeof(double));
+	for (i = 0ul; i < n_times; i++) {
+		/* as in vice/milkyway/utils.py, the area times the surface density */
+		specified[i] = factor * (area * milkyway_default_evolution(radius,
+			i * dt));
+	}
+	return specified;
+
+}
+
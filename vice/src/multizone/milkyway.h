@@ -0,0 +1,108 @@
+
+#ifndef MULTIZONE_MILKYWAY_H
+#define MULTIZONE_MILKYWAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * The default evolutionary function of the milkyway object.
+ *
+ * Parameters
+ * ==========
+ * radius: 		Galactocentric radius in kpc
+ * time: 		Simulation time in Gyr
+ *
+ * Returns
+ * =======
+ * Always 1.0, interpreted according to the mode of the milkyway object (a
+ * surface density of infall of 1 Msun yr^-1 kpc^-2 by default).
+ *
+ * source: milkyway.c
+ */
+extern double milkyway_default_evolution(double radius, double time);
+
+/*
+ * The default mass loading factor of the milkyway object.
+ *
+ * Parameters
+ * ==========
+ * radius: 		Galactocentric radius in kpc
+ *
+ * Returns
+ * =======
+ * eta(r) = y_O^CC / Z_O^sun 10^(0.08 (r - 4 kpc) - 0.3) - 0.6, with
+ * y_O^CC = 0.015 and Z_O^sun = 0.00572.
+ *
+ * source: milkyway.c
+ */
+extern double milkyway_default_mass_loading(double radius);
+
+/*
+ * Determine the number of edges of the annuli of a milkyway model.
+ *
+ * Parameters
+ * ==========
+ * min_radius: 	The inner edge of the innermost annulus in kpc
+ * max_radius: 	The outer edge of the outermost annulus in kpc
+ * zone_width: 	The width of each annulus in kpc
+ *
+ * Returns
+ * =======
+ * The number of elements in the array returned by milkyway_radial_bins
+ *
+ * source: milkyway.c
+ */
+extern unsigned long milkyway_n_radial_bins(double min_radius,
+	double max_radius, double zone_width);
+
+/*
+ * Determine the edges of the annuli of a milkyway model.
+ *
+ * Parameters
+ * ==========
+ * min_radius: 	The inner edge of the innermost annulus in kpc
+ * max_radius: 	The outer edge of the outermost annulus in kpc
+ * zone_width: 	The width of each annulus in kpc
+ *
+ * Returns
+ * =======
+ * The edges of the annuli, sorted from least to greatest, with
+ * milkyway_n_radial_bins elements. If zone_width exceeds the difference
+ * between the maximum and minimum radii, these are the only two elements.
+ *
+ * source: milkyway.c
+ */
+extern double *milkyway_radial_bins(double min_radius, double max_radius,
+	double zone_width);
+
+/*
+ * Evaluate the default evolutionary function of the milkyway object at each
+ * timestep of a zone's simulation.
+ *
+ * Parameters
+ * ==========
+ * radius: 		The galactocentric radius of the zone in kpc
+ * area: 		The area of the zone in kpc^2
+ * factor: 		A factor to multiply each value by (1e9 to convert rates in
+ * 				Msun yr^-1 to Msun Gyr^-1, 1 for a gas supply)
+ * dt: 			The timestep size in Gyr
+ * n_times: 	The number of timesteps to evaluate at
+ *
+ * Returns
+ * =======
+ * The mass or rate specified for the zone at each timestep, for use as the
+ * specified field of its ISM.
+ *
+ * source: milkyway.c
+ */
+extern double *milkyway_default_specified(double radius, double area,
+	double factor, double dt, unsigned long n_times);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* MULTIZONE_MILKYWAY_H */
+
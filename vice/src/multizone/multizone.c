@@ -8,11 +8,16 @@
 #include "../tracer.h"
 #include "../utils.h"
 #include "../io.h"
+#include "../profile.h"
 #include "multizone.h"
 #include "tracer.h"
 
 /* ---------- Static function comment headers not duplicated here ---------- */
 static unsigned short multizone_timestepper(MULTIZONE *mz);
+static unsigned short multizone_finish(MULTIZONE *mz, unsigned short x);
+static unsigned short multizone_setup_from_checkpoint(MULTIZONE *mz);
+static unsigned short multizone_start_tracer_file(MULTIZONE *mz);
+static void multizone_stream_tracers(MULTIZONE *mz);
 static void verbosity(MULTIZONE mz);
 
 
@@ -46,7 +51,8 @@ extern void link_zone(MULTIZONE *mz, unsigned long address,
  * Returns
  * =======
  * 0 on success, 1 on zone setup failure, 2 on migration normalization
- * error, 3 on tracer particle file I/O error.
+ * error, 3 on tracer particle file I/O error, 4 if the simulation completed
+ * but a checkpoint could not be written.
  *
  * header: multizone.h
  */
@@ -61,31 +67,237 @@ extern unsigned short multizone_evolve(MULTIZONE *mz) {
 
 	/*
 	 * Run either the simple or full evolution depending on the user's
-	 * specification at runtime.
+	 * specification at runtime. Checkpoints are only supported in the
+	 * latter case, and the star particle zone histories are saved once
+	 * up front since they do not change as the simulation evolves.
 	 */
 	if ((*mz).simple) {
 		multizone_evolve_simple(mz);
+	} else if ((*mz).checkpoint_interval > 0 &&
+		multizone_write_tracer_checkpoint(*mz)) {
+		mz -> checkpoint_interval = 0;
+		multizone_evolve_full(mz);
+		x = 4;
+	} else {
+		if (multizone_evolve_full(mz)) x = 4;
+	}
+
+	return multizone_finish(mz, x);
+
+}
+
+
+/*
+ * Resumes a multizone simulation from the checkpoint in its output directory
+ * and runs it to completion.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object to resume
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on zone setup failure, 2 on migration normalization
+ * error, 3 on tracer particle file I/O error, 4 if the simulation completed
+ * but a checkpoint could not be written, 5 if the checkpoint could not be
+ * read, 6 if the checkpoint does not describe this simulation.
+ *
+ * header: multizone.h
+ */
+extern unsigned short multizone_resume(MULTIZONE *mz) {
+
+	unsigned short x = multizone_setup_from_checkpoint(mz);
+	if (x) return x;
+
+	/*
+	 * The star particle zone histories are only saved when checkpoints are
+	 * written periodically. Otherwise those computed at setup are used.
+	 */
+	x = multizone_read_tracer_checkpoint(mz);
+	if (x) {
+		multizone_clean(mz);
+		return 4u + x;
 	} else {
+		x = multizone_evolve_full(mz) ? 4u : 0u;
+	}
+
+	return multizone_finish(mz, x);
+
+}
+
+
+/*
+ * Extends a completed multizone simulation to the final output time from the
+ * state saved in its output directory at the end of the simulation.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object to extend
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on zone setup failure, 2 on migration normalization
+ * error, 3 on tracer particle file I/O error, 4 if the simulation completed
+ * but a checkpoint could not be written, 5 if the saved state could not be
+ * read, 6 if the saved state does not describe this simulation.
+ *
+ * Notes
+ * =====
+ * The star particles follow the zone histories computed at setup for the
+ * extended simulation, rather than those of the original. Their current
+ * zones are therefore taken from these new histories, since the original
+ * simulation holds every star particle fixed over the final timesteps.
+ *
+ * header: multizone.h
+ */
+extern unsigned short multizone_extend(MULTIZONE *mz) {
+
+	unsigned short x = multizone_setup_from_checkpoint(mz);
+	if (x) return x;
+
+	unsigned int i;
+	for (i = 0u; i < (*(*mz).mig).n_zones; i++) {
+		singlezone_sync_output_index(mz -> zones[i]);
+	}
+	unsigned long j, timestep = (*(*mz).zones[0]).timestep;
+	for (j = 0ul; j < (*(*mz).mig).tracer_count; j++) {
+		TRACER *t = (*(*mz).mig).tracers[j];
+		t -> zone_current = (unsigned) (*t).zone_history[timestep];
+	}
+
+	if ((*mz).checkpoint_interval > 0 &&
+		multizone_write_tracer_checkpoint(*mz)) {
+		mz -> checkpoint_interval = 0;
 		multizone_evolve_full(mz);
+		x = 4u;
+	} else {
+		x = multizone_evolve_full(mz) ? 4u : 0u;
 	}
 
+	return multizone_finish(mz, x);
+
+}
+
+
+/*
+ * Sets up every zone in a multizone object for simulation and restores
+ * their state from the checkpoint in the output directory.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on zone setup failure, 2 on migration normalization
+ * error, 5 if the checkpoint could not be read, 6 if the checkpoint does not
+ * describe this simulation.
+ */
+static unsigned short multizone_setup_from_checkpoint(MULTIZONE *mz) {
+
+	unsigned int i;
+	for (i = 0; i < (*(*mz).mig).n_zones; i++) {
+		if (singlezone_setup_no_io(mz -> zones[i])) return 1;
+	}
+	if (migration_matrix_sanitycheck((*(*mz).mig).gas_migration,
+		n_timesteps((*(*mz).zones[0])), (*(*mz).mig).n_zones)) return 2;
+
+	unsigned short x = multizone_read_checkpoint(mz);
+	if (x) {
+		/* Don't leave the tracer count pointing beyond what was read */
+		mz -> mig -> tracer_count = 0l;
+		multizone_clean(mz);
+		return 4u + x;
+	} else {
+		return 0u;
+	}
+
+}
+
+
+/*
+ * Opens the tracers output file and writes its header, unless it is open
+ * already.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ */
+static unsigned short multizone_start_tracer_file(MULTIZONE *mz) {
+
+	if ((*(*mz).mig).tracers_output != NULL) {
+		return 0u;
+	} else if (multizone_open_tracer_file(mz)) {
+		return 1u;
+	} else {
+		write_tracers_header(*mz);
+		return 0u;
+	}
+
+}
+
+
+/*
+ * Writes the tracer particles injected since the previous call to the
+ * tracers output file, if it is open.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object
+ */
+static void multizone_stream_tracers(MULTIZONE *mz) {
+
+	PROFILE *p = (*(*mz).ctx).profile;
+	profile_start(p, PROFILE_WRITE_TRACERS);
+	write_tracer_cohorts(*mz);
+	profile_stop(p, PROFILE_WRITE_TRACERS);
+
+}
+
+
+/*
+ * Writes the stellar distribution functions and the star particle data to
+ * the output files at the end of a multizone simulation and frees up the
+ * memory.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object
+ * x: 		The return value of the simulation thus far
+ *
+ * Returns
+ * =======
+ * x if the star particle data was written successfully, 3 otherwise.
+ */
+static unsigned short multizone_finish(MULTIZONE *mz, unsigned short x) {
+
 	/*
 	 * Before writing out the tracer particle information, chop off the ones
 	 * that were formed in the previous timestep. These stars formed one
 	 * timestep after the user's specified ending time, and will mess up
 	 * age calculations from the output.
 	 */
+	PROFILE *p = (*(*mz).ctx).profile;
+	profile_start(p, PROFILE_TRACERS_MDF);
 	tracers_MDF(mz);
+	profile_stop(p, PROFILE_TRACERS_MDF);
+	profile_start(p, PROFILE_WRITE_MDF);
 	write_multizone_mdf(*mz);
+	profile_stop(p, PROFILE_WRITE_MDF);
 
-	/* Write the tracer particle data */
-	if (!multizone_open_tracer_file(mz)) {
-		write_tracers_header(*mz);
+	/* Write the remainder of the tracer particle data */
+	profile_start(p, PROFILE_WRITE_TRACERS);
+	if (!multizone_start_tracer_file(mz)) {
 		write_tracers_output(*mz);
 		multizone_close_tracer_file(mz);
 	} else {
 		x = 3;
 	}
+	profile_stop(p, PROFILE_WRITE_TRACERS);
 
 	multizone_clean(mz);
 	if ((*mz).verbose) printf("Finished.\n");
@@ -145,19 +357,39 @@ extern void multizone_evolve_simple(MULTIZONE *mz) {
  * ==========
  * mz: 		A pointer to the multizone object to run
  *
+ * Returns
+ * =======
+ * 0 on success, 1 if a checkpoint could not be written. In the latter case
+ * the simulation still runs to completion.
+ *
  * header: multizone.h
  */
-extern void multizone_evolve_full(MULTIZONE *mz) {
+extern unsigned short multizone_evolve_full(MULTIZONE *mz) {
 
 	/*
-	 * Use the variable n to keep track of the number of outputs. Pull a
-	 * local copy of the first zone just for convenience. Lastly, tracer
-	 * particles are injected at the end of each timestep, so inject them at
-	 * the start of the simulation to account for the first timestep.
+	 * Pull a local copy of the first zone just for convenience, whose
+	 * output_index keeps track of the number of outputs. Tracer particles
+	 * are injected at the end of each timestep, so inject them at the start
+	 * of the simulation to account for the first timestep. Simulations
+	 * resumed from a checkpoint have already done so.
 	 */
-	long n = 0l;
+	unsigned short checkpoint_failed = 0u;
+	unsigned int i;
 	SINGLEZONE *sz = mz -> zones[0];
-	inject_tracers(mz);
+	PROFILE *p = (*(*mz).ctx).profile;
+	setup_tracer_merging(mz);
+
+	/*
+	 * Star particles are written to the output file as they are injected.
+	 * If it cannot be opened, that is reported once the simulation is over.
+	 */
+	multizone_start_tracer_file(mz);
+	if (!(*sz).timestep) {
+		profile_start(p, PROFILE_INJECTION);
+		inject_tracers(mz);
+		profile_stop(p, PROFILE_INJECTION);
+	} else {}
+	multizone_stream_tracers(mz);
 	while ((*sz).current_time <= (*sz).output_times[(*sz).n_outputs - 1l]) {
 		/*
 		 * Run the simulation until the time reaches the final output time
@@ -165,17 +397,42 @@ extern void multizone_evolve_full(MULTIZONE *mz) {
 		 * whenever an output time is reached, or if the current timestep is
 		 * closer to the next output time than the subsequent timestep.
 		 */
-		if ((*sz).current_time >= (*sz).output_times[n] ||
-			2 * (*sz).output_times[n] < 2 * (*sz).current_time + (*sz).dt) {
+		if ((*sz).current_time >= (*sz).output_times[(*sz).output_index] ||
+			2 * (*sz).output_times[(*sz).output_index] <
+			2 * (*sz).current_time + (*sz).dt) {
+			profile_start(p, PROFILE_WRITE_HISTORY);
 			write_multizone_history(*mz);
-			n++;
+			profile_stop(p, PROFILE_WRITE_HISTORY);
+			for (i = 0u; i < (*(*mz).mig).n_zones; i++) {
+				mz -> zones[i] -> output_index++;
+			}
 		} else {}
 		if (multizone_timestepper(mz)) break;
+		if (checkpoint_due((*mz).checkpoint_interval, (*sz).dt,
+			(*sz).timestep - 1ul, (*sz).timestep)) {
+			profile_start(p, PROFILE_CHECKPOINT);
+			checkpoint_failed |= multizone_write_checkpoint(mz);
+			profile_stop(p, PROFILE_CHECKPOINT);
+		} else {}
 		verbosity(*mz);
 	}
 	verbosity(*mz);
+	profile_start(p, PROFILE_INJECTION);
 	inject_tracers(mz);
+	profile_stop(p, PROFILE_INJECTION);
+	multizone_stream_tracers(mz);
+
+	/*
+	 * The final state is saved before the output at the final timestep,
+	 * which an extended simulation will not necessarily write.
+	 */
+	profile_start(p, PROFILE_CHECKPOINT);
+	checkpoint_failed |= multizone_write_checkpoint(mz);
+	profile_stop(p, PROFILE_CHECKPOINT);
+	profile_start(p, PROFILE_WRITE_HISTORY);
 	write_multizone_history(*mz);
+	profile_stop(p, PROFILE_WRITE_HISTORY);
+	return checkpoint_failed;
 
 }
 
@@ -193,8 +450,18 @@ extern void multizone_evolve_full(MULTIZONE *mz) {
  */
 static unsigned short multizone_timestepper(MULTIZONE *mz) {
 
+	PROFILE *p = (*(*mz).ctx).profile;
+	if ((*(*mz).mig).merge_threshold) {
+		profile_start(p, PROFILE_MERGING);
+		merge_tracers(mz);
+		profile_stop(p, PROFILE_MERGING);
+	} else {}
+	profile_start(p, PROFILE_GAS);
 	update_zone_evolution(mz);
+	profile_stop(p, PROFILE_GAS);
+	profile_start(p, PROFILE_ENRICHMENT);
 	update_elements(mz);
+	profile_stop(p, PROFILE_ENRICHMENT);
 
 	/*
 	 * Now each element and the ISM in each zone are at the next timestep.
@@ -202,22 +469,29 @@ static unsigned short multizone_timestepper(MULTIZONE *mz) {
 	 */
 	unsigned int i, j;
 
+	profile_start(p, PROFILE_MDF);
 	for (i = 0; i < (*(*mz).mig).n_zones; i++) {
 		SINGLEZONE *sz = mz -> zones[i];
 		for (j = 0; j < (*sz).n_elements; j++) {
-			sz -> elements[j] -> Z[(*sz).timestep + 1l] = (
+			sz -> state -> Z[((*sz).timestep + 1l) * (*sz).n_elements + j] = (
 				(*(*sz).elements[j]).mass / (*(*sz).ism).mass
 			);
 		}
 		update_MDF(sz);
 	}
+	profile_stop(p, PROFILE_MDF);
 
 	/*
 	 * Migrating gas and stars before injecting tracers ensures that stars
 	 * will never migrate the timestep they're born.
 	 */
+	profile_start(p, PROFILE_MIGRATION);
 	migrate(mz);
+	profile_stop(p, PROFILE_MIGRATION);
+	profile_start(p, PROFILE_INJECTION);
 	inject_tracers(mz);
+	profile_stop(p, PROFILE_INJECTION);
+	multizone_stream_tracers(mz);
 	for (i = 0; i < (*(*mz).mig).n_zones; i++) {
 		mz -> zones[i] -> current_time += (*(*mz).zones[i]).dt;
 		mz -> zones[i] -> timestep++;
@@ -287,6 +561,7 @@ extern void multizone_clean(MULTIZONE *mz) {
 	}
 	free(mz -> mig -> tracers);
 	mz -> mig -> tracers = NULL;
+	free_merged_tracers(mz -> mig);
 
 	/* free up the migration matrix */
 	free(mz -> mig -> gas_migration);
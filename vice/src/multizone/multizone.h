@@ -33,12 +33,56 @@ extern void link_zone(MULTIZONE *mz, unsigned long address,
  * Returns
  * =======
  * 0 on success, 1 on zone setup failure, 2 on migration normalization
- * error, 3 on tracer particle file I/O error.
+ * error, 3 on tracer particle file I/O error, 4 if the simulation completed
+ * but a checkpoint could not be written.
  *
  * source: multizone.c
  */
 extern unsigned short multizone_evolve(MULTIZONE *mz);
 
+/*
+ * Resumes a multizone simulation from the checkpoint in its output directory
+ * and runs it to completion.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object to resume
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on zone setup failure, 2 on migration normalization
+ * error, 3 on tracer particle file I/O error, 4 if the simulation completed
+ * but a checkpoint could not be written, 5 if the checkpoint could not be
+ * read, 6 if the checkpoint does not describe this simulation.
+ *
+ * source: multizone.c
+ */
+extern unsigned short multizone_resume(MULTIZONE *mz);
+
+/*
+ * Extends a completed multizone simulation to the final output time from the
+ * state saved in its output directory at the end of the simulation.
+ *
+ * Parameters
+ * ==========
+ * mz: 		A pointer to the multizone object to extend
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on zone setup failure, 2 on migration normalization
+ * error, 3 on tracer particle file I/O error, 4 if the simulation completed
+ * but a checkpoint could not be written, 5 if the saved state could not be
+ * read, 6 if the saved state does not describe this simulation.
+ *
+ * Notes
+ * =====
+ * The star particles follow the zone histories computed at setup for the
+ * extended simulation, rather than those of the original.
+ *
+ * source: multizone.c
+ */
+extern unsigned short multizone_extend(MULTIZONE *mz);
+
 /*
  * Runs the multizone simulation under current user settings with tracer
  * particles not tracked at each individual timestep
@@ -59,9 +103,14 @@ extern void multizone_evolve_simple(MULTIZONE *mz);
  * ==========
  * mz: 		A pointer to the multizone object to run
  *
+ * Returns
+ * =======
+ * 0 on success, 1 if a checkpoint could not be written. In the latter case
+ * the simulation still runs to completion.
+ *
  * source: multizone.c
  */
-extern void multizone_evolve_full(MULTIZONE *mz);
+extern unsigned short multizone_evolve_full(MULTIZONE *mz);
 
 /*
  * Sets up every zone in a multizone object for simulation
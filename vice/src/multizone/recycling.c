@@ -11,6 +11,8 @@
 #include <stdlib.h>
 #include "../multizone.h"
 #include "recycling.h"
+#include "tracer.h"
+#include "merging.h"
 
 /*
  * Re-enriches each zone in a multizone simulation. Zones with instantaneous
@@ -36,18 +38,15 @@ extern void recycle_metals_from_tracers(MULTIZONE *mz, unsigned int index) {
 	 */
 
 	unsigned long i;
-	for (i = 0l; i < (*(*mz).mig).tracer_count; i++) {
-		TRACER *t = mz -> mig -> tracers[i];
+	for (i = 0l; i < n_enriching_tracers(*(*mz).mig); i++) {
+		TRACER *t = enriching_tracer(*(*mz).mig, i);
 		SSP *ssp = mz -> zones[(*t).zone_origin] -> ssp;
 
 		if ((*ssp).continuous) {
 			/* ------------------- Continuous recycling ------------------- */
 			unsigned long n = (*(*mz).zones[0]).timestep - (*t).timestep_origin;
 			/* The metallicity by mass of this element in the tracer */
-			double Z = (
-				(*(*(*mz).zones[(*t).zone_origin]).elements[index]).Z[(
-					*t).timestep_origin]
-			);
+			double Z = tracer_abundance(*mz, *t, index);
 			mz -> zones[(*t).zone_current] -> elements[index] -> mass += (
 				Z * (*t).mass * ((*ssp).crf[n + 1l] - (*ssp).crf[n])
 			);
@@ -103,8 +102,8 @@ extern double *gas_recycled_in_zones(MULTIZONE mz) {
 
 	/* Look at each tracer particle for continuous recycling */
 	unsigned long i;
-	for (i = 0l; i < (*mz.mig).tracer_count; i++) {
-		TRACER *t = (*mz.mig).tracers[i];
+	for (i = 0l; i < n_enriching_tracers(*mz.mig); i++) {
+		TRACER *t = enriching_tracer(*mz.mig, i);
 		SSP *ssp = mz.zones[(*t).zone_origin] -> ssp;
 
 		if ((*ssp).continuous) {
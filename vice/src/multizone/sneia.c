@@ -8,6 +8,7 @@
 #include "../sneia.h"
 #include "sneia.h"
 #include "tracer.h"
+#include "merging.h"
 
 /*
  * Determine the total mass production of a given element produced by SNe Ia
@@ -31,8 +32,8 @@ extern double *m_sneia_from_tracers(MULTIZONE mz, unsigned short index) {
 	for (i = 0l; i < (*mz.mig).n_zones; i++) {
 		mass[i] = 0;
 	}
-	for (i = 0l; i < (*mz.mig).tracer_count; i++) {
-		TRACER *t = mz.mig -> tracers[i];
+	for (i = 0l; i < n_enriching_tracers(*mz.mig); i++) {
+		TRACER *t = enriching_tracer(*mz.mig, i);
 		SNEIA_YIELD_SPECS sneia = *(
 			mz.zones[(*t).zone_origin] -> elements[index] -> sneia_yields
 		);
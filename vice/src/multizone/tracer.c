@@ -90,6 +90,7 @@ extern void compute_tracer_masses(MULTIZONE *mz) {
  */
 extern double tracer_metallicity(MULTIZONE mz, TRACER t) {
 
+	if (t.abundances != NULL) return t.metallicity;
 	return scale_metallicity(
 		(*mz.zones[t.zone_origin]),
 		t.timestep_origin
@@ -97,6 +98,30 @@ extern double tracer_metallicity(MULTIZONE mz, TRACER t) {
 
 }
 
+
+/*
+ * Determine the metallicity by mass of a given element in a tracer particle.
+ *
+ * Parameters
+ * ==========
+ * mz: 		The multizone object for the current simulation
+ * t: 		The tracer particle to determine the abundance of
+ * index: 	The index of the element
+ *
+ * Returns
+ * =======
+ * The mass fraction of the element in the tracer particle
+ *
+ * header: tracer.h
+ */
+extern double tracer_abundance(MULTIZONE mz, TRACER t, unsigned int index) {
+
+	if (t.abundances != NULL) return t.abundances[index];
+	SINGLEZONE origin = *mz.zones[t.zone_origin];
+	return (*origin.state).Z[t.timestep_origin * origin.n_elements + index];
+
+}
+
 /*
  * Allocate memory for the stellar tracer particles
  *
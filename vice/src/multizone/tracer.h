@@ -53,6 +53,23 @@ extern void compute_tracer_masses(MULTIZONE *mz);
  */
 extern double tracer_metallicity(MULTIZONE mz, TRACER t);
 
+/*
+ * Determine the metallicity by mass of a given element in a tracer particle.
+ *
+ * Parameters
+ * ==========
+ * mz: 		The multizone object for the current simulation
+ * t: 		The tracer particle to determine the abundance of
+ * index: 	The index of the element
+ *
+ * Returns
+ * =======
+ * The mass fraction of the element in the tracer particle
+ *
+ * source: tracer.c
+ */
+extern double tracer_abundance(MULTIZONE mz, TRACER t, unsigned int index);
+
 /*
  * Allocate memory for the stellar tracer particles
  *
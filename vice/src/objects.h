@@ -12,7 +12,9 @@ extern "C" {
 #include "objects/callback_2arg.h"
 #include "objects/ccsne.h"
 #include "objects/channel.h"
+#include "objects/context.h"
 #include "objects/element.h"
+#include "objects/ensemble.h"
 #include "objects/fromfile.h"
 #include "objects/hydrodiskstars.h"
 #include "objects/imf.h"
@@ -23,6 +25,8 @@ extern "C" {
 #include "objects/mdf.h"
 #include "objects/migration.h"
 #include "objects/multizone.h"
+#include "objects/profile.h"
+#include "objects/sensitivity.h"
 #include "objects/singlezone.h"
 #include "objects/sneia.h"
 #include "objects/ssp.h"
@@ -17,6 +17,9 @@ extern CALLBACK_2ARG *callback_2arg_initialize(void) {
 	CALLBACK_2ARG *cb2 = (CALLBACK_2ARG *) malloc (sizeof(CALLBACK_2ARG));
 	cb2 -> assumed_constant = 0;
 	cb2 -> user_func = NULL;
+	cb2 -> native = 0u;
+	cb2 -> calls = NULL;
+	cb2 -> owns_user_func = 0u;
 	return cb2;
 
 }
@@ -30,6 +33,7 @@ extern CALLBACK_2ARG *callback_2arg_initialize(void) {
 extern void callback_2arg_free(CALLBACK_2ARG *cb2) {
 
 	if (cb2 != NULL) {
+		if ((*cb2).owns_user_func) free(cb2 -> user_func);
 		free(cb2);
 		cb2 = NULL;
 	} else {}
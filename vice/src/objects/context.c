@@ -0,0 +1,51 @@
+/*
+ * This file implements memory management for the CONTEXT object.
+ */
+
+#include <stdlib.h>
+#include "../ssp/mlr.h"
+#include "objects.h"
+#include "context.h"
+
+
+/*
+ * Allocate memory for and return a pointer to a CONTEXT struct. The
+ * mass-lifetime relation is set to Larson (1974), which requires no data, and
+ * all other fields to NULL.
+ *
+ * header: context.h
+ */
+extern CONTEXT *context_initialize(void) {
+
+	CONTEXT *ctx = (CONTEXT *) malloc (sizeof(CONTEXT));
+	ctx -> mlr = LARSON1974;
+	ctx -> hpt2000 = NULL;
+	ctx -> ka1997 = NULL;
+	ctx -> vincenzo2016 = NULL;
+	ctx -> pb = NULL;
+	ctx -> hds = NULL;
+	ctx -> profile = NULL;
+	return ctx;
+
+}
+
+
+/*
+ * Free up the memory stored in a CONTEXT struct, including any mass-lifetime
+ * relation data imported into it. The hydrodiskstars and profile objects
+ * are owned by python and are not freed.
+ *
+ * header: context.h
+ */
+extern void context_free(CONTEXT *ctx) {
+
+	if (ctx != NULL) {
+
+		free_mlr_data(ctx);
+		free(ctx);
+		ctx = NULL;
+
+	} else {}
+
+}
+
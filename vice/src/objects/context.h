@@ -0,0 +1,34 @@
+
+#ifndef OBJECTS_CONTEXT_H
+#define OBJECTS_CONTEXT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "objects.h"
+
+/*
+ * Allocate memory for and return a pointer to a CONTEXT struct. The
+ * mass-lifetime relation is set to Larson (1974), which requires no data, and
+ * all other fields to NULL.
+ *
+ * source: context.c
+ */
+extern CONTEXT *context_initialize(void);
+
+/*
+ * Free up the memory stored in a CONTEXT struct, including any mass-lifetime
+ * relation data imported into it. The hydrodiskstars and profile objects
+ * are owned by python and are not freed.
+ *
+ * source: context.c
+ */
+extern void context_free(CONTEXT *ctx);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* OBJECTS_CONTEXT_H */
+
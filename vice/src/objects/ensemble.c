@@ -0,0 +1,71 @@
+/*
+ * This file implements memory management for the ensemble object.
+ */
+
+#include <stdlib.h>
+#include "../io.h"
+#include "objects.h"
+#include "ensemble.h"
+
+
+/*
+ * Allocates memory for and returns a pointer to an ensemble object
+ *
+ * Parameters
+ * ==========
+ * n: 		The number of members in the ensemble
+ *
+ * header: ensemble.h
+ */
+extern ENSEMBLE *ensemble_initialize(unsigned long n) {
+
+	/*
+	 * As in the multizone object, memory is allocated for n pointers to
+	 * singlezone objects, which are created through the python interpreter
+	 * and linked here via link_member.
+	 */
+	ENSEMBLE *ens = (ENSEMBLE *) malloc (sizeof(ENSEMBLE));
+	ens -> members = (SINGLEZONE **) malloc (n * sizeof(SINGLEZONE *));
+	ens -> name = (char *) malloc (MAX_FILENAME_SIZE * sizeof(char));
+	ens -> n_members = n;
+	ens -> n_threads = 1u;
+	ens -> verbose = 0;
+	ens -> history_writer = NULL;
+	ens -> mdf_writer = NULL;
+	return ens;
+
+}
+
+
+/*
+ * Frees the memory stored in an ensemble object
+ *
+ * header: ensemble.h
+ */
+extern void ensemble_free(ENSEMBLE *ens) {
+
+	if (ens != NULL) {
+
+		/*
+		 * The singlezone objects for each member free themselves via their
+		 * __dealloc__ functions in python, so only the array of pointers is
+		 * freed here.
+		 */
+
+		if ((*ens).members != NULL) {
+			free(ens -> members);
+			ens -> members = NULL;
+		} else {}
+
+		if ((*ens).name != NULL) {
+			free(ens -> name);
+			ens -> name = NULL;
+		} else {}
+
+		free(ens);
+		ens = NULL;
+
+	}
+
+}
+
@@ -0,0 +1,35 @@
+
+#ifndef OBJECTS_ENSEMBLE_H
+#define OBJECTS_ENSEMBLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "objects.h"
+
+/*
+ * Allocates memory for and returns a pointer to an ensemble object
+ *
+ * Parameters
+ * ==========
+ * n: 		The number of members in the ensemble
+ *
+ * source: ensemble.c
+ */
+extern ENSEMBLE *ensemble_initialize(unsigned long n);
+
+/*
+ * Frees the memory stored in an ensemble object
+ *
+ * source: ensemble.c
+ */
+extern void ensemble_free(ENSEMBLE *ens);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus*/
+
+#endif /* OBJECTS_ENSEMBLE_H */
+
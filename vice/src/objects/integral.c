@@ -9,13 +9,16 @@
 
 
 /*
- * Allocate memory for and return a pointer to an integral object.
+ * Allocate memory for and return a pointer to an integral object. The
+ * additional data passed to the integrand is initialized to NULL.
  *
  * header: integral.h
  */
 extern INTEGRAL *integral_initialize(void) {
 
-	return (INTEGRAL *) malloc (sizeof(INTEGRAL));
+	INTEGRAL *intgrl = (INTEGRAL *) malloc (sizeof(INTEGRAL));
+	intgrl -> params = NULL;
+	return intgrl;
 
 }
 
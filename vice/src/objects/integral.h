@@ -9,7 +9,8 @@ extern "C" {
 #include "objects.h"
 
 /*
- * Allocate memory for and return a pointer to an integral object.
+ * Allocate memory for and return a pointer to an integral object. The
+ * additional data passed to the integrand is initialized to NULL.
  *
  * source: integral.c
  */
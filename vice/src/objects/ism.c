@@ -69,6 +69,11 @@ extern void ism_free(ISM *ism) {
 			ism -> mode = NULL;
 		} else {}
 
+		if ((*ism).functional_tau_star != NULL) {
+			callback_2arg_free(ism -> functional_tau_star);
+			ism -> functional_tau_star = NULL;
+		} else {}
+
 		free(ism);
 		ism = NULL;
 
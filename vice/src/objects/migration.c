@@ -26,6 +26,13 @@ extern MIGRATION *migration_initialize(unsigned int n) {
 	mig -> gas_migration = NULL;
 	mig -> tracers = NULL;
 	mig -> tracers_output = NULL;
+	mig -> tracers_buffer = NULL;
+	mig -> tracers_written = 0ul;
+	mig -> tracers_offset = 0l;
+	mig -> merged = NULL;
+	mig -> n_merged = 0ul;
+	mig -> first_unmerged = 0ul;
+	mig -> merge_threshold = 0ul;
 	return mig;
 
 }
@@ -54,11 +61,27 @@ extern void migration_free(MIGRATION *mig) {
 			mig -> tracers = NULL;
 		} else {}
 
+		if ((*mig).merged != NULL) {
+			/* merged particles share the zone histories of the tracers */
+			unsigned long i;
+			for (i = 0l; i < (*mig).n_merged; i++) {
+				mig -> merged[i] -> zone_history = NULL;
+				tracer_free(mig -> merged[i]);
+			}
+			free(mig -> merged);
+			mig -> merged = NULL;
+		} else {}
+
 		if ((*mig).tracers_output != NULL) {
 			fclose(mig -> tracers_output);
 			mig -> tracers_output = NULL;
 		} else {}
 
+		if ((*mig).tracers_buffer != NULL) {
+			free(mig -> tracers_buffer);
+			mig -> tracers_buffer = NULL;
+		} else {}
+
 		free(mig);
 		mig = NULL;
 
@@ -8,6 +8,7 @@
 #include "objects.h"
 #include "multizone.h"
 #include "migration.h"
+#include "context.h"
 
 
 /*
@@ -31,7 +32,10 @@ extern MULTIZONE *multizone_initialize(unsigned int n) {
 	mz -> zones = (SINGLEZONE **) malloc (n * sizeof(SINGLEZONE *));
 	mz -> name = (char *) malloc (MAX_FILENAME_SIZE * sizeof(char));
 	mz -> mig = migration_initialize(n);
+	mz -> ctx = context_initialize();
 	mz -> verbose = 0;
+	mz -> checkpoint_interval = 0;
+	mz -> merge_age = 0;
 	return mz;
 
 }
@@ -62,6 +66,7 @@ extern void multizone_free(MULTIZONE *mz) {
 			mz -> mig = NULL;
 		}
 
+		context_free(mz -> ctx);
 		free(mz);
 		mz = NULL;
 
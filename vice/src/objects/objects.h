@@ -23,6 +23,11 @@ typedef struct callback_1arg {
 	 * 		specified a function.
 	 * user_func: A void pointer to the PyObject corresponding to the user's
 	 * 		function defined in python
+	 * native: 1 if user_func instead points to a C object which callback
+	 * 		evaluates without the python interpreter (e.g. an
+	 * 		INTERP_SCHEME_1D), 0 otherwise
+	 * calls: A counter incremented each time the function is evaluated while
+	 * 		the simulation is being profiled. NULL otherwise.
 	 *
 	 * Notes
 	 * =====
@@ -33,6 +38,8 @@ typedef struct callback_1arg {
 	double (*callback)(double, void *);
 	double assumed_constant;
 	void *user_func;
+	unsigned short native;
+	unsigned long *calls;
 
 } CALLBACK_1ARG;
 
@@ -48,6 +55,14 @@ typedef struct callback_2arg {
 	 * 		specified a function.
 	 * user_func: A void pointer to the PyObject corresponding to the user's
 	 * 		function defined in python
+	 * native: 1 if user_func instead points to a C object which callback
+	 * 		evaluates without the python interpreter (e.g. an
+	 * 		INTERP_SCHEME_2D), 0 otherwise
+	 * owns_user_func: 1 if that C object was allocated for this callback
+	 * 		alone (e.g. a J21_SF_LAW), and is freed along with it, 0 otherwise
+	 * calls: A counter incremented each time the function is evaluated while
+	 * 		the simulation is being profiled. NULL otherwise.
+	 *
 	 * Notes
 	 * =====
 	 * The attribute assumed_constant allows a callback function to be adopted
@@ -58,6 +73,9 @@ typedef struct callback_2arg {
 	double (*callback)(double, double, void *);
 	double assumed_constant;
 	void *user_func;
+	unsigned short native;
+	unsigned short owns_user_func;
+	unsigned long *calls;
 
 } CALLBACK_2ARG;
 
@@ -117,6 +135,47 @@ typedef struct interpolation_scheme_2d {
 } INTERP_SCHEME_2D;
 
 
+typedef struct J21_star_formation_law {
+
+	/*
+	 * This struct holds the parameters of the star formation law adopted by
+	 * Johnson et al. (2021), the default in the milkyway object. See
+	 * vice/toolkit/J21_sf_law.py for further details.
+	 *
+	 * area: The surface area of the star forming region in kpc^2
+	 * present_day_molecular: The depletion time of molecular gas at the
+	 * 		present day in Gyr
+	 * molecular_index: The power-law index on the time-dependence of the
+	 * 		depletion time of molecular gas
+	 * Sigma_g1: The lower of the two gas surface densities at which the
+	 * 		Kennicutt-Schmidt relation breaks, in Msun kpc^-2
+	 * Sigma_g2: The higher of the two gas surface densities at which the
+	 * 		Kennicutt-Schmidt relation breaks, in Msun kpc^-2
+	 * index1: The power-law index of tau_star on the gas surface density
+	 * 		below Sigma_g1 (i.e. 1 - N for a Kennicutt-Schmidt index N)
+	 * index2: The power-law index of tau_star on the gas surface density
+	 * 		between Sigma_g1 and Sigma_g2
+	 * sfr_mode: 1 if the law is evaluated as a function of the star
+	 * 		formation rate, 0 if of the gas supply
+	 *
+	 * Notes
+	 * =====
+	 * This object holds no pointers, so a CALLBACK_2ARG which owns one frees
+	 * it with the standard library's free function.
+	 */
+
+	double area;
+	double present_day_molecular;
+	double molecular_index;
+	double Sigma_g1;
+	double Sigma_g2;
+	double index1;
+	double index2;
+	unsigned short sfr_mode;
+
+} J21_SF_LAW;
+
+
 typedef struct asymptotic_giant_branch_star_yield_grid {
 
 	/*
@@ -213,7 +272,6 @@ typedef struct element {
 	 * ccsne_yield: The struct holding this element's CCSNe yield information
 	 * SNEIA_YIELD: The struct holding this element's SNeIa yield information
 	 * symbol: The symbol of the element from the periodic table (lower-case)
-	 * Z: The metallicity by mass of this element at all previous timesteps
 	 * Zin: The metallicity by mass of the infall rate at all timesteps
 	 * primordial: The primordial abundance by mass due to big bang
 	 * 		nucleosynthesis
@@ -228,7 +286,6 @@ typedef struct element {
 	CHANNEL **channels;
 	unsigned short n_channels;
 	char *symbol;
-	double *Z;
 	double *Zin;
 	double primordial;
 	double unretained;
@@ -238,6 +295,46 @@ typedef struct element {
 } ELEMENT;
 
 
+typedef struct element_state {
+
+	/*
+	 * This struct stores the state of a set of elements contiguously, such
+	 * that all of them are moved forward in a single loop over elements.
+	 * Each zone keeps one for its elements, and the linear response one for
+	 * its copies of them.
+	 *
+	 * n_elements: The number of elements in the set
+	 * Z: The metallicity by mass of each element at all timesteps. The value
+	 * 		for element j at timestep i is stored at index i * n_elements + j.
+	 * mass: The mass of each element in Msun over the current update
+	 * sources: The mass of each element in Msun produced by each enrichment
+	 * 		channel and retained by the ISM over the current update
+	 * recycled: The mass of each element in Msun returned to the ISM by
+	 * 		previous generations of stars over the current update
+	 * infall: The mass of each element in Msun accreted by the ISM over the
+	 * 		current update
+	 * helium: 1 for helium, which is not ejected at an enhanced metallicity
+	 * 		and does not count toward the metallicity, and 0 for all others
+	 * entrainment: The entrainment fraction of the CCSN, SN Ia, and AGB star
+	 * 		ejecta of each element. The fraction for element j from channel c
+	 * 		is stored at index c * n_elements + j (see src/element.h).
+	 * solar: The sum of the solar abundances by mass of the elements which
+	 * 		count toward the metallicity
+	 */
+
+	unsigned int n_elements;
+	double *Z;
+	double *mass;
+	double *sources;
+	double *recycled;
+	double *infall;
+	unsigned short *helium;
+	double *entrainment;
+	double solar;
+
+} ELEMENT_STATE;
+
+
 typedef struct interstellar_medium {
 
 	/*
@@ -363,6 +460,7 @@ typedef struct single_stellar_population {
 	IMF_ *imf;
 	double *crf;
 	double *msmf;
+	unsigned short cached;
 	double postMS;
 	double R0;
 	int continuous;
@@ -370,6 +468,187 @@ typedef struct single_stellar_population {
 } SSP;
 
 
+typedef struct profile {
+
+	/*
+	 * This struct accumulates the wall-clock time spent in each phase of a
+	 * simulation when it is ran with profiling enabled.
+	 *
+	 * seconds: The total time in seconds spent in each phase, indexed by the
+	 * 		PROFILE_* phases (see src/profile.h)
+	 * calls: The number of times each phase was entered
+	 * start: The reading of the monotonic clock in seconds when each phase
+	 * 		was most recently entered
+	 */
+
+	double *seconds;
+	unsigned long *calls;
+	double *start;
+
+} PROFILE;
+
+
+typedef struct simulation_context {
+
+	/*
+	 * This struct holds the state that the calculations of a simulation
+	 * depend on beyond the parameters of its zones. Each singlezone and
+	 * multizone object carries its own, such that several simulations can
+	 * run at once on separate threads.
+	 *
+	 * mlr: The hash-code of the mass-lifetime relation (see ssp/mlr.h)
+	 * hpt2000: The coefficients of the Hurley, Pols & Tout (2000)
+	 * 		mass-lifetime relation. NULL if not imported.
+	 * ka1997: The lifetimes of stars tabulated by Kodama & Arimoto (1997) as
+	 * 		a function of metallicity and mass. NULL if not imported.
+	 * vincenzo2016: The interpolation schemes for the coefficients A, B, and
+	 * 		C of the Vincenzo et al. (2016) mass-lifetime relation as
+	 * 		functions of metallicity. NULL if not imported.
+	 * pb: The progressbar printed as a singlezone simulation runs. NULL if
+	 * 		the simulation is not running verbosely.
+	 * hds: The hydrodiskstars object driving the migration of star particles
+	 * 		in a multizone simulation. NULL if not applicable.
+	 * profile: The time spent in each phase of the simulation. NULL unless
+	 * 		it is being profiled. The zones of a multizone simulation share
+	 * 		that of the multizone object.
+	 */
+
+	unsigned short mlr;
+	double **hpt2000;
+	INTERP_SCHEME_2D *ka1997;
+	INTERP_SCHEME_1D **vincenzo2016;
+	struct progressbar *pb;
+	struct hydrodiskstars *hds;
+	PROFILE *profile;
+
+} CONTEXT;
+
+
+typedef struct age_bins {
+
+	/*
+	 * This struct stores the star formation history of a singlezone
+	 * simulation older than some threshold age merged into bins of birth
+	 * time, whose widths grow in proportion to the age of the stars within
+	 * them.
+	 *
+	 * threshold: The age in timesteps beyond which stellar populations are
+	 * 		binned
+	 * n_bins: The number of bins
+	 * binned: The number of timesteps whose star formation is stored in the
+	 * 		bins. Star formation at all later timesteps is at full resolution.
+	 * start: The timestep at which each bin begins
+	 * width: The number of timesteps spanned by each bin, a power of two
+	 * mass: The sum of the star formation rate over the timesteps in each bin
+	 * metals: The star formation rate-weighted sum of the scaled metallicity
+	 * 		(see scale_metallicity in src/utils.h) over each bin
+	 * Z: The star formation rate-weighted sum of the metallicity by mass of
+	 * 		each element over each bin. The sum for bin i and element j is
+	 * 		stored at index i * n_elements + j.
+	 * RIa: The cumulative sum of the SNe Ia rate of each element, starting
+	 * 		at zero. The sum over the first i timesteps for element j is
+	 * 		stored at index j * (n_RIa + 1) + i.
+	 * n_RIa: The length of the SNe Ia rate of each element
+	 * error: The largest upper bound on the relative error in an enrichment
+	 * 		rate introduced by the binning
+	 */
+
+	unsigned long threshold;
+	unsigned long n_bins;
+	unsigned long binned;
+	unsigned long *start;
+	unsigned long *width;
+	double *mass;
+	double *metals;
+	double *Z;
+	double *RIa;
+	unsigned long n_RIa;
+	double error;
+
+} AGE_BINS;
+
+
+typedef struct linear_response {
+
+	/*
+	 * This struct holds the response of the mass of each element in the ISM
+	 * to its yields from each enrichment channel in singlezone simulations.
+	 *
+	 * elements: Copies of each element evolved alongside the element itself
+	 * 		under the same gas evolution, each with the yields of only one
+	 * 		enrichment channel. There are RESPONSE_CHANNELS of them per
+	 * 		element (see src/singlezone/response.h), stored element-major.
+	 * n_elements: The number of elements copied
+	 * state: The state of the copies, stored in the same order
+	 * writer: A FILE struct for the response.out output file
+	 *
+	 * Notes
+	 * =====
+	 * The copies share the SNe Ia delay-time distribution and the AGB star
+	 * yield grids of the element itself, but own their yield callbacks and
+	 * their Zin arrays.
+	 */
+
+	ELEMENT **elements;
+	unsigned int n_elements;
+	ELEMENT_STATE *state;
+	FILE *writer;
+
+} RESPONSE;
+
+
+typedef struct sensitivity {
+
+	/*
+	 * This struct holds the derivatives of the ISM mass and the mass of each
+	 * element with respect to a set of scalar parameters in singlezone
+	 * simulations, carried forward alongside the integration.
+	 *
+	 * n_params: The number of parameters
+	 * params: The parameter for each derivative, one of the SENSITIVITY_*
+	 * 		values (see src/singlezone/sensitivity.h)
+	 * elements: For the yield of an element, the index of that element.
+	 * 		Ignored otherwise.
+	 * n_elements: The number of elements in the simulation. This is zero
+	 * 		until the derivatives are set up for a simulation.
+	 * mass: The derivative of the ISM mass for each parameter
+	 * star_formation_rate: The derivative of the star formation rate
+	 * infall_rate: The derivative of the infall rate
+	 * star_formation_history: The derivative of the star formation rate at
+	 * 		each timestep, for each parameter
+	 * element_mass: The derivative of the mass of each element, stored at
+	 * 		index k * n_elements + j for parameter k and element j
+	 * Z: The derivative of the metallicity by mass of each element at each
+	 * 		timestep, indexed as element_mass
+	 * RIa: The derivative of the SNe Ia delay-time distribution of each
+	 * 		element with respect to its e-folding timescale. NULL unless it
+	 * 		is one of the parameters.
+	 * mass_prev: The ISM mass at the beginning of the current timestep
+	 * infall_prev: The infall rate at the beginning of the current timestep
+	 * element_mass_prev: The mass of each element at the beginning of the
+	 * 		current timestep
+	 * writer: A FILE struct for the sensitivities.out output file
+	 */
+
+	unsigned short n_params;
+	unsigned short *params;
+	unsigned int *elements;
+	unsigned int n_elements;
+	double *mass;
+	double *star_formation_rate;
+	double *infall_rate;
+	double **star_formation_history;
+	double *element_mass;
+	double **Z;
+	double **RIa;
+	double mass_prev;
+	double infall_prev;
+	double *element_mass_prev;
+	FILE *writer;
+
+} SENSITIVITY;
+
+
 typedef struct singlezone {
 
 	/*
@@ -386,14 +665,49 @@ typedef struct singlezone {
 	 * timestep: The timestep number. The current time is also equal to this
 	 * 		times the timestep size.
 	 * n_outputs: The number of times in the output_times array
+	 * output_index: The index of the next output time to be written to the
+	 * 		history.out file.
+	 * checkpoint_interval: The time in Gyr between checkpoints of the
+	 * 		simulation state. Checkpointing is disabled if this is zero.
+	 * step: The number of timesteps of size dt spanned by the next update of
+	 * 		the simulation. This is always 1 unless the simulation is ran with
+	 * 		adaptive timestepping.
+	 * trial_step: The number of timesteps of size dt to attempt on the next
+	 * 		step of adaptive timestepping.
+	 * tolerance: The relative error tolerance of adaptive timestepping.
+	 * 		Adaptive timestepping is disabled if this is zero.
+	 * integrator: The method by which the ISM mass and the mass of each
+	 * 		element are moved forward in time. Either EULER or EXPONENTIAL
+	 * 		(see src/singlezone.h).
+	 * analytic: boolean int describing whether or not the ISM mass and the
+	 * 		mass of each element are evaluated from their closed-form
+	 * 		solutions in place of the integrator (see
+	 * 		src/singlezone/analytic.c)
+	 * age_binning: The age in Gyr beyond which stellar populations are merged
+	 * 		into bins of growing width in the enrichment from SNe Ia, AGB
+	 * 		stars, and recycling. This is disabled if it is zero.
+	 * binning_error: The upper bound on the relative error in the enrichment
+	 * 		rates introduced by age binning over the most recent simulation.
+	 * age_bins: The binned star formation history. NULL unless the simulation
+	 * 		is running with age binning.
+	 * linear_response: boolean int describing whether or not to record the
+	 * 		response of each element's mass to its yields from each channel
+	 * response: The response of each element's mass to its yields. NULL
+	 * 		unless the simulation is recording it.
+	 * sensitivity: The derivatives of the ISM mass and each element's mass
+	 * 		with respect to the parameters selected by the user. NULL unless
+	 * 		the simulation is computing them.
 	 * Z_solar: The adopted metallicity by mass of the sun
 	 * n_elements: The number of elements to track
 	 * verbose: boolean int describing whether or not to print the time as the
 	 * 		simulation evolves
 	 * elements: The yield information for each element
+	 * state: The state of each element, stored contiguously. NULL unless the
+	 * 		simulation is running.
 	 * ism: The time evolution information for the interstellar medium (ISM)
 	 * mdf: The stellar metallicity distribution function (MDF) information
 	 * ssp: Information relevant to single stellar populations
+	 * ctx: The context the simulation runs in
 	 */
 
 	char *name;
@@ -404,13 +718,28 @@ typedef struct singlezone {
 	double *output_times;
 	unsigned long timestep;
 	unsigned long n_outputs;
+	unsigned long output_index;
+	double checkpoint_interval;
+	unsigned long step;
+	unsigned long trial_step;
+	double tolerance;
+	unsigned short integrator;
+	unsigned short analytic;
+	double age_binning;
+	double binning_error;
+	AGE_BINS *age_bins;
+	unsigned short linear_response;
+	RESPONSE *response;
+	SENSITIVITY *sensitivity;
 	double Z_solar;
 	unsigned int n_elements;
 	unsigned short verbose;
 	ELEMENT **elements;
+	ELEMENT_STATE *state;
 	ISM *ism;
 	MDF *mdf;
 	SSP *ssp;
+	CONTEXT *ctx;
 
 } SINGLEZONE;
 
@@ -426,10 +755,19 @@ typedef struct tracer {
 	 * zone_history: The zone number of the tracer particle at all timesteps
 	 * 		This is -1 at timesteps before the tracer particle is born
 	 * timestep_origin: The timestep at which the tracer particle is born
+	 * width: The number of timesteps spanned by the births of the tracer
+	 * 		particles merged into this one. 1 for unmerged particles.
+	 * abundances: The mass-weighted metallicity by mass of each element of
+	 * 		the tracer particles merged into this one. NULL for unmerged
+	 * 		particles.
+	 * metallicity: The mass-weighted scaled metallicity of the tracer
+	 * 		particles merged into this one. Unused for unmerged particles.
 	 *
 	 * Notes
 	 * =====
-	 * zone_history is an array filled from user-specifications in python
+	 * zone_history is an array filled from user-specifications in python.
+	 * Merged particles share the zone_history of their most massive member
+	 * and have a timestep_origin at the centre of the timesteps they span.
 	 */
 
 	double mass;
@@ -437,6 +775,9 @@ typedef struct tracer {
 	unsigned int zone_origin;
 	unsigned int zone_current;
 	unsigned long timestep_origin;
+	unsigned long width;
+	double *abundances;
+	double metallicity;
 
 } TRACER;
 
@@ -451,6 +792,19 @@ typedef struct migration {
 	 * tracer_count: The number of active tracer particles
 	 * gas_migration: The migration matrix associated with the ISM gas
 	 * tracers: Pointers to the tracer particles themselves
+	 * tracers_output: A FILE struct for the tracers.out output file
+	 * tracers_buffer: The buffer for writes to the tracers.out output file
+	 * tracers_written: The number of tracer particles already written to the
+	 * 		tracers.out output file
+	 * tracers_offset: The position in the tracers.out output file at which
+	 * 		the data of the first tracer particle begins
+	 * merged: Pointers to the particles formed by merging aged tracer
+	 * 		particles, ordered from the oldest to youngest
+	 * n_merged: The number of merged particles
+	 * first_unmerged: The index of the first tracer particle which has not
+	 * 		been merged
+	 * merge_threshold: The age in timesteps beyond which tracer particles
+	 * 		are merged. Merging is disabled if this is zero.
 	 */
 
 	unsigned int n_zones;
@@ -459,6 +813,13 @@ typedef struct migration {
 	double ***gas_migration;
 	TRACER **tracers;
 	FILE *tracers_output;
+	char *tracers_buffer;
+	unsigned long tracers_written;
+	long tracers_offset;
+	TRACER **merged;
+	unsigned long n_merged;
+	unsigned long first_unmerged;
+	unsigned long merge_threshold;
 
 } MIGRATION;
 
@@ -473,6 +834,16 @@ typedef struct multizone {
 	 * mig: The migration settings for this simulation
 	 * verbose: boolean int describing whether or not to print the time as the
 	 * 		simulation evolves
+	 * simple: boolean int describing whether or not to evolve each zone
+	 * 		independently and compute tracer particle masses afterwards
+	 * checkpoint_interval: The time in Gyr between checkpoints of the
+	 * 		simulation state. Checkpointing is disabled if this is zero.
+	 * merge_age: The age in Gyr beyond which tracer particles sharing a zone
+	 * 		of origin, a current zone, and a bin in age are merged in the
+	 * 		enrichment from SNe Ia, AGB stars, recycling, and custom channels.
+	 * 		Merging is disabled if this is zero.
+	 * ctx: The context the simulation runs in. Each zone carries its own as
+	 * 		well.
 	 */
 
 	char *name;
@@ -480,29 +851,65 @@ typedef struct multizone {
 	MIGRATION *mig;
 	unsigned short verbose;
 	unsigned short simple;
+	double checkpoint_interval;
+	double merge_age;
+	CONTEXT *ctx;
 
 } MULTIZONE;
 
 
+typedef struct ensemble {
+
+	/*
+	 * This struct is the core of the ensemble object, which integrates many
+	 * singlezone models with the same output times together.
+	 *
+	 * name: The name of the simulation
+	 * members: The SINGLEZONE objects corresponding to each member
+	 * n_members: The number of members in the ensemble
+	 * n_threads: The number of threads to integrate the members across
+	 * verbose: boolean int describing whether or not to print the progress
+	 * 		of the ensemble as members finish
+	 * history_writer: A FILE struct for the history.out output file
+	 * mdf_writer: A FILE struct for the mdf.out output file
+	 */
+
+	char *name;
+	SINGLEZONE **members;
+	unsigned long n_members;
+	unsigned int n_threads;
+	unsigned short verbose;
+	FILE *history_writer;
+	FILE *mdf_writer;
+
+} ENSEMBLE;
+
+
 typedef struct integral {
 
 	/*
 	 * This struct encodes information on a definite integral.
 	 *
-	 * func: The function to integrate
+	 * func: The function to integrate, which takes params as its second
+	 * 		argument
+	 * params: Any additional data needed to evaluate the function
 	 * a: The lower bound of integration
 	 * b: The upper bound of integration
 	 * tolerance: The maximum allowed numerical tolerance
 	 * method: The hash-code for the method of integration
 	 * Nmax: The maximum number of bins in quadrature (failsafe against
-	 * 		non-convergent solutions)
-	 * Nmin: The minimum number of bins in quadrature
+	 * 		non-convergent solutions). For adaptive Gauss-Kronrod quadrature,
+	 * 		the maximum number of function evaluations.
+	 * Nmin: The minimum number of bins in quadrature. For adaptive
+	 * 		Gauss-Kronrod quadrature, the minimum number of function
+	 * 		evaluations.
 	 * results: The numerically computed value of the integral, it's
 	 * 		approximate numerical errors and the number of bins in quadrature
 	 * 		at the time of convergence.
 	 */
 
-	double (*func)(double);
+	double (*func)(double, void *);
+	void *params;
 	double a;
 	double b;
 	double tolerance;
@@ -0,0 +1,51 @@
+/*
+ * This file implements memory management for the PROFILE object.
+ */
+
+#include <stdlib.h>
+#include "../profile.h"
+#include "objects.h"
+#include "profile.h"
+
+
+/*
+ * Allocate memory for and return a pointer to a PROFILE struct, with no time
+ * spent in any phase of the simulation.
+ *
+ * header: profile.h
+ */
+extern PROFILE *profile_initialize(void) {
+
+	PROFILE *p = (PROFILE *) malloc (sizeof(PROFILE));
+	p -> seconds = (double *) malloc (PROFILE_N_PHASES * sizeof(double));
+	p -> calls = (unsigned long *) malloc (PROFILE_N_PHASES *
+		sizeof(unsigned long));
+	p -> start = (double *) malloc (PROFILE_N_PHASES * sizeof(double));
+	unsigned short i;
+	for (i = 0u; i < PROFILE_N_PHASES; i++) {
+		p -> seconds[i] = 0;
+		p -> calls[i] = 0ul;
+		p -> start[i] = 0;
+	}
+	return p;
+
+}
+
+
+/*
+ * Free up the memory stored in a PROFILE struct.
+ *
+ * header: profile.h
+ */
+extern void profile_free(PROFILE *p) {
+
+	if (p != NULL) {
+		free(p -> seconds);
+		free(p -> calls);
+		free(p -> start);
+		free(p);
+		p = NULL;
+	} else {}
+
+}
+
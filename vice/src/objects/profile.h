@@ -0,0 +1,31 @@
+
+#ifndef OBJECTS_PROFILE_H
+#define OBJECTS_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "objects.h"
+
+/*
+ * Allocate memory for and return a pointer to a PROFILE struct, with no time
+ * spent in any phase of the simulation.
+ *
+ * source: profile.c
+ */
+extern PROFILE *profile_initialize(void);
+
+/*
+ * Free up the memory stored in a PROFILE struct.
+ *
+ * source: profile.c
+ */
+extern void profile_free(PROFILE *p);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* OBJECTS_PROFILE_H */
+
@@ -0,0 +1,107 @@
+/*
+ * This file implements memory management for the SENSITIVITY object.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "objects.h"
+#include "sensitivity.h"
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static void free_2d_array(double **arr, unsigned long n);
+
+
+/*
+ * Allocate memory for and return a pointer to a SENSITIVITY struct.
+ * Allocates memory for the parameter and element index of each derivative
+ * and initializes all other fields to NULL.
+ *
+ * Parameters
+ * ==========
+ * n_params: 	The number of parameters to take derivatives with respect to
+ *
+ * header: sensitivity.h
+ */
+extern SENSITIVITY *sensitivity_initialize(unsigned short n_params) {
+
+	SENSITIVITY *sens = (SENSITIVITY *) malloc (sizeof(SENSITIVITY));
+	sens -> n_params = n_params;
+	sens -> params = (unsigned short *) malloc (n_params *
+		sizeof(unsigned short));
+	sens -> elements = (unsigned int *) malloc (n_params *
+		sizeof(unsigned int));
+	sens -> n_elements = 0u;
+	sens -> mass = NULL;
+	sens -> star_formation_rate = NULL;
+	sens -> infall_rate = NULL;
+	sens -> star_formation_history = NULL;
+	sens -> element_mass = NULL;
+	sens -> Z = NULL;
+	sens -> RIa = NULL;
+	sens -> mass_prev = 0;
+	sens -> infall_prev = 0;
+	sens -> element_mass_prev = NULL;
+	sens -> writer = NULL;
+	return sens;
+
+}
+
+
+/*
+ * Free up the memory stored in a SENSITIVITY struct and close its output
+ * file.
+ *
+ * Parameters
+ * ==========
+ * sens: 	A pointer to the sensitivity to free
+ *
+ * header: sensitivity.h
+ */
+extern void sensitivity_free(SENSITIVITY *sens) {
+
+	if (sens != NULL) {
+
+		if ((*sens).writer != NULL) {
+			fclose(sens -> writer);
+			sens -> writer = NULL;
+		} else {}
+
+		free_2d_array(sens -> star_formation_history, (*sens).n_params);
+		free_2d_array(sens -> Z, (*sens).n_params * (*sens).n_elements);
+		free_2d_array(sens -> RIa, (*sens).n_elements);
+		free(sens -> params);
+		free(sens -> elements);
+		free(sens -> mass);
+		free(sens -> star_formation_rate);
+		free(sens -> infall_rate);
+		free(sens -> element_mass);
+		free(sens -> element_mass_prev);
+		free(sens);
+		sens = NULL;
+
+	} else {}
+
+}
+
+
+/*
+ * Free up the memory stored by a 2-D array whose rows were allocated
+ * separately. Rows which were never allocated must be NULL.
+ *
+ * Parameters
+ * ==========
+ * arr: 	The array to free. Nothing happens if this is NULL.
+ * n: 		The number of rows
+ */
+static void free_2d_array(double **arr, unsigned long n) {
+
+	if (arr != NULL) {
+		unsigned long i;
+		for (i = 0ul; i < n; i++) {
+			free(arr[i]);
+		}
+		free(arr);
+	} else {}
+
+}
+
@@ -0,0 +1,40 @@
+#ifndef OBJECTS_SENSITIVITY_H
+#define OBJECTS_SENSITIVITY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "objects.h"
+
+/*
+ * Allocate memory for and return a pointer to a SENSITIVITY struct.
+ * Allocates memory for the parameter and element index of each derivative
+ * and initializes all other fields to NULL.
+ *
+ * Parameters
+ * ==========
+ * n_params: 	The number of parameters to take derivatives with respect to
+ *
+ * source: sensitivity.c
+ */
+extern SENSITIVITY *sensitivity_initialize(unsigned short n_params);
+
+/*
+ * Free up the memory stored in a SENSITIVITY struct and close its output
+ * file.
+ *
+ * Parameters
+ * ==========
+ * sens: 	A pointer to the sensitivity to free
+ *
+ * source: sensitivity.c
+ */
+extern void sensitivity_free(SENSITIVITY *sens);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* OBJECTS_SENSITIVITY_H */
+
@@ -4,10 +4,13 @@
 
 #include <stdlib.h>
 #include "../singlezone.h"
+#include "../ssp.h"
 #include "../io.h"
 #include "objects.h"
 #include "singlezone.h"
 #include "ssp.h"
+#include "context.h"
+#include "sensitivity.h"
 
 
 /*
@@ -23,10 +26,25 @@ extern SINGLEZONE *singlezone_initialize(void) {
 	sz -> history_writer = NULL;
 	sz -> mdf_writer = NULL;
 	sz -> output_times = NULL;
+	sz -> output_index = 0ul;
+	sz -> checkpoint_interval = 0;
+	sz -> step = 1ul;
+	sz -> trial_step = 1ul;
+	sz -> tolerance = 0;
+	sz -> integrator = EULER;
+	sz -> analytic = 0u;
+	sz -> age_binning = 0;
+	sz -> binning_error = 0;
+	sz -> age_bins = NULL;
+	sz -> linear_response = 0u;
+	sz -> response = NULL;
+	sz -> sensitivity = NULL;
 	sz -> elements = NULL; 		/* set by python */
+	sz -> state = NULL;
 	sz -> ism = ism_initialize();
 	sz -> mdf = mdf_initialize();
 	sz -> ssp = ssp_initialize();
+	sz -> ctx = context_initialize();
 	return sz;
 
 }
@@ -54,7 +72,14 @@ extern void singlezone_free(SINGLEZONE *sz) {
 
 		ism_free(sz -> ism);
 		mdf_free(sz -> mdf);
+		element_state_free(sz -> state);
+		age_bins_free(sz -> age_bins);
+		response_free(sz -> response);
+		sensitivity_free(sz -> sensitivity);
+		/* hand back any tables shared with other singlezone objects first */
+		release_SSP_tables(sz);
 		ssp_free(sz -> ssp);
+		context_free(sz -> ctx);
 
 		if ((*sz).name != NULL) {
 			free(sz -> name);
@@ -30,6 +30,7 @@ extern SSP *ssp_initialize(void) {
 	);
 	ssp -> crf = NULL;
 	ssp -> msmf = NULL;
+	ssp -> cached = 0u;
 	return ssp;
 
 }
@@ -44,15 +45,19 @@ extern void ssp_free(SSP *ssp) {
 
 	if (ssp != NULL) {
 
-		if ((*ssp).crf != NULL) {
+		/*
+		 * Tables from the cache in ssp/cache.c are owned by the cache, which
+		 * may be in another extension and still sharing them with other SSPs.
+		 */
+		if ((*ssp).crf != NULL && !(*ssp).cached) {
 			free(ssp -> crf);
-			ssp -> crf = NULL;
 		} else {}
+		ssp -> crf = NULL;
 
-		if ((*ssp).msmf != NULL) {
+		if ((*ssp).msmf != NULL && !(*ssp).cached) {
 			free(ssp -> msmf);
-			ssp -> msmf = NULL;
 		} else {}
+		ssp -> msmf = NULL;
 
 		if ((*ssp).imf != NULL) {
 			imf_free(ssp -> imf);
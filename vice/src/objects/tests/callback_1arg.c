@@ -22,7 +22,9 @@ extern unsigned short test_callback_1arg_initialize(void) {
 	CALLBACK_1ARG *test = callback_1arg_initialize();
 	unsigned short result = (test != NULL &&
 		(*test).assumed_constant == 0 &&
-		(*test).user_func == NULL
+		(*test).user_func == NULL &&
+		!(*test).native &&
+		(*test).calls == NULL
 	);
 	callback_1arg_free(test);
 	return result;
@@ -22,7 +22,10 @@ extern unsigned short test_callback_2arg_initialize(void) {
 	CALLBACK_2ARG *test = callback_2arg_initialize();
 	unsigned short result = (test != NULL &&
 		(*test).assumed_constant == 0 &&
-		(*test).user_func == NULL
+		(*test).user_func == NULL &&
+		!(*test).native &&
+		!(*test).owns_user_func &&
+		(*test).calls == NULL
 	);
 	callback_2arg_free(test);
 	return result;
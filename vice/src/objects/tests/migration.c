@@ -26,7 +26,9 @@ extern unsigned short test_migration_initialize(void) {
 		(*test).tracer_count == 0ul &&
 		(*test).gas_migration == NULL &&
 		(*test).tracers == NULL &&
-		(*test).tracers_output == NULL
+		(*test).tracers_output == NULL &&
+		(*test).tracers_buffer == NULL &&
+		(*test).tracers_written == 0ul
 	);
 	migration_free(test);
 	return result;
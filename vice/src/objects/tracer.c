@@ -18,6 +18,9 @@ extern TRACER *tracer_initialize(void) {
 	TRACER *t = (TRACER *) malloc (sizeof(TRACER));
 	t -> mass = 0;
 	t -> zone_history = NULL;
+	t -> width = 1ul;
+	t -> abundances = NULL;
+	t -> metallicity = 0;
 	return t;
 
 }
@@ -37,6 +40,11 @@ extern void tracer_free(TRACER *t) {
 			t -> zone_history = NULL;
 		}
 
+		if ((*t).abundances != NULL) {
+			free(t -> abundances);
+			t -> abundances = NULL;
+		} else {}
+
 		free(t);
 		t = NULL;
 		
@@ -0,0 +1,121 @@
+/*
+ * This file implements the timing of the phases of a simulation when it is
+ * profiled.
+ *
+ * Notes
+ * =====
+ * Each phase is timed with the monotonic clock, which is unaffected by
+ * changes to the system time. Simulations which are not profiled carry a
+ * NULL profile, and the functions here return immediately.
+ */
+
+#include <time.h>
+#include "profile.h"
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static double monotonic_time(void);
+
+/* The name of each phase, indexed by the PROFILE_* values in profile.h */
+static const char *PHASE_NAMES[PROFILE_N_PHASES] = {
+	"setup_output",
+	"setup_SSP",
+	"setup_RIa",
+	"setup_MDF",
+	"setup_gas",
+	"setup_age_bins",
+	"setup_response",
+	"setup_sensitivity",
+	"age_bins",
+	"gas",
+	"enrichment",
+	"analytic",
+	"response",
+	"sensitivity",
+	"MDF",
+	"merging",
+	"migration",
+	"injection",
+	"tracers_MDF",
+	"write_history",
+	"write_MDF",
+	"write_tracers",
+	"checkpoint"
+};
+
+
+/*
+ * Record the time at which a phase of a simulation begins.
+ *
+ * Parameters
+ * ==========
+ * p: 			The profile of the simulation. NULL if it is not being
+ * 				profiled, in which case this function does nothing.
+ * phase: 		The phase beginning, one of the PROFILE_* values
+ *
+ * header: profile.h
+ */
+extern void profile_start(PROFILE *p, unsigned short phase) {
+
+	if (p != NULL) p -> start[phase] = monotonic_time();
+
+}
+
+
+/*
+ * Add the time elapsed since a phase of a simulation began to the total time
+ * spent in it.
+ *
+ * Parameters
+ * ==========
+ * p: 			The profile of the simulation. NULL if it is not being
+ * 				profiled, in which case this function does nothing.
+ * phase: 		The phase ending, one of the PROFILE_* values
+ *
+ * header: profile.h
+ */
+extern void profile_stop(PROFILE *p, unsigned short phase) {
+
+	if (p != NULL) {
+		p -> seconds[phase] += monotonic_time() - (*p).start[phase];
+		p -> calls[phase]++;
+	} else {}
+
+}
+
+
+/*
+ * Determine the name of a phase of a simulation, as reported in python.
+ *
+ * Parameters
+ * ==========
+ * phase: 		One of the PROFILE_* values
+ *
+ * Returns
+ * =======
+ * The name of the phase. NULL if it is not recognized.
+ *
+ * header: profile.h
+ */
+extern const char *profile_phase_name(unsigned short phase) {
+
+	return phase < PROFILE_N_PHASES ? PHASE_NAMES[phase] : NULL;
+
+}
+
+
+/*
+ * Read the monotonic clock.
+ *
+ * Returns
+ * =======
+ * The time in seconds since an arbitrary starting point, which does not
+ * change while the process runs.
+ */
+static double monotonic_time(void) {
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + 1.e-9 * now.tv_nsec;
+
+}
+
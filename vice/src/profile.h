@@ -0,0 +1,160 @@
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * The phases of a simulation which are timed when it is profiled. The
+ * first several set up the simulation, the following several advance it one
+ * timestep, and the remainder write its output.
+ */
+#ifndef PROFILE_SETUP_OUTPUT
+#define PROFILE_SETUP_OUTPUT 0u
+#endif /* PROFILE_SETUP_OUTPUT */
+
+#ifndef PROFILE_SETUP_SSP
+#define PROFILE_SETUP_SSP 1u
+#endif /* PROFILE_SETUP_SSP */
+
+#ifndef PROFILE_SETUP_RIA
+#define PROFILE_SETUP_RIA 2u
+#endif /* PROFILE_SETUP_RIA */
+
+#ifndef PROFILE_SETUP_MDF
+#define PROFILE_SETUP_MDF 3u
+#endif /* PROFILE_SETUP_MDF */
+
+#ifndef PROFILE_SETUP_GAS
+#define PROFILE_SETUP_GAS 4u
+#endif /* PROFILE_SETUP_GAS */
+
+#ifndef PROFILE_SETUP_AGE_BINS
+#define PROFILE_SETUP_AGE_BINS 5u
+#endif /* PROFILE_SETUP_AGE_BINS */
+
+#ifndef PROFILE_SETUP_RESPONSE
+#define PROFILE_SETUP_RESPONSE 6u
+#endif /* PROFILE_SETUP_RESPONSE */
+
+#ifndef PROFILE_SETUP_SENSITIVITY
+#define PROFILE_SETUP_SENSITIVITY 7u
+#endif /* PROFILE_SETUP_SENSITIVITY */
+
+#ifndef PROFILE_AGE_BINS
+#define PROFILE_AGE_BINS 8u
+#endif /* PROFILE_AGE_BINS */
+
+#ifndef PROFILE_GAS
+#define PROFILE_GAS 9u
+#endif /* PROFILE_GAS */
+
+#ifndef PROFILE_ENRICHMENT
+#define PROFILE_ENRICHMENT 10u
+#endif /* PROFILE_ENRICHMENT */
+
+#ifndef PROFILE_ANALYTIC
+#define PROFILE_ANALYTIC 11u
+#endif /* PROFILE_ANALYTIC */
+
+#ifndef PROFILE_RESPONSE
+#define PROFILE_RESPONSE 12u
+#endif /* PROFILE_RESPONSE */
+
+#ifndef PROFILE_SENSITIVITY
+#define PROFILE_SENSITIVITY 13u
+#endif /* PROFILE_SENSITIVITY */
+
+#ifndef PROFILE_MDF
+#define PROFILE_MDF 14u
+#endif /* PROFILE_MDF */
+
+#ifndef PROFILE_MERGING
+#define PROFILE_MERGING 15u
+#endif /* PROFILE_MERGING */
+
+#ifndef PROFILE_MIGRATION
+#define PROFILE_MIGRATION 16u
+#endif /* PROFILE_MIGRATION */
+
+#ifndef PROFILE_INJECTION
+#define PROFILE_INJECTION 17u
+#endif /* PROFILE_INJECTION */
+
+#ifndef PROFILE_TRACERS_MDF
+#define PROFILE_TRACERS_MDF 18u
+#endif /* PROFILE_TRACERS_MDF */
+
+#ifndef PROFILE_WRITE_HISTORY
+#define PROFILE_WRITE_HISTORY 19u
+#endif /* PROFILE_WRITE_HISTORY */
+
+#ifndef PROFILE_WRITE_MDF
+#define PROFILE_WRITE_MDF 20u
+#endif /* PROFILE_WRITE_MDF */
+
+#ifndef PROFILE_WRITE_TRACERS
+#define PROFILE_WRITE_TRACERS 21u
+#endif /* PROFILE_WRITE_TRACERS */
+
+#ifndef PROFILE_CHECKPOINT
+#define PROFILE_CHECKPOINT 22u
+#endif /* PROFILE_CHECKPOINT */
+
+/* The number of phases timed */
+#ifndef PROFILE_N_PHASES
+#define PROFILE_N_PHASES 23u
+#endif /* PROFILE_N_PHASES */
+
+#include "objects.h"
+
+/*
+ * Record the time at which a phase of a simulation begins.
+ *
+ * Parameters
+ * ==========
+ * p: 			The profile of the simulation. NULL if it is not being
+ * 				profiled, in which case this function does nothing.
+ * phase: 		The phase beginning, one of the PROFILE_* values above
+ *
+ * source: profile.c
+ */
+extern void profile_start(PROFILE *p, unsigned short phase);
+
+/*
+ * Add the time elapsed since a phase of a simulation began to the total time
+ * spent in it.
+ *
+ * Parameters
+ * ==========
+ * p: 			The profile of the simulation. NULL if it is not being
+ * 				profiled, in which case this function does nothing.
+ * phase: 		The phase ending, one of the PROFILE_* values above
+ *
+ * source: profile.c
+ */
+extern void profile_stop(PROFILE *p, unsigned short phase);
+
+/*
+ * Determine the name of a phase of a simulation, as reported in python.
+ *
+ * Parameters
+ * ==========
+ * phase: 		One of the PROFILE_* values above
+ *
+ * Returns
+ * =======
+ * The name of the phase. NULL if it is not recognized.
+ *
+ * source: profile.c
+ */
+extern const char *profile_phase_name(unsigned short phase);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* PROFILE_H */
+
@@ -22,15 +22,35 @@ extern "C" {
 #define BUFFER 10l
 #endif /* BUFFER */
 
+/*
+ * The integrators for the ISM mass and the mass of each element. EULER takes
+ * forward Euler steps; EXPONENTIAL integrates the depletion due to star
+ * formation and outflows exactly over each timestep, holding the sources and
+ * the depletion rate fixed.
+ */
+#ifndef EULER
+#define EULER 0u
+#endif /* EULER */
+
+#ifndef EXPONENTIAL
+#define EXPONENTIAL 1u
+#endif /* EXPONENTIAL */
+
 #include "objects.h"
 #include "objects/singlezone.h"
+#include "singlezone/adaptive.h"
+#include "singlezone/agebins.h"
 #include "singlezone/agb.h"
+#include "singlezone/analytic.h"
 #include "singlezone/ccsne.h"
 #include "singlezone/channel.h"
 #include "singlezone/element.h"
+#include "singlezone/integrator.h"
 #include "singlezone/ism.h"
 #include "singlezone/mdf.h"
 #include "singlezone/recycling.h"
+#include "singlezone/response.h"
+#include "singlezone/sensitivity.h"
 #include "singlezone/singlezone.h"
 #include "singlezone/sneia.h"
 
@@ -0,0 +1,339 @@
+/*
+ * This file implements adaptive timestepping in VICE's singlezone
+ * simulations.
+ *
+ * Notes
+ * =====
+ * The update equations are the same as with a fixed timestep, only spanning
+ * multiple timesteps of size dt at once. Each step is therefore an integer
+ * multiple of dt, and the simulation keeps track of the star formation
+ * history and the metallicity of each element at every timestep. This allows
+ * the integrals over all previous stellar populations (e.g. recycling and
+ * SN Ia enrichment) to be evaluated exactly as they are with a fixed
+ * timestep.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "../singlezone.h"
+#include "../io.h"
+#include "../profile.h"
+#include "adaptive.h"
+
+/*
+ * The state of a singlezone simulation that changes over the course of an
+ * update, excluding the star formation history and the metallicity of each
+ * element at all previous timesteps.
+ *
+ * current_time: The time in the simulation in Gyr
+ * timestep: The timestep number
+ * mass: The ISM mass in Msun
+ * star_formation_rate: The star formation rate in Msun/Gyr
+ * infall_rate: The infall rate in Msun/Gyr
+ * element_mass: The mass of each element in the ISM in Msun
+ * unretained: The mass of each element produced but not retained by the ISM
+ * 		over one timestep of size dt
+ */
+typedef struct adaptive_state {
+
+	double current_time;
+	unsigned long timestep;
+	double mass;
+	double star_formation_rate;
+	double infall_rate;
+	double *element_mass;
+	double *unretained;
+
+} ADAPTIVE_STATE;
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static ADAPTIVE_STATE *adaptive_state_initialize(unsigned int n_elements);
+static void adaptive_state_free(ADAPTIVE_STATE *state);
+static void save_state(SINGLEZONE sz, ADAPTIVE_STATE *state);
+static void restore_state(SINGLEZONE *sz, ADAPTIVE_STATE state);
+static double step_error(SINGLEZONE sz, ADAPTIVE_STATE big);
+static void write_intermediate_outputs(SINGLEZONE *sz, ADAPTIVE_STATE start,
+	ADAPTIVE_STATE mid, ADAPTIVE_STATE end);
+
+
+/*
+ * Advances a singlezone simulation forward by an adaptively chosen number of
+ * timesteps. The step size is controlled by step doubling: an update spanning
+ * 2k timesteps is compared with two consecutive updates spanning k timesteps
+ * each, and k is halved until the relative difference in the ISM mass and the
+ * abundance of each element is within the tolerance. The solution from the
+ * two smaller updates is kept, and k is doubled for the next step if the
+ * error was well within the tolerance.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to advance
+ *
+ * header: adaptive.h
+ */
+extern void adaptive_timestepper(SINGLEZONE *sz) {
+
+	/*
+	 * The number of timesteps of size dt remaining until the final output
+	 * time. Step doubling requires at least two of them.
+	 */
+	unsigned long remaining = (unsigned long) ceil(
+		((*sz).output_times[(*sz).n_outputs - 1l] - (*sz).current_time) /
+		(*sz).dt - 1e-6);
+	if (remaining < 2ul) {
+		sz -> step = 1ul;
+		singlezone_step(sz);
+		profile_start((*(*sz).ctx).profile, PROFILE_MDF);
+		update_MDF(sz);
+		profile_stop((*(*sz).ctx).profile, PROFILE_MDF);
+		return;
+	} else {}
+
+	unsigned int i;
+	unsigned long k = (*sz).trial_step, m;
+	if (k > ADAPTIVE_MAX_STEP) k = ADAPTIVE_MAX_STEP;
+	if (k > remaining / 2ul) k = remaining / 2ul;
+	if (!k) k = 1ul;
+
+	ADAPTIVE_STATE *start = adaptive_state_initialize((*sz).n_elements);
+	ADAPTIVE_STATE *big = adaptive_state_initialize((*sz).n_elements);
+	ADAPTIVE_STATE *mid = adaptive_state_initialize((*sz).n_elements);
+	ADAPTIVE_STATE *end = adaptive_state_initialize((*sz).n_elements);
+	save_state(*sz, start);
+
+	double err;
+	while (1) {
+		/*
+		 * The big step goes first, since the two smaller steps overwrite the
+		 * star formation history and metallicities it interpolated.
+		 */
+		restore_state(sz, *start);
+		sz -> step = 2ul * k;
+		singlezone_step(sz);
+		save_state(*sz, big);
+
+		restore_state(sz, *start);
+		sz -> step = k;
+		singlezone_step(sz);
+		for (i = 0u; i < (*sz).n_elements; i++) {
+			sz -> elements[i] -> unretained /= k;
+		}
+		save_state(*sz, mid);
+		singlezone_step(sz);
+		for (i = 0u; i < (*sz).n_elements; i++) {
+			sz -> elements[i] -> unretained /= k;
+		}
+
+		err = step_error(*sz, *big);
+		if (err <= (*sz).tolerance || k == 1ul) break;
+		k /= 2ul;
+	}
+	sz -> step = 1ul;
+	save_state(*sz, end);
+
+	/* The MDF at each timestep spanned by the update */
+	profile_start((*(*sz).ctx).profile, PROFILE_MDF);
+	for (m = (*start).timestep + 1ul; m <= (*end).timestep; m++) {
+		update_MDF_from_history(sz, m);
+	}
+	profile_stop((*(*sz).ctx).profile, PROFILE_MDF);
+	profile_start((*(*sz).ctx).profile, PROFILE_WRITE_HISTORY);
+	write_intermediate_outputs(sz, *start, *mid, *end);
+	profile_stop((*(*sz).ctx).profile, PROFILE_WRITE_HISTORY);
+	restore_state(sz, *end);
+
+	/*
+	 * Euler's method is first order, so the difference between the two
+	 * solutions scales as the square of the step size.
+	 */
+	if (4 * err <= (*sz).tolerance && 2ul * k <= ADAPTIVE_MAX_STEP) {
+		sz -> trial_step = 2ul * k;
+	} else {
+		sz -> trial_step = k;
+	}
+
+	adaptive_state_free(start);
+	adaptive_state_free(big);
+	adaptive_state_free(mid);
+	adaptive_state_free(end);
+
+}
+
+
+/*
+ * Allocate memory for and return a pointer to an ADAPTIVE_STATE object.
+ *
+ * Parameters
+ * ==========
+ * n_elements: 		The number of elements tracked by the simulation
+ */
+static ADAPTIVE_STATE *adaptive_state_initialize(unsigned int n_elements) {
+
+	ADAPTIVE_STATE *state = (ADAPTIVE_STATE *) malloc (sizeof(ADAPTIVE_STATE));
+	state -> element_mass = (double *) malloc (n_elements * sizeof(double));
+	state -> unretained = (double *) malloc (n_elements * sizeof(double));
+	return state;
+
+}
+
+
+/*
+ * Free up the memory stored in an ADAPTIVE_STATE object.
+ *
+ * Parameters
+ * ==========
+ * state: 		A pointer to the state to free
+ */
+static void adaptive_state_free(ADAPTIVE_STATE *state) {
+
+	if (state != NULL) {
+		free(state -> element_mass);
+		free(state -> unretained);
+		free(state);
+	} else {}
+
+}
+
+
+/*
+ * Record the current state of a singlezone simulation.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * state: 	A pointer to the state to store it in
+ */
+static void save_state(SINGLEZONE sz, ADAPTIVE_STATE *state) {
+
+	unsigned int i;
+	state -> current_time = sz.current_time;
+	state -> timestep = sz.timestep;
+	state -> mass = (*sz.ism).mass;
+	state -> star_formation_rate = (*sz.ism).star_formation_rate;
+	state -> infall_rate = (*sz.ism).infall_rate;
+	for (i = 0u; i < sz.n_elements; i++) {
+		state -> element_mass[i] = (*sz.elements[i]).mass;
+		state -> unretained[i] = (*sz.elements[i]).unretained;
+	}
+
+}
+
+
+/*
+ * Restore a singlezone simulation to a previously recorded state.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ * state: 	The state to restore it to
+ */
+static void restore_state(SINGLEZONE *sz, ADAPTIVE_STATE state) {
+
+	unsigned int i;
+	sz -> current_time = state.current_time;
+	sz -> timestep = state.timestep;
+	sz -> ism -> mass = state.mass;
+	sz -> ism -> star_formation_rate = state.star_formation_rate;
+	sz -> ism -> infall_rate = state.infall_rate;
+	for (i = 0u; i < (*sz).n_elements; i++) {
+		sz -> elements[i] -> mass = state.element_mass[i];
+		sz -> elements[i] -> unretained = state.unretained[i];
+	}
+
+}
+
+
+/*
+ * Determine the relative error in a single update spanning 2k timesteps by
+ * comparing it to the current state after two updates spanning k timesteps.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * big: 	The state following the single larger update
+ *
+ * Returns
+ * =======
+ * The largest relative difference in the ISM mass and the abundance by mass
+ * of each element between the two solutions.
+ */
+static double step_error(SINGLEZONE sz, ADAPTIVE_STATE big) {
+
+	double err = 0, mass = (*sz.ism).mass;
+	if (mass == big.mass) {
+		/* Also the case when the gas supply is depleted in both solutions */
+		if (!mass) return 0;
+	} else if (mass) {
+		err = fabs(big.mass - mass) / mass;
+	} else {
+		return HUGE_VAL;
+	}
+	if (!big.mass) return HUGE_VAL;
+
+	unsigned int i;
+	for (i = 0u; i < sz.n_elements; i++) {
+		double Z = (*sz.elements[i]).mass / mass;
+		double Zbig = big.element_mass[i] / big.mass;
+		if (Z != Zbig) {
+			double x = Z ? fabs(Zbig - Z) / fabs(Z) : HUGE_VAL;
+			if (x > err) err = x;
+		} else {}
+	}
+	return err;
+
+}
+
+
+/*
+ * Write the outputs which are due at the timesteps within an update spanning
+ * multiple timesteps. The state of the simulation at each of them is
+ * linearly interpolated between the recorded states, with the abundances
+ * taken from the interpolated metallicities of each element.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ * start: 	The state at the beginning of the update
+ * mid: 	The state following the first of the two smaller updates
+ * end: 	The state at the end of the update
+ *
+ * Notes
+ * =====
+ * An output is written at a given timestep under the same condition as in
+ * the main evolution loop. The output at the end of the update is left to
+ * the main evolution loop.
+ */
+static void write_intermediate_outputs(SINGLEZONE *sz, ADAPTIVE_STATE start,
+	ADAPTIVE_STATE mid, ADAPTIVE_STATE end) {
+
+	unsigned int i;
+	unsigned long m;
+	for (m = start.timestep + 1ul; m < end.timestep; m++) {
+		if ((*sz).output_index >= (*sz).n_outputs) break;
+		double time = start.current_time + (m - start.timestep) * (*sz).dt;
+		if (time >= (*sz).output_times[(*sz).output_index] ||
+			2 * (*sz).output_times[(*sz).output_index] <
+			2 * time + (*sz).dt) {
+			ADAPTIVE_STATE a = m <= mid.timestep ? start : mid;
+			ADAPTIVE_STATE b = m <= mid.timestep ? mid : end;
+			double frac = (double) (m - a.timestep) / (b.timestep - a.timestep);
+			sz -> current_time = time;
+			sz -> timestep = m;
+			sz -> ism -> mass = (1 - frac) * a.mass + frac * b.mass;
+			sz -> ism -> star_formation_rate = (
+				*(*sz).ism).star_formation_history[m];
+			sz -> ism -> infall_rate = (1 - frac) * a.infall_rate +
+				frac * b.infall_rate;
+			for (i = 0u; i < (*sz).n_elements; i++) {
+				sz -> elements[i] -> mass = (
+					(*(*sz).state).Z[m * (*sz).n_elements + i] *
+					(*(*sz).ism).mass);
+				sz -> elements[i] -> unretained = (
+					(1 - frac) * a.unretained[i] + frac * b.unretained[i]);
+			}
+			write_singlezone_history(*sz);
+			sz -> output_index++;
+		} else {}
+	}
+
+}
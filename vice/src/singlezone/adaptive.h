@@ -0,0 +1,50 @@
+#ifndef SINGLEZONE_ADAPTIVE_H
+#define SINGLEZONE_ADAPTIVE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * The maximum number of timesteps of size dt that adaptive timestepping will
+ * take in a single update of the simulation. Step doubling compares one
+ * update of this size against two of half this size.
+ */
+#ifndef ADAPTIVE_MAX_STEP
+#define ADAPTIVE_MAX_STEP 64ul
+#endif /* ADAPTIVE_MAX_STEP */
+
+#include "../objects.h"
+
+/*
+ * Advances a singlezone simulation forward by an adaptively chosen number of
+ * timesteps. The step size is controlled by step doubling: an update spanning
+ * 2k timesteps is compared with two consecutive updates spanning k timesteps
+ * each, and k is halved until the relative difference in the ISM mass and the
+ * abundance of each element is within the tolerance. The solution from the
+ * two smaller updates is kept, and k is doubled for the next step if the
+ * error was well within the tolerance.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to advance
+ *
+ * Notes
+ * =====
+ * The step size is always an integer multiple of dt, such that the cumulative
+ * return fraction and main sequence mass fraction are evaluated at the ages
+ * they were tabulated at on setup. The star formation history and the
+ * metallicity of each element at the timesteps within each update are
+ * linearly interpolated, and this function updates the stellar MDF and
+ * writes any outputs at these timesteps. The simulation never steps past the
+ * final output time.
+ *
+ * source: adaptive.c
+ */
+extern void adaptive_timestepper(SINGLEZONE *sz);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SINGLEZONE_ADAPTIVE_H */
@@ -23,8 +23,8 @@
  *
  * Returns
  * =======
- * The mass of the given element in solar masses produced by AGB stars in one
- * timestep from all previous generations of stars.
+ * The mass of the given element in solar masses produced by AGB stars over
+ * the next sz.step timesteps from all previous generations of stars.
  *
  * header: agb.h
  */
@@ -33,22 +33,30 @@ extern double m_AGB(SINGLEZONE sz, ELEMENT e) {
 	if (sz.timestep == 0l) {
 		return 0; /* No star's yet */
 	} else {
-		unsigned long i;
-		double mass = 0;
-		for (i = 0l; i <= sz.timestep; i++) {
+		unsigned long i, binned = 0ul;
+		double mass = 0, bound = 0;
+		if (sz.age_bins != NULL) {
+			/* Stellar populations older than the threshold age are binned */
+			mass = binned_m_AGB(sz, e, &bound);
+			binned = (*sz.age_bins).binned;
+		} else {}
+		for (i = 0l; i + binned <= sz.timestep; i++) {
 			/* The metallicity of the stars that formed i timesteps ago */
 			double Z = scale_metallicity(sz, sz.timestep - i);
 
 			/* From section 4.4 of VICE's science documentation */
 			mass += (
 				get_AGB_yield(e, Z,
-					dying_star_mass(i * sz.dt, (*sz.ssp).postMS, Z)) *
+					dying_star_mass(i * sz.dt, (*sz.ssp).postMS, Z, sz.ctx)) *
 				(*sz.ism).star_formation_history[sz.timestep - i] * sz.dt *
-				((*sz.ssp).msmf[i] - (*sz.ssp).msmf[i + 1l])
+				((*sz.ssp).msmf[i] - (*sz.ssp).msmf[i + sz.step])
 			);
 			
 		}
 
+		if (sz.age_bins != NULL) {
+			record_binning_error(sz.age_bins, bound, mass);
+		} else {}
 		return mass;
 		
 	}
@@ -19,8 +19,8 @@ extern "C" {
  *
  * Returns
  * =======
- * The mass of the given element in solar masses produced by AGB stars in one
- * timestep from all previous generations of stars.
+ * The mass of the given element in solar masses produced by AGB stars over
+ * the next sz.step timesteps from all previous generations of stars.
  *
  * source: agb.c
  */
@@ -0,0 +1,471 @@
+/*
+ * This file implements the binning of old stellar populations by age in
+ * VICE's singlezone simulations.
+ *
+ * Notes
+ * =====
+ * The SNe Ia delay-time distribution, the main sequence mass fraction, and
+ * the cumulative return fraction change slowly at large ages. Stellar
+ * populations older than a threshold age are therefore merged into bins of
+ * birth time whose widths grow in proportion to their age, and the
+ * enrichment from each bin is computed from the average of each kernel over
+ * the ages it spans. This reduces the cost of each timestep from the number
+ * of previous timesteps to roughly the threshold age in timesteps times the
+ * logarithm of the number of previous timesteps.
+ *
+ * Provided that each kernel is monotonic across a bin, the error in the
+ * enrichment from that bin is no larger than its star formation times the
+ * difference in the kernel between its youngest and oldest ages. This bound
+ * does not include the variation of the metallicity across a bin, which
+ * enters the yields and the lifetimes of AGB stars.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../singlezone.h"
+#include "../sneia.h"
+#include "../ssp.h"
+#include "../utils.h"
+#include "agebins.h"
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static unsigned short can_merge(AGE_BINS bins, unsigned long index,
+	unsigned long timestep);
+static void merge_bins(AGE_BINS *bins, unsigned long index,
+	unsigned int n_elements);
+static void move_bin(AGE_BINS *bins, unsigned long from, unsigned long to,
+	unsigned int n_elements);
+static unsigned int element_index(SINGLEZONE sz, char *symbol);
+static double RIa_at_age(ELEMENT e, unsigned long n_RIa, unsigned long age);
+
+
+/*
+ * Setup the binned star formation history in preparation for a singlezone
+ * simulation. This does nothing if the simulation is not running with age
+ * binning.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object that is about to be ran
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: agebins.h
+ */
+extern unsigned short setup_age_bins(SINGLEZONE *sz) {
+
+	age_bins_free(sz -> age_bins);
+	sz -> age_bins = NULL;
+	sz -> binning_error = 0;
+	if ((*sz).age_binning <= 0) return 0u;
+
+	AGE_BINS *bins = (AGE_BINS *) malloc (sizeof(AGE_BINS));
+	if (bins == NULL) return 1u;
+	unsigned long i, n = n_timesteps(*sz);
+	bins -> threshold = (unsigned long) round((*sz).age_binning / (*sz).dt);
+	if (!(*bins).threshold) bins -> threshold = 1ul;
+	if ((*sz).tolerance > 0 && (*bins).threshold < ADAPTIVE_MAX_STEP) {
+		bins -> threshold = ADAPTIVE_MAX_STEP;
+	} else {}
+	bins -> n_bins = 0ul;
+	bins -> binned = 0ul;
+	bins -> error = 0;
+	bins -> n_RIa = (unsigned long) (RIA_MAX_EVAL_TIME / (*sz).dt);
+	bins -> start = (unsigned long *) malloc (n * sizeof(unsigned long));
+	bins -> width = (unsigned long *) malloc (n * sizeof(unsigned long));
+	bins -> mass = (double *) malloc (n * sizeof(double));
+	bins -> metals = (double *) malloc (n * sizeof(double));
+	bins -> Z = (double *) malloc (n * (*sz).n_elements * sizeof(double));
+	bins -> RIa = (double *) malloc (((*bins).n_RIa + 1ul) *
+		(*sz).n_elements * sizeof(double));
+	sz -> age_bins = bins;
+	if ((*bins).start == NULL || (*bins).width == NULL ||
+		(*bins).mass == NULL || (*bins).metals == NULL ||
+		(*bins).Z == NULL || (*bins).RIa == NULL) return 1u;
+
+	unsigned int j;
+	for (j = 0u; j < (*sz).n_elements; j++) {
+		double *sum = (*bins).RIa + j * ((*bins).n_RIa + 1ul);
+		sum[0] = 0;
+		for (i = 0ul; i < (*bins).n_RIa; i++) {
+			sum[i + 1ul] = sum[i] + (
+				*(*(*sz).elements[j]).sneia_yields).RIa[i];
+		}
+	}
+
+	return 0u;
+
+}
+
+
+/*
+ * Free up the memory stored in an AGE_BINS struct.
+ *
+ * Parameters
+ * ==========
+ * bins: 	A pointer to the bins to free
+ *
+ * header: agebins.h
+ */
+extern void age_bins_free(AGE_BINS *bins) {
+
+	if (bins != NULL) {
+		free(bins -> start);
+		free(bins -> width);
+		free(bins -> mass);
+		free(bins -> metals);
+		free(bins -> Z);
+		free(bins -> RIa);
+		free(bins);
+	} else {}
+
+}
+
+
+/*
+ * Move the star formation at all timesteps older than the threshold age into
+ * the bins, then merge neighbouring bins of equal width until each bin spans
+ * no more than its youngest age divided by the threshold age.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * header: agebins.h
+ */
+extern void update_age_bins(SINGLEZONE *sz) {
+
+	AGE_BINS *bins = (*sz).age_bins;
+	if (bins == NULL) return;
+
+	unsigned int j;
+	double *sfh = (*(*sz).ism).star_formation_history;
+	while ((*bins).binned + (*bins).threshold <= (*sz).timestep) {
+		unsigned long i = (*bins).binned, b = (*bins).n_bins;
+		bins -> start[b] = i;
+		bins -> width[b] = 1ul;
+		bins -> mass[b] = sfh[i];
+		bins -> metals[b] = sfh[i] * scale_metallicity(*sz, i);
+		for (j = 0u; j < (*sz).n_elements; j++) {
+			bins -> Z[b * (*sz).n_elements + j] = (
+				sfh[i] * (*(*sz).state).Z[i * (*sz).n_elements + j]);
+		}
+		bins -> n_bins++;
+		bins -> binned++;
+	}
+
+	/*
+	 * Merging two bins of width w allows the bins of width 2w to merge, so
+	 * keep going until there are no more.
+	 */
+	unsigned short merged;
+	do {
+		unsigned long b, n = 0ul;
+		merged = 0u;
+		for (b = 0ul; b < (*bins).n_bins; b++) {
+			if (can_merge(*bins, b, (*sz).timestep)) {
+				merge_bins(bins, b, (*sz).n_elements);
+				move_bin(bins, b, n, (*sz).n_elements);
+				merged = 1u;
+				b++;
+			} else {
+				move_bin(bins, b, n, (*sz).n_elements);
+			}
+			n++;
+		}
+		bins -> n_bins = n;
+	} while (merged);
+
+}
+
+
+/*
+ * Determine whether or not a bin can be merged with the next bin.
+ *
+ * Parameters
+ * ==========
+ * bins: 		The bins for the current simulation
+ * index: 		The index of the older of the two bins
+ * timestep: 	The current timestep number
+ *
+ * Returns
+ * =======
+ * 1 if the two bins have the same width, the older of them begins at a
+ * timestep divisible by twice that width, and the youngest age within them
+ * is at least the threshold age times twice that width. 0 otherwise.
+ */
+static unsigned short can_merge(AGE_BINS bins, unsigned long index,
+	unsigned long timestep) {
+
+	if (index + 1ul >= bins.n_bins) return 0u;
+	unsigned long w = bins.width[index];
+	return (bins.width[index + 1ul] == w &&
+		!(bins.start[index] % (2ul * w)) &&
+		timestep - (bins.start[index + 1ul] + w - 1ul) >=
+			2ul * w * bins.threshold);
+
+}
+
+
+/*
+ * Add the contents of a bin to the bin preceding it.
+ *
+ * Parameters
+ * ==========
+ * bins: 		A pointer to the bins for the current simulation
+ * index: 		The index of the bin to add the next bin to
+ * n_elements: 	The number of elements tracked by the simulation
+ */
+static void merge_bins(AGE_BINS *bins, unsigned long index,
+	unsigned int n_elements) {
+
+	unsigned int j;
+	unsigned long next = index + 1ul;
+	bins -> width[index] += (*bins).width[next];
+	bins -> mass[index] += (*bins).mass[next];
+	bins -> metals[index] += (*bins).metals[next];
+	for (j = 0u; j < n_elements; j++) {
+		bins -> Z[index * n_elements + j] += (*bins).Z[next * n_elements + j];
+	}
+
+}
+
+
+/*
+ * Copy the contents of one bin to another.
+ *
+ * Parameters
+ * ==========
+ * bins: 		A pointer to the bins for the current simulation
+ * from: 		The index of the bin to copy
+ * to: 			The index to copy it to
+ * n_elements: 	The number of elements tracked by the simulation
+ */
+static void move_bin(AGE_BINS *bins, unsigned long from, unsigned long to,
+	unsigned int n_elements) {
+
+	if (from == to) return;
+	unsigned int j;
+	bins -> start[to] = (*bins).start[from];
+	bins -> width[to] = (*bins).width[from];
+	bins -> mass[to] = (*bins).mass[from];
+	bins -> metals[to] = (*bins).metals[from];
+	for (j = 0u; j < n_elements; j++) {
+		bins -> Z[to * n_elements + j] = (*bins).Z[from * n_elements + j];
+	}
+
+}
+
+
+/*
+ * Determine the rate of mass enrichment of a given element at the current
+ * timestep from SNe Ia from the stellar populations stored in the bins.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE object for the current simulation
+ * e: 		The element to find the rate of mass enrichment for
+ * bound: 	A pointer to the upper bound on the error in the returned value
+ *
+ * Returns
+ * =======
+ * The time-derivative of the SNe Ia mass enrichment from the binned stellar
+ * populations.
+ *
+ * header: agebins.h
+ */
+extern double binned_mdot_sneia(SINGLEZONE sz, ELEMENT e, double *bound) {
+
+	AGE_BINS bins = *sz.age_bins;
+	double *sum = bins.RIa + element_index(sz, e.symbol) * (bins.n_RIa + 1ul);
+	unsigned long b;
+	double mdotia = 0;
+	*bound = 0;
+	for (b = 0ul; b < bins.n_bins; b++) {
+		if (!bins.mass[b]) continue;
+		/* The youngest and oldest ages in the bin */
+		unsigned long young = (
+			sz.timestep - (bins.start[b] + bins.width[b] - 1ul));
+		unsigned long old = sz.timestep - bins.start[b];
+		double y = get_ia_yield(e, bins.metals[b] / bins.mass[b]);
+		double mean = (
+			sum[old + 1ul < bins.n_RIa ? old + 1ul : bins.n_RIa] -
+			sum[young < bins.n_RIa ? young : bins.n_RIa]
+		) / bins.width[b];
+		mdotia += y * bins.mass[b] * mean;
+		*bound += fabs(y) * bins.mass[b] * fabs(
+			RIa_at_age(e, bins.n_RIa, young) - RIa_at_age(e, bins.n_RIa, old));
+	}
+	return mdotia;
+
+}
+
+
+/*
+ * Determine the mass of a given element produced by AGB stars over the next
+ * sz.step timesteps from the stellar populations stored in the bins.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE object for the current simulation
+ * e: 		The element to find the mass yield for
+ * bound: 	A pointer to the upper bound on the error in the returned value
+ *
+ * Returns
+ * =======
+ * The mass of the element in Msun produced by AGB stars in the binned
+ * stellar populations.
+ *
+ * header: agebins.h
+ */
+extern double binned_m_AGB(SINGLEZONE sz, ELEMENT e, double *bound) {
+
+	AGE_BINS bins = *sz.age_bins;
+	double *msmf = (*sz.ssp).msmf;
+	unsigned long b, i;
+	double mass = 0;
+	*bound = 0;
+	for (b = 0ul; b < bins.n_bins; b++) {
+		if (!bins.mass[b]) continue;
+		unsigned long young = (
+			sz.timestep - (bins.start[b] + bins.width[b] - 1ul));
+		unsigned long old = sz.timestep - bins.start[b];
+		double Z = bins.metals[b] / bins.mass[b];
+		double y = get_AGB_yield(e, Z, dying_star_mass(
+			0.5 * (young + old) * sz.dt, (*sz.ssp).postMS, Z, sz.ctx));
+
+		/*
+		 * The sum of msmf[i] - msmf[i + sz.step] over the ages in the bin
+		 * telescopes to sz.step terms at each end.
+		 */
+		double dmsmf = 0;
+		for (i = 0ul; i < sz.step; i++) {
+			dmsmf += msmf[young + i] - msmf[old + 1ul + i];
+		}
+		mass += y * bins.mass[b] * sz.dt * dmsmf / bins.width[b];
+		*bound += fabs(y) * bins.mass[b] * sz.dt * fabs(
+			(msmf[young] - msmf[young + sz.step]) -
+			(msmf[old] - msmf[old + sz.step]));
+	}
+	return mass;
+
+}
+
+
+/*
+ * Determine the mass recycled over the next sz.step timesteps from the
+ * stellar populations stored in the bins for either a given element or the
+ * gas supply.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE object for the current simulation
+ * e: 		A pointer to the element to find the recycled mass. NULL to find
+ * 			it for the total ISM gas.
+ * bound: 	A pointer to the upper bound on the error in the returned value
+ *
+ * Returns
+ * =======
+ * The recycled mass in Msun from the binned stellar populations.
+ *
+ * header: agebins.h
+ */
+extern double binned_mass_recycled(SINGLEZONE sz, ELEMENT *e, double *bound) {
+
+	AGE_BINS bins = *sz.age_bins;
+	double *crf = (*sz.ssp).crf;
+	unsigned int j = e == NULL ? 0u : element_index(sz, (*e).symbol);
+	unsigned long b, i;
+	double mass = 0;
+	*bound = 0;
+	for (b = 0ul; b < bins.n_bins; b++) {
+		unsigned long young = (
+			sz.timestep - (bins.start[b] + bins.width[b] - 1ul));
+		unsigned long old = sz.timestep - bins.start[b];
+		double weight;
+		if (e == NULL) { 		/* This is the gas supply */
+			weight = bins.mass[b];
+		} else { 			/* element -> weight by Z */
+			weight = bins.Z[b * sz.n_elements + j];
+		}
+
+		/* The dCRF summed over the ages in the bin telescopes as in AGB */
+		double dcrf = 0;
+		for (i = 0ul; i < sz.step; i++) {
+			dcrf += crf[old + 1ul + i] - crf[young + i];
+		}
+		mass += weight * sz.dt * dcrf / bins.width[b];
+		*bound += fabs(weight) * sz.dt * fabs(
+			(crf[young + sz.step] - crf[young]) -
+			(crf[old + sz.step] - crf[old]));
+	}
+	return mass;
+
+}
+
+
+/*
+ * Record the relative error in an enrichment rate introduced by the binning.
+ *
+ * Parameters
+ * ==========
+ * bins: 	A pointer to the bins for the current simulation
+ * bound: 	The upper bound on the error from the binned stellar populations
+ * total: 	The enrichment rate from all stellar populations
+ *
+ * header: agebins.h
+ */
+extern void record_binning_error(AGE_BINS *bins, double bound, double total) {
+
+	if (bound > 0 && total) {
+		double x = bound / fabs(total);
+		if (x > (*bins).error) bins -> error = x;
+	} else {}
+
+}
+
+
+/*
+ * Determine the index of an element within a singlezone object.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * symbol: 	The symbol of the element
+ *
+ * Returns
+ * =======
+ * The index of the element with the given symbol. 0 if there is none.
+ */
+static unsigned int element_index(SINGLEZONE sz, char *symbol) {
+
+	unsigned int j;
+	for (j = 0u; j < sz.n_elements; j++) {
+		if (!strcmp((*sz.elements[j]).symbol, symbol)) return j;
+	}
+	return 0u;
+
+}
+
+
+/*
+ * Look up the SNe Ia rate of an element at a given age.
+ *
+ * Parameters
+ * ==========
+ * e: 		The element to look up the SNe Ia rate for
+ * n_RIa: 	The length of its SNe Ia rate
+ * age: 	The age in timesteps
+ *
+ * Returns
+ * =======
+ * The normalized SNe Ia rate, or zero beyond the length of the array.
+ */
+static double RIa_at_age(ELEMENT e, unsigned long n_RIa, unsigned long age) {
+
+	return age < n_RIa ? (*e.sneia_yields).RIa[age] : 0;
+
+}
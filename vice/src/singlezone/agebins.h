@@ -0,0 +1,140 @@
+#ifndef SINGLEZONE_AGEBINS_H
+#define SINGLEZONE_AGEBINS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "../objects.h"
+
+/*
+ * Setup the binned star formation history in preparation for a singlezone
+ * simulation. This does nothing if the simulation is not running with age
+ * binning.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object that is about to be ran
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * Notes
+ * =====
+ * With adaptive timestepping, the threshold age is at least
+ * ADAPTIVE_MAX_STEP timesteps, such that the star formation history and
+ * metallicities interpolated by a rejected step are never binned.
+ *
+ * source: agebins.c
+ */
+extern unsigned short setup_age_bins(SINGLEZONE *sz);
+
+/*
+ * Free up the memory stored in an AGE_BINS struct.
+ *
+ * Parameters
+ * ==========
+ * bins: 	A pointer to the bins to free
+ *
+ * source: agebins.c
+ */
+extern void age_bins_free(AGE_BINS *bins);
+
+/*
+ * Move the star formation at all timesteps older than the threshold age into
+ * the bins, then merge neighbouring bins of equal width until each bin spans
+ * no more than its youngest age divided by the threshold age.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * Notes
+ * =====
+ * A bin of width 2w is formed from the two bins of width w which begin at
+ * timesteps divisible by 2w and w. The bins at a given timestep therefore do
+ * not depend on the timesteps at which they were updated previously, and
+ * simulations resumed from checkpoints rebuild the same bins from the star
+ * formation history.
+ *
+ * source: agebins.c
+ */
+extern void update_age_bins(SINGLEZONE *sz);
+
+/*
+ * Determine the rate of mass enrichment of a given element at the current
+ * timestep from SNe Ia from the stellar populations stored in the bins.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE object for the current simulation
+ * e: 		The element to find the rate of mass enrichment for
+ * bound: 	A pointer to the upper bound on the error in the returned value
+ *
+ * Returns
+ * =======
+ * The time-derivative of the SNe Ia mass enrichment from the binned stellar
+ * populations.
+ *
+ * source: agebins.c
+ */
+extern double binned_mdot_sneia(SINGLEZONE sz, ELEMENT e, double *bound);
+
+/*
+ * Determine the mass of a given element produced by AGB stars over the next
+ * sz.step timesteps from the stellar populations stored in the bins.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE object for the current simulation
+ * e: 		The element to find the mass yield for
+ * bound: 	A pointer to the upper bound on the error in the returned value
+ *
+ * Returns
+ * =======
+ * The mass of the element in Msun produced by AGB stars in the binned
+ * stellar populations.
+ *
+ * source: agebins.c
+ */
+extern double binned_m_AGB(SINGLEZONE sz, ELEMENT e, double *bound);
+
+/*
+ * Determine the mass recycled over the next sz.step timesteps from the
+ * stellar populations stored in the bins for either a given element or the
+ * gas supply.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The SINGLEZONE object for the current simulation
+ * e: 		A pointer to the element to find the recycled mass. NULL to find
+ * 			it for the total ISM gas.
+ * bound: 	A pointer to the upper bound on the error in the returned value
+ *
+ * Returns
+ * =======
+ * The recycled mass in Msun from the binned stellar populations.
+ *
+ * source: agebins.c
+ */
+extern double binned_mass_recycled(SINGLEZONE sz, ELEMENT *e, double *bound);
+
+/*
+ * Record the relative error in an enrichment rate introduced by the binning.
+ *
+ * Parameters
+ * ==========
+ * bins: 	A pointer to the bins for the current simulation
+ * bound: 	The upper bound on the error from the binned stellar populations
+ * total: 	The enrichment rate from all stellar populations
+ *
+ * source: agebins.c
+ */
+extern void record_binning_error(AGE_BINS *bins, double bound, double total);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SINGLEZONE_AGEBINS_H */
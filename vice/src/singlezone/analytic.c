@@ -0,0 +1,221 @@
+/*
+ * This file implements the analytic solutions to the evolution of the ISM
+ * and the mass of each element in VICE's singlezone simulations.
+ *
+ * Notes
+ * =====
+ * With a constant mass loading factor eta, star formation efficiency
+ * timescale tau_star, and recycling fraction r, the gas supply obeys
+ *
+ * dMg/dt = IFR(t) - Mg / tau_dep
+ *
+ * with 1 / tau_dep = (1 + eta - r) / tau_star. For an infall rate
+ * A exp(-a t), with a = 0 for a constant infall rate, the solution is a sum
+ * of convolutions of exponentials. So is that of the enrichment equation
+ * with constant yields and an exponential SN Ia delay-time distribution,
+ * since the SN Ia rate is itself a convolution of the star formation rate
+ * with an exponential. Writing E_x(t) = exp(-x t), these are
+ *
+ * Mg(t) = Mg(0) E_b + A (E_a * E_b)
+ *
+ * Mx(t) = Mx(0) E_k + A Zx,in (E_a * E_k) + y_cc / tau_star (
+ * 		Mg(0) (E_b * E_k) + A (E_a * E_b * E_k)) + y_ia R / tau_star (
+ * 		Mg(0) (E_b * E_c * E_k) + A (E_a * E_b * E_c * E_k))
+ *
+ * where * denotes a convolution, b = 1 / tau_dep, c = 1 / tau_ia,
+ * k = (1 + eta xi_enh - r) / tau_star for the outflow enhancement xi_enh,
+ * and the SN Ia terms are evaluated at t - t_d with normalization R. See
+ * sections 3 and 4 of VICE's science documentation.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "../singlezone.h"
+#include "../sneia.h"
+#include "analytic.h"
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static double exponential_convolution(double *rates, unsigned short n,
+	double time);
+static double exp_divided_difference(double *x, unsigned short n);
+
+
+/*
+ * Evaluate the ISM mass, star formation and infall rates, and the mass of
+ * each element at the next timestep from their closed-form solutions.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * header: analytic.h
+ */
+extern void analytic_update(SINGLEZONE *sz) {
+
+	unsigned long next = (*sz).timestep + (*sz).step;
+	double time = next * (*sz).dt;
+	double h = (*sz).step * (*sz).dt;
+	ISM *ism = (*sz).ism;
+
+	/*
+	 * The parameters are constant in time, and the initial ISM mass is the
+	 * initial star formation rate times the star formation efficiency
+	 * timescale.
+	 */
+	double tau_star = (*ism).tau_star[0];
+	double eta = (*ism).eta[0];
+	double R0 = (*(*sz).ssp).R0;
+	double initial = (*ism).star_formation_history[0] * tau_star;
+	double infall = (*ism).specified[0];
+	double rates[ANALYTIC_MAX_RATES];
+	rates[0] = infall > 0 ? log(infall / (*ism).specified[1]) / (*sz).dt : 0;
+	rates[1] = (1 + eta - R0) / tau_star;
+
+	ism -> mass = (initial * exponential_convolution(rates + 1, 1u, time) +
+		infall * exponential_convolution(rates, 2u, time));
+	ism -> infall_rate = (*ism).specified[next];
+	update_gas_evolution_sanitycheck(sz);
+	ism -> star_formation_rate = (*ism).mass / tau_star;
+	ism -> star_formation_history[next] = (*ism).star_formation_rate;
+
+	unsigned int i;
+	for (i = 0u; i < (*sz).n_elements; i++) {
+		ELEMENT *e = (*sz).elements[i];
+		SNEIA_YIELD_SPECS *specs = (*e).sneia_yields;
+		double y_cc = get_cc_yield(*e, 0);
+		double y_ia = get_ia_yield(*e, 0);
+		double ent_cc = (*(*e).ccsne_yields).entrainment;
+		double ent_ia = (*specs).entrainment;
+
+		/* don't eject helium at an enhanced metallicity */
+		double enh = (*(*sz).state).helium[i] ? 1 : (*ism).enh[0];
+		double inflow[2] = {rates[0], (1 + eta * enh - R0) / tau_star};
+		double ccsne[3] = {rates[0], rates[1], inflow[1]};
+
+		double mass = (*e).primordial * initial * exponential_convolution(
+			inflow + 1, 1u, time);
+		mass += infall * ((*e).Zin[0] + (*e).primordial) * (
+			exponential_convolution(inflow, 2u, time));
+		mass += ent_cc * y_cc / tau_star * (
+			initial * exponential_convolution(ccsne + 1, 2u, time) +
+			infall * exponential_convolution(ccsne, 3u, time));
+
+		/* the SN Ia rate, normalized over the delay-time distribution */
+		double rate_ia = 0;
+		if (time > (*specs).t_d) {
+			double delayed = time - (*specs).t_d;
+			double c = 1 / (*specs).tau_ia;
+			double norm = c / (1 - exp(-c * (RIA_MAX_EVAL_TIME -
+				(*specs).t_d)));
+			double sneia[4] = {rates[0], rates[1], c, inflow[1]};
+			mass += ent_ia * y_ia * norm / tau_star * (
+				initial * exponential_convolution(sneia + 1, 3u, delayed) +
+				infall * exponential_convolution(sneia, 4u, delayed));
+			rate_ia = norm / tau_star * (
+				initial * exponential_convolution(sneia + 1, 2u, delayed) +
+				infall * exponential_convolution(sneia, 3u, delayed));
+		} else {}
+
+		e -> mass = mass;
+		e -> unretained = ((1 - ent_cc) * y_cc * (*ism).star_formation_rate +
+			(1 - ent_ia) * y_ia * rate_ia) * h;
+		update_element_mass_sanitycheck(e);
+	}
+
+}
+
+
+/*
+ * Determine the convolution of several exponentials exp(-rate * t) with one
+ * another.
+ *
+ * Parameters
+ * ==========
+ * rates: 	The decay rate of each exponential in Gyr^-1. Negative values
+ * 			are growing exponentials.
+ * n: 		The number of exponentials, at most ANALYTIC_MAX_RATES
+ * time: 	The time at which to evaluate the convolution in Gyr
+ *
+ * Returns
+ * =======
+ * The value of the convolution. For n = 1, this is simply exp(-rate * t).
+ *
+ * Notes
+ * =====
+ * The convolution of n exponentials evaluated at time t is (-t)^(n - 1)
+ * times the divided difference of exp(-x) at the points x = rate * t. This
+ * remains finite when any of the rates are equal, in which case it picks up
+ * powers of t.
+ */
+static double exponential_convolution(double *rates, unsigned short n,
+	double time) {
+
+	double x[ANALYTIC_MAX_RATES];
+	unsigned short i, j;
+	for (i = 0u; i < n; i++) {
+		/* insertion sort, such that the points are in ascending order */
+		double value = rates[i] * time;
+		for (j = i; j > 0u && x[j - 1u] > value; j--) x[j] = x[j - 1u];
+		x[j] = value;
+	}
+	return pow(-time, n - 1u) * exp_divided_difference(x, n);
+
+}
+
+
+/*
+ * Determine the divided difference of exp(-x) at a set of points.
+ *
+ * Parameters
+ * ==========
+ * x: 		The points, sorted in ascending order
+ * n: 		The number of points
+ *
+ * Returns
+ * =======
+ * The divided difference exp(-x)[x_1, ..., x_n]
+ *
+ * Notes
+ * =====
+ * Points which are spread over more than one e-folding use the usual
+ * recursion. Otherwise this sums the power series about their mean m, in
+ * which the divided difference of (x - m)^j is the complete homogeneous
+ * symmetric polynomial of degree j - n + 1 in the points relative to m. This
+ * avoids the loss of precision in the recursion when points are close
+ * together or equal.
+ */
+static double exp_divided_difference(double *x, unsigned short n) {
+
+	if (n == 1u) {
+		return exp(-x[0]);
+	} else if (x[n - 1u] - x[0] > 1) {
+		return (exp_divided_difference(x + 1, n - 1u) -
+			exp_divided_difference(x, n - 1u)) / (x[n - 1u] - x[0]);
+	} else {
+		unsigned short i, p;
+		double mean = 0;
+		for (i = 0u; i < n; i++) mean += x[i];
+		mean /= n;
+
+		/* complete homogeneous symmetric polynomials, added one at a time */
+		double homogeneous[ANALYTIC_SERIES_TERMS];
+		homogeneous[0] = 1;
+		for (p = 1u; p < ANALYTIC_SERIES_TERMS; p++) homogeneous[p] = 0;
+		for (i = 0u; i < n; i++) {
+			for (p = 1u; p < ANALYTIC_SERIES_TERMS; p++) {
+				homogeneous[p] += (x[i] - mean) * homogeneous[p - 1u];
+			}
+		}
+
+		/* coefficient of (x - m)^j in exp(-(x - m)), starting at j = n - 1 */
+		double coeff = 1, sum = 0;
+		for (i = 1u; i < n; i++) coeff *= -1.0 / i;
+		for (p = 0u; p < ANALYTIC_SERIES_TERMS; p++) {
+			sum += coeff * homogeneous[p];
+			coeff *= -1.0 / (p + n);
+		}
+		return exp(-mean) * sum;
+	}
+
+}
+
@@ -0,0 +1,53 @@
+#ifndef SINGLEZONE_ANALYTIC_H
+#define SINGLEZONE_ANALYTIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * The number of terms in the power series for the convolution of several
+ * exponentials when their decay rates are close to one another.
+ */
+#ifndef ANALYTIC_SERIES_TERMS
+#define ANALYTIC_SERIES_TERMS 25u
+#endif /* ANALYTIC_SERIES_TERMS */
+
+/*
+ * The largest number of exponentials convolved with one another in the
+ * analytic solutions.
+ */
+#ifndef ANALYTIC_MAX_RATES
+#define ANALYTIC_MAX_RATES 4u
+#endif /* ANALYTIC_MAX_RATES */
+
+#include "../objects.h"
+
+/*
+ * Evaluate the ISM mass, star formation and infall rates, and the mass of
+ * each element at the next timestep from their closed-form solutions.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * Notes
+ * =====
+ * This requires that the simulation be ran in infall mode with an infall
+ * rate which is either constant or exponential in time, a constant mass
+ * loading factor, star formation efficiency timescale, and outflow
+ * enhancement with no outflow smoothing, instantaneous recycling, an
+ * exponential SN Ia delay-time distribution, constant inflow metallicities,
+ * metallicity-independent CCSN and SN Ia yields, and no AGB star yields.
+ * These conditions are determined in python before the simulation is ran.
+ *
+ * source: analytic.c
+ */
+extern void analytic_update(SINGLEZONE *sz);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SINGLEZONE_ANALYTIC_H */
+
@@ -13,84 +13,222 @@
 
 
 /*
- * Allocates memory for bookkeeping each elements previous ISM metallicity
- * and sets each element to zero.
+ * Allocate memory for and return a pointer to the state of a set of
+ * elements, with the metallicity of each element set to zero at all
+ * timesteps.
  *
  * Parameters
  * ==========
- * e: 				A pointer to the element to setup the Z array for
- * n_timesteps: 	The number of elements in this array (i.e. the total
- * 					number of timesteps in the simulation)
+ * elements: 		The elements themselves
+ * n_elements: 		The number of elements
+ * n_timesteps: 	The number of timesteps to store the metallicity of each
+ * 					element for (i.e. the total number of timesteps in the
+ * 					simulation)
  *
  * Returns
  * =======
- * 0 on success, 1 on failure
+ * The state, with the helium mask, the entrainment fractions, and the sum of
+ * the solar abundances taken from the elements. NULL on failure.
  *
  * header: element.h
  */
-extern unsigned short malloc_Z(ELEMENT *e, unsigned long n_timesteps) {
+extern ELEMENT_STATE *element_state_initialize(ELEMENT **elements,
+	unsigned int n_elements, unsigned long n_timesteps) {
 
-	e -> Z = (double *) malloc (n_timesteps * sizeof(double));
-	if ((*e).Z == NULL) {
-		return 1;
-	} else {
-		unsigned long i;
-		for (i = 0l; i < n_timesteps; i++) {
-			e -> Z[i] = 0;
-		}
-		return 0;
+	ELEMENT_STATE *state = (ELEMENT_STATE *) malloc (sizeof(ELEMENT_STATE));
+	if (state == NULL) return NULL;
+	state -> n_elements = n_elements;
+	state -> Z = (double *) malloc (n_timesteps * n_elements * sizeof(double));
+	state -> mass = (double *) malloc (n_elements * sizeof(double));
+	state -> sources = (double *) malloc (n_elements * sizeof(double));
+	state -> recycled = (double *) malloc (n_elements * sizeof(double));
+	state -> infall = (double *) malloc (n_elements * sizeof(double));
+	state -> helium = (unsigned short *) malloc (n_elements *
+		sizeof(unsigned short));
+	state -> entrainment = (double *) malloc (ENTRAINMENT_CHANNELS *
+		n_elements * sizeof(double));
+	if ((*state).Z == NULL || (*state).mass == NULL ||
+		(*state).sources == NULL || (*state).recycled == NULL ||
+		(*state).infall == NULL || (*state).helium == NULL ||
+		(*state).entrainment == NULL) {
+		element_state_free(state);
+		return NULL;
+	} else {}
+
+	unsigned long i;
+	for (i = 0ul; i < n_timesteps * n_elements; i++) state -> Z[i] = 0;
+	state -> solar = 0;
+	for (i = 0ul; i < n_elements; i++) {
+		ELEMENT *e = elements[i];
+		state -> helium[i] = !strcmp((*e).symbol, "he");
+		state -> entrainment[ENTRAINMENT_CCSNE * n_elements + i] = (
+			*(*e).ccsne_yields).entrainment;
+		state -> entrainment[ENTRAINMENT_SNEIA * n_elements + i] = (
+			*(*e).sneia_yields).entrainment;
+		state -> entrainment[ENTRAINMENT_AGB * n_elements + i] = (
+			*(*e).agb_grid).entrainment;
+		/* Don't count helium as a metal */
+		if (!(*state).helium[i]) state -> solar += (*e).solar;
 	}
+	return state;
+
+}
+
+
+/*
+ * Free up the memory stored in an ELEMENT_STATE struct.
+ *
+ * Parameters
+ * ==========
+ * state: 	A pointer to the state to free
+ *
+ * header: element.h
+ */
+extern void element_state_free(ELEMENT_STATE *state) {
+
+	if (state != NULL) {
+		free(state -> Z);
+		free(state -> mass);
+		free(state -> sources);
+		free(state -> recycled);
+		free(state -> infall);
+		free(state -> helium);
+		free(state -> entrainment);
+		free(state);
+		state = NULL;
+	} else {}
 
 }
 
 
 /*
- * Updates the mass of a single element at the current timestep.
+ * Updates the mass of each element in a singlezone object at the current
+ * timestep, moving them forward sz.step timesteps.
  *
  * Parameters
  * ==========
- * sz: 		The singlezone object currently being simulated
- * e: 		A pointer to the element to update
+ * sz: 		A pointer to the singlezone object currently being simulated
  *
  * header: element.h
  */
-extern void update_element_mass(SINGLEZONE sz, ELEMENT *e) {
+extern void update_element_masses(SINGLEZONE *sz) {
+
+	unsigned int i;
+	advance_element_masses(*sz, (*sz).elements, (*sz).state);
+	for (i = 0u; i < (*sz).n_elements; i++) {
+		update_element_mass_sanitycheck(sz -> elements[i]);
+	}
+
+}
+
+
+/*
+ * Moves the mass of each of a set of elements forward sz.step timesteps
+ * without the sanity check on the result.
+ *
+ * Parameters
+ * ==========
+ * sz: 			The singlezone object currently being simulated
+ * elements: 	The elements to update
+ * state: 		The state of the elements
+ *
+ * header: element.h
+ */
+extern void advance_element_masses(SINGLEZONE sz, ELEMENT **elements,
+	ELEMENT_STATE *state) {
 
 	/*
-	 * Pull the amount of mass produced by each enrichment channel, then add
-	 * the retained part to the ISM mass and the unretained part to the
-	 * instantaneous mass outflow.
+	 * Change Notes
+	 * ============
+	 * This used to move one element forward at a time. The enrichment from
+	 * each channel is still found for each element, as it depends on their
+	 * yields, but the remaining terms are the same for every element up to
+	 * its mass and whether or not it is helium. They are now computed once,
+	 * and all of the elements are moved forward in a single loop over the
+	 * contiguous arrays in their state.
 	 */
 
-	double m_cc = mdot_ccsne(sz, *e) * sz.dt;
-	double m_ia = mdot_sneia(sz, *e) * sz.dt;
-	double m_agb = m_AGB(sz, *e);
+	unsigned int j, n = (*state).n_elements;
+	double h = sz.step * sz.dt;
+	double *mass = (*state).mass;
+	double *sources = (*state).sources;
+	double *recycled = (*state).recycled;
+	double *infall = (*state).infall;
+	unsigned short *helium = (*state).helium;
+	double *ent_cc = (*state).entrainment + ENTRAINMENT_CCSNE * n;
+	double *ent_ia = (*state).entrainment + ENTRAINMENT_SNEIA * n;
+	double *ent_agb = (*state).entrainment + ENTRAINMENT_AGB * n;
 
-	e -> mass += (*(*e).ccsne_yields).entrainment * m_cc;
-	e -> mass += (*(*e).sneia_yields).entrainment * m_ia;
-	e -> mass += (*(*e).agb_grid).entrainment * m_agb;
+	/*
+	 * Pull the amount of mass produced by each enrichment channel, then add
+	 * the retained part to the sources and the unretained part to the
+	 * instantaneous mass outflow.
+	 */
+	for (j = 0u; j < n; j++) {
+		ELEMENT *e = elements[j];
+		double m_cc = mdot_ccsne(sz, *e) * h;
+		double m_ia = mdot_sneia(sz, *e) * h;
+		double m_agb = m_AGB(sz, *e);
+		e -> unretained = 0;
+		e -> unretained += (1 - ent_cc[j]) * m_cc;
+		e -> unretained += (1 - ent_ia[j]) * m_ia;
+		e -> unretained += (1 - ent_agb[j]) * m_agb;
+		sources[j] = ent_cc[j] * m_cc + ent_ia[j] * m_ia + ent_agb[j] * m_agb;
+		infall[j] = (*sz.ism).infall_rate * h * (*e).Zin[sz.timestep];
+		mass[j] = (*e).mass;
+	}
 
-	e -> unretained = 0;
-	e -> unretained += (1 - (*(*e).ccsne_yields).entrainment) * m_cc;
-	e -> unretained += (1 - (*(*e).sneia_yields).entrainment) * m_ia;
-	e -> unretained += (1 - (*(*e).agb_grid).entrainment) * m_agb;
+	/*
+	 * With instantaneous recycling, the recycled mass is proportional to the
+	 * mass of the element at the time of the update.
+	 */
+	unsigned short continuous = (*sz.ssp).continuous;
+	if (continuous) metals_recycled(sz, state);
+	double ism = (*sz.ism).mass;
+	double returned = (*sz.ism).star_formation_rate * h * (*sz.ssp).R0;
+	double outflow = get_outflow_rate(sz);
 
-	
 	/*
-	 * Take care of subsequent terms in the enrichment equation.
+	 * Take care of subsequent terms in the enrichment equation. Helium is
+	 * not ejected at an enhanced metallicity, so each depletion term takes
+	 * one of two values, indexed by the helium mask.
 	 */
-	e -> mass += mass_recycled(sz, e);
-	e -> mass -= ((*sz.ism).star_formation_rate * sz.dt *
-		(*e).mass / (*sz.ism).mass);
-	/* don't eject helium at an enhanced metallicity */
-	if (strcmp((*e).symbol, "he")) {
-		e -> mass -= ((*sz.ism).enh[sz.timestep] * get_outflow_rate(sz) *
-			sz.dt / (*sz.ism).mass * (*e).mass);
+	if (sz.integrator == EXPONENTIAL && ism > 0) {
+		/*
+		 * Depletion by star formation and outflows at a fixed rate, applied
+		 * to the mass at the beginning of the timestep and to the sources
+		 * produced over it.
+		 */
+		double decay[2], weight[2];
+		unsigned short k;
+		for (k = 0u; k < 2u; k++) {
+			double rate = (*sz.ism).star_formation_rate + outflow * (
+				k ? 1 : (*sz.ism).enh[sz.timestep]);
+			decay[k] = exponential_update(1, 0, rate / ism, h);
+			weight[k] = exponential_update(0, 1, rate / ism, h);
+		}
+		for (j = 0u; j < n; j++) {
+			double m = mass[j];
+			double r = continuous ? recycled[j] : returned * m / ism;
+			mass[j] = m * decay[helium[j]] + (
+				sources[j] + r + infall[j]) * weight[helium[j]];
+		}
 	} else {
-		e -> mass -= get_outflow_rate(sz) * sz.dt / (*sz.ism).mass * (*e).mass;
+		double depletion[2] = {
+			(*sz.ism).enh[sz.timestep] * outflow * h / ism,
+			outflow * h / ism
+		};
+		double sfr = (*sz.ism).star_formation_rate * h;
+		for (j = 0u; j < n; j++) {
+			double m = mass[j] + sources[j];
+			m += continuous ? recycled[j] : returned * m / ism;
+			m -= sfr * m / ism;
+			m -= depletion[helium[j]] * m;
+			mass[j] = m + infall[j];
+		}
 	}
-	e -> mass += (*sz.ism).infall_rate * sz.dt * (*e).Zin[sz.timestep];
-	update_element_mass_sanitycheck(e);
+
+	for (j = 0u; j < n; j++) elements[j] -> mass = mass[j];
 
 }
 
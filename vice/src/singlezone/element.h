@@ -9,34 +9,71 @@ extern "C" {
 #include "../objects.h"
 
 /*
- * Allocates memory for bookkeeping each elements previous ISM metallicity
- * and sets each element to zero.
+ * Allocate memory for and return a pointer to the state of a set of
+ * elements, with the metallicity of each element set to zero at all
+ * timesteps.
  *
  * Parameters
  * ==========
- * e: 				A pointer to the element to setup the Z array for
- * n_timesteps: 	The number of elements in this array (i.e. the total
- * 					number of timesteps in the simulation)
+ * elements: 		The elements themselves
+ * n_elements: 		The number of elements
+ * n_timesteps: 	The number of timesteps to store the metallicity of each
+ * 					element for (i.e. the total number of timesteps in the
+ * 					simulation)
  *
  * Returns
  * =======
- * 0 on success, 1 on failure
+ * The state, with the helium mask, the entrainment fractions, and the sum of
+ * the solar abundances taken from the elements. NULL on failure.
  *
  * source: element.c
  */
-extern unsigned short malloc_Z(ELEMENT *e, unsigned long n_timesteps);
+extern ELEMENT_STATE *element_state_initialize(ELEMENT **elements,
+	unsigned int n_elements, unsigned long n_timesteps);
 
 /*
- * Updates the mass of a single element at the current timestep.
+ * Free up the memory stored in an ELEMENT_STATE struct.
  *
  * Parameters
  * ==========
- * sz: 		The singlezone object currently being simulated
- * e: 		A pointer to the element to update
+ * state: 	A pointer to the state to free
  *
  * source: element.c
  */
-extern void update_element_mass(SINGLEZONE sz, ELEMENT *e);
+extern void element_state_free(ELEMENT_STATE *state);
+
+/*
+ * Updates the mass of each element in a singlezone object at the current
+ * timestep, moving them forward sz.step timesteps.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object currently being simulated
+ *
+ * source: element.c
+ */
+extern void update_element_masses(SINGLEZONE *sz);
+
+/*
+ * Moves the mass of each of a set of elements forward sz.step timesteps
+ * without the sanity check on the result.
+ *
+ * Parameters
+ * ==========
+ * sz: 			The singlezone object currently being simulated
+ * elements: 	The elements to update
+ * state: 		The state of the elements
+ *
+ * Notes
+ * =====
+ * The copies of each element recording its linear response to its yields
+ * may take on negative masses (e.g. from net destruction in AGB stars), which
+ * the sanity check would otherwise set to zero.
+ *
+ * source: element.c
+ */
+extern void advance_element_masses(SINGLEZONE sz, ELEMENT **elements,
+	ELEMENT_STATE *state);
 
 /*
  * Performs a sanity check on a given element immediately after it's mass
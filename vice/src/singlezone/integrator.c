@@ -0,0 +1,87 @@
+/*
+ * This file implements the integrators for the ISM mass and the mass of each
+ * element in VICE's singlezone and multizone simulations.
+ */
+
+#include <math.h>
+#include "integrator.h"
+
+
+/*
+ * Move a reservoir of mass forward in time with the exponential integrator.
+ * This is the exact solution to dM/dt = S / h - rate * M over a time
+ * interval h, holding the sources S and the depletion rate fixed.
+ *
+ * Parameters
+ * ==========
+ * mass: 		The mass in the reservoir at the beginning of the interval
+ * sources: 	The mass added to the reservoir over the interval
+ * rate: 		The rate at which the reservoir is depleted, in Gyr^-1
+ * h: 			The size of the interval in Gyr
+ *
+ * Returns
+ * =======
+ * The mass in the reservoir at the end of the interval.
+ *
+ * header: integrator.h
+ */
+extern double exponential_update(double mass, double sources, double rate,
+	double h) {
+
+	double x = rate * h;
+	if (x > 0) {
+		/*
+		 * The sources are weighted by (1 - e^-x) / x, computed with expm1
+		 * to retain precision when x is small.
+		 */
+		return mass * exp(-x) + sources * (-expm1(-x) / x);
+	} else {
+		return mass + sources;
+	}
+
+}
+
+
+/*
+ * Determine the derivative of the exponential integrator's update with
+ * respect to some parameter, given the derivatives of its inputs.
+ *
+ * Parameters
+ * ==========
+ * mass: 		The mass in the reservoir at the beginning of the interval
+ * sources: 	The mass added to the reservoir over the interval
+ * rate: 		The rate at which the reservoir is depleted, in Gyr^-1
+ * h: 			The size of the interval in Gyr
+ * dmass: 		The derivative of mass with respect to the parameter
+ * dsources: 	The derivative of sources with respect to the parameter
+ * drate: 		The derivative of rate with respect to the parameter
+ *
+ * Returns
+ * =======
+ * The derivative of exponential_update(mass, sources, rate, h)
+ *
+ * header: integrator.h
+ */
+extern double exponential_update_derivative(double mass, double sources,
+	double rate, double h, double dmass, double dsources, double drate) {
+
+	double x = rate * h;
+	if (x > 0) {
+		/* phi(x) = (1 - e^-x) / x and its derivative (e^-x - phi) / x */
+		double decay = exp(-x);
+		double phi = -expm1(-x) / x;
+		double dphi;
+		if (x > 1e-4) {
+			dphi = (decay - phi) / x;
+		} else {
+			/* Taylor series, avoiding cancellation */
+			dphi = -0.5 + x / 3;
+		}
+		return (decay * dmass + phi * dsources +
+			(sources * dphi - mass * decay) * h * drate);
+	} else {
+		return dmass + dsources;
+	}
+
+}
+
@@ -0,0 +1,64 @@
+#ifndef SINGLEZONE_INTEGRATOR_H
+#define SINGLEZONE_INTEGRATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Move a reservoir of mass forward in time with the exponential integrator.
+ * This is the exact solution to dM/dt = S / h - rate * M over a time
+ * interval h, holding the sources S and the depletion rate fixed.
+ *
+ * Parameters
+ * ==========
+ * mass: 		The mass in the reservoir at the beginning of the interval
+ * sources: 	The mass added to the reservoir over the interval
+ * rate: 		The rate at which the reservoir is depleted, in Gyr^-1
+ * h: 			The size of the interval in Gyr
+ *
+ * Returns
+ * =======
+ * The mass in the reservoir at the end of the interval. For rate * h << 1,
+ * this reduces to the forward Euler update mass + sources - rate * h * mass.
+ *
+ * Notes
+ * =====
+ * Unlike forward Euler, this remains accurate and positive when the interval
+ * is long compared to the depletion time 1 / rate, such as when the star
+ * formation efficiency timescale is short or the mass loading factor is
+ * large.
+ *
+ * source: integrator.c
+ */
+extern double exponential_update(double mass, double sources, double rate,
+	double h);
+
+/*
+ * Determine the derivative of the exponential integrator's update with
+ * respect to some parameter, given the derivatives of its inputs.
+ *
+ * Parameters
+ * ==========
+ * mass: 		The mass in the reservoir at the beginning of the interval
+ * sources: 	The mass added to the reservoir over the interval
+ * rate: 		The rate at which the reservoir is depleted, in Gyr^-1
+ * h: 			The size of the interval in Gyr
+ * dmass: 		The derivative of mass with respect to the parameter
+ * dsources: 	The derivative of sources with respect to the parameter
+ * drate: 		The derivative of rate with respect to the parameter
+ *
+ * Returns
+ * =======
+ * The derivative of exponential_update(mass, sources, rate, h)
+ *
+ * source: integrator.c
+ */
+extern double exponential_update_derivative(double mass, double sources,
+	double rate, double h, double dmass, double dsources, double drate);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SINGLEZONE_INTEGRATOR_H */
@@ -89,7 +89,7 @@ extern unsigned short setup_gas_evolution(SINGLEZONE *sz) {
 
 /*
  * Moves the infall rate, total gas mass, and star formation rate in a
- * singlezone simulation forward one timestep
+ * singlezone simulation forward (*sz).step timesteps
  *
  * Parameters
  * ==========
@@ -115,39 +115,51 @@ extern unsigned short update_gas_evolution(SINGLEZONE *sz) {
 	 * Primordial inflow is taken into account prior to updating the infall and
 	 * gas supply so that there isn't a 1-timestep delay or advance in the
 	 * amount of helium added
+	 *
+	 * With adaptive timestepping, the update spans (*sz).step timesteps, and
+	 * the step size is h = (*sz).step * dt in place of dt.
 	 */
 
+	double h = (*sz).step * (*sz).dt;
+	unsigned long next = (*sz).timestep + (*sz).step;
 	primordial_inflow(sz);
 	switch (checksum((*(*sz).ism).mode)) {
 
 		case GAS:
-			sz -> ism -> mass = (*(*sz).ism).specified[(*sz).timestep + 1l];
+			sz -> ism -> mass = (*(*sz).ism).specified[next];
 			sz -> ism -> star_formation_rate = ((*(*sz).ism).mass /
 				get_SFE_timescale(*sz, 0u));
 			sz -> ism -> infall_rate = (
 				((*(*sz).ism).mass - (*(*sz).ism).specified[(*sz).timestep] -
-					mass_recycled(*sz, NULL)) / (*sz).dt +
+					mass_recycled(*sz, NULL)) / h +
 				(*(*sz).ism).star_formation_rate + get_outflow_rate(*sz)
 			);
 			break;
 
 		case IFR:
-			sz -> ism -> mass += (
-				((*(*sz).ism).infall_rate - (*(*sz).ism).star_formation_rate -
-					get_outflow_rate(*sz)) * (*sz).dt + mass_recycled(*sz, NULL)
-			);
-			sz -> ism -> infall_rate = (*(*sz).ism).specified[(
-				*sz).timestep + 1l];
+			if ((*sz).integrator == EXPONENTIAL && (*(*sz).ism).mass > 0) {
+				/* depletion by star formation and outflows at a fixed rate */
+				sz -> ism -> mass = exponential_update((*(*sz).ism).mass,
+					(*(*sz).ism).infall_rate * h + mass_recycled(*sz, NULL),
+					((*(*sz).ism).star_formation_rate + get_outflow_rate(*sz)) /
+						(*(*sz).ism).mass, h);
+			} else {
+				sz -> ism -> mass += (
+					((*(*sz).ism).infall_rate -
+						(*(*sz).ism).star_formation_rate -
+						get_outflow_rate(*sz)) * h + mass_recycled(*sz, NULL)
+				);
+			}
+			sz -> ism -> infall_rate = (*(*sz).ism).specified[next];
 			sz -> ism -> star_formation_rate = ((*(*sz).ism).mass /
 				get_SFE_timescale(*sz, 0u));
 			break;
 
 		case SFR:
-			sz -> ism -> star_formation_rate = (
-				*(*sz).ism).specified[(*sz).timestep + 1l];
+			sz -> ism -> star_formation_rate = (*(*sz).ism).specified[next];
 			double dMg = get_ism_mass_SFRmode(*sz, 0u) - (*(*sz).ism).mass;
 			sz -> ism -> infall_rate = (
-				(dMg - mass_recycled(*sz, NULL)) / (*sz).dt +
+				(dMg - mass_recycled(*sz, NULL)) / h +
 				(*(*sz).ism).star_formation_rate + get_outflow_rate(*sz)
 			);
 			sz -> ism -> mass += dMg;
@@ -159,7 +171,7 @@ extern unsigned short update_gas_evolution(SINGLEZONE *sz) {
 	}
 
 	update_gas_evolution_sanitycheck(sz);
-	sz -> ism -> star_formation_history[(*sz).timestep + 1l] = (
+	sz -> ism -> star_formation_history[next] = (
 		*(*sz).ism).star_formation_rate;
 	return 0u;
 
@@ -186,19 +198,19 @@ extern double get_SFE_timescale(SINGLEZONE sz, unsigned short setup) {
 	 * If this function is not being called on singlezone setup, get the
 	 * SFE timescale at the next timestep
 	 */
-	setup = 1 - setup;
+	unsigned long next = sz.timestep + (setup ? 0ul : sz.step);
 	if ((*(*sz.ism).functional_tau_star).user_func != NULL) {
 		/* User-specified function of time and gas mass, in that order. */
 		return callback_2arg_evaluate(*(*sz.ism).functional_tau_star,
 			sz.current_time, (*sz.ism).mass);
 	} else if ((*sz.ism).schmidt) {
 		/* Single-zone implementation of Kennicutt-Schmidt Law */
-		return ((*sz.ism).tau_star[sz.timestep + setup] *
+		return ((*sz.ism).tau_star[next] *
 			pow((*sz.ism).mass / (*sz.ism).mgschmidt,
 				-(*sz.ism).schmidt_index));
 	} else {
 		/* Instantaneous star formation efficiency */
-		return (*sz.ism).tau_star[sz.timestep + setup];
+		return (*sz.ism).tau_star[next];
 	}
 
 }
@@ -232,7 +244,7 @@ extern double get_ism_mass_SFRmode(SINGLEZONE sz, unsigned short setup) {
 	 * timescale at the next timestep.
 	 */
 
-	setup = 1 - setup;
+	unsigned long next = sz.timestep + (setup ? 0ul : sz.step);
 	double tau_star;
 	if ((*(*sz.ism).functional_tau_star).user_func != NULL) {
 		/*
@@ -248,7 +260,7 @@ extern double get_ism_mass_SFRmode(SINGLEZONE sz, unsigned short setup) {
 			/* The value implied by the current star formation rate */
 			tau_star = (
 				pow(
-					(*sz.ism).tau_star[sz.timestep + setup],
+					(*sz.ism).tau_star[next],
 					1 / (1 + (*sz.ism).schmidt_index)
 				) * pow(
 					(*sz.ism).star_formation_rate / (*sz.ism).mgschmidt,
@@ -259,7 +271,7 @@ extern double get_ism_mass_SFRmode(SINGLEZONE sz, unsigned short setup) {
 			tau_star = 0;
 		}
 	} else {
-		tau_star = (*sz.ism).tau_star[sz.timestep + setup];
+		tau_star = (*sz.ism).tau_star[next];
 	}
 
 	return (*sz.ism).star_formation_rate * tau_star;
@@ -315,7 +327,7 @@ extern void primordial_inflow(SINGLEZONE *sz) {
 		unsigned int i;
 		for (i = 0; i < (*sz).n_elements; i++) {
 			sz -> elements[i] -> mass += (
-				(*(*sz).ism).infall_rate * (*sz).dt *
+				(*(*sz).ism).infall_rate * (*sz).step * (*sz).dt *
 				(*(*sz).elements[i]).primordial
 			);
 		}
@@ -1,5 +1,6 @@
 
 #include <stdlib.h>
+#include <math.h>
 #include "../singlezone.h"
 #include "../mdf.h"
 #include "../utils.h"
@@ -136,6 +137,48 @@ extern void update_MDF(SINGLEZONE *sz) {
 }
 
 
+/*
+ * Update the metallicity distribution function with the stars formed at a
+ * previous timestep. This is equivalent to update_MDF, but takes the star
+ * formation rate and abundances from the star formation history and the
+ * metallicity of each element at that timestep rather than the current
+ * state of the ISM.
+ *
+ * Parameters
+ * ==========
+ * sz: 			A pointer to the singlezone object to update the MDF for
+ * timestep: 	The timestep number to take the star formation rate and
+ * 				abundances from
+ *
+ * Notes
+ * =====
+ * This is used by adaptive timestepping, which fills in the timesteps
+ * spanned by each update by interpolation.
+ *
+ * header: mdf.h
+ */
+extern void update_MDF_from_history(SINGLEZONE *sz, unsigned long timestep) {
+
+	unsigned int i, j, n = 0u;
+	double sfr = (*(*sz).ism).star_formation_history[timestep];
+	double *Z = (*(*sz).state).Z + timestep * (*sz).n_elements;
+	for (i = 0; i < (*sz).n_elements; i++) {
+		double onH1 = log10(Z[i] / (*(*sz).elements[i]).solar);
+		long bin = get_bin_number((*(*sz).mdf).bins,
+			(*(*sz).mdf).n_bins, onH1);
+		if (bin != -1l) sz -> mdf -> abundance_distributions[i][bin] += sfr;
+		for (j = 0; j < i; j++) {
+			double onH2 = log10(Z[j] / (*(*sz).elements[j]).solar);
+			bin = get_bin_number((*(*sz).mdf).bins, (*(*sz).mdf).n_bins,
+				onH1 - onH2);
+			if (bin != -1l) sz -> mdf -> ratio_distributions[n][bin] += sfr;
+			n++;
+		}
+	}
+
+}
+
+
 /*
  * Normalize the metallicity distribution functions stored within a singlezone
  * object in prep for write-out at the end of a simulation. This converts each
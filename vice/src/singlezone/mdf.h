@@ -40,6 +40,28 @@ extern unsigned short setup_MDF(SINGLEZONE *sz);
  */
 extern void update_MDF(SINGLEZONE *sz);
 
+/*
+ * Update the metallicity distribution function with the stars formed at a
+ * previous timestep. This is equivalent to update_MDF, but takes the star
+ * formation rate and abundances from the star formation history and the
+ * metallicity of each element at that timestep rather than the current
+ * state of the ISM.
+ *
+ * Parameters
+ * ==========
+ * sz: 			A pointer to the singlezone object to update the MDF for
+ * timestep: 	The timestep number to take the star formation rate and
+ * 				abundances from
+ *
+ * Notes
+ * =====
+ * This is used by adaptive timestepping, which fills in the timesteps
+ * spanned by each update by interpolation.
+ *
+ * source: mdf.c
+ */
+extern void update_MDF_from_history(SINGLEZONE *sz, unsigned long timestep);
+
 /*
  * Normalize the metallicity distribution functions stored within a singlezone
  * object in prep for write-out at the end of a simulation. This converts each
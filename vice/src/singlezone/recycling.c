@@ -8,6 +8,7 @@
  * enrichment rate is the return plus the net yield.
  */
 
+#include <stdlib.h>
 #include "../singlezone.h"
 #include "recycling.h"
 
@@ -20,42 +21,121 @@
  * Parameters
  * ==========
  * sz: 		The singlezone object for the current simulation
- * e: 		A pointer to the element to find the recycled mass. NULL to find
- * 			it for the total ISM gas.
+ * e: 		A pointer to one of the zone's elements to find the recycled
+ * 			mass. NULL to find it for the total ISM gas.
  *
  * Returns
  * =======
- * The recycled mass in Msun
+ * The recycled mass in Msun over the next sz.step timesteps
  *
  * header: recycling.h
  */
 extern double mass_recycled(SINGLEZONE sz, ELEMENT *e) {
 
+	/*
+	 * Change Notes
+	 * ============
+	 * The metallicity of each element is stored in the zone's ELEMENT_STATE
+	 * rather than with the element itself, so the element is located by
+	 * its position in the zone.
+	 */
+	unsigned int j = 0u;
+	if (e != NULL) while (sz.elements[j] != e) j++;
+
 	/* ----------------------- Continuous recycling ----------------------- */
 	if ((*sz.ssp).continuous) {
-		unsigned long i;
-		double mass = 0;
-		/* From each previous timestep, there's a dCRF contribution */
-		for (i = 0l; i <= sz.timestep; i++) {
+		unsigned long i, binned = 0ul;
+		double mass = 0, bound = 0;
+		if (sz.age_bins != NULL) {
+			/* Stellar populations older than the threshold age are binned */
+			mass = binned_mass_recycled(sz, e, &bound);
+			binned = (*sz.age_bins).binned;
+		} else {}
+		/*
+		 * From each previous timestep, there's a dCRF contribution over the
+		 * sz.step timesteps that the simulation is moving forward.
+		 */
+		for (i = 0l; i + binned <= sz.timestep; i++) {
+			double dcrf = (*sz.ssp).crf[i + sz.step] - (*sz.ssp).crf[i];
 			if (e == NULL) { 		/* This is the gas supply */
 				mass += ((*sz.ism).star_formation_history[sz.timestep - i] *
-					sz.dt * ((*sz.ssp).crf[i + 1l] - (*sz.ssp).crf[i]));
+					sz.dt * dcrf);
 			} else { 			/* element -> weight by Z */
 				mass += ((*sz.ism).star_formation_history[sz.timestep - i] *
-					sz.dt * ((*sz.ssp).crf[i + 1l] - (*sz.ssp).crf[i]) *
-					(*e).Z[sz.timestep - i]);
+					sz.dt * dcrf * (*sz.state).Z[(sz.timestep - i) *
+					sz.n_elements + j]);
 			}
 		}
+		if (sz.age_bins != NULL) {
+			record_binning_error(sz.age_bins, bound, mass);
+		} else {}
 		return mass;
 	/* ---------------------- Instantaneous recycling ---------------------- */
 	} else {
+		double h = sz.step * sz.dt;
 		if (e == NULL) {			/* gas supply */
-			return (*sz.ism).star_formation_rate * sz.dt * (*sz.ssp).R0;
+			return (*sz.ism).star_formation_rate * h * (*sz.ssp).R0;
 		} else { 				/* element -> weight by Z */
-			return ((*sz.ism).star_formation_rate * sz.dt * (*sz.ssp).R0 *
+			return ((*sz.ism).star_formation_rate * h * (*sz.ssp).R0 *
 				(*e).mass / (*sz.ism).mass);
 		}
 	}
 
 }
 
+
+/*
+ * Determine the mass of each of a set of elements recycled from all previous
+ * generations of stars with continuous recycling, storing it in the set's
+ * recycled masses.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * state: 	The state of the elements. Stellar populations stored in age
+ * 			bins are only taken into account for the elements of the zone
+ * 			itself.
+ *
+ * Notes
+ * =====
+ * The weight of the stars formed at each previous timestep is the same for
+ * every element, so it is computed once and applied to the metallicity of
+ * all of them at that timestep, which are stored contiguously. The result
+ * is the same as that of mass_recycled for each element.
+ *
+ * header: recycling.h
+ */
+extern void metals_recycled(SINGLEZONE sz, ELEMENT_STATE *state) {
+
+	unsigned int j, n = (*state).n_elements;
+	unsigned long i, binned = 0ul;
+	double *bound = NULL;
+	if (sz.age_bins != NULL && state == sz.state) {
+		/* Stellar populations older than the threshold age are binned */
+		bound = (double *) malloc (n * sizeof(double));
+		for (j = 0u; j < n; j++) {
+			state -> recycled[j] = binned_mass_recycled(sz, sz.elements[j],
+				&bound[j]);
+		}
+		binned = (*sz.age_bins).binned;
+	} else {
+		for (j = 0u; j < n; j++) state -> recycled[j] = 0;
+	}
+
+	for (i = 0ul; i + binned <= sz.timestep; i++) {
+		double weight = ((*sz.ism).star_formation_history[sz.timestep - i] *
+			sz.dt * ((*sz.ssp).crf[i + sz.step] - (*sz.ssp).crf[i]));
+		double *Z = (*state).Z + (sz.timestep - i) * n;
+		double *recycled = (*state).recycled;
+		for (j = 0u; j < n; j++) recycled[j] += weight * Z[j];
+	}
+
+	if (bound != NULL) {
+		for (j = 0u; j < n; j++) {
+			record_binning_error(sz.age_bins, bound[j], (*state).recycled[j]);
+		}
+		free(bound);
+	} else {}
+
+}
+
@@ -16,17 +16,33 @@ extern "C" {
  * Parameters
  * ==========
  * sz: 		The singlezone object for the current simulation
- * e: 		A pointer to the element to find the recycled mass. NULL to find
- * 			it for the total ISM gas.
+ * e: 		A pointer to one of the zone's elements to find the recycled
+ * 			mass. NULL to find it for the total ISM gas.
  *
  * Returns
  * =======
- * The recycled mass in Msun
+ * The recycled mass in Msun over the next sz.step timesteps
  *
  * source: recycling.c
  */
 extern double mass_recycled(SINGLEZONE sz, ELEMENT *e);
 
+/*
+ * Determine the mass of each of a set of elements recycled from all previous
+ * generations of stars with continuous recycling, storing it in the set's
+ * recycled masses.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * state: 	The state of the elements. Stellar populations stored in age
+ * 			bins are only taken into account for the elements of the zone
+ * 			itself.
+ *
+ * source: recycling.c
+ */
+extern void metals_recycled(SINGLEZONE sz, ELEMENT_STATE *state);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,239 @@
+/*
+ * This file implements the linear response of each element's mass to its
+ * yields in VICE's singlezone simulations.
+ *
+ * Notes
+ * =====
+ * For a fixed gas evolution, the enrichment equation is linear in the mass
+ * of each element and its sources. When the yields do not depend on
+ * metallicity, the mass of an element at any time is therefore a weighted
+ * sum of its mass per unit CCSN yield, its mass per unit SN Ia yield, its
+ * mass from AGB stars, and its mass with every yield set to zero. Each of
+ * these is found by evolving a copy of the element alongside it, with that
+ * channel's yield set to one (or left unchanged for AGB stars) and all
+ * others to zero.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../singlezone.h"
+#include "../element.h"
+#include "../io.h"
+#include "response.h"
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static ELEMENT *response_element(SINGLEZONE sz, ELEMENT e,
+	unsigned short channel);
+static void response_element_free(ELEMENT *copy);
+
+
+/*
+ * Setup the response of each element's mass to its yields in preparation for
+ * a singlezone simulation, opening the response.out output file. This does
+ * nothing if the simulation is not recording the response.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object that is about to be ran
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: response.h
+ */
+extern unsigned short setup_response(SINGLEZONE *sz) {
+
+	response_free(sz -> response);
+	sz -> response = NULL;
+	if (!(*sz).linear_response) return 0u;
+
+	RESPONSE *response = (RESPONSE *) malloc (sizeof(RESPONSE));
+	if (response == NULL) return 1u;
+	response -> writer = NULL;
+	response -> n_elements = 0u;
+	response -> state = NULL;
+	response -> elements = (ELEMENT **) malloc (
+		RESPONSE_CHANNELS * (*sz).n_elements * sizeof(ELEMENT *));
+	sz -> response = response;
+	if ((*response).elements == NULL) return 1u;
+
+	unsigned int i;
+	unsigned short j;
+	for (i = 0u; i < (*sz).n_elements; i++) {
+		for (j = 0u; j < RESPONSE_CHANNELS; j++) {
+			response -> elements[RESPONSE_CHANNELS * i + j] = response_element(
+				*sz, *(*sz).elements[i], j);
+		}
+		/* counted before checking, such that the copies are all freed */
+		response -> n_elements++;
+		for (j = 0u; j < RESPONSE_CHANNELS; j++) {
+			if ((*response).elements[RESPONSE_CHANNELS * i + j] == NULL) {
+				return 1u;
+			} else {}
+		}
+	}
+
+	/* The copies are stored contiguously in the same order as the state */
+	response -> state = element_state_initialize((*response).elements,
+		RESPONSE_CHANNELS * (*sz).n_elements, n_timesteps(*sz));
+	if ((*response).state == NULL) return 1u;
+	for (i = 0u; i < RESPONSE_CHANNELS * (*sz).n_elements; i++) {
+		response -> state -> Z[i] = (
+			(*(*response).elements[i]).mass / (*(*sz).ism).mass);
+	}
+
+	return open_response_file(sz);
+
+}
+
+
+/*
+ * Free up the memory stored in a RESPONSE struct and close its output file.
+ *
+ * Parameters
+ * ==========
+ * response: 	A pointer to the response to free
+ *
+ * header: response.h
+ */
+extern void response_free(RESPONSE *response) {
+
+	if (response != NULL) {
+
+		if ((*response).writer != NULL) {
+			fclose(response -> writer);
+			response -> writer = NULL;
+		} else {}
+
+		if ((*response).elements != NULL) {
+			unsigned long i;
+			for (i = 0ul; i < RESPONSE_CHANNELS * (*response).n_elements; i++) {
+				response_element_free((*response).elements[i]);
+			}
+			free(response -> elements);
+			response -> elements = NULL;
+		} else {}
+
+		element_state_free(response -> state);
+		response -> state = NULL;
+		free(response);
+		response = NULL;
+
+	} else {}
+
+}
+
+
+/*
+ * Move the copy of each element for each enrichment channel forward sz.step
+ * timesteps, exactly as the element itself.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * header: response.h
+ */
+extern void update_response(SINGLEZONE *sz) {
+
+	if ((*sz).response == NULL) return;
+	RESPONSE *response = (*sz).response;
+	unsigned long i, next = (*sz).timestep + (*sz).step;
+	unsigned long n = RESPONSE_CHANNELS * (*sz).n_elements;
+
+	/* negative masses are allowed to keep the response linear */
+	advance_element_masses(*sz, (*response).elements, (*response).state);
+	for (i = 0ul; i < n; i++) {
+		/* The ISM is already at the next timestep */
+		response -> state -> Z[next * n + i] = (
+			(*(*response).elements[i]).mass / (*(*sz).ism).mass);
+	}
+
+}
+
+
+/*
+ * Make the copy of an element which records its response to the yields of a
+ * given enrichment channel.
+ *
+ * Parameters
+ * ==========
+ * sz: 			The singlezone object that is about to be ran
+ * e: 			The element to copy
+ * channel: 	The enrichment channel, one of the RESPONSE_* values
+ *
+ * Returns
+ * =======
+ * The copy, with its mass set at the first timestep, or NULL on failure
+ *
+ * Notes
+ * =====
+ * The copies share the SNe Ia delay-time distribution and the AGB star
+ * yields of the element itself, and otherwise own their own memory. The AGB
+ * star yields are shared by every copy such that the same grid is evaluated
+ * in all of them, but only that for the AGB channel retains the ejecta.
+ */
+static ELEMENT *response_element(SINGLEZONE sz, ELEMENT e,
+	unsigned short channel) {
+
+	ELEMENT *copy = element_initialize();
+	copy -> Zin = NULL;
+	strcpy(copy -> symbol, e.symbol);
+	copy -> solar = e.solar;
+	copy -> unretained = 0;
+
+	copy -> ccsne_yields -> yield_ -> assumed_constant = (
+		channel == RESPONSE_CCSNE);
+	copy -> ccsne_yields -> entrainment = (*e.ccsne_yields).entrainment;
+	copy -> sneia_yields -> yield_ -> assumed_constant = (
+		channel == RESPONSE_SNEIA);
+	copy -> sneia_yields -> entrainment = (*e.sneia_yields).entrainment;
+	copy -> sneia_yields -> RIa = (*e.sneia_yields).RIa;
+
+	callback_2arg_free(copy -> agb_grid -> custom_yield);
+	interp_scheme_2d_free(copy -> agb_grid -> interpolator);
+	copy -> agb_grid -> custom_yield = (*e.agb_grid).custom_yield;
+	copy -> agb_grid -> interpolator = (*e.agb_grid).interpolator;
+	copy -> agb_grid -> entrainment = (
+		channel == RESPONSE_AGB ? (*e.agb_grid).entrainment : 0);
+
+	/* The primordial abundance and the infall belong with the zero yields */
+	unsigned long i, n = n_timesteps(sz);
+	copy -> Zin = (double *) malloc (n * sizeof(double));
+	if ((*copy).Zin == NULL) {
+		response_element_free(copy);
+		return NULL;
+	} else {
+		for (i = 0ul; i < n; i++) {
+			copy -> Zin[i] = channel == RESPONSE_OTHER ? e.Zin[i] : 0;
+		}
+	}
+	copy -> primordial = channel == RESPONSE_OTHER ? e.primordial : 0;
+	copy -> mass = (*copy).primordial * (*sz.ism).mass;
+	return copy;
+
+}
+
+
+/*
+ * Free up the memory stored by the copy of an element, leaving alone that
+ * shared with the element itself.
+ *
+ * Parameters
+ * ==========
+ * copy: 	The copy to free
+ */
+static void response_element_free(ELEMENT *copy) {
+
+	if (copy != NULL) {
+		copy -> sneia_yields -> RIa = NULL;
+		copy -> agb_grid -> custom_yield = NULL;
+		copy -> agb_grid -> interpolator = NULL;
+		free(copy -> Zin);
+		copy -> Zin = NULL;
+		element_free(copy);
+	} else {}
+
+}
+
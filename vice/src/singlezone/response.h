@@ -0,0 +1,90 @@
+#ifndef SINGLEZONE_RESPONSE_H
+#define SINGLEZONE_RESPONSE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * The enrichment channels whose yields the response of each element's mass
+ * is recorded for, and the number of them. RESPONSE_OTHER holds the mass
+ * with all yields set to zero: that from the primordial abundance and
+ * metal-rich infall.
+ */
+#ifndef RESPONSE_CCSNE
+#define RESPONSE_CCSNE 0u
+#endif /* RESPONSE_CCSNE */
+
+#ifndef RESPONSE_SNEIA
+#define RESPONSE_SNEIA 1u
+#endif /* RESPONSE_SNEIA */
+
+#ifndef RESPONSE_AGB
+#define RESPONSE_AGB 2u
+#endif /* RESPONSE_AGB */
+
+#ifndef RESPONSE_OTHER
+#define RESPONSE_OTHER 3u
+#endif /* RESPONSE_OTHER */
+
+#ifndef RESPONSE_CHANNELS
+#define RESPONSE_CHANNELS 4u
+#endif /* RESPONSE_CHANNELS */
+
+#include "../objects.h"
+
+/*
+ * Setup the response of each element's mass to its yields in preparation for
+ * a singlezone simulation, opening the response.out output file. This does
+ * nothing if the simulation is not recording the response.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object that is about to be ran
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * Notes
+ * =====
+ * This must be called after the gas evolution and the elements themselves
+ * are setup, as the copies take their initial masses from them.
+ *
+ * source: response.c
+ */
+extern unsigned short setup_response(SINGLEZONE *sz);
+
+/*
+ * Free up the memory stored in a RESPONSE struct and close its output file.
+ *
+ * Parameters
+ * ==========
+ * response: 	A pointer to the response to free
+ *
+ * source: response.c
+ */
+extern void response_free(RESPONSE *response);
+
+/*
+ * Move the copy of each element for each enrichment channel forward sz.step
+ * timesteps, exactly as the element itself.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * Notes
+ * =====
+ * This must be called after the gas evolution is updated, but before the
+ * timestep number is incremented.
+ *
+ * source: response.c
+ */
+extern void update_response(SINGLEZONE *sz);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SINGLEZONE_RESPONSE_H */
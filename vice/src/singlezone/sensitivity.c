@@ -0,0 +1,778 @@
+/*
+ * This file implements the derivatives of the ISM mass and the mass of each
+ * element with respect to scalar parameters in VICE's singlezone
+ * simulations.
+ *
+ * Notes
+ * =====
+ * The derivatives are carried forward alongside the integration (i.e. in
+ * forward mode), differentiating each update of the ISM and of every element
+ * in the form that it is taken in update_gas_evolution and
+ * update_element_masses. A single simulation thereby yields the full Jacobian
+ * of the ISM and element masses with respect to the selected parameters at
+ * every output time. The dependence of the AGB star yields and the stellar
+ * lifetimes on metallicity is not differentiated.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "../singlezone.h"
+#include "../element.h"
+#include "../ism.h"
+#include "../sneia.h"
+#include "../ssp.h"
+#include "../io.h"
+#include "../utils.h"
+#include "sensitivity.h"
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static unsigned short malloc_sensitivity(SINGLEZONE *sz);
+static unsigned short setup_RIa_derivative(SINGLEZONE *sz);
+static void update_gas_sensitivity(SINGLEZONE *sz, unsigned short k);
+static void update_element_sensitivity(SINGLEZONE *sz, unsigned int j);
+static double tau_star_derivative(SINGLEZONE sz, unsigned short k,
+	unsigned short setup, double dmass);
+static double ism_mass_SFRmode_derivative(SINGLEZONE sz, unsigned short k,
+	unsigned short setup);
+static double outflow_rate(SINGLEZONE sz, double sfr);
+static double outflow_rate_derivative(SINGLEZONE sz, unsigned short k,
+	double sfr, double dsfr);
+static double gas_recycled(SINGLEZONE sz, double sfr);
+static double gas_recycled_derivative(SINGLEZONE sz, unsigned short k,
+	double dsfr);
+static double element_recycled(SINGLEZONE sz, ELEMENT *e, double mass);
+static double element_recycled_derivative(SINGLEZONE sz, unsigned short k,
+	unsigned int j, double mass, double dmass);
+static double depletion_derivative(double mass, double dmass, double rate,
+	double drate, double ism, double dism);
+
+
+/*
+ * Setup the derivatives of the ISM mass and the mass of each element with
+ * respect to the parameters selected by the user in preparation for a
+ * singlezone simulation, opening the sensitivities.out output file. This
+ * does nothing if the simulation is not computing them.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object that is about to be ran
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: sensitivity.h
+ */
+extern unsigned short setup_sensitivity(SINGLEZONE *sz) {
+
+	if ((*sz).sensitivity == NULL) return 0u;
+	if (malloc_sensitivity(sz) || setup_RIa_derivative(sz)) return 1u;
+
+	/*
+	 * The initial ISM mass is either specified by the user or found from
+	 * the star formation rate, in which case only the latter depends on the
+	 * parameters through the star formation efficiency timescale.
+	 */
+	SENSITIVITY *sens = (*sz).sensitivity;
+	double mass = (*(*sz).ism).mass;
+	double sfr = (*(*sz).ism).star_formation_rate;
+	unsigned short k;
+	unsigned int j;
+	for (k = 0u; k < (*sens).n_params; k++) {
+		double tau_star = get_SFE_timescale(*sz, 1u);
+		if (checksum((*(*sz).ism).mode) == SFR) {
+			sens -> mass[k] = ism_mass_SFRmode_derivative(*sz, k, 1u);
+			sens -> star_formation_rate[k] = 0;
+		} else {
+			sens -> mass[k] = 0;
+			sens -> star_formation_rate[k] = (-mass *
+				tau_star_derivative(*sz, k, 1u, 0) / (tau_star * tau_star));
+		}
+		if (mass <= 1e-12) sens -> mass[k] = 0;
+		if (sfr <= 0) sens -> star_formation_rate[k] = 0;
+		sens -> infall_rate[k] = 0;
+		sens -> star_formation_history[k][0] = (
+			*sens).star_formation_rate[k];
+		for (j = 0u; j < (*sz).n_elements; j++) {
+			unsigned long idx = k * (*sens).n_elements + j;
+			ELEMENT e = *(*sz).elements[j];
+			sens -> element_mass[idx] = e.primordial * (*sens).mass[k];
+			sens -> Z[idx][0] = ((*sens).element_mass[idx] * mass -
+				e.mass * (*sens).mass[k]) / (mass * mass);
+		}
+	}
+
+	sens -> mass_prev = mass;
+	sens -> infall_prev = (*(*sz).ism).infall_rate;
+	for (j = 0u; j < (*sz).n_elements; j++) {
+		sens -> element_mass_prev[j] = (*(*sz).elements[j]).mass;
+	}
+
+	return open_sensitivity_file(sz);
+
+}
+
+
+/*
+ * Move the derivatives of the ISM mass, star formation and infall rates,
+ * and the mass of each element forward one timestep.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * header: sensitivity.h
+ */
+extern void update_sensitivity(SINGLEZONE *sz) {
+
+	if ((*sz).sensitivity == NULL) return;
+	SENSITIVITY *sens = (*sz).sensitivity;
+	unsigned short k;
+	unsigned int j;
+
+	/* The primordial inflow, added before the ISM is updated */
+	if (!isnan((*sens).infall_prev)) {
+		double h = (*sz).step * (*sz).dt;
+		for (k = 0u; k < (*sens).n_params; k++) {
+			for (j = 0u; j < (*sz).n_elements; j++) {
+				sens -> element_mass[k * (*sens).n_elements + j] += (
+					(*sens).infall_rate[k] * h *
+					(*(*sz).elements[j]).primordial);
+			}
+		}
+	} else {}
+
+	for (k = 0u; k < (*sens).n_params; k++) update_gas_sensitivity(sz, k);
+	for (j = 0u; j < (*sz).n_elements; j++) update_element_sensitivity(sz, j);
+
+	sens -> mass_prev = (*(*sz).ism).mass;
+	sens -> infall_prev = (*(*sz).ism).infall_rate;
+	for (j = 0u; j < (*sz).n_elements; j++) {
+		sens -> element_mass_prev[j] = (*(*sz).elements[j]).mass;
+	}
+
+}
+
+
+/*
+ * Allocate memory for the derivatives in a singlezone simulation.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object that is about to be ran
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * Notes
+ * =====
+ * Each array of rows is assigned to the SENSITIVITY struct with every row
+ * set to NULL before any of them are allocated, such that sensitivity_free
+ * cleans up after a failure part way through.
+ */
+static unsigned short malloc_sensitivity(SINGLEZONE *sz) {
+
+	SENSITIVITY *sens = (*sz).sensitivity;
+	unsigned long i, n = n_timesteps(*sz);
+	unsigned short k;
+	sens -> n_elements = (*sz).n_elements;
+
+	sens -> mass = (double *) malloc ((*sens).n_params * sizeof(double));
+	sens -> star_formation_rate = (double *) malloc ((*sens).n_params *
+		sizeof(double));
+	sens -> infall_rate = (double *) malloc ((*sens).n_params *
+		sizeof(double));
+	sens -> element_mass = (double *) malloc ((*sens).n_params *
+		(*sens).n_elements * sizeof(double));
+	sens -> element_mass_prev = (double *) malloc ((*sens).n_elements *
+		sizeof(double));
+	if ((*sens).mass == NULL || (*sens).star_formation_rate == NULL ||
+		(*sens).infall_rate == NULL || (*sens).element_mass == NULL ||
+		(*sens).element_mass_prev == NULL) return 1u;
+
+	sens -> star_formation_history = (double **) malloc ((*sens).n_params *
+		sizeof(double *));
+	if ((*sens).star_formation_history == NULL) return 1u;
+	for (k = 0u; k < (*sens).n_params; k++) {
+		sens -> star_formation_history[k] = NULL;
+	}
+	for (k = 0u; k < (*sens).n_params; k++) {
+		sens -> star_formation_history[k] = (double *) malloc (n *
+			sizeof(double));
+		if ((*sens).star_formation_history[k] == NULL) return 1u;
+	}
+
+	sens -> Z = (double **) malloc ((*sens).n_params * (*sens).n_elements *
+		sizeof(double *));
+	if ((*sens).Z == NULL) return 1u;
+	for (i = 0ul; i < (*sens).n_params * (*sens).n_elements; i++) {
+		sens -> Z[i] = NULL;
+	}
+	for (i = 0ul; i < (*sens).n_params * (*sens).n_elements; i++) {
+		sens -> Z[i] = (double *) malloc (n * sizeof(double));
+		if ((*sens).Z[i] == NULL) return 1u;
+	}
+
+	return 0u;
+
+}
+
+
+/*
+ * Determine the derivative of the SNe Ia delay-time distribution of each
+ * element with respect to its e-folding timescale, if that is one of the
+ * parameters.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object that is about to be ran
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * Notes
+ * =====
+ * With f(t) = exp(-t / tau_ia) for t >= t_d and zero otherwise, the delay-
+ * time distribution is g = f / S with S the sum of f over its length. Its
+ * derivative is then dg = (df - g dS) / S, with df = f t / tau_ia^2.
+ */
+static unsigned short setup_RIa_derivative(SINGLEZONE *sz) {
+
+	SENSITIVITY *sens = (*sz).sensitivity;
+	unsigned short k;
+	for (k = 0u; k < (*sens).n_params; k++) {
+		if ((*sens).params[k] == SENSITIVITY_TAU_IA) break;
+	}
+	if (k == (*sens).n_params) return 0u;
+
+	unsigned int j;
+	unsigned long i, length = (unsigned long) (RIA_MAX_EVAL_TIME / (*sz).dt);
+	sens -> RIa = (double **) malloc ((*sens).n_elements * sizeof(double *));
+	if ((*sens).RIa == NULL) return 1u;
+	for (j = 0u; j < (*sens).n_elements; j++) sens -> RIa[j] = NULL;
+	for (j = 0u; j < (*sens).n_elements; j++) {
+		sens -> RIa[j] = (double *) malloc (length * sizeof(double));
+		if ((*sens).RIa[j] == NULL) return 1u;
+		SNEIA_YIELD_SPECS *specs = (*(*sz).elements[j]).sneia_yields;
+		double sum = 0, dsum = 0;
+		for (i = 0ul; i < length; i++) {
+			double t = i * (*sz).dt;
+			double f = t < (*specs).t_d ? 0 : exp(-t / (*specs).tau_ia);
+			sens -> RIa[j][i] = f * t / ((*specs).tau_ia * (*specs).tau_ia);
+			sum += f;
+			dsum += (*sens).RIa[j][i];
+		}
+		for (i = 0ul; i < length; i++) {
+			sens -> RIa[j][i] = ((*sens).RIa[j][i] -
+				(*specs).RIa[i] * dsum) / sum;
+		}
+	}
+	return 0u;
+
+}
+
+
+/*
+ * Move the derivatives of the ISM mass, star formation rate, and infall rate
+ * with respect to one parameter forward sz.step timesteps, following
+ * update_gas_evolution.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ * k: 		The index of the parameter
+ */
+static void update_gas_sensitivity(SINGLEZONE *sz, unsigned short k) {
+
+	SENSITIVITY *sens = (*sz).sensitivity;
+	double h = (*sz).step * (*sz).dt;
+	unsigned long next = (*sz).timestep + (*sz).step;
+	double mass = (*(*sz).ism).mass;
+	double sfr = (*(*sz).ism).star_formation_rate;
+	double sfr_prev = (*(*sz).ism).star_formation_history[(*sz).timestep];
+	double dmass_prev = (*sens).mass[k];
+	double dmass, dsfr, difr, tau_star;
+
+	switch (checksum((*(*sz).ism).mode)) {
+
+		case GAS:
+			dmass = 0;
+			tau_star = get_SFE_timescale(*sz, 0u);
+			dsfr = -mass * tau_star_derivative(*sz, k, 0u, dmass) / (
+				tau_star * tau_star);
+			difr = (-gas_recycled_derivative(*sz, k, dsfr) / h + dsfr +
+				outflow_rate_derivative(*sz, k, sfr, dsfr));
+			break;
+
+		case IFR:
+			if ((*sz).integrator == EXPONENTIAL && (*sens).mass_prev > 0) {
+				double depletion = sfr_prev + outflow_rate(*sz, sfr_prev);
+				double ddepletion = ((*sens).star_formation_rate[k] +
+					outflow_rate_derivative(*sz, k, sfr_prev,
+						(*sens).star_formation_rate[k]));
+				dmass = exponential_update_derivative((*sens).mass_prev,
+					(*sens).infall_prev * h + gas_recycled(*sz, sfr_prev),
+					depletion / (*sens).mass_prev, h, dmass_prev,
+					(*sens).infall_rate[k] * h + gas_recycled_derivative(*sz,
+						k, (*sens).star_formation_rate[k]),
+					(ddepletion * (*sens).mass_prev -
+						depletion * dmass_prev) /
+						((*sens).mass_prev * (*sens).mass_prev));
+			} else {
+				dmass = dmass_prev + ((*sens).infall_rate[k] -
+					(*sens).star_formation_rate[k] -
+					outflow_rate_derivative(*sz, k, sfr_prev,
+						(*sens).star_formation_rate[k])) * h +
+					gas_recycled_derivative(*sz, k,
+						(*sens).star_formation_rate[k]);
+			}
+			if (mass <= 1e-12) dmass = 0;
+			tau_star = get_SFE_timescale(*sz, 0u);
+			dsfr = (dmass * tau_star - mass * tau_star_derivative(*sz, k, 0u,
+				dmass)) / (tau_star * tau_star);
+			difr = 0;
+			break;
+
+		case SFR:
+			dsfr = 0;
+			dmass = ism_mass_SFRmode_derivative(*sz, k, 0u);
+			difr = ((dmass - dmass_prev -
+				gas_recycled_derivative(*sz, k, dsfr)) / h + dsfr +
+				outflow_rate_derivative(*sz, k, sfr, dsfr));
+			break;
+
+		default:
+			return;
+
+	}
+
+	/* Derivatives vanish wherever the sanity checks impose a bound */
+	if (mass <= 1e-12) dmass = 0;
+	if (sfr <= 0) dsfr = 0;
+	if ((*(*sz).ism).infall_rate <= 0) difr = 0;
+	sens -> mass[k] = dmass;
+	sens -> star_formation_rate[k] = dsfr;
+	sens -> infall_rate[k] = difr;
+	sens -> star_formation_history[k][next] = dsfr;
+
+}
+
+
+/*
+ * Move the derivatives of the mass of one element with respect to every
+ * parameter forward sz.step timesteps, following update_element_masses.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ * j: 		The index of the element
+ *
+ * Notes
+ * =====
+ * The contributions of the stellar populations at each previous timestep to
+ * the enrichment from AGB stars and SNe Ia are the same for every parameter,
+ * and are therefore computed once and weighted by the derivative of the star
+ * formation history for each one.
+ */
+static void update_element_sensitivity(SINGLEZONE *sz, unsigned int j) {
+
+	SENSITIVITY *sens = (*sz).sensitivity;
+	ELEMENT *e = (*sz).elements[j];
+	double h = (*sz).step * (*sz).dt;
+	unsigned long i, t = (*sz).timestep, next = t + (*sz).step;
+	double *sfh = (*(*sz).ism).star_formation_history;
+	double *RIa = (*(*e).sneia_yields).RIa;
+	double ism = (*(*sz).ism).mass;
+	double sfr = (*(*sz).ism).star_formation_rate;
+	double ifr = (*(*sz).ism).infall_rate;
+	double ofr = outflow_rate(*sz, sfr);
+	/* don't eject helium at an enhanced metallicity */
+	double enh = (*(*sz).state).helium[j] ? 1 : (*(*sz).ism).enh[t];
+
+	/* The mass at the start of the timestep with the primordial inflow */
+	double mass = (*sens).element_mass_prev[j];
+	if (!isnan((*sens).infall_prev)) {
+		mass += (*sens).infall_prev * h * (*e).primordial;
+	} else {}
+
+	/* Yields are constant when derivatives are taken */
+	double y_cc = get_cc_yield(*e, 0);
+	double y_ia = get_ia_yield(*e, 0);
+	double sneia = 0, m_agb = 0;
+	for (i = 0ul; i < t; i++) sneia += sfh[i] * RIa[t - i];
+	double *agb = NULL;
+	if (t) {
+		agb = (double *) malloc ((t + 1ul) * sizeof(double));
+		if (agb == NULL) return;
+		for (i = 0ul; i <= t; i++) {
+			double Z = scale_metallicity(*sz, t - i);
+			agb[i] = (get_AGB_yield(*e, Z, dying_star_mass(i * (*sz).dt,
+				(*(*sz).ssp).postMS, Z, (*sz).ctx)) * (*sz).dt *
+				((*(*sz).ssp).msmf[i] - (*(*sz).ssp).msmf[i + (*sz).step]));
+			m_agb += agb[i] * sfh[t - i];
+		}
+	} else {}
+	double sources = (
+		(*(*e).ccsne_yields).entrainment * y_cc * sfr * h +
+		(*(*e).sneia_yields).entrainment * y_ia * sneia * h +
+		(*(*e).agb_grid).entrainment * m_agb
+	);
+
+	unsigned short k;
+	for (k = 0u; k < (*sens).n_params; k++) {
+		unsigned long idx = k * (*sens).n_elements + j;
+		double *dsfh = (*sens).star_formation_history[k];
+		double dism = (*sens).mass[k];
+		double dsfr = (*sens).star_formation_rate[k];
+		double dofr = outflow_rate_derivative(*sz, k, sfr, dsfr);
+		double dmass = (*sens).element_mass[idx];
+		unsigned short own = (*sens).elements[k] == j;
+
+		double dsneia = 0, dm_agb = 0;
+		for (i = 0ul; i < t; i++) dsneia += dsfh[i] * RIa[t - i];
+		if ((*sens).params[k] == SENSITIVITY_TAU_IA) {
+			for (i = 0ul; i < t; i++) {
+				dsneia += sfh[i] * (*sens).RIa[j][t - i];
+			}
+		} else {}
+		if (agb != NULL) {
+			for (i = 0ul; i <= t; i++) dm_agb += agb[i] * dsfh[t - i];
+		} else {}
+		double dm_cc = y_cc * dsfr * h;
+		double dm_ia = y_ia * dsneia * h;
+		if (own && (*sens).params[k] == SENSITIVITY_CCSNE) {
+			dm_cc += sfr * h;
+		} else if (own && (*sens).params[k] == SENSITIVITY_SNEIA) {
+			dm_ia += sneia * h;
+		} else {}
+		double dsources = (
+			(*(*e).ccsne_yields).entrainment * dm_cc +
+			(*(*e).sneia_yields).entrainment * dm_ia +
+			(*(*e).agb_grid).entrainment * dm_agb
+		);
+
+		if ((*sz).integrator == EXPONENTIAL && ism > 0) {
+			double rate = (sfr + ofr * enh) / ism;
+			double drate = ((dsfr + dofr * enh) * ism -
+				(sfr + ofr * enh) * dism) / (ism * ism);
+			dmass = exponential_update_derivative(mass,
+				sources + element_recycled(*sz, e, mass) +
+					ifr * h * (*e).Zin[t],
+				rate, h, dmass,
+				dsources + element_recycled_derivative(*sz, k, j, mass,
+					dmass) + (*sens).infall_rate[k] * h * (*e).Zin[t],
+				drate);
+		} else {
+			/* the sequence of updates in update_element_masses */
+			double m = mass + sources;
+			dmass += dsources;
+			dmass += element_recycled_derivative(*sz, k, j, m, dmass);
+			m += element_recycled(*sz, e, m);
+			dmass = depletion_derivative(m, dmass, sfr * h, dsfr * h, ism,
+				dism);
+			m -= sfr * h * m / ism;
+			dmass = depletion_derivative(m, dmass, enh * ofr * h,
+				enh * dofr * h, ism, dism);
+			dmass += (*sens).infall_rate[k] * h * (*e).Zin[t];
+		}
+
+		/* The mass of the element is bounded at zero by the sanity check */
+		if ((*e).mass <= 0) dmass = 0;
+		sens -> element_mass[idx] = dmass;
+		sens -> Z[idx][next] = (dmass * ism - (*e).mass * dism) / (ism * ism);
+	}
+
+	free(agb);
+
+}
+
+
+/*
+ * Determine the derivative of the star formation efficiency timescale at the
+ * next timestep, following get_SFE_timescale.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * k: 		The index of the parameter
+ * setup: 	1 if this function is being called from the setup, 0 otherwise
+ * dmass: 	The derivative of the ISM mass
+ *
+ * Returns
+ * =======
+ * The derivative of the timescale in Gyr per unit parameter
+ */
+static double tau_star_derivative(SINGLEZONE sz, unsigned short k,
+	unsigned short setup, double dmass) {
+
+	unsigned long next = sz.timestep + (setup ? 0ul : sz.step);
+	double dtau = (*sz.sensitivity).params[k] == SENSITIVITY_TAU_STAR;
+	if ((*sz.ism).schmidt) {
+		double scale = pow((*sz.ism).mass / (*sz.ism).mgschmidt,
+			-(*sz.ism).schmidt_index);
+		return (dtau * scale - (*sz.ism).tau_star[next] * scale *
+			(*sz.ism).schmidt_index * dmass / (*sz.ism).mass);
+	} else {
+		return dtau;
+	}
+
+}
+
+
+/*
+ * Determine the derivative of the ISM mass at the next timestep when the
+ * simulation is ran in SFR mode, following get_ism_mass_SFRmode.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * k: 		The index of the parameter
+ * setup: 	1 if this function is being called from the setup, 0 otherwise
+ *
+ * Returns
+ * =======
+ * The derivative of the ISM mass per unit parameter
+ */
+static double ism_mass_SFRmode_derivative(SINGLEZONE sz, unsigned short k,
+	unsigned short setup) {
+
+	/* The specified star formation rate does not depend on the parameters */
+	if ((*sz.sensitivity).params[k] != SENSITIVITY_TAU_STAR) return 0;
+	unsigned long next = sz.timestep + (setup ? 0ul : sz.step);
+	if ((*sz.ism).schmidt) {
+		double index = (*sz.ism).schmidt_index;
+		return ((*sz.ism).star_formation_rate ?
+			get_ism_mass_SFRmode(sz, setup) / (
+				(1 + index) * (*sz.ism).tau_star[next]) : 0);
+	} else {
+		return (*sz.ism).star_formation_rate;
+	}
+
+}
+
+
+/*
+ * Determine the mass outflow rate for a given star formation rate, following
+ * get_outflow_rate.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * sfr: 	The star formation rate at the time of the update
+ *
+ * Returns
+ * =======
+ * The mass outflow rate in Msun/Gyr
+ */
+static double outflow_rate(SINGLEZONE sz, double sfr) {
+
+	if ((*sz.ism).smoothing_time < sz.dt) {
+		return (*sz.ism).eta[sz.timestep] * sfr;
+	} else {
+		/* does not depend on the current star formation rate */
+		return get_outflow_rate(sz);
+	}
+
+}
+
+
+/*
+ * Determine the derivative of the mass outflow rate, following
+ * get_outflow_rate.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * k: 		The index of the parameter
+ * sfr: 	The star formation rate at the time of the update
+ * dsfr: 	Its derivative
+ *
+ * Returns
+ * =======
+ * The derivative of the mass outflow rate in Msun/Gyr per unit parameter
+ */
+static double outflow_rate_derivative(SINGLEZONE sz, unsigned short k,
+	double sfr, double dsfr) {
+
+	double deta = (*sz.sensitivity).params[k] == SENSITIVITY_ETA;
+	if ((*sz.ism).smoothing_time < sz.dt) {
+		return deta * sfr + (*sz.ism).eta[sz.timestep] * dsfr;
+	} else {
+		double *dsfh = (*sz.sensitivity).star_formation_history[k];
+		unsigned long i, n = (unsigned long) ((*sz.ism).smoothing_time /
+			sz.dt);
+		if (n > sz.timestep) n = sz.timestep;
+		double mean_sfr = 0, dmean_sfr = 0;
+		for (i = 0ul; i <= n; i++) {
+			mean_sfr += (*sz.ism).star_formation_history[sz.timestep - i];
+			dmean_sfr += dsfh[sz.timestep - i];
+		}
+		mean_sfr /= n + 1ul;
+		dmean_sfr /= n + 1ul;
+		return deta * mean_sfr + (*sz.ism).eta[sz.timestep] * dmean_sfr;
+	}
+
+}
+
+
+/*
+ * Determine the mass of gas recycled from previous generations of stars
+ * for a given star formation rate, following mass_recycled.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * sfr: 	The star formation rate at the time of the update
+ *
+ * Returns
+ * =======
+ * The recycled mass in Msun
+ */
+static double gas_recycled(SINGLEZONE sz, double sfr) {
+
+	if ((*sz.ssp).continuous) {
+		/* does not depend on the current star formation rate */
+		return mass_recycled(sz, NULL);
+	} else {
+		return sfr * sz.step * sz.dt * (*sz.ssp).R0;
+	}
+
+}
+
+
+/*
+ * Determine the derivative of the mass of gas recycled from previous
+ * generations of stars, following mass_recycled.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * k: 		The index of the parameter
+ * dsfr: 	The derivative of the star formation rate at the time of the
+ * 			update
+ *
+ * Returns
+ * =======
+ * The derivative of the recycled mass in Msun per unit parameter
+ */
+static double gas_recycled_derivative(SINGLEZONE sz, unsigned short k,
+	double dsfr) {
+
+	if ((*sz.ssp).continuous) {
+		double *dsfh = (*sz.sensitivity).star_formation_history[k];
+		double dmass = 0;
+		unsigned long i;
+		for (i = 0ul; i <= sz.timestep; i++) {
+			dmass += dsfh[sz.timestep - i] * sz.dt * (
+				(*sz.ssp).crf[i + sz.step] - (*sz.ssp).crf[i]);
+		}
+		return dmass;
+	} else {
+		return dsfr * sz.step * sz.dt * (*sz.ssp).R0;
+	}
+
+}
+
+
+/*
+ * Determine the mass of an element recycled from previous generations of
+ * stars, following mass_recycled.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * e: 		The element
+ * mass: 	The mass of the element at the time of the update
+ *
+ * Returns
+ * =======
+ * The recycled mass of the element in Msun
+ */
+static double element_recycled(SINGLEZONE sz, ELEMENT *e, double mass) {
+
+	if ((*sz.ssp).continuous) {
+		/* does not depend on the current mass of the element */
+		return mass_recycled(sz, e);
+	} else {
+		return ((*sz.ism).star_formation_rate * sz.step * sz.dt *
+			(*sz.ssp).R0 * mass / (*sz.ism).mass);
+	}
+
+}
+
+
+/*
+ * Determine the derivative of the mass of an element recycled from previous
+ * generations of stars, following mass_recycled.
+ *
+ * Parameters
+ * ==========
+ * sz: 		The singlezone object for the current simulation
+ * k: 		The index of the parameter
+ * j: 		The index of the element
+ * mass: 	The mass of the element at the time of the update
+ * dmass: 	Its derivative
+ *
+ * Returns
+ * =======
+ * The derivative of the recycled mass of the element in Msun per unit
+ * parameter
+ */
+static double element_recycled_derivative(SINGLEZONE sz, unsigned short k,
+	unsigned int j, double mass, double dmass) {
+
+	SENSITIVITY sens = *sz.sensitivity;
+	if ((*sz.ssp).continuous) {
+		double *sfh = (*sz.ism).star_formation_history;
+		double *dsfh = sens.star_formation_history[k];
+		double *Z = (*sz.state).Z;
+		double *dZ = sens.Z[k * sens.n_elements + j];
+		double drecycled = 0;
+		unsigned long i;
+		for (i = 0ul; i <= sz.timestep; i++) {
+			unsigned long n = sz.timestep - i;
+			drecycled += (dsfh[n] * Z[n * sz.n_elements + j] +
+				sfh[n] * dZ[n]) * sz.dt * (
+				(*sz.ssp).crf[i + sz.step] - (*sz.ssp).crf[i]);
+		}
+		return drecycled;
+	} else {
+		double sfr = (*sz.ism).star_formation_rate;
+		double ism = (*sz.ism).mass;
+		return sz.step * sz.dt * (*sz.ssp).R0 * (
+			sens.star_formation_rate[k] * mass / ism +
+			sfr * dmass / ism -
+			sfr * mass * sens.mass[k] / (ism * ism));
+	}
+
+}
+
+
+/*
+ * Determine the derivative of the mass of an element after it is depleted
+ * in proportion to its abundance in the ISM, as by star formation or
+ * outflows in a forward Euler step.
+ *
+ * Parameters
+ * ==========
+ * mass: 	The mass of the element before the depletion
+ * dmass: 	Its derivative
+ * rate: 	The mass of the ISM depleted over the timestep
+ * drate: 	Its derivative
+ * ism: 	The mass of the ISM
+ * dism: 	Its derivative
+ *
+ * Returns
+ * =======
+ * The derivative of mass - rate * mass / ism
+ */
+static double depletion_derivative(double mass, double dmass, double rate,
+	double drate, double ism, double dism) {
+
+	return dmass - (drate * mass + rate * dmass) / ism + (
+		rate * mass * dism / (ism * ism));
+
+}
+
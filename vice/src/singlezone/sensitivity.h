@@ -0,0 +1,82 @@
+#ifndef SINGLEZONE_SENSITIVITY_H
+#define SINGLEZONE_SENSITIVITY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * The parameters which derivatives can be taken with respect to: the mass
+ * loading factor, the star formation efficiency timescale, the e-folding
+ * timescale of the SNe Ia delay-time distribution, and the CCSN and SN Ia
+ * yields of a single element.
+ */
+#ifndef SENSITIVITY_ETA
+#define SENSITIVITY_ETA 0u
+#endif /* SENSITIVITY_ETA */
+
+#ifndef SENSITIVITY_TAU_STAR
+#define SENSITIVITY_TAU_STAR 1u
+#endif /* SENSITIVITY_TAU_STAR */
+
+#ifndef SENSITIVITY_TAU_IA
+#define SENSITIVITY_TAU_IA 2u
+#endif /* SENSITIVITY_TAU_IA */
+
+#ifndef SENSITIVITY_CCSNE
+#define SENSITIVITY_CCSNE 3u
+#endif /* SENSITIVITY_CCSNE */
+
+#ifndef SENSITIVITY_SNEIA
+#define SENSITIVITY_SNEIA 4u
+#endif /* SENSITIVITY_SNEIA */
+
+#include "../objects.h"
+
+/*
+ * Setup the derivatives of the ISM mass and the mass of each element with
+ * respect to the parameters selected by the user in preparation for a
+ * singlezone simulation, opening the sensitivities.out output file. This
+ * does nothing if the simulation is not computing them.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object that is about to be ran
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * Notes
+ * =====
+ * This must be called after the gas evolution and the elements are setup.
+ *
+ * source: sensitivity.c
+ */
+extern unsigned short setup_sensitivity(SINGLEZONE *sz);
+
+/*
+ * Move the derivatives of the ISM mass, star formation and infall rates,
+ * and the mass of each element forward one timestep.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * Notes
+ * =====
+ * This must be called after the ISM and every element are updated, but
+ * before the timestep number is incremented. Each derivative follows the
+ * update of the quantity itself in update_gas_evolution and
+ * update_element_masses line by line.
+ *
+ * source: sensitivity.c
+ */
+extern void update_sensitivity(SINGLEZONE *sz);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SINGLEZONE_SENSITIVITY_H */
+
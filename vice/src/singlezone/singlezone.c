@@ -9,13 +9,15 @@
 #include "../singlezone.h"
 #include "../ssp.h"
 #include "../io.h"
+#include "../profile.h"
 #include "singlezone.h"
 
 /* ---------- Static function comment headers not duplicated here ---------- */
 static unsigned short singlezone_timestepper(SINGLEZONE *sz);
-
-/* A progressbar that will run for the singlezone object */
-static PROGRESSBAR *PB = NULL;
+static unsigned short singlezone_evolve_loop(SINGLEZONE *sz,
+	unsigned short save_final_state);
+static unsigned short singlezone_finish(SINGLEZONE *sz,
+	unsigned short checkpoint_failed);
 
 
 /*
@@ -43,22 +45,92 @@ extern long singlezone_address(SINGLEZONE *sz) {
  *
  * Returns
  * =======
- * 0 on success, 1 on setup failure
+ * 0 on success, 1 on setup failure, 2 if the simulation completed but a
+ * checkpoint could not be written
  *
  * header: singlezone.h
  */
 extern unsigned short singlezone_evolve(SINGLEZONE *sz) {
 
 	if (singlezone_setup(sz)) return 1u; 	/* setup failed */
-	singlezone_evolve_no_setup_no_clean(sz);
+	return singlezone_finish(sz, singlezone_evolve_loop(sz, 1u));
 
-	/* Normalize the MDF, write it out, close the files */
-	normalize_MDF(sz);
-	write_mdf_output(*sz);
-	singlezone_close_files(sz);
-	singlezone_clean(sz);
+}
+
+
+/*
+ * Resumes a singlezone simulation from the checkpoint in its output
+ * directory and runs it to completion.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to resume
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on setup failure, 2 if the simulation completed but a
+ * checkpoint could not be written, 3 if the checkpoint could not be read, 4
+ * if the checkpoint does not describe this simulation
+ *
+ * header: singlezone.h
+ */
+extern unsigned short singlezone_resume(SINGLEZONE *sz) {
+
+	if (singlezone_setup_no_io(sz)) return 1u;
+	unsigned short x = singlezone_read_checkpoint(sz);
+	if (x) {
+		singlezone_close_files(sz);
+		singlezone_clean(sz);
+		return 2u + x;
+	} else if ((*sz).current_time >= (*sz).output_times[(*sz).n_outputs - 1l]) {
+		/*
+		 * The checkpoint was saved at the end of the simulation, in which
+		 * case only the output at the final timestep remains to be written.
+		 */
+		write_singlezone_history(*sz);
+		return singlezone_finish(sz, 0u);
+	} else {
+		return singlezone_finish(sz, singlezone_evolve_loop(sz, 1u));
+	}
 
-	return 0u;
+}
+
+
+/*
+ * Extends a completed singlezone simulation to the final output time from
+ * the state saved in its output directory at the end of the simulation.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to extend
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on setup failure, 2 if the simulation completed but a
+ * checkpoint could not be written, 3 if the saved state could not be read,
+ * 4 if the saved state does not describe this simulation
+ *
+ * Notes
+ * =====
+ * The output times must be the only difference between the current settings
+ * and those of the simulation being extended. Those which precede the
+ * ending time of the original simulation are ignored, having already been
+ * written to the history.out file.
+ *
+ * header: singlezone.h
+ */
+extern unsigned short singlezone_extend(SINGLEZONE *sz) {
+
+	if (singlezone_setup_no_io(sz)) return 1u;
+	unsigned short x = singlezone_read_checkpoint(sz);
+	if (x) {
+		singlezone_close_files(sz);
+		singlezone_clean(sz);
+		return 2u + x;
+	} else {
+		singlezone_sync_output_index(sz);
+		return singlezone_finish(sz, singlezone_evolve_loop(sz, 1u));
+	}
 
 }
 
@@ -71,11 +143,73 @@ extern unsigned short singlezone_evolve(SINGLEZONE *sz) {
  * ==========
  * sz: 		A pointer to the singlezone object to run
  *
+ * Returns
+ * =======
+ * 0 on success, 1 if a checkpoint could not be written. In the latter case
+ * the simulation still runs to completion.
+ *
  * header: singlezone.h
  */
-extern void singlezone_evolve_no_setup_no_clean(SINGLEZONE *sz) {
+extern unsigned short singlezone_evolve_no_setup_no_clean(SINGLEZONE *sz) {
+
+	return singlezone_evolve_loop(sz, 0u);
+
+}
 
-	long n = 0l; 	/* keep track of the number of outputs */
+
+/*
+ * Determine the index of the next output time to be written to the
+ * history.out file based on the current time in the simulation.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * header: singlezone.h
+ */
+extern void singlezone_sync_output_index(SINGLEZONE *sz) {
+
+	/*
+	 * An output time has been written if it was closer to a previous
+	 * timestep than the one following it, exactly as in the evolution loop.
+	 */
+	sz -> output_index = 0ul;
+	while ((*sz).output_index < (*sz).n_outputs - 1ul &&
+		2 * (*sz).output_times[(*sz).output_index] <
+		2 * (*sz).current_time - (*sz).dt) {
+		sz -> output_index++;
+	}
+
+}
+
+
+/*
+ * Evolves a singlezone simulation from its current state until the final
+ * output time.
+ *
+ * Parameters
+ * ==========
+ * sz: 					A pointer to the singlezone object to run
+ * save_final_state: 	Whether or not to write a checkpoint at the end of the
+ * 						simulation, allowing it to be extended later.
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 if a checkpoint could not be written. In the latter case
+ * the simulation still runs to completion.
+ */
+static unsigned short singlezone_evolve_loop(SINGLEZONE *sz,
+	unsigned short save_final_state) {
+
+	/*
+	 * Change Notes
+	 * ============
+	 * The number of outputs written so far is now tracked by the singlezone
+	 * object itself rather than a local variable, such that it can be
+	 * restored when resuming from a checkpoint.
+	 */
+	unsigned short checkpoint_failed = 0u;
+	PROFILE *p = (*(*sz).ctx).profile;
 	while ((*sz).current_time <= (*sz).output_times[(*sz).n_outputs - 1l]) {
 		/*
 		 * Run the simulation until the time reaches the final output time
@@ -83,16 +217,67 @@ extern void singlezone_evolve_no_setup_no_clean(SINGLEZONE *sz) {
 		 * output time is reached, or if the current timestep is closer to the
 		 * next output time than the subsequent timestep.
 		 */
-		if ((*sz).current_time >= (*sz).output_times[n] ||
-			2 * (*sz).output_times[n] < 2 * (*sz).current_time + (*sz).dt) {
+		if ((*sz).current_time >= (*sz).output_times[(*sz).output_index] ||
+			2 * (*sz).output_times[(*sz).output_index] <
+			2 * (*sz).current_time + (*sz).dt) {
+			profile_start(p, PROFILE_WRITE_HISTORY);
 			write_singlezone_history(*sz);
-			n++;
+			profile_stop(p, PROFILE_WRITE_HISTORY);
+			sz -> output_index++;
 		} else {}
+		unsigned long previous = (*sz).timestep;
 		if (singlezone_timestepper(sz)) break;
+		if (checkpoint_due((*sz).checkpoint_interval, (*sz).dt, previous,
+			(*sz).timestep)) {
+			profile_start(p, PROFILE_CHECKPOINT);
+			checkpoint_failed |= singlezone_write_checkpoint(sz);
+			profile_stop(p, PROFILE_CHECKPOINT);
+		} else {}
 		singlezone_verbosity(*sz);
 	}
 	singlezone_verbosity(*sz);
+
+	/*
+	 * The final state is saved before the output at the final timestep,
+	 * which an extended simulation will not necessarily write.
+	 */
+	if (save_final_state) {
+		profile_start(p, PROFILE_CHECKPOINT);
+		checkpoint_failed |= singlezone_write_checkpoint(sz);
+		profile_stop(p, PROFILE_CHECKPOINT);
+	} else {}
+	profile_start(p, PROFILE_WRITE_HISTORY);
 	write_singlezone_history(*sz);
+	profile_stop(p, PROFILE_WRITE_HISTORY);
+	return checkpoint_failed;
+
+}
+
+
+/*
+ * Normalizes and writes the stellar MDF at the end of a singlezone
+ * simulation, closes the output files, and frees up the memory.
+ *
+ * Parameters
+ * ==========
+ * sz: 					A pointer to the singlezone object
+ * checkpoint_failed: 	Whether or not a checkpoint could not be written
+ *
+ * Returns
+ * =======
+ * 0 on success, 2 if a checkpoint could not be written
+ */
+static unsigned short singlezone_finish(SINGLEZONE *sz,
+	unsigned short checkpoint_failed) {
+
+	PROFILE *p = (*(*sz).ctx).profile;
+	profile_start(p, PROFILE_WRITE_MDF);
+	normalize_MDF(sz);
+	write_mdf_output(*sz);
+	profile_stop(p, PROFILE_WRITE_MDF);
+	singlezone_close_files(sz);
+	singlezone_clean(sz);
+	return 2u * checkpoint_failed;
 
 }
 
@@ -110,25 +295,102 @@ extern void singlezone_evolve_no_setup_no_clean(SINGLEZONE *sz) {
  */
 static unsigned short singlezone_timestepper(SINGLEZONE *sz) {
 
+	/*
+	 * Change Notes
+	 * ============
+	 * With adaptive timestepping, the step size is chosen by the adaptive
+	 * timestepper, which also takes care of the MDF and any outputs which
+	 * fall within each step. Otherwise the simulation moves forward exactly
+	 * one timestep as before.
+	 */
+	if ((*sz).tolerance > 0) {
+		adaptive_timestepper(sz);
+	} else {
+		sz -> step = 1ul;
+		singlezone_step(sz);
+		/*
+		 * The MDF only depends on the ISM at the next timestep, so it can be
+		 * updated after the timestep number and current time have moved.
+		 */
+		profile_start((*(*sz).ctx).profile, PROFILE_MDF);
+		update_MDF(sz);
+		profile_stop((*(*sz).ctx).profile, PROFILE_MDF);
+	}
+
+	return (*sz).current_time >= (*sz).output_times[(*sz).n_outputs - 1l];
+
+}
+
+
+/*
+ * Advances the ISM and all elements in a singlezone object forward by
+ * (*sz).step timesteps. If this spans multiple timesteps, the star formation
+ * history and the metallicity of each element at the intermediate timesteps
+ * are linearly interpolated.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to advance
+ *
+ * header: singlezone.h
+ */
+extern void singlezone_step(SINGLEZONE *sz) {
+
 	/*
 	 * Timestep number and current time get moved LAST. This is taken into
 	 * account in each of the following subroutines.
 	 */
-	unsigned int i;
-	update_gas_evolution(sz);
-	for (i = 0; i < (*sz).n_elements; i++) {
-		update_element_mass(*sz, (*sz).elements[i]);
+	unsigned int i, n = (*sz).n_elements;
+	unsigned long j, next = (*sz).timestep + (*sz).step;
+	PROFILE *p = (*(*sz).ctx).profile;
+	if ((*sz).age_bins != NULL) {
+		profile_start(p, PROFILE_AGE_BINS);
+		update_age_bins(sz);
+		profile_stop(p, PROFILE_AGE_BINS);
+	} else {}
+	if ((*sz).analytic) {
+		profile_start(p, PROFILE_ANALYTIC);
+		analytic_update(sz);
+		profile_stop(p, PROFILE_ANALYTIC);
+	} else {
+		profile_start(p, PROFILE_GAS);
+		update_gas_evolution(sz);
+		profile_stop(p, PROFILE_GAS);
+		profile_start(p, PROFILE_ENRICHMENT);
+		update_element_masses(sz);
+		profile_stop(p, PROFILE_ENRICHMENT);
+	}
+	double *Z = (*(*sz).state).Z;
+	for (i = 0; i < n; i++) {
 		/* Now the ISM and this element are at the next timestep */
-		sz -> elements[i] -> Z[(*sz).timestep + 1l] = (
-			(*(*sz).elements[i]).mass / (*(*sz).ism).mass);
+		Z[next * n + i] = (*(*sz).elements[i]).mass / (*(*sz).ism).mass;
 	}
-	update_MDF(sz);
+	if ((*sz).response != NULL) {
+		profile_start(p, PROFILE_RESPONSE);
+		update_response(sz);
+		profile_stop(p, PROFILE_RESPONSE);
+	} else {}
+	if ((*sz).sensitivity != NULL) {
+		profile_start(p, PROFILE_SENSITIVITY);
+		update_sensitivity(sz);
+		profile_stop(p, PROFILE_SENSITIVITY);
+	} else {}
 
-	sz -> current_time += (*sz).dt;
-	sz -> timestep++;
+	for (j = 1ul; j < (*sz).step; j++) {
+		double frac = (double) j / (*sz).step;
+		double *sfh = (*(*sz).ism).star_formation_history;
+		sfh[(*sz).timestep + j] = (1 - frac) * sfh[(*sz).timestep] +
+			frac * sfh[next];
+		double *row = Z + ((*sz).timestep + j) * n;
+		for (i = 0; i < n; i++) {
+			row[i] = (1 - frac) * Z[(*sz).timestep * n + i] + (
+				frac * Z[next * n + i]);
+		}
+	}
+
+	sz -> current_time += (*sz).step * (*sz).dt;
+	sz -> timestep = next;
 
-	return (*sz).current_time >= (*sz).output_times[(*sz).n_outputs - 1l];
-	
 }
 
 
@@ -148,14 +410,47 @@ static unsigned short singlezone_timestepper(SINGLEZONE *sz) {
 extern unsigned short singlezone_setup(SINGLEZONE *sz) {
 
 	/* Open output files and write headers */
+	PROFILE *p = (*(*sz).ctx).profile;
+	profile_start(p, PROFILE_SETUP_OUTPUT);
 	if (singlezone_open_files(sz)) {
 		return 1u;
 	} else {
 		write_history_header(*sz);
-		sz -> current_time = 0.0;
-		sz -> timestep = 0l;
 		write_mdf_header(*sz);
 	}
+	profile_stop(p, PROFILE_SETUP_OUTPUT);
+
+	/*
+	 * The response and the derivatives are only recorded from the beginning
+	 * of a simulation, and their setup is only timed when they are.
+	 */
+	if (singlezone_setup_no_io(sz)) return 1u;
+	profile_start(p, PROFILE_SETUP_RESPONSE);
+	if (setup_response(sz)) return 1u;
+	if ((*sz).response != NULL) profile_stop(p, PROFILE_SETUP_RESPONSE);
+	profile_start(p, PROFILE_SETUP_SENSITIVITY);
+	unsigned short x = setup_sensitivity(sz);
+	if ((*sz).sensitivity != NULL) profile_stop(p, PROFILE_SETUP_SENSITIVITY);
+	return x;
+
+}
+
+
+/*
+ * Setup the singlezone object for simulation without opening the output
+ * files.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to do the setup for
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: singlezone.h
+ */
+extern unsigned short singlezone_setup_no_io(SINGLEZONE *sz) {
 
 	/*
 	 * Change Notes
@@ -164,34 +459,86 @@ extern unsigned short singlezone_setup(SINGLEZONE *sz) {
 	 * here. It was moved to its current position after a primordial
 	 * abundance was taken into account, for which the ISM mass is necessary.
 	 * This is not set until after setup_gas_evolution() is called.
+	 *
+	 * Everything following the setup of the single stellar population
+	 * quantities is now in singlezone_setup_evolution, such that ensembles
+	 * of singlezone objects can compute them once and share them.
+	 *
+	 * The cumulative return fraction and main sequence mass fraction are
+	 * now taken from a cache shared by every singlezone object in the
+	 * process rather than computed for each.
 	 */
 
 	/*
-	 * Setup the cumulative return fraction, main sequence mass fraction,
-	 * metallicity distribution function, SNe Ia rates, and gas evolution.
+	 * Setup the cumulative return fraction, main sequence mass fraction, and
+	 * SNe Ia rates, then the metallicity distribution function and gas
+	 * evolution.
 	 */
 
-	if (setup_CRF(sz)) return 1u;
-	if (setup_MSMF(sz)) return 1u;
-	if (setup_MDF(sz)) return 1u;
+	PROFILE *p = (*(*sz).ctx).profile;
+	profile_start(p, PROFILE_SETUP_SSP);
+	if (acquire_SSP_tables(sz)) return 1u;
+	profile_stop(p, PROFILE_SETUP_SSP);
+	profile_start(p, PROFILE_SETUP_RIA);
 	if (setup_RIa(sz)) return 1u;
+	profile_stop(p, PROFILE_SETUP_RIA);
+	return singlezone_setup_evolution(sz);
+
+}
+
+
+/*
+ * Setup the time-evolving quantities of a singlezone object for simulation,
+ * assuming that the cumulative return fraction, main sequence mass
+ * fraction, and SNe Ia rates have already been computed.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to do the setup for
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: singlezone.h
+ */
+extern unsigned short singlezone_setup_evolution(SINGLEZONE *sz) {
+
+	sz -> current_time = 0.0;
+	sz -> timestep = 0l;
+	sz -> step = 1ul;
+	sz -> trial_step = 1ul;
+	sz -> output_index = 0l;
+
+	PROFILE *p = (*(*sz).ctx).profile;
+	profile_start(p, PROFILE_SETUP_MDF);
+	if (setup_MDF(sz)) return 1u;
+	profile_stop(p, PROFILE_SETUP_MDF);
+	profile_start(p, PROFILE_SETUP_GAS);
 	if (setup_gas_evolution(sz)) return 1u;
+	profile_stop(p, PROFILE_SETUP_GAS);
+	/*
+	 * The singlezone object always allocates memory for 10 timesteps beyond
+	 * the ending time as a safeguard against memory errors.
+	 */
+	element_state_free(sz -> state);
+	sz -> state = element_state_initialize((*sz).elements, (*sz).n_elements,
+		n_timesteps(*sz));
+	if ((*sz).state == NULL) return 1u;
 	unsigned int i;
 	for (i = 0u; i < (*sz).n_elements; i++) {
-		/*
-		 * The singlezone object always allocates memory for 10 timesteps
-		 * beyond the ending time as a safeguard against memory errors.
-		 */
-		if (malloc_Z(sz -> elements[i], n_timesteps(*sz))) return 1u;
 		sz -> elements[i] -> mass = (
 			(*(*sz).elements[i]).primordial * (*(*sz).ism).mass
 		);
-		sz -> elements[i] -> Z[0l] = (
-			(*(*sz).elements[i]).mass / (*(*sz).ism).mass
-		);
+		sz -> state -> Z[i] = (*(*sz).elements[i]).mass / (*(*sz).ism).mass;
+		/* reported at the first output, before any enrichment has occurred */
+		sz -> elements[i] -> unretained = 0;
 	}
 
-	return 0u;
+	profile_start(p, PROFILE_SETUP_AGE_BINS);
+	unsigned short x = setup_age_bins(sz);
+	if ((*sz).age_bins != NULL) profile_stop(p, PROFILE_SETUP_AGE_BINS);
+	return x;
 
 }
 
@@ -221,13 +568,13 @@ extern void singlezone_clean(SINGLEZONE *sz) {
 			sz -> elements[i] -> agb_grid -> interpolator -> ycoords = NULL;
 			sz -> elements[i] -> agb_grid -> interpolator -> zcoords = NULL;
 		} else {}
-		free(sz -> elements[i] -> Z);
 		free(sz -> elements[i] -> Zin);
 		free(sz -> elements[i] -> sneia_yields -> RIa);
-		sz -> elements[i] -> Z = NULL;
 		sz -> elements[i] -> Zin = NULL;
 		sz -> elements[i] -> sneia_yields -> RIa = NULL;
 	}
+	element_state_free(sz -> state);
+	sz -> state = NULL;
 	free(sz -> ism -> specified);
 	free(sz -> ism -> star_formation_history);
 	free(sz -> ism -> eta);
@@ -235,8 +582,16 @@ extern void singlezone_clean(SINGLEZONE *sz) {
 	free(sz -> ism -> tau_star);
 	free(sz -> mdf -> abundance_distributions);
 	free(sz -> mdf -> ratio_distributions);
-	free(sz -> ssp -> crf);
-	free(sz -> ssp -> msmf);
+	release_SSP_tables(sz);
+	if ((*sz).age_bins != NULL) {
+		sz -> binning_error = (*(*sz).age_bins).error;
+		age_bins_free(sz -> age_bins);
+		sz -> age_bins = NULL;
+	} else {}
+	response_free(sz -> response);
+	sz -> response = NULL;
+	sensitivity_free(sz -> sensitivity);
+	sz -> sensitivity = NULL;
 	free(sz -> output_times);
 	sz -> ism -> specified = NULL;
 	sz -> ism -> star_formation_history = NULL;
@@ -245,8 +600,6 @@ extern void singlezone_clean(SINGLEZONE *sz) {
 	sz -> ism -> tau_star = NULL;
 	sz -> mdf -> abundance_distributions = NULL;
 	sz -> mdf -> ratio_distributions = NULL;
-	sz -> ssp -> crf = NULL;
-	sz -> ssp -> msmf = NULL;
 	sz -> output_times = NULL;
 	sz -> current_time = 0;
 	sz -> timestep = 0l;
@@ -354,19 +707,22 @@ extern unsigned long n_timesteps(SINGLEZONE sz) {
 extern void singlezone_verbosity(SINGLEZONE sz) {
 
 	if (sz.verbose) {
-		if (PB == NULL) {
-			PB = progressbar_initialize(n_timesteps(sz) - BUFFER);
-			PB -> custom_left_hand_side = 1u;
-			PB -> eta_mode = 875u;
+		CONTEXT *ctx = sz.ctx;
+		if ((*ctx).pb == NULL) {
+			ctx -> pb = progressbar_initialize(n_timesteps(sz) - BUFFER);
+			ctx -> pb -> custom_left_hand_side = 1u;
+			ctx -> pb -> eta_mode = 875u;
 		} else {}
 		char current_time[100];
 		sprintf(current_time, "Current Time: %.2f Gyr", sz.current_time);
-		progressbar_set_left_hand_side(PB, current_time);
-		if (sz.timestep <= (*PB).maxval) progressbar_update(PB, sz.timestep);
-		if (sz.timestep == (*PB).maxval) {
-			progressbar_finish(PB);
-			progressbar_free(PB);
-			PB = NULL;
+		progressbar_set_left_hand_side((*ctx).pb, current_time);
+		if (sz.timestep <= (*(*ctx).pb).maxval) {
+			progressbar_update((*ctx).pb, sz.timestep);
+		} else {}
+		if (sz.timestep == (*(*ctx).pb).maxval) {
+			progressbar_finish(ctx -> pb);
+			progressbar_free(ctx -> pb);
+			ctx -> pb = NULL;
 		} else {}
 	} else {}
 
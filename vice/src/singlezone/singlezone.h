@@ -29,12 +29,56 @@ extern long singlezone_address(SINGLEZONE *sz);
  *
  * Returns
  * =======
- * 0 on success, 1 on setup failure
+ * 0 on success, 1 on setup failure, 2 if the simulation completed but a
+ * checkpoint could not be written
  *
  * source: singlezone.c
  */
 extern unsigned short singlezone_evolve(SINGLEZONE *sz);
 
+/*
+ * Resumes a singlezone simulation from the checkpoint in its output
+ * directory and runs it to completion.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to resume
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on setup failure, 2 if the simulation completed but a
+ * checkpoint could not be written, 3 if the checkpoint could not be read, 4
+ * if the checkpoint does not describe this simulation
+ *
+ * source: singlezone.c
+ */
+extern unsigned short singlezone_resume(SINGLEZONE *sz);
+
+/*
+ * Extends a completed singlezone simulation to the final output time from
+ * the state saved in its output directory at the end of the simulation.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to extend
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on setup failure, 2 if the simulation completed but a
+ * checkpoint could not be written, 3 if the saved state could not be read,
+ * 4 if the saved state does not describe this simulation
+ *
+ * Notes
+ * =====
+ * The output times must be the only difference between the current settings
+ * and those of the simulation being extended. Those which precede the
+ * ending time of the original simulation are ignored, having already been
+ * written to the history.out file.
+ *
+ * source: singlezone.c
+ */
+extern unsigned short singlezone_extend(SINGLEZONE *sz);
+
 /*
  * Evolves a singlezone simulation under current user settings, but does not
  * write the MDF output or normalization.
@@ -43,9 +87,40 @@ extern unsigned short singlezone_evolve(SINGLEZONE *sz);
  * ==========
  * sz: 		A pointer to the singlezone object to run
  *
+ * Returns
+ * =======
+ * 0 on success, 1 if a checkpoint could not be written. In the latter case
+ * the simulation still runs to completion.
+ *
+ * source: singlezone.c
+ */
+extern unsigned short singlezone_evolve_no_setup_no_clean(SINGLEZONE *sz);
+
+/*
+ * Advances the ISM and all elements in a singlezone object forward by
+ * (*sz).step timesteps. If this spans multiple timesteps, the star formation
+ * history and the metallicity of each element at the intermediate timesteps
+ * are linearly interpolated.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to advance
+ *
  * source: singlezone.c
  */
-extern void singlezone_evolve_no_setup_no_clean(SINGLEZONE *sz);
+extern void singlezone_step(SINGLEZONE *sz);
+
+/*
+ * Determine the index of the next output time to be written to the
+ * history.out file based on the current time in the simulation.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object for the current simulation
+ *
+ * source: singlezone.c
+ */
+extern void singlezone_sync_output_index(SINGLEZONE *sz);
 
 /*
  * Setup the singlezone object for simulation.
@@ -62,6 +137,39 @@ extern void singlezone_evolve_no_setup_no_clean(SINGLEZONE *sz);
  */
 extern unsigned short singlezone_setup(SINGLEZONE *sz);
 
+/*
+ * Setup the singlezone object for simulation without opening the output
+ * files.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to do the setup for
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: singlezone.c
+ */
+extern unsigned short singlezone_setup_no_io(SINGLEZONE *sz);
+
+/*
+ * Setup the time-evolving quantities of a singlezone object for simulation,
+ * assuming that the cumulative return fraction, main sequence mass
+ * fraction, and SNe Ia rates have already been computed.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to do the setup for
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * source: singlezone.c
+ */
+extern unsigned short singlezone_setup_evolution(SINGLEZONE *sz);
+
 /*
  * Frees up the memory allocated in running a singlezone simulation. These
  * values are objects that are stored at the python level and copied at
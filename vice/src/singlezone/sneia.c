@@ -34,15 +34,21 @@ static double RIa_builtin(ELEMENT e, double time);
  */
 extern double mdot_sneia(SINGLEZONE sz, ELEMENT e) {
 
-	unsigned long i;
-	double mdotia = 0;
-	for (i = 0l; i < sz.timestep; i++) {
+	unsigned long i, first = 0ul;
+	double mdotia = 0, bound = 0;
+	if (sz.age_bins != NULL) {
+		/* Stellar populations older than the threshold age are binned */
+		mdotia = binned_mdot_sneia(sz, e, &bound);
+		first = (*sz.age_bins).binned;
+	} else {}
+	for (i = first; i < sz.timestep; i++) {
 		mdotia += (
 			get_ia_yield(e, scale_metallicity(sz, i)) *
 			(*sz.ism).star_formation_history[i] *
 			(*e.sneia_yields).RIa[sz.timestep - i]
 		);
 	}
+	if (sz.age_bins != NULL) record_binning_error(sz.age_bins, bound, mdotia);
 	/* Entrainment is handled in vice/src/singlezone/element.c */
 	return mdotia;
 
@@ -1,8 +1,10 @@
 # cython: language_level = 3, boundscheck = False
 
 from __future__ import absolute_import
-from ....core.objects._element cimport ELEMENT
+from ....core.objects._element cimport ELEMENT, ELEMENT_STATE
 
 cdef extern from "../element.h":
-	unsigned short malloc_Z(ELEMENT *e, unsigned long n_timesteps)
+	ELEMENT_STATE *element_state_initialize(ELEMENT **elements,
+		unsigned int n_elements, unsigned long n_timesteps)
+	void element_state_free(ELEMENT_STATE *state)
 
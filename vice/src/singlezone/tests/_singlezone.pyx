@@ -63,7 +63,7 @@ def test_element():
 		return ["vice.src.singlezone.element", None]
 	return ["vice.src.singlezone.element",
 		[
-			_TEST_.test_element_malloc_Z()
+			_TEST_.test_element_state_initialize()
 		]
 	]
 
@@ -179,17 +179,23 @@ cdef class singlezone_tester:
 		return ["vice.src.singlezone.singlezone.singlezone_evolve", test]
 
 	@unittest
-	def test_element_malloc_Z(self):
+	def test_element_state_initialize(self):
 		r"""
-		vice.src.singlezone.element.malloc_Z unit test
+		vice.src.singlezone.element.element_state_initialize unit test
 		"""
 		def test():
-			if 1 - _element.malloc_Z(self._sz[0].elements[0], 10):
-				free(self._sz[0].elements[0][0].Z)
-				return True
-			else:
-				return False
-		return ["vice.src.singlezone.element.malloc_Z", test]
+			_element.element_state_free(self._sz[0].state)
+			self._sz[0].state = _element.element_state_initialize(
+				self._sz[0].elements, self._sz[0].n_elements, 10)
+			if self._sz[0].state is NULL: return False
+			status = self._sz[0].state[0].n_elements == self._sz[0].n_elements
+			for i in range(10 * self._sz[0].n_elements):
+				status &= self._sz[0].state[0].Z[i] == 0
+			_element.element_state_free(self._sz[0].state)
+			self._sz[0].state = NULL
+			return status
+		return ["vice.src.singlezone.element.element_state_initialize",
+			test]
 
 	@unittest
 	def test_ism_setup_gas_evolution(self):
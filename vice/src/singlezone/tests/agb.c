@@ -56,7 +56,7 @@ extern unsigned short max_age_ssp_test_m_AGB(SINGLEZONE *sz) {
 		status &= m_AGB(*sz, *(*sz).elements[i]) == (
 			get_AGB_yield(*(*sz).elements[i], 0,
 				dying_star_mass((*sz).timestep * (*sz).dt,
-					(*(*sz).ssp).postMS, 0)) *
+					(*(*sz).ssp).postMS, 0, (*sz).ctx)) *
 			(*(*sz).ism).star_formation_history[0] * (*sz).dt *
 			(
 				(*(*sz).ssp).msmf[(*sz).timestep] -
@@ -66,7 +66,7 @@ def max_age_ssp_test(**kwargs):
 	return [
 		_TEST_.test_m_AGB(),
 		_TEST_.test_m_ccsne(),
-		_TEST_.test_update_element_mass(),
+		_TEST_.test_update_element_masses(),
 		_TEST_.test_onH(),
 		_TEST_.test_update_gas_evolution(),
 		_TEST_.test_get_outflow_rate(),
@@ -120,13 +120,13 @@ cdef class max_age_ssp:
 		return ["vice.src.singlezone.ccsne.m_ccsne", test]
 
 	@unittest
-	def test_update_element_mass(self):
+	def test_update_element_masses(self):
 		r"""
-		vice.src.singlezone.element.update_element_mass max age SSP test
+		vice.src.singlezone.element.update_element_masses max age SSP test
 		"""
 		def test():
-			return _max_age_ssp.max_age_ssp_test_update_element_mass(self._sz)
-		return ["vice.src.singlezone.element.update_element_mass", test]
+			return _max_age_ssp.max_age_ssp_test_update_element_masses(self._sz)
+		return ["vice.src.singlezone.element.update_element_masses", test]
 
 	@unittest
 	def test_onH(self):
@@ -61,7 +61,7 @@ def quiescence_test(**kwargs):
 	return [
 		_TEST_.test_m_agb(),
 		_TEST_.test_m_ccsne(),
-		_TEST_.test_update_element_mass(),
+		_TEST_.test_update_element_masses(),
 		_TEST_.test_onH(),
 		_TEST_.test_update_gas_evolution(),
 		_TEST_.test_get_outflow_rate(),
@@ -117,13 +117,13 @@ cdef class quiescence:
 		return ["vice.src.singlezone.ccsne.m_ccsne", test]
 
 	@unittest
-	def test_update_element_mass(self):
+	def test_update_element_masses(self):
 		r"""
-		vice.src.singlezone.element.update_element_mass quiescence test
+		vice.src.singlezone.element.update_element_masses quiescence test
 		"""
 		def test():
-			return _quiescence.quiescence_test_update_element_mass(self._sz)
-		return ["vice.src.singlezone.element.update_element_mass", test]
+			return _quiescence.quiescence_test_update_element_masses(self._sz)
+		return ["vice.src.singlezone.element.update_element_masses", test]
 
 	@unittest
 	def test_onH(self):
@@ -17,7 +17,7 @@ cdef extern from "../ccsne.h":
 	unsigned short zero_age_ssp_test_m_ccsne(SINGLEZONE *sz)
 
 cdef extern from "../element.h":
-	unsigned short zero_age_ssp_test_update_element_mass(SINGLEZONE *sz)
+	unsigned short zero_age_ssp_test_update_element_masses(SINGLEZONE *sz)
 	unsigned short zero_age_ssp_test_onH(SINGLEZONE *sz)
 
 cdef extern from "../ism.h":
@@ -7,7 +7,7 @@
 #include <math.h>
 
 /*
- * Implements the quiescence test on the update_element_mass function in the
+ * Implements the quiescence test on the update_element_masses function in the
  * parent directory by ensuring that each element's mass is equal to zero.
  *
  * Parameters
@@ -20,7 +20,7 @@
  *
  * header: element.h
  */
-extern unsigned short quiescence_test_update_element_mass(SINGLEZONE *sz) {
+extern unsigned short quiescence_test_update_element_masses(SINGLEZONE *sz) {
 
 	unsigned short i, status = 1u;
 	for (i = 0u; i < (*sz).n_elements; i++) {
@@ -33,7 +33,7 @@ extern unsigned short quiescence_test_update_element_mass(SINGLEZONE *sz) {
 
 
 /*
- * Performs the max age SSP edge-case test on the update_element_mass function
+ * Performs the max age SSP edge-case test on the update_element_masses function
  * in the parent directory by ensuring that each element's mass is nonzero.
  *
  * Parameters
@@ -46,7 +46,7 @@ extern unsigned short quiescence_test_update_element_mass(SINGLEZONE *sz) {
  *
  * header: element.h
  */
-extern unsigned short max_age_ssp_test_update_element_mass(SINGLEZONE *sz) {
+extern unsigned short max_age_ssp_test_update_element_masses(SINGLEZONE *sz) {
 
 	unsigned short i, status = 1u;
 	for (i = 0u; i < (*sz).n_elements; i++) {
@@ -59,8 +59,8 @@ extern unsigned short max_age_ssp_test_update_element_mass(SINGLEZONE *sz) {
 
 
 /*
- * Performs the zero age SSP edge-case test on the update_element_mass function
- * in the parent directory.
+ * Performs the zero age SSP edge-case test on the update_element_masses
+ * function in the parent directory.
  *
  * Parameters
  * ==========
@@ -72,10 +72,10 @@ extern unsigned short max_age_ssp_test_update_element_mass(SINGLEZONE *sz) {
  *
  * header: element.h
  */
-extern unsigned short zero_age_ssp_test_update_element_mass(SINGLEZONE *sz) {
+extern unsigned short zero_age_ssp_test_update_element_masses(SINGLEZONE *sz) {
 
 	/* The same criteria as the max age test */
-	return max_age_ssp_test_update_element_mass(sz);
+	return max_age_ssp_test_update_element_masses(sz);
 
 }
 
@@ -7,7 +7,7 @@ extern "C" {
 #endif /* __cplusplus */
 
 /*
- * Implements the quiescence test on the update_element_mass function in the
+ * Implements the quiescence test on the update_element_masses function in the
  * parent directory by ensuring that each element's mass is equal to zero.
  *
  * Parameters
@@ -20,10 +20,10 @@ extern "C" {
  *
  * source: element.c
  */
-extern unsigned short quiescence_test_update_element_mass(SINGLEZONE *sz);
+extern unsigned short quiescence_test_update_element_masses(SINGLEZONE *sz);
 
 /*
- * Performs the max age SSP edge-case test on the update_element_mass function
+ * Performs the max age SSP edge-case test on the update_element_masses function
  * in the parent directory by ensuring that each element's mass is nonzero.
  *
  * Parameters
@@ -36,11 +36,11 @@ extern unsigned short quiescence_test_update_element_mass(SINGLEZONE *sz);
  *
  * source: element.c
  */
-extern unsigned short max_age_ssp_test_update_element_mass(SINGLEZONE *sz);
+extern unsigned short max_age_ssp_test_update_element_masses(SINGLEZONE *sz);
 
 /*
- * Performs the zero age SSP edge-case test on the update_element_mass function
- * in the parent directory.
+ * Performs the zero age SSP edge-case test on the update_element_masses
+ * function in the parent directory.
  *
  * Parameters
  * ==========
@@ -52,7 +52,7 @@ extern unsigned short max_age_ssp_test_update_element_mass(SINGLEZONE *sz);
  *
  * source: element.c
  */
-extern unsigned short zero_age_ssp_test_update_element_mass(SINGLEZONE *sz);
+extern unsigned short zero_age_ssp_test_update_element_masses(SINGLEZONE *sz);
 
 /*
  * Implements the quiescence test on the onH function in the parent directory
@@ -86,7 +86,7 @@ extern unsigned short zero_age_ssp_test_mass_recycled(SINGLEZONE *sz) {
 	for (i = 0u; i < (*sz).n_elements; i++) {
 		double recycled = (
 			(*(*sz).ism).star_formation_rate * (*sz).dt *
-			(*(*sz).elements[i]).Z[(*sz).timestep] *
+			(*(*sz).state).Z[(*sz).timestep * (*sz).n_elements + i] *
 			(*(*sz).ssp).crf[1]
 		);
 		double percent_difference = absval(
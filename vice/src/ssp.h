@@ -22,11 +22,11 @@ extern "C" {
 #endif /* SSP_TOLERANCE */
 
 /*
- * Hash-code for simpson's rule
+ * Hash-code for adaptive gauss-kronrod quadrature
  * User modification strongly discouraged
  */
 #ifndef SSP_METHOD
-#define SSP_METHOD 777
+#define SSP_METHOD 1314
 #endif /* SSP_METHOD */
 
 /*
@@ -47,6 +47,7 @@ extern "C" {
 
 #include "objects.h"
 #include "objects/ssp.h"
+#include "ssp/cache.h"
 #include "ssp/crf.h"
 #include "ssp/mlr.h"
 #include "ssp/msmf.h"
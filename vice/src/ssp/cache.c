@@ -0,0 +1,364 @@
+/*
+ * This file implements a cache of the cumulative return fraction and main
+ * sequence mass fraction tables computed for singlezone simulations. Zones of
+ * a multizone model, members of an ensemble, and repeated simulations in one
+ * process which have the same IMF, mass range, post main sequence lifetime,
+ * mass-lifetime relation, and timestep size share a single table.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include "../ssp.h"
+#include "../singlezone.h"
+#include "../imf.h"
+#include "../utils.h"
+#include "cache.h"
+
+typedef struct ssp_table {
+
+	/*
+	 * One entry in the cache, along with the parameters it was computed
+	 * under. Entries are stored in a linked list ordered from most to least
+	 * recently acquired.
+	 *
+	 * spec: The IMF specifier
+	 * m_lower: The lower mass limit on star formation in Msun
+	 * m_upper: The upper mass limit on star formation in Msun
+	 * imf_samples: The value of a custom IMF at SSP_CACHE_IMF_SAMPLES
+	 * 		logarithmically spaced masses. NULL for built-in IMFs.
+	 * postMS: The ratio of a star's post main sequence lifetime to its main
+	 * 		sequence lifetime
+	 * mlr: The hashcode of the mass-lifetime relation
+	 * dt: The timestep size in Gyr
+	 * n: The number of timesteps the tables extend to
+	 * crf: The cumulative return fraction at each timestep
+	 * msmf: The main sequence mass fraction at each timestep
+	 * references: The number of singlezone objects using the tables
+	 * next: The next entry in the cache
+	 */
+
+	char *spec;
+	double m_lower;
+	double m_upper;
+	double *imf_samples;
+	double postMS;
+	unsigned short mlr;
+	double dt;
+	unsigned long n;
+	double *crf;
+	double *msmf;
+	unsigned long references;
+	struct ssp_table *next;
+
+} SSP_TABLE;
+
+/* ---------- Static function comment headers not duplicated here ---------- */
+static double *sample_custom_imf(IMF_ imf);
+static unsigned short table_matches(SSP_TABLE table, SINGLEZONE sz,
+	double *imf_samples);
+static SSP_TABLE *table_initialize(SINGLEZONE *sz, double *imf_samples);
+static void table_free(SSP_TABLE *table);
+static void table_release(SINGLEZONE *sz);
+static void evict_unused_tables(void);
+
+/* The most recently acquired table, NULL if there are none */
+static SSP_TABLE *CACHE = NULL;
+
+/* Serializes access to the cache between threads */
+static pthread_mutex_t CACHE_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+
+/*
+ * Point a singlezone object to the cumulative return fraction and main
+ * sequence mass fraction for its IMF, mass range, post main sequence
+ * lifetime, timestep size, and number of timesteps, computing them only if
+ * no other singlezone object has already done so.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to setup the tables within
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: cache.h
+ */
+extern unsigned short acquire_SSP_tables(SINGLEZONE *sz) {
+
+	/*
+	 * Tables are computed while the cache is locked. setup_CRF and
+	 * setup_MSMF are not safe to call from multiple threads at once in the
+	 * case of custom IMFs anyway.
+	 */
+	pthread_mutex_lock(&CACHE_LOCK);
+	table_release(sz); /* in case the tables were already acquired */
+	double *imf_samples = sample_custom_imf(*(*(*sz).ssp).imf);
+	SSP_TABLE **previous = &CACHE;
+	SSP_TABLE *table = CACHE;
+	while (table != NULL && !table_matches(*table, *sz, imf_samples)) {
+		previous = &(table -> next);
+		table = (*table).next;
+	}
+
+	if (table != NULL) {
+		/* Take it out of the list here; it goes back in at the front */
+		*previous = (*table).next;
+		free(imf_samples);
+	} else {
+		table = table_initialize(sz, imf_samples);
+	}
+
+	unsigned short x;
+	if (table != NULL) {
+		table -> next = CACHE;
+		CACHE = table;
+		table -> references++;
+		sz -> ssp -> crf = (*table).crf;
+		sz -> ssp -> msmf = (*table).msmf;
+		sz -> ssp -> cached = 1u;
+		x = 0u;
+	} else {
+		x = 1u;
+	}
+	pthread_mutex_unlock(&CACHE_LOCK);
+	return x;
+
+}
+
+
+/*
+ * Give back the cumulative return fraction and main sequence mass fraction
+ * tables acquired by a singlezone object. Tables which are no longer in use
+ * are kept for subsequent simulations, up to SSP_CACHE_SIZE of them.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to release the tables from
+ *
+ * header: cache.h
+ */
+extern void release_SSP_tables(SINGLEZONE *sz) {
+
+	pthread_mutex_lock(&CACHE_LOCK);
+	table_release(sz);
+	pthread_mutex_unlock(&CACHE_LOCK);
+
+}
+
+
+/*
+ * Free every cumulative return fraction and main sequence mass fraction
+ * table which is no longer in use by any singlezone object.
+ *
+ * header: cache.h
+ */
+extern void clear_SSP_table_cache(void) {
+
+	pthread_mutex_lock(&CACHE_LOCK);
+	SSP_TABLE **previous = &CACHE;
+	while (*previous != NULL) {
+		SSP_TABLE *table = *previous;
+		if ((*table).references) {
+			previous = &(table -> next);
+		} else {
+			*previous = (*table).next;
+			table_free(table);
+		}
+	}
+	pthread_mutex_unlock(&CACHE_LOCK);
+
+}
+
+
+/*
+ * Evaluate a custom IMF at logarithmically spaced masses across the mass
+ * range of star formation.
+ *
+ * Parameters
+ * ==========
+ * imf: 	The IMF_ object to sample
+ *
+ * Returns
+ * =======
+ * The values of the IMF at SSP_CACHE_IMF_SAMPLES masses from m_lower to
+ * m_upper, inclusive. NULL if the IMF is not custom.
+ */
+static double *sample_custom_imf(IMF_ imf) {
+
+	if (checksum(imf.spec) != CUSTOM) return NULL;
+	unsigned short i;
+	double *samples = (double *) malloc (SSP_CACHE_IMF_SAMPLES *
+		sizeof(double));
+	for (i = 0u; i < SSP_CACHE_IMF_SAMPLES; i++) {
+		samples[i] = imf_evaluate(imf, imf.m_lower * pow(
+			imf.m_upper / imf.m_lower,
+			(double) i / (SSP_CACHE_IMF_SAMPLES - 1u)));
+	}
+	return samples;
+
+}
+
+
+/*
+ * Determine whether or not a table in the cache can be used by a singlezone
+ * object.
+ *
+ * Parameters
+ * ==========
+ * table: 			The entry in the cache
+ * sz: 				The singlezone object
+ * imf_samples: 	The singlezone object's custom IMF sampled by
+ * 					sample_custom_imf. NULL for built-in IMFs.
+ *
+ * Returns
+ * =======
+ * 1 if the parameters the table was computed under are the same as the
+ * singlezone object's and the table extends to at least as many timesteps,
+ * 0 otherwise.
+ */
+static unsigned short table_matches(SSP_TABLE table, SINGLEZONE sz,
+	double *imf_samples) {
+
+	IMF_ imf = *(*sz.ssp).imf;
+	if (table.dt != sz.dt ||
+		table.n < n_timesteps(sz) ||
+		table.postMS != (*sz.ssp).postMS ||
+		table.mlr != (*sz.ctx).mlr ||
+		table.m_lower != imf.m_lower ||
+		table.m_upper != imf.m_upper ||
+		strcmp(table.spec, imf.spec)) return 0u;
+	if (imf_samples != NULL) {
+		unsigned short i;
+		for (i = 0u; i < SSP_CACHE_IMF_SAMPLES; i++) {
+			if (table.imf_samples[i] != imf_samples[i]) return 0u;
+		}
+	} else {}
+	return 1u;
+
+}
+
+
+/*
+ * Compute the cumulative return fraction and main sequence mass fraction for
+ * a singlezone object and store them in a new entry for the cache.
+ *
+ * Parameters
+ * ==========
+ * sz: 				A pointer to the singlezone object
+ * imf_samples: 	The singlezone object's custom IMF sampled by
+ * 					sample_custom_imf. NULL for built-in IMFs. The new entry
+ * 					takes ownership of this array.
+ *
+ * Returns
+ * =======
+ * A pointer to the new entry, which is not yet in the cache and has no
+ * references. NULL on failure.
+ */
+static SSP_TABLE *table_initialize(SINGLEZONE *sz, double *imf_samples) {
+
+	SSP_TABLE *table = (SSP_TABLE *) malloc (sizeof(SSP_TABLE));
+	table -> spec = (char *) malloc (SPEC_CHARP_SIZE * sizeof(char));
+	strcpy(table -> spec, (*(*(*sz).ssp).imf).spec);
+	table -> m_lower = (*(*(*sz).ssp).imf).m_lower;
+	table -> m_upper = (*(*(*sz).ssp).imf).m_upper;
+	table -> imf_samples = imf_samples;
+	table -> postMS = (*(*sz).ssp).postMS;
+	table -> mlr = (*(*sz).ctx).mlr;
+	table -> dt = (*sz).dt;
+	table -> n = n_timesteps(*sz);
+	table -> references = 0ul;
+	table -> next = NULL;
+
+	sz -> ssp -> crf = NULL;
+	sz -> ssp -> msmf = NULL;
+	unsigned short x = setup_CRF(sz) || setup_MSMF(sz);
+	table -> crf = (*(*sz).ssp).crf;
+	table -> msmf = (*(*sz).ssp).msmf;
+	sz -> ssp -> crf = NULL;
+	sz -> ssp -> msmf = NULL;
+	if (x) {
+		table_free(table);
+		return NULL;
+	} else {
+		return table;
+	}
+
+}
+
+
+/*
+ * Free up the memory stored in an entry of the cache.
+ *
+ * Parameters
+ * ==========
+ * table: 		The entry to free, which must already be out of the cache
+ */
+static void table_free(SSP_TABLE *table) {
+
+	free(table -> spec);
+	free(table -> imf_samples);
+	free(table -> crf);
+	free(table -> msmf);
+	free(table);
+
+}
+
+
+/*
+ * Give back the tables held by a singlezone object, freeing them if they did
+ * not come from a cache. Must be called with the cache locked.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to release the tables from
+ */
+static void table_release(SINGLEZONE *sz) {
+
+	if ((*(*sz).ssp).crf == NULL && (*(*sz).ssp).msmf == NULL) return;
+	SSP_TABLE *table = CACHE;
+	while (table != NULL && (*table).crf != (*(*sz).ssp).crf) {
+		table = (*table).next;
+	}
+	if (table != NULL) {
+		table -> references--;
+		evict_unused_tables();
+	} else if (!(*(*sz).ssp).cached) {
+		free(sz -> ssp -> crf);
+		free(sz -> ssp -> msmf);
+	} else {
+		/*
+		 * Acquired from the copy of this cache compiled into another
+		 * extension, which still owns them.
+		 */
+	}
+	sz -> ssp -> crf = NULL;
+	sz -> ssp -> msmf = NULL;
+	sz -> ssp -> cached = 0u;
+
+}
+
+
+/*
+ * Free the least recently acquired tables which are no longer in use, such
+ * that at most SSP_CACHE_SIZE of them remain in the cache. Must be called
+ * with the cache locked.
+ */
+static void evict_unused_tables(void) {
+
+	unsigned long n_unused = 0ul;
+	SSP_TABLE **previous = &CACHE;
+	while (*previous != NULL) {
+		SSP_TABLE *table = *previous;
+		if (!(*table).references && ++n_unused > SSP_CACHE_SIZE) {
+			*previous = (*table).next;
+			table_free(table);
+		} else {
+			previous = &(table -> next);
+		}
+	}
+
+}
+
@@ -0,0 +1,86 @@
+
+#ifndef SSP_CACHE_H
+#define SSP_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * The number of cumulative return fraction and main sequence mass fraction
+ * tables which are kept in memory once no simulation is using them
+ */
+#ifndef SSP_CACHE_SIZE
+#define SSP_CACHE_SIZE 16u
+#endif /* SSP_CACHE_SIZE */
+
+/*
+ * The number of stellar masses at which custom IMFs are sampled to determine
+ * whether or not two of them are the same
+ */
+#ifndef SSP_CACHE_IMF_SAMPLES
+#define SSP_CACHE_IMF_SAMPLES 100u
+#endif /* SSP_CACHE_IMF_SAMPLES */
+
+#include "../objects.h"
+
+/*
+ * Point a singlezone object to the cumulative return fraction and main
+ * sequence mass fraction for its IMF, mass range, post main sequence
+ * lifetime, timestep size, and number of timesteps, computing them only if
+ * no other singlezone object has already done so.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to setup the tables within
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * Notes
+ * =====
+ * The tables are shared between every singlezone object which acquires them,
+ * and must be given back with release_SSP_tables rather than freed. They
+ * also depend on the mass-lifetime relation of the singlezone object's
+ * context, which is taken into account. Custom IMFs are compared by their values at SSP_CACHE_IMF_SAMPLES
+ * logarithmically spaced stellar masses, such that the same function
+ * assigned to many zones is integrated only once.
+ *
+ * source: cache.c
+ */
+extern unsigned short acquire_SSP_tables(SINGLEZONE *sz);
+
+/*
+ * Give back the cumulative return fraction and main sequence mass fraction
+ * tables acquired by a singlezone object. Tables which are no longer in use
+ * are kept for subsequent simulations, up to SSP_CACHE_SIZE of them.
+ *
+ * Parameters
+ * ==========
+ * sz: 		A pointer to the singlezone object to release the tables from
+ *
+ * Notes
+ * =====
+ * Tables which did not come from acquire_SSP_tables are freed. Each
+ * extension compiles its own copy of this cache, and tables acquired through
+ * another extension's copy are left to it.
+ *
+ * source: cache.c
+ */
+extern void release_SSP_tables(SINGLEZONE *sz);
+
+/*
+ * Free every cumulative return fraction and main sequence mass fraction
+ * table which is no longer in use by any singlezone object.
+ *
+ * source: cache.c
+ */
+extern void clear_SSP_table_cache(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SSP_CACHE_H */
+
@@ -14,16 +14,15 @@
 #include "mlr.h"
 
 /* ---------- static function comment headers not duplicated here ---------- */
-static double CRFdenominator_integrand(double m);
-static double CRFnumerator_integrand(double m);
-static double CRFnumerator_Kalirai08(SSP ssp, double time);
+static double CRFdenominator_integrand(double m, void *imf);
+static double CRFnumerator_integrand(double m, void *imf);
+static double CRFnumerator_Kalirai08(SSP ssp, double time, CONTEXT *ctx);
 static double CRFnumerator_Kalirai08_IMFrange(double m_upper,
 	double turnoff_mass, double m_lower, double a);
 static double CRFnumerator_Kalirai08_above_8Msun(double m_upper,
 	double turnoff_mass, double a);
 static double CRFnumerator_Kalirai08_below_8Msun(double m_upper,
 	double turnoff_mass, double a);
-static IMF_ *ADOPTED_IMF = NULL;
 
 /*
  * Determine the cumulative return fraction from a single stellar population
@@ -34,6 +33,7 @@ static IMF_ *ADOPTED_IMF = NULL;
  * ssp: 		An SSP struct containing information on the stallar IMF and
  * 				the mass range of star formation
  * time: 		The age of the stellar population in Gyr
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -42,9 +42,9 @@ static IMF_ *ADOPTED_IMF = NULL;
  *
  * header: ssp.h
  */
-extern double CRF(SSP ssp, double time) {
+extern double CRF(SSP ssp, double time, CONTEXT *ctx) {
 
-	double numerator = CRFnumerator_Kalirai08(ssp, time);
+	double numerator = CRFnumerator_Kalirai08(ssp, time, ctx);
 	if (numerator < 0) {
 		/* numerator will be -1 in the case of an unrecognized IMF */
 		return -1;
@@ -90,7 +90,7 @@ extern unsigned short setup_CRF(SINGLEZONE *sz) {
 		sz -> ssp -> crf = (double *) malloc (n * sizeof(double));
 		for (i = 0l; i < n; i++) {
 			sz -> ssp -> crf[i] = CRFnumerator_Kalirai08(
-				(*(*sz).ssp), i * (*sz).dt) / denominator;
+				(*(*sz).ssp), i * (*sz).dt, (*sz).ctx) / denominator;
 		}
 		return 0u;
 
@@ -105,6 +105,7 @@ extern unsigned short setup_CRF(SINGLEZONE *sz) {
  * Parameters
  * ==========
  * m: 		The initial stellar mass in Msun
+ * imf: 	A pointer to the adopted IMF_ object
  *
  * Returns
  * =======
@@ -115,9 +116,9 @@ extern unsigned short setup_CRF(SINGLEZONE *sz) {
  * ========
  * Section 2.2 of Science Documentation: The Cumulative Return Fraction
  */
-static double CRFnumerator_integrand(double m) {
+static double CRFnumerator_integrand(double m, void *imf) {
 
-	return (m - Kalirai08_remnant_mass(m)) * imf_evaluate(*ADOPTED_IMF, m);
+	return (m - Kalirai08_remnant_mass(m)) * imf_evaluate(*((IMF_ *) imf), m);
 
 }
 
@@ -128,6 +129,7 @@ static double CRFnumerator_integrand(double m) {
  * Parameters
  * ==========
  * m: 		The initial stellar mass in Msun
+ * imf: 	A pointer to the adopted IMF_ object
  *
  * Returns
  * =======
@@ -137,9 +139,9 @@ static double CRFnumerator_integrand(double m) {
  * ========
  * Section 2.2 of Science Documentation: The Cumulative Return Fraction
  */
-static double CRFdenominator_integrand(double m) {
+static double CRFdenominator_integrand(double m, void *imf) {
 
-	return m * imf_evaluate(*ADOPTED_IMF, m);
+	return m * imf_evaluate(*((IMF_ *) imf), m);
 
 }
 
@@ -159,6 +161,7 @@ static double CRFdenominator_integrand(double m) {
  * 				the mass range of star formation
  * time: 		The time in Gyr following the single stellar population's
  * 				formation.
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -183,9 +186,9 @@ static double CRFdenominator_integrand(double m) {
  * Kalirai et al. (2008), ApJ, 676, 594
  * Kroupa (2001), MNRAS, 322, 231
  */
-static double CRFnumerator_Kalirai08(SSP ssp, double t) {
+static double CRFnumerator_Kalirai08(SSP ssp, double t, CONTEXT *ctx) {
 
-	double turnoff_mass = dying_star_mass(t, ssp.postMS, 0.014);
+	double turnoff_mass = dying_star_mass(t, ssp.postMS, 0.014, ctx);
 	if (turnoff_mass > (*ssp.imf).m_upper) return 0;
 	switch (checksum((*ssp.imf).spec)) {
 
@@ -245,9 +248,9 @@ static double CRFnumerator_Kalirai08(SSP ssp, double t) {
 
 		case CUSTOM:
 			/* custom IMF -> no assumptions made, must integrate numerically */
-			ADOPTED_IMF = ssp.imf;
 			INTEGRAL *numerator = integral_initialize();
 			numerator -> func = &CRFnumerator_integrand;
+			numerator -> params = ssp.imf;
 			numerator -> a = turnoff_mass;
 			numerator -> b = (*ssp.imf).m_upper;
 			/* default values for these parameters */
@@ -258,7 +261,6 @@ static double CRFnumerator_Kalirai08(SSP ssp, double t) {
 			quad(numerator);
 			double x = (*numerator).result;
 			integral_free(numerator);
-			ADOPTED_IMF = NULL;
 			return x;
 
 		default:
@@ -467,9 +469,9 @@ extern double CRFdenominator(SSP ssp) {
 
 		case CUSTOM:
 			/* custom IMF -> no assumptions made, must integrate numerically */
-			ADOPTED_IMF = ssp.imf;
 			INTEGRAL *denominator = integral_initialize();
 			denominator -> func = &CRFdenominator_integrand;
+			denominator -> params = ssp.imf;
 			denominator -> a = (*ssp.imf).m_lower;
 			denominator -> b = (*ssp.imf).m_upper;
 			/* default values for these properties */
@@ -480,7 +482,6 @@ extern double CRFdenominator(SSP ssp) {
 			quad(denominator);
 			double x = (*denominator).result;
 			integral_free(denominator);
-			ADOPTED_IMF = NULL;
 			return x;
 
 		default:
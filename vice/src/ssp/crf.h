@@ -17,6 +17,7 @@ extern "C" {
  * ssp: 		An SSP struct containing information on the stallar IMF and
  * 				the mass range of star formation
  * time: 		The age of the stellar population in Gyr
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -25,7 +26,7 @@ extern "C" {
  *
  * source: ssp.c
  */
-extern double CRF(SSP spp, double time);
+extern double CRF(SSP spp, double time, CONTEXT *ctx);
 
 /*
  * Evaluate the cumulative return fraction across all timesteps in preparation
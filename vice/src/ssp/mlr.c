@@ -8,12 +8,10 @@
 #include "../ssp.h"
 #include "mlr.h"
 
-/* The hash-code for the current MLR setting: default is Larson (1974) */
-static unsigned short MLR_SETTING = LARSON1974;
 
 /*
  * Determine the mass of dying stars from a single stellar population of known
- * age under the current mass-lifetime relationship setting.
+ * age under the mass-lifetime relationship setting of a context.
  *
  * Parameters
  * ==========
@@ -21,6 +19,8 @@ static unsigned short MLR_SETTING = LARSON1974;
  * postMS: 			The ratio of a star's post main sequence lifetime to its
  * 					main sequence lifetime. Zero for main sequence turnoff mass.
  * Z: 				The metallicity by mass of the stellar population.
+ * ctx: 			The context holding the mass-lifetime relationship setting
+ * 					and any data it requires.
  *
  * Returns
  * =======
@@ -37,16 +37,17 @@ static unsigned short MLR_SETTING = LARSON1974;
  *
  * header: mlr.h
  */
-extern double dying_star_mass(double time, double postMS, double Z) {
+extern double dying_star_mass(double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	/*
 	 * Simply construct a function pointer to the current MLR setting and call
 	 * it directly.
 	 */
 
-	double (*mlr)(double, double, double);
+	double (*mlr)(double, double, double, CONTEXT *);
 
-	switch (MLR_SETTING) {
+	switch ((*ctx).mlr) {
 
 		case POWERLAW:
 			mlr = &powerlaw_turnoffmass;
@@ -86,30 +87,18 @@ extern double dying_star_mass(double time, double postMS, double Z) {
 
 	}
 
-	return mlr(time, postMS, Z);
+	return mlr(time, postMS, Z, ctx);
 
 }
 
 
 /*
- * Get the hashcode of the current mass-lifetime relationship setting. Their
- * values are #define'd in ./vice/src/ssp/mlr.h.
- *
- * header: mlr.h
- */
-extern unsigned short get_mlr_hashcode(void) {
-
-	return MLR_SETTING;
-
-}
-
-
-/*
- * Set the global mass-lifetime relationship setting via the hashcodes
+ * Set the mass-lifetime relationship setting of a context via the hashcodes
  * attached to each of them #define'd in ./vice/src/ssp/mlr.h.
  *
  * Parameters
  * ==========
+ * ctx: 			The context to set the mass-lifetime relationship within
  * hashcode: 		The hashcode corresponding to the desired MLR. See header
  * 					file for allowed values.
  *
@@ -119,12 +108,13 @@ extern unsigned short get_mlr_hashcode(void) {
  *
  * header: mlr.h
  */
-extern unsigned short set_mlr_hashcode(unsigned short hashcode) {
+extern unsigned short set_mlr_hashcode(CONTEXT *ctx,
+	unsigned short hashcode) {
 
 	if (hashcode == POWERLAW || hashcode == VINCENZO2016 ||
 		hashcode == HPT2000 || hashcode == KA1997 || hashcode == PM1993 ||
 		hashcode == MM1989 || hashcode == LARSON1974) {
-		MLR_SETTING = hashcode;
+		ctx -> mlr = hashcode;
 		return 0u;
 	} else {
 		return 1u; /* unrecognized MLR -> ValueError in Python */
@@ -132,3 +122,59 @@ extern unsigned short set_mlr_hashcode(unsigned short hashcode) {
 
 }
 
+
+/*
+ * Import the data required by the mass-lifetime relationship setting of a
+ * context, if it requires any.
+ *
+ * Parameters
+ * ==========
+ * ctx: 			The context to import the data into
+ * filename: 		The full path to the file holding the data.
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on failure
+ *
+ * header: mlr.h
+ */
+extern unsigned short import_mlr_data(CONTEXT *ctx, char *filename) {
+
+	switch ((*ctx).mlr) {
+
+		case VINCENZO2016:
+			return vincenzo2016_import(ctx, filename);
+
+		case HPT2000:
+			return hpt2000_import(ctx, filename);
+
+		case KA1997:
+			return ka1997_import(ctx, filename);
+
+		default:
+			/* no data required */
+			return 0u;
+
+	}
+
+}
+
+
+/*
+ * Free up the memory stored by the data imported into a context for its
+ * mass-lifetime relationship setting, if any.
+ *
+ * Parameters
+ * ==========
+ * ctx: 			The context holding the data
+ *
+ * header: mlr.h
+ */
+extern void free_mlr_data(CONTEXT *ctx) {
+
+	vincenzo2016_free(ctx);
+	hpt2000_free(ctx);
+	ka1997_free(ctx);
+
+}
+
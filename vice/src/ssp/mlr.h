@@ -53,7 +53,7 @@ extern "C" {
 
 /*
  * Determine the mass of dying stars from a single stellar population of known
- * age under the current mass-lifetime relationship setting.
+ * age under the mass-lifetime relationship setting of a context.
  *
  * Parameters
  * ==========
@@ -61,6 +61,8 @@ extern "C" {
  * postMS: 			The ratio of a star's post main sequence lifetime to its
  * 					main sequence lifetime. Zero for main sequence turnoff mass.
  * Z: 				The metallicity by mass of the stellar population.
+ * ctx: 			The context holding the mass-lifetime relationship setting
+ * 					and any data it requires.
  *
  * Returns
  * =======
@@ -77,32 +79,55 @@ extern "C" {
  *
  * source: mlr.c
  */
-extern double dying_star_mass(double time, double postMS, double Z);
+extern double dying_star_mass(double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
- * Get the hashcode of the current mass-lifetime relationship setting. Their
- * values are #define'd in ./vice/src/ssp/mlr.h.
+ * Set the mass-lifetime relationship setting of a context via the hashcodes
+ * attached to each of them #define'd in ./vice/src/ssp/mlr.h.
+ *
+ * Parameters
+ * ==========
+ * ctx: 			The context to set the mass-lifetime relationship within
+ * hashcode: 		The hashcode corresponding to the desired MLR. See header
+ * 					file for allowed values.
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on an unrecognized hashcode.
  *
  * source: mlr.c
  */
-extern unsigned short get_mlr_hashcode(void);
+extern unsigned short set_mlr_hashcode(CONTEXT *ctx, unsigned short hashcode);
 
 /*
- * Set the global mass-lifetime relationship setting via the hashcodes
- * attached to each of them #define'd in ./vice/src/ssp/mlr.h.
+ * Import the data required by the mass-lifetime relationship setting of a
+ * context, if it requires any.
  *
  * Parameters
  * ==========
- * hashcode: 		The hashcode corresponding to the desired MLR. See header
- * 					file for allowed values.
+ * ctx: 			The context to import the data into
+ * filename: 		The full path to the file holding the data.
  *
  * Returns
  * =======
- * 0 on success, 1 on an unrecognized hashcode.
+ * 0 on success, 1 on failure
+ *
+ * source: mlr.c
+ */
+extern unsigned short import_mlr_data(CONTEXT *ctx, char *filename);
+
+/*
+ * Free up the memory stored by the data imported into a context for its
+ * mass-lifetime relationship setting, if any.
+ *
+ * Parameters
+ * ==========
+ * ctx: 			The context holding the data
  *
  * source: mlr.c
  */
-extern unsigned short set_mlr_hashcode(unsigned short hashcode);
+extern void free_mlr_data(CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
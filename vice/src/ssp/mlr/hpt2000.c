@@ -29,15 +29,17 @@
 
 /* ---------- static function comment headers not duplicated here ---------- */
 static double hpt2000_x(double Z);
-static double hpt2000_mu(double mass, double Z);
-static double a_n(unsigned short n, double Z);
+static double hpt2000_mu(double mass, double Z, CONTEXT *ctx);
+static double a_n(unsigned short n, double Z, CONTEXT *ctx);
 static double zeta(double Z);
 
 /* The metallicity of the sun as in Hurley, Pols & Tout (2000) */
 static const double Z_SOLAR = 0.02;
-static double **HPT2000TABLE = NULL;
 static const unsigned short HPT2000TABLE_DIMENSION = 4u;
 
+/* The number of coefficients a_n tabulated in hpt2000.dat */
+static const unsigned short HPT2000_N_COEFFICIENTS = 10u;
+
 
 /*
  * Compute the mass of dying stars in a star cluster of known age according to
@@ -49,6 +51,8 @@ static const unsigned short HPT2000TABLE_DIMENSION = 4u;
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Hurley, Pols & Tout (2000) data
+ * 				has been imported.
  *
  * Notes
  * =====
@@ -67,11 +71,12 @@ static const unsigned short HPT2000TABLE_DIMENSION = 4u;
  *
  * header: hpt2000.h
  */
-extern double hpt2000_turnoffmass(double time, double postMS, double Z) {
+extern double hpt2000_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (time > 0) {
 		return bisection(&hpt2000_lifetime, BISECTION_INITIAL_LOWER_BOUND,
-			BISECTION_INITIAL_UPPER_BOUND, time, postMS, Z);
+			BISECTION_INITIAL_UPPER_BOUND, time, postMS, Z, ctx);
 	} else if (time < 0) {
 		/*
 		 * There was an error somewhere. This function shouldn't ever receive a
@@ -108,6 +113,8 @@ extern double hpt2000_turnoffmass(double time, double postMS, double Z) {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Hurley, Pols & Tout (2000) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -115,7 +122,8 @@ extern double hpt2000_turnoffmass(double time, double postMS, double Z) {
  *
  * header: hpt2000.h
  */
-extern double hpt2000_lifetime(double mass, double postMS, double Z) {
+extern double hpt2000_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	/*
 	 * Due to the polynomial dependence of the coefficients a_n on metallicity
@@ -123,17 +131,18 @@ extern double hpt2000_lifetime(double mass, double postMS, double Z) {
 	 * Therefore, as a safeguard, this function enforces a minimum value of
 	 * zeta of -3.
 	 */
-	if (zeta(Z) < -3) return hpt2000_lifetime(mass, postMS, 2.0e-5);
+	if (zeta(Z) < -3) return hpt2000_lifetime(mass, postMS, 2.0e-5, ctx);
 
 	if (mass > 0) {
 
 		/* Analytic form -> see file header */
-		double coeff = fmax(hpt2000_mu(mass, Z), hpt2000_x(Z));
+		double coeff = fmax(hpt2000_mu(mass, Z, ctx), hpt2000_x(Z));
 		double tbgb = (
-			a_n(1, Z) + a_n(2, Z) * pow(mass, 4) + a_n(3, Z) * pow(mass, 5.5) +
+			a_n(1, Z, ctx) + a_n(2, Z, ctx) * pow(mass, 4) +
+			a_n(3, Z, ctx) * pow(mass, 5.5) +
 			pow(mass, 7)
 		) / (
-			a_n(4, Z) * pow(mass, 2) + a_n(5, Z) * pow(mass, 7)
+			a_n(4, Z, ctx) * pow(mass, 2) + a_n(5, Z, ctx) * pow(mass, 7)
 		);
 		return 1.0e-3 * (1 + postMS) * coeff * tbgb; /* 1e-3: Myr -> Gyr */
 
@@ -187,11 +196,13 @@ static double hpt2000_x(double Z) {
  * Parameters
  * ==========
  * Z: 		The metallicity by mass.
+ * ctx: 	The context holding the Hurley, Pols & Tout (2000) data.
  */
-static double hpt2000_mu(double mass, double Z) {
+static double hpt2000_mu(double mass, double Z, CONTEXT *ctx) {
 
-	return fmax(0.5, 1.0 - 0.01 * fmax(a_n(6, Z) / pow(mass, a_n(7, Z)),
-		a_n(8, Z) + a_n(9, Z) / pow(mass, a_n(10, Z))));
+	return fmax(0.5, 1.0 - 0.01 * fmax(
+		a_n(6, Z, ctx) / pow(mass, a_n(7, Z, ctx)),
+		a_n(8, Z, ctx) + a_n(9, Z, ctx) / pow(mass, a_n(10, Z, ctx))));
 
 }
 
@@ -203,14 +214,14 @@ static double hpt2000_mu(double mass, double Z) {
  * a_n = \alpha + \beta * \zeta + \gamma * \zeta^2 + \eta * \zeta^3
  *
  * where the values of \alpha, \beta, \gamma, and \delta are given in the file
- * hpt2000.dat in this directory.
+ * hpt2000.dat in this directory and imported into the context ctx.
  */
-static double a_n(unsigned short n, double Z) {
+static double a_n(unsigned short n, double Z, CONTEXT *ctx) {
 
 	double a = 0, zeta_ = zeta(Z);
 	unsigned short i;
 	for (i = 0u; i < HPT2000TABLE_DIMENSION; i++) {
-		a += HPT2000TABLE[n - 1][i] * pow(zeta_, i);
+		a += (*ctx).hpt2000[n - 1][i] * pow(zeta_, i);
 	}
 	return a;
 
@@ -241,12 +252,13 @@ static double zeta(double Z) {
 
 
 /*
- * Import the Hurley, Pols & Tout (2000) data. This function must be called
- * from python before hpt2000_lifetime or hpt2000_turnoffmass can be called,
- * otherwise a segmentation fault will occur.
+ * Import the Hurley, Pols & Tout (2000) data into a context. This function
+ * must be called from python before hpt2000_lifetime or hpt2000_turnoffmass
+ * can be called with that context, otherwise a segmentation fault will occur.
  *
  * Parameters
  * ==========
+ * ctx: 		The context to import the data into
  * filename: 	The full path to the file holding the data.
  *
  * Returns
@@ -255,16 +267,22 @@ static double zeta(double Z) {
  *
  * header: hpt2000.h
  */
-extern unsigned short hpt2000_import(char *filename) {
+extern unsigned short hpt2000_import(CONTEXT *ctx, char *filename) {
 
-	HPT2000TABLE = read_square_ascii_file(filename);
-	return HPT2000TABLE == NULL;
+	hpt2000_free(ctx); /* in case it's already been imported */
+	ctx -> hpt2000 = read_square_ascii_file(filename);
+	return (*ctx).hpt2000 == NULL;
 
 }
 
 
 /*
- * Free up the memory stored by the Hurley, Pols & Tout (2000) data.
+ * Free up the memory stored by the Hurley, Pols & Tout (2000) data in a
+ * context.
+ *
+ * Parameters
+ * ==========
+ * ctx: 		The context holding the data
  *
  * References
  * ==========
@@ -272,10 +290,16 @@ extern unsigned short hpt2000_import(char *filename) {
  *
  * header: hpt2000.h
  */
-extern void hpt2000_free(void) {
-
-	free(HPT2000TABLE);
-	HPT2000TABLE = NULL;
+extern void hpt2000_free(CONTEXT *ctx) {
+
+	if ((*ctx).hpt2000 != NULL) {
+		unsigned short i;
+		for (i = 0u; i < HPT2000_N_COEFFICIENTS; i++) {
+			free(ctx -> hpt2000[i]);
+		}
+		free(ctx -> hpt2000);
+		ctx -> hpt2000 = NULL;
+	} else {}
 
 }
 
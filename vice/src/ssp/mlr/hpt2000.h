@@ -18,6 +18,8 @@ extern "C" {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Hurley, Pols & Tout (2000) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -36,7 +38,8 @@ extern "C" {
  *
  * source: hpt2000.c
  */
-extern double hpt2000_turnoffmass(double time, double postMS, double Z);
+extern double hpt2000_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Compute the lifetime of a star of known mass according to the formalism
@@ -48,6 +51,8 @@ extern double hpt2000_turnoffmass(double time, double postMS, double Z);
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Hurley, Pols & Tout (2000) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -55,15 +60,17 @@ extern double hpt2000_turnoffmass(double time, double postMS, double Z);
  *
  * source: hpt2000.c
  */
-extern double hpt2000_lifetime(double mass, double postMS, double Z);
+extern double hpt2000_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
- * Import the Hurley, Pols & Tout (2000) data. This function must be called
- * from python before hpt2000_lifetime or hpt2000_turnoffmass can be called,
- * otherwise a segmentation fault will occur.
+ * Import the Hurley, Pols & Tout (2000) data into a context. This function
+ * must be called from python before hpt2000_lifetime or hpt2000_turnoffmass
+ * can be called with that context, otherwise a segmentation fault will occur.
  *
  * Parameters
  * ==========
+ * ctx: 		The context to import the data into
  * filename: 	The full path to the file holding the data.
  *
  * Returns
@@ -72,10 +79,15 @@ extern double hpt2000_lifetime(double mass, double postMS, double Z);
  *
  * source: hpt2000.c
  */
-extern unsigned short hpt2000_import(char *filename);
+extern unsigned short hpt2000_import(CONTEXT *ctx, char *filename);
 
 /*
- * Free up the memory stored by the Hurley, Pols & Tout (2000) data.
+ * Free up the memory stored by the Hurley, Pols & Tout (2000) data in a
+ * context.
+ *
+ * Parameters
+ * ==========
+ * ctx: 		The context holding the data
  *
  * References
  * ==========
@@ -83,7 +95,7 @@ extern unsigned short hpt2000_import(char *filename);
  *
  * source: hpt2000.c
  */
-extern void hpt2000_free(void);
+extern void hpt2000_free(CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
@@ -18,7 +18,6 @@
 
 static const unsigned short N_MASSES = 41u;
 static const unsigned short N_METALLICITIES = 9u;
-static INTERP_SCHEME_2D *KA1997 = NULL;
 
 
 /*
@@ -31,6 +30,8 @@ static INTERP_SCHEME_2D *KA1997 = NULL;
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Kodama & Arimoto (1997) data
+ * 				has been imported.
  *
  * Notes
  * =====
@@ -56,12 +57,13 @@ static INTERP_SCHEME_2D *KA1997 = NULL;
  *
  * header: ka1997.h
  */
-extern double ka1997_turnoffmass(double time, double postMS, double Z) {
+extern double ka1997_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (time > 0) {
 		/* Enforce postMS = 0 -> see note */
 		return bisection(&ka1997_lifetime, BISECTION_INITIAL_LOWER_BOUND,
-			BISECTION_INITIAL_UPPER_BOUND, time, 0.0, Z);
+			BISECTION_INITIAL_UPPER_BOUND, time, 0.0, Z, ctx);
 	} else if (time < 0) {
 		/*
 		 * There was an error somewhere. This function shouldn't ever receive a
@@ -98,6 +100,8 @@ extern double ka1997_turnoffmass(double time, double postMS, double Z) {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Kodama & Arimoto (1997) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -117,10 +121,11 @@ extern double ka1997_turnoffmass(double time, double postMS, double Z) {
  *
  * header: ka1997.h
  */
-extern double ka1997_lifetime(double mass, double postMS, double Z) {
+extern double ka1997_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (mass > 0) {
-		return interp_scheme_2d_evaluate(*KA1997, Z, mass);
+		return interp_scheme_2d_evaluate(*(*ctx).ka1997, Z, mass);
 	} else if (mass < 0) {
 		/*
 		 * There was an error somewhere. This function shouldn't ever receive a
@@ -149,11 +154,13 @@ extern double ka1997_lifetime(double mass, double postMS, double Z) {
 
 /*
  * Import the Kodama & Arimoto (1997) data into a 2-dimension interpolation
- * scheme. This function must be called from python before ka1997_lifetime or
- * ka1997_turnoffmass can be called, otherwise a segmentation fault will occur.
+ * scheme within a context. This function must be called from python before
+ * ka1997_lifetime or ka1997_turnoffmass can be called with that context,
+ * otherwise a segmentation fault will occur.
  *
  * Parameters
  * ==========
+ * ctx: 		The context to import the data into
  * filename: 	The full path to the file holding the data.
  *
  * Returns
@@ -166,40 +173,46 @@ extern double ka1997_lifetime(double mass, double postMS, double Z) {
  *
  * header: ka1997.h
  */
-extern unsigned short ka1997_import(char *filename) {
+extern unsigned short ka1997_import(CONTEXT *ctx, char *filename) {
 
 	FILE *in = fopen(filename, "r");
 	if (in == NULL) return 1u;
 
-	KA1997 = interp_scheme_2d_initialize();
-	KA1997 -> n_x_values = N_METALLICITIES;
-	KA1997 -> n_y_values = N_MASSES;
+	ka1997_free(ctx); /* in case it's already been imported */
+	INTERP_SCHEME_2D *ka1997 = interp_scheme_2d_initialize();
+	ka1997 -> n_x_values = N_METALLICITIES;
+	ka1997 -> n_y_values = N_MASSES;
 
-	KA1997 -> xcoords = (double *) malloc (N_METALLICITIES * sizeof(double));
-	KA1997 -> ycoords = (double *) malloc (N_MASSES * sizeof(double));
-	KA1997 -> zcoords = (double **) malloc (N_METALLICITIES * sizeof(double));
+	ka1997 -> xcoords = (double *) malloc (N_METALLICITIES * sizeof(double));
+	ka1997 -> ycoords = (double *) malloc (N_MASSES * sizeof(double));
+	ka1997 -> zcoords = (double **) malloc (N_METALLICITIES * sizeof(double));
 
 	unsigned short i, j;
 	for (i = 0u; i < N_METALLICITIES; i++) {
-		KA1997 -> zcoords[i] = (double *) malloc (N_MASSES * sizeof(double));
+		ka1997 -> zcoords[i] = (double *) malloc (N_MASSES * sizeof(double));
 		for (j = 0u; j < N_MASSES; j++) {
 			fscanf(in, "%lf %lf %lf\n",
-				&(KA1997 -> ycoords[j]),
-				&(KA1997 -> xcoords[i]),
-				&(KA1997 -> zcoords[i][j])
+				&(ka1997 -> ycoords[j]),
+				&(ka1997 -> xcoords[i]),
+				&(ka1997 -> zcoords[i][j])
 			);
-			KA1997 -> zcoords[i][j] *= 1.0e-9; /* yr -> Gyr */
+			ka1997 -> zcoords[i][j] *= 1.0e-9; /* yr -> Gyr */
 		}
 	}
 
 	fclose(in);
+	ctx -> ka1997 = ka1997;
 	return 0u;
 
 }
 
 
 /*
- * Free up the memory stored by the Kodama & Arimoto (1997) data.
+ * Free up the memory stored by the Kodama & Arimoto (1997) data in a context.
+ *
+ * Parameters
+ * ==========
+ * ctx: 		The context holding the data
  *
  * References
  * ==========
@@ -207,10 +220,10 @@ extern unsigned short ka1997_import(char *filename) {
  *
  * header: ka1997.h
  */
-extern void ka1997_free(void) {
+extern void ka1997_free(CONTEXT *ctx) {
 
-	interp_scheme_2d_free(KA1997);
-	KA1997 = NULL;
+	interp_scheme_2d_free(ctx -> ka1997);
+	ctx -> ka1997 = NULL;
 
 }
 
@@ -18,6 +18,8 @@ extern "C" {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Kodama & Arimoto (1997) data
+ * 				has been imported.
  *
  * Notes
  * =====
@@ -43,7 +45,8 @@ extern "C" {
  *
  * source: ka1997.c
  */
-extern double ka1997_turnoffmass(double time, double postMS, double Z);
+extern double ka1997_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Compute the lifetime of a star of known mass according to the stellar
@@ -55,6 +58,8 @@ extern double ka1997_turnoffmass(double time, double postMS, double Z);
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Kodama & Arimoto (1997) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -74,15 +79,18 @@ extern double ka1997_turnoffmass(double time, double postMS, double Z);
  *
  * source: ka1997.c
  */
-extern double ka1997_lifetime(double mass, double postMS, double Z);
+extern double ka1997_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Import the Kodama & Arimoto (1997) data into a 2-dimension interpolation
- * scheme. This function must be called from python before ka1997_lifetime or
- * ka1997_turnoffmass can be called, otherwise a segmentation fault will occur.
+ * scheme within a context. This function must be called from python before
+ * ka1997_lifetime or ka1997_turnoffmass can be called with that context,
+ * otherwise a segmentation fault will occur.
  *
  * Parameters
  * ==========
+ * ctx: 		The context to import the data into
  * filename: 	The full path to the file holding the data.
  *
  * Returns
@@ -95,10 +103,14 @@ extern double ka1997_lifetime(double mass, double postMS, double Z);
  *
  * source: ha1997.c
  */
-extern unsigned short ka1997_import(char *filename);
+extern unsigned short ka1997_import(CONTEXT *ctx, char *filename);
 
 /*
- * Free up the memory stored by the Kodama & Arimoto (1997) data.
+ * Free up the memory stored by the Kodama & Arimoto (1997) data in a context.
+ *
+ * Parameters
+ * ==========
+ * ctx: 		The context holding the data
  *
  * References
  * ==========
@@ -106,7 +118,7 @@ extern unsigned short ka1997_import(char *filename);
  *
  * source: ka1997.c
  */
-extern void ka1997_free(void);
+extern void ka1997_free(CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
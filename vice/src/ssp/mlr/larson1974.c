@@ -50,6 +50,8 @@ static const double GAMMA = 0.88;
  * postMS: 		The ratio of the post main sequence lifetime to the main
  * 				sequence lifetime. Zero for main sequence turnoff mass alone.
  * Z: 			The metallicity of the stellar population.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -68,7 +70,8 @@ static const double GAMMA = 0.88;
  *
  * header: larson1974.h
  */
-extern double larson1974_turnoffmass(double time, double postMS, double Z) {
+extern double larson1974_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (time > 0) {
 
@@ -144,6 +147,8 @@ extern double larson1974_turnoffmass(double time, double postMS, double Z) {
  * postMS: 		The ratio of the post main sequence lifetime to the main
  * 				sequence lifetime. Zero for main sequence lifetime alone.
  * Z: 			The metallicity of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -162,7 +167,8 @@ extern double larson1974_turnoffmass(double time, double postMS, double Z) {
  *
  * header: larson1974.h
  */
-extern double larson1974_lifetime(double mass, double postMS, double Z) {
+extern double larson1974_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (mass > 0) {
 
@@ -19,6 +19,8 @@ extern "C" {
  * postMS: 		The ratio of the post main sequence lifetime to the main
  * 				sequence lifetime. Zero for main sequence turnoff mass alone.
  * Z: 			The metallicity of the stellar population.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -37,7 +39,8 @@ extern "C" {
  *
  * source: larson1974.c
  */
-extern double larson1974_turnoffmass(double time, double postMS, double Z);
+extern double larson1974_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Calculate the lifetime of a star of known mass in Gyr according to the
@@ -49,6 +52,8 @@ extern double larson1974_turnoffmass(double time, double postMS, double Z);
  * postMS: 		The ratio of the post main sequence lifetime to the main
  * 				sequence lifetime. Zero for main sequence lifetime alone.
  * Z: 			The metallicity of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -67,7 +72,8 @@ extern double larson1974_turnoffmass(double time, double postMS, double Z);
  *
  * source: larson1974.c
  */
-extern double larson1974_lifetime(double mass, double postMS, double Z);
+extern double larson1974_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
@@ -40,6 +40,8 @@ static double beta(double mass);
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -58,7 +60,8 @@ static double beta(double mass);
  *
  * header: mm1989.h
  */
-extern double mm1989_turnoffmass(double time, double postMS, double Z) {
+extern double mm1989_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (time > 0) {
 		/*
@@ -66,7 +69,7 @@ extern double mm1989_turnoffmass(double time, double postMS, double Z) {
 		 * be easily determined, so we fall back on the numerical root-finder.
 		 */
 		return bisection(&mm1989_lifetime, BISECTION_INITIAL_LOWER_BOUND,
-			BISECTION_INITIAL_UPPER_BOUND, time, postMS, Z);
+			BISECTION_INITIAL_UPPER_BOUND, time, postMS, Z, ctx);
 	} else if (time < 0) {
 		/*
 		 * There was an error somewhere. This function shouldn't ever receive a
@@ -103,6 +106,8 @@ extern double mm1989_turnoffmass(double time, double postMS, double Z) {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -121,7 +126,8 @@ extern double mm1989_turnoffmass(double time, double postMS, double Z) {
  *
  * header: mm1989.h
  */
-extern double mm1989_lifetime(double mass, double postMS, double Z) {
+extern double mm1989_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (mass > 0) {
 		double lifetime;
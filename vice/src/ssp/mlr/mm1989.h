@@ -18,6 +18,8 @@ extern "C" {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -36,7 +38,8 @@ extern "C" {
  *
  * source: mm1989.c
  */
-extern double mm1989_turnoffmass(double time, double postMS, double Z);
+extern double mm1989_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Compute the lifetime of a star of known mass according to the formula from
@@ -48,6 +51,8 @@ extern double mm1989_turnoffmass(double time, double postMS, double Z);
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -66,7 +71,8 @@ extern double mm1989_turnoffmass(double time, double postMS, double Z);
  *
  * source: mm1989.c
  */
-extern double mm1989_lifetime(double mass, double postMS, double Z);
+extern double mm1989_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx);
 
 #ifdef __cpluslpus
 }
@@ -42,6 +42,8 @@ static const double MU = 0.1116;
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -60,7 +62,8 @@ static const double MU = 0.1116;
  *
  * header: pm1993.h
  */
-extern double pm1993_turnoffmass(double time, double postMS, double Z) {
+extern double pm1993_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (time > 0) {
 
@@ -141,6 +144,8 @@ extern double pm1993_turnoffmass(double time, double postMS, double Z) {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -159,7 +164,8 @@ extern double pm1993_turnoffmass(double time, double postMS, double Z) {
  *
  * header: pm1993.h
  */
-extern double pm1993_lifetime(double mass, double postMS, double Z) {
+extern double pm1993_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (mass > 0) {
 		double tau;
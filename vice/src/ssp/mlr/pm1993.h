@@ -6,6 +6,8 @@
 extern "C" {
 #endif /* __cplusplus */
 
+#include "../../objects.h"
+
 /*
  * Compute the mass of dying stars in a star cluster of known age according to
  * the formalism of Padovani & Matteucci (1993).
@@ -16,6 +18,8 @@ extern "C" {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -34,7 +38,8 @@ extern "C" {
  *
  * source: pm1993.c
  */
-extern double pm1993_turnoffmass(double time, double postMS, double Z);
+extern double pm1993_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Compute the lifetime of a star of known mass according to the formalism
@@ -46,6 +51,8 @@ extern double pm1993_turnoffmass(double time, double postMS, double Z);
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -64,7 +71,8 @@ extern double pm1993_turnoffmass(double time, double postMS, double Z);
  *
  * source: pm1993.c
  */
-extern double pm1993_lifetime(double mass, double postMS, double Z);
+extern double pm1993_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
@@ -28,6 +28,8 @@
  * postMS: 		The ratio of star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -55,7 +57,8 @@
  *
  * header: powerlaw.h
  */
-extern double powerlaw_turnoffmass(double time, double postMS, double Z) {
+extern double powerlaw_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (time > 0) {
 		/* analytic solution -> see file header */
@@ -99,6 +102,8 @@ extern double powerlaw_turnoffmass(double time, double postMS, double Z) {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -111,7 +116,8 @@ extern double powerlaw_turnoffmass(double time, double postMS, double Z) {
  *
  * header: powerlaw.h
  */
-extern double powerlaw_lifetime(double mass, double postMS, double Z) {
+extern double powerlaw_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (mass > 0) {
 		/* analytic solution -> see file header */
@@ -18,6 +18,8 @@ extern "C" {
  * postMS: 		The ratio of star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -45,7 +47,8 @@ extern "C" {
  *
  * source: powerlaw.c
  */
-extern double powerlaw_turnoffmass(double time, double postMS, double Z);
+extern double powerlaw_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Compute the lifetime of a star of known mass according to the simple
@@ -57,6 +60,8 @@ extern double powerlaw_turnoffmass(double time, double postMS, double Z);
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence lifetime only.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context of the calculation. Unused by this
+ * 				mass-lifetime relation, which requires no data.
  *
  * Returns
  * =======
@@ -69,7 +74,8 @@ extern double powerlaw_turnoffmass(double time, double postMS, double Z);
  *
  * source: powerlaw.c
  */
-extern double powerlaw_lifetime(double mass, double postMS, double Z);
+extern double powerlaw_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
@@ -30,6 +30,7 @@ static double percent_difference(double actual, double test);
  * 				The second parameter to func.
  * Z: 			The metallicity by mass of the stellar population. The third
  * 				parameter to func.
+ * ctx: 			The context passed along to func
  *
  * Returns
  * =======
@@ -50,8 +51,9 @@ static double percent_difference(double actual, double test);
  *
  * header: root.h
  */
-extern double bisection(double (*func)(double, double, double), double lower,
-	double upper, double time, double postMS, double Z) {
+extern double bisection(double (*func)(double, double, double, CONTEXT *),
+	double lower, double upper, double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	/*
 	 * In the bisection method, you start with an interval enclosing a root
@@ -61,15 +63,16 @@ extern double bisection(double (*func)(double, double, double), double lower,
 	 */
 
 	double middle = (lower + upper) / 2;
-	if (percent_difference(func(middle, postMS, Z), time) < SSP_TOLERANCE ||
+	if (percent_difference(func(middle, postMS, Z, ctx), time) <
+		SSP_TOLERANCE ||
 		percent_difference(lower, upper) < SSP_TOLERANCE) {
 		/* the base case -> solution has converged */
 		return middle;
 	} else {
 		/* the recursive case -> solution has not yet converged. */
-		double f_lower = func(lower, postMS, Z);
-		double f_middle = func(middle, postMS, Z);
-		double f_upper = func(upper, postMS, Z);
+		double f_lower = func(lower, postMS, Z, ctx);
+		double f_middle = func(middle, postMS, Z, ctx);
+		double f_upper = func(upper, postMS, Z, ctx);
 
 		if (sign(f_upper - time) == sign(f_lower - time)) {
 			/*
@@ -83,10 +86,10 @@ extern double bisection(double (*func)(double, double, double), double lower,
 			return 500;
 		} else if (sign(f_lower - time) == sign(f_middle - time)) {
 			/* the root is between middle and upper */
-			return bisection(func, middle, upper, time, postMS, Z);
+			return bisection(func, middle, upper, time, postMS, Z, ctx);
 		} else if (sign(f_middle - time) == sign(f_upper - time)) {
 			/* the root is between lower and middle */
-			return bisection(func, lower, middle, time, postMS, Z);
+			return bisection(func, lower, middle, time, postMS, Z, ctx);
 		} else {
 			/*
 			 * There has been an error. Return a dummy value for error
@@ -32,6 +32,7 @@ extern "C" {
  * 				The second parameter to func.
  * Z: 			The metallicity by mass of the stellar population. The third
  * 				parameter to func.
+ * ctx: 			The context passed along to func
  *
  * Returns
  * =======
@@ -52,8 +53,9 @@ extern "C" {
  *
  * source: root.c
  */
-extern double bisection(double (*func)(double, double, double), double lower,
-	double upper, double time, double postMS, double Z);
+extern double bisection(double (*func)(double, double, double, CONTEXT *),
+	double lower, double upper, double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
@@ -29,13 +29,12 @@
 #include "vincenzo2016.h"
 
 /*
- * VINCENZO_A: The interpolation scheme for the values of A
- * VINCENZO_B: The interpolation scheme for the values of B
- * VINCENZO_C: The interpolation scheme for the values of C
+ * The indeces of the interpolation schemes for the values of A, B, and C
+ * within the vincenzo2016 field of a context
  */
-static INTERP_SCHEME_1D *VINCENZO_A = NULL;
-static INTERP_SCHEME_1D *VINCENZO_B = NULL;
-static INTERP_SCHEME_1D *VINCENZO_C = NULL;
+static const unsigned short VINCENZO_A = 0u;
+static const unsigned short VINCENZO_B = 1u;
+static const unsigned short VINCENZO_C = 2u;
 
 
 /*
@@ -48,6 +47,8 @@ static INTERP_SCHEME_1D *VINCENZO_C = NULL;
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence turnoff mass.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Vincenzo et al. (2016) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -67,13 +68,17 @@ static INTERP_SCHEME_1D *VINCENZO_C = NULL;
  *
  * header: vincenzo2016.h
  */
-extern double vincenzo2016_turnoffmass(double time, double postMS, double Z) {
+extern double vincenzo2016_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (time > 0) {
 
-		double a = interp_scheme_1d_evaluate(*VINCENZO_A, Z);
-		double b = interp_scheme_1d_evaluate(*VINCENZO_B, Z);
-		double c = interp_scheme_1d_evaluate(*VINCENZO_C, Z);
+		double a = interp_scheme_1d_evaluate(
+			*(*ctx).vincenzo2016[VINCENZO_A], Z);
+		double b = interp_scheme_1d_evaluate(
+			*(*ctx).vincenzo2016[VINCENZO_B], Z);
+		double c = interp_scheme_1d_evaluate(
+			*(*ctx).vincenzo2016[VINCENZO_C], Z);
 
 		/* analytic solution, see file header */
 		double mass = pow(log(time / a)  / b, -1.0 / c);
@@ -134,6 +139,8 @@ extern double vincenzo2016_turnoffmass(double time, double postMS, double Z) {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetimes. Zero for just the main sequence lifetime.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Vincenzo et al. (2016) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -153,13 +160,17 @@ extern double vincenzo2016_turnoffmass(double time, double postMS, double Z) {
  *
  * header: vincenzo2016.h
  */
-extern double vincenzo2016_lifetime(double mass, double postMS, double Z) {
+extern double vincenzo2016_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx) {
 
 	if (mass > 0) {
 
-		double a = interp_scheme_1d_evaluate(*VINCENZO_A, Z);
-		double b = interp_scheme_1d_evaluate(*VINCENZO_B, Z);
-		double c = interp_scheme_1d_evaluate(*VINCENZO_C, Z);
+		double a = interp_scheme_1d_evaluate(
+			*(*ctx).vincenzo2016[VINCENZO_A], Z);
+		double b = interp_scheme_1d_evaluate(
+			*(*ctx).vincenzo2016[VINCENZO_B], Z);
+		double c = interp_scheme_1d_evaluate(
+			*(*ctx).vincenzo2016[VINCENZO_C], Z);
 
 		return a * exp(b * pow(mass, -c));
 
@@ -194,12 +205,13 @@ extern double vincenzo2016_lifetime(double mass, double postMS, double Z) {
 
 
 /*
- * Import the Vincenzo et al. (2016) data. This function must be called from
- * python before vincenzo2016_lifetime or vincenzo2016_turnoff mass can be
- * called, otherwise a segmentation fault will occur.
+ * Import the Vincenzo et al. (2016) data into a context. This function must be
+ * called from python before vincenzo2016_lifetime or vincenzo2016_turnoff mass
+ * can be called with that context, otherwise a segmentation fault will occur.
  *
  * Parameters
  * ==========
+ * ctx: 			The context to import the data into
  * filename: 		The full path to the file holding the data.
  *
  * Returns
@@ -212,7 +224,7 @@ extern double vincenzo2016_lifetime(double mass, double postMS, double Z) {
  *
  * header: vincenzo2016.h
  */
-extern unsigned short vincenzo2016_import(char *filename) {
+extern unsigned short vincenzo2016_import(CONTEXT *ctx, char *filename) {
 
 	int hlength = header_length(filename);
 	if (hlength == -1) return 1u;
@@ -220,43 +232,44 @@ extern unsigned short vincenzo2016_import(char *filename) {
 	if (flength == -1) return 1u;
 	unsigned long n_points = (unsigned long) flength - (unsigned long) hlength;
 
-	VINCENZO_A = interp_scheme_1d_initialize();
-	VINCENZO_B = interp_scheme_1d_initialize();
-	VINCENZO_C = interp_scheme_1d_initialize();
-
-	VINCENZO_A -> n_points = (unsigned long) n_points;
-	VINCENZO_B -> n_points = (unsigned long) n_points;
-	VINCENZO_C -> n_points = (unsigned long) n_points;
-
-	VINCENZO_A -> xcoords = (double *) malloc (n_points * sizeof(double));
-	VINCENZO_A -> ycoords = (double *) malloc (n_points * sizeof(double));
-	VINCENZO_B -> xcoords = (double *) malloc (n_points * sizeof(double));
-	VINCENZO_B -> ycoords = (double *) malloc (n_points * sizeof(double));
-	VINCENZO_C -> xcoords = (double *) malloc (n_points * sizeof(double));
-	VINCENZO_C -> ycoords = (double *) malloc (n_points * sizeof(double));
-
+	vincenzo2016_free(ctx); /* in case it's already been imported */
 	FILE *in = fopen(filename, "r");
 	if (in == NULL) return 1u;
+
 	unsigned short i;
+	INTERP_SCHEME_1D **schemes = (INTERP_SCHEME_1D **) malloc (3u *
+		sizeof(INTERP_SCHEME_1D *));
+	for (i = 0u; i < 3u; i++) {
+		schemes[i] = interp_scheme_1d_initialize();
+		schemes[i] -> n_points = n_points;
+		schemes[i] -> xcoords = (double *) malloc (n_points * sizeof(double));
+		schemes[i] -> ycoords = (double *) malloc (n_points * sizeof(double));
+	}
+
 	for (i = 0u; i < n_points; i++) {
 		double z, a, b, c;
 		fscanf(in, "%lf %lf %lf %lf\n", &z, &a, &b, &c);
-		VINCENZO_A -> xcoords[i] = z;
-		VINCENZO_A -> ycoords[i] = a;
-		VINCENZO_B -> xcoords[i] = z;
-		VINCENZO_B -> ycoords[i] = b;
-		VINCENZO_C -> xcoords[i] = z;
-		VINCENZO_C -> ycoords[i] = c;
+		schemes[VINCENZO_A] -> xcoords[i] = z;
+		schemes[VINCENZO_A] -> ycoords[i] = a;
+		schemes[VINCENZO_B] -> xcoords[i] = z;
+		schemes[VINCENZO_B] -> ycoords[i] = b;
+		schemes[VINCENZO_C] -> xcoords[i] = z;
+		schemes[VINCENZO_C] -> ycoords[i] = c;
 	}
 
 	fclose(in);
+	ctx -> vincenzo2016 = schemes;
 	return 0u;
 
 }
 
 
 /*
- * Free up the memory stored by the Vincenzo et al. (2016) schema.
+ * Free up the memory stored by the Vincenzo et al. (2016) schema in a context.
+ *
+ * Parameters
+ * ==========
+ * ctx: 			The context holding the data
  *
  * References
  * ==========
@@ -264,15 +277,16 @@ extern unsigned short vincenzo2016_import(char *filename) {
  *
  * header: vincenzo2016.h
  */
-extern void vincenzo2016_free(void) {
+extern void vincenzo2016_free(CONTEXT *ctx) {
 
-	interp_scheme_1d_free(VINCENZO_A);
-	interp_scheme_1d_free(VINCENZO_B);
-	interp_scheme_1d_free(VINCENZO_C);
-
-	VINCENZO_A = NULL;
-	VINCENZO_B = NULL;
-	VINCENZO_C = NULL;
+	if ((*ctx).vincenzo2016 != NULL) {
+		unsigned short i;
+		for (i = 0u; i < 3u; i++) {
+			interp_scheme_1d_free(ctx -> vincenzo2016[i]);
+		}
+		free(ctx -> vincenzo2016);
+		ctx -> vincenzo2016 = NULL;
+	} else {}
 
 }
 
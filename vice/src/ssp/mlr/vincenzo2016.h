@@ -18,6 +18,8 @@ extern "C" {
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetime. Zero for the main sequence turnoff mass.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Vincenzo et al. (2016) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -37,7 +39,8 @@ extern "C" {
  *
  * source: vincenzo2016.c
  */
-extern double vincenzo2016_turnoffmass(double time, double postMS, double Z);
+extern double vincenzo2016_turnoffmass(double time, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Compute the lifetime of a star of known mass according to the Vincenzo et
@@ -49,6 +52,8 @@ extern double vincenzo2016_turnoffmass(double time, double postMS, double Z);
  * postMS: 		The ratio of a star's post main sequence lifetime to its main
  * 				sequence lifetimes. Zero for just the main sequence lifetime.
  * Z: 			The metallicity by mass of the star.
+ * ctx: 			The context into which the Vincenzo et al. (2016) data
+ * 				has been imported.
  *
  * Returns
  * =======
@@ -68,7 +73,8 @@ extern double vincenzo2016_turnoffmass(double time, double postMS, double Z);
  *
  * source: vincenzo2016.c
  */
-extern double vincenzo2016_lifetime(double mass, double postMS, double Z);
+extern double vincenzo2016_lifetime(double mass, double postMS, double Z,
+	CONTEXT *ctx);
 
 /*
  * Assign the full path to the Vincenzo et al. (2016) data to be stored as a
@@ -83,12 +89,13 @@ extern double vincenzo2016_lifetime(double mass, double postMS, double Z);
 extern void set_vincenzo2016_filename(char *filename);
 
 /*
- * Import the Vincenzo et al. (2016) data. This function must be called by
- * python before vincenzo2016_lifetime or vincenzo2016_turnoff mass can be
- * called, otherwise a segmentation fault will occur.
+ * Import the Vincenzo et al. (2016) data into a context. This function must be
+ * called by python before vincenzo2016_lifetime or vincenzo2016_turnoff mass
+ * can be called with that context, otherwise a segmentation fault will occur.
  *
  * Parameters
  * ==========
+ * ctx: 			The context to import the data into
  * filename: 		The name of the file holding the data.
  *
  * Returns
@@ -101,10 +108,14 @@ extern void set_vincenzo2016_filename(char *filename);
  *
  * source: vincenzo2016.c
  */
-extern unsigned short vincenzo2016_import(char *filename);
+extern unsigned short vincenzo2016_import(CONTEXT *ctx, char *filename);
 
 /*
- * Free up the memory stored by the interpolation schema.
+ * Free up the memory stored by the interpolation schema in a context.
+ *
+ * Parameters
+ * ==========
+ * ctx: 			The context holding the data
  *
  * References
  * ==========
@@ -112,7 +123,7 @@ extern unsigned short vincenzo2016_import(char *filename);
  *
  * source: vincenzo2016.c
  */
-extern void vincenzo2016_free(void);
+extern void vincenzo2016_free(CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
@@ -14,8 +14,7 @@
 #include "mlr.h"
 
 /* ---------- static function comment headers not duplicated here ---------- */
-static double MSMFnumerator_integrand(double m);
-static IMF_ *ADOPTED_IMF = NULL;
+static double MSMFnumerator_integrand(double m, void *imf);
 
 
 /*
@@ -27,6 +26,7 @@ static IMF_ *ADOPTED_IMF = NULL;
  * ssp: 		A SSP struct containing information on the stellar IMF and
  * 				the mass range of star formation
  * time: 		The age of the stellar population in Gyr
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -35,14 +35,14 @@ static IMF_ *ADOPTED_IMF = NULL;
  *
  * header: ssp.h
  */
-extern double MSMF(SSP ssp, double time) {
+extern double MSMF(SSP ssp, double time, CONTEXT *ctx) {
 
 	double denominator = MSMFdenominator(ssp);
 	if (denominator < 0) {
 		/* MSMFdenominator returns -1 for an unrecognized IMF */
 		return -1;
 	} else {
-		return MSMFnumerator(ssp, time) / denominator;
+		return MSMFnumerator(ssp, time, ctx) / denominator;
 	}
 
 }
@@ -83,7 +83,7 @@ extern unsigned short setup_MSMF(SINGLEZONE *sz) {
 		sz -> ssp -> msmf = (double *) malloc (n * sizeof(double));
 		for (i = 0l; i < n; i++) {
 			sz -> ssp -> msmf[i] = MSMFnumerator((*(*sz).ssp),
-				i * (*sz).dt) / denominator;
+				i * (*sz).dt, (*sz).ctx) / denominator;
 		}
 		return 0;
 	}
@@ -129,6 +129,7 @@ extern double MSMFdenominator(SSP ssp) {
  * ssp: 		A SSP struct containing information on the stellar IMF and
  * 				mass range of star formation
  * time: 		The age of the stellar population in Gyr
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -148,7 +149,7 @@ extern double MSMFdenominator(SSP ssp) {
  *
  * header: msmf.h
  */
-extern double MSMFnumerator(SSP ssp, double t) {
+extern double MSMFnumerator(SSP ssp, double t, CONTEXT *ctx) {
 
 	/*
 	 * The integrated form of the numerator of the main sequence mass fraction
@@ -157,7 +158,7 @@ extern double MSMFnumerator(SSP ssp, double t) {
 	 * for each of the relevant mass ranges.
 	 */
 
-	double turnoff_mass = dying_star_mass(t, ssp.postMS, 0.014);
+	double turnoff_mass = dying_star_mass(t, ssp.postMS, 0.014, ctx);
 
 	/*
 	 * First check if it's ouside the mass range of star formation and handle
@@ -215,9 +216,9 @@ extern double MSMFnumerator(SSP ssp, double t) {
 
 		case CUSTOM:
 			/* custom IMF -> no assumptions made, must integrate numerically */
-			ADOPTED_IMF = ssp.imf;
 			INTEGRAL *numerator = integral_initialize();
 			numerator -> func = &MSMFnumerator_integrand;
+			numerator -> params = ssp.imf;
 			numerator -> a = (*ssp.imf).m_lower;
 			numerator -> b = turnoff_mass;
 			/* default values for these parameters */
@@ -228,7 +229,6 @@ extern double MSMFnumerator(SSP ssp, double t) {
 			quad(numerator);
 			double x = (*numerator).result;
 			integral_free(numerator);
-			ADOPTED_IMF = NULL;
 			return x;
 
 		default:
@@ -246,6 +246,7 @@ extern double MSMFnumerator(SSP ssp, double t) {
  * Parameters
  * ==========
  * m: 			The initial stellar mass in Msun
+ * imf: 		A pointer to the adopted IMF_ object
  *
  * Returns
  * =======
@@ -255,9 +256,9 @@ extern double MSMFnumerator(SSP ssp, double t) {
  * ========
  * Section 2.3 of Science Documentation: The Main Sequence Mass Fraction
  */
-static double MSMFnumerator_integrand(double m) {
+static double MSMFnumerator_integrand(double m, void *imf) {
 
-	return m * imf_evaluate(*ADOPTED_IMF, m);
+	return m * imf_evaluate(*((IMF_ *) imf), m);
 
 }
 
@@ -17,6 +17,7 @@ extern "C" {
  * ssp: 		A SSP struct containing information on the stellar IMF and
  * 				the mass range of star formation
  * time: 		The age of the stellar population in Gyr
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -25,7 +26,7 @@ extern "C" {
  *
  * source: ssp.c
  */
-extern double MSMF(SSP ssp, double time);
+extern double MSMF(SSP ssp, double time, CONTEXT *ctx);
 
 /*
  * Evaluate the main sequence mass fraction across all timesteps in preparation
@@ -84,6 +85,7 @@ extern double MSMFdenominator(SSP ssp);
  * ssp: 		A SSP struct containing information on the stellar IMF and
  * 				mass range of star formation
  * time: 		The age of the stellar population in Gyr
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -92,7 +94,7 @@ extern double MSMFdenominator(SSP ssp);
  *
  * source: msmf.c
  */
-extern double MSMFnumerator(SSP ssp, double t);
+extern double MSMFnumerator(SSP ssp, double t, CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
@@ -20,6 +20,7 @@
  * times: 		The times at which the simulation will evaluate
  * n_times: 	The number of elements in the times array
  * mstar: 		The mass of the stellar population in Msun
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -30,7 +31,8 @@
  * header: ssp.h
  */
 extern double *single_population_enrichment(SSP *ssp, ELEMENT *e,
-	double Z, double *times, unsigned long n_times, double mstar) {
+	double Z, double *times, unsigned long n_times, double mstar,
+	CONTEXT *ctx) {
 
 	double *mass = (double *) malloc (n_times * sizeof(double));
 	if (mass == NULL) return NULL; 	/* memory error */
@@ -45,7 +47,8 @@ extern double *single_population_enrichment(SSP *ssp, ELEMENT *e,
 	} else {
 		unsigned long i;
 		for (i = 0l; i < n_times; i++) {
-			ssp -> msmf[i] = MSMFnumerator(*ssp, times[i]) / denominator;
+			ssp -> msmf[i] = MSMFnumerator(*ssp, times[i], ctx) /
+				denominator;
 		}
 	}
 
@@ -65,7 +68,7 @@ extern double *single_population_enrichment(SSP *ssp, ELEMENT *e,
 			/* The contribution from AGB stars */
 			mass[i] += (
 				get_AGB_yield(*e, Z,
-					dying_star_mass(times[i], (*ssp).postMS, Z)) *
+					dying_star_mass(times[i], (*ssp).postMS, Z, ctx)) *
 				mstar * ((*ssp).msmf[i] - (*ssp).msmf[i + 1l])
 			);
 
@@ -20,6 +20,7 @@ extern "C" {
  * times: 		The times at which the simulation will evaluate
  * n_times: 	The number of elements in the times array
  * mstar: 		The mass of the stellar population in Msun
+ * ctx: 		The context holding the mass-lifetime relationship
  *
  * Returns
  * =======
@@ -30,7 +31,8 @@ extern "C" {
  * source: ssp.c
  */
 extern double *single_population_enrichment(SSP *ssp, ELEMENT *e,
-	double Z, double *times, unsigned long n_times, double mstar);
+	double Z, double *times, unsigned long n_times, double mstar,
+	CONTEXT *ctx);
 
 #ifdef __cplusplus
 }
@@ -7,6 +7,7 @@ extern "C" {
 #endif /* __cplusplus */
 
 #include "../objects.h"
+#include "tests/cache.h"
 #include "tests/crf.h"
 #include "tests/mlr.h"
 #include "tests/msmf.h"
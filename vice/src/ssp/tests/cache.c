@@ -0,0 +1,63 @@
+/*
+ * This file implements testing of the cumulative return fraction and main
+ * sequence mass fraction cache at vice/src/ssp/cache.h
+ */
+
+#include <stdlib.h>
+#include "../../ssp.h"
+#include "../../objects/tests.h"
+#include "cache.h"
+
+
+/*
+ * Test the acquire_SSP_tables and release_SSP_tables functions at
+ * vice/src/ssp/cache.h
+ *
+ * Returns
+ * =======
+ * 1 on success, 0 on failure
+ *
+ * header: cache.h
+ */
+extern unsigned short test_SSP_table_cache(void) {
+
+	/*
+	 * Two identical singlezone objects should share tables, a third with a
+	 * different upper mass limit should not, and the shared tables should
+	 * still be there for the first once it's given them back.
+	 */
+	SINGLEZONE *first = singlezone_test_instance();
+	SINGLEZONE *second = singlezone_test_instance();
+	SINGLEZONE *third = singlezone_test_instance();
+	third -> ssp -> imf -> m_upper = 50;
+
+	unsigned short result = 0u;
+	if (!acquire_SSP_tables(first) && !acquire_SSP_tables(second) &&
+		!acquire_SSP_tables(third)) {
+		double *crf = (*(*first).ssp).crf;
+		result = (
+			(*(*second).ssp).crf == crf &&
+			(*(*second).ssp).msmf == (*(*first).ssp).msmf &&
+			(*(*third).ssp).crf != crf
+		);
+		release_SSP_tables(first);
+		release_SSP_tables(second);
+		result &= (*(*first).ssp).crf == NULL;
+		if (!acquire_SSP_tables(first)) {
+			result &= (*(*first).ssp).crf == crf;
+		} else {
+			result = 0u;
+		}
+	} else {}
+
+	release_SSP_tables(first);
+	release_SSP_tables(second);
+	release_SSP_tables(third);
+	clear_SSP_table_cache();
+	singlezone_free(first);
+	singlezone_free(second);
+	singlezone_free(third);
+	return result;
+
+}
+
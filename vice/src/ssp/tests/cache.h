@@ -0,0 +1,28 @@
+
+#ifndef TESTS_SSP_CACHE_H
+#define TESTS_SSP_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "../../objects.h"
+
+/*
+ * Test the acquire_SSP_tables and release_SSP_tables functions at
+ * vice/src/ssp/cache.h
+ *
+ * Returns
+ * =======
+ * 1 on success, 0 on failure
+ *
+ * source: cache.c
+ */
+extern unsigned short test_SSP_table_cache(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* TESTS_SSP_CACHE_H */
+
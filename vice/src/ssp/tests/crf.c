@@ -118,11 +118,16 @@ static unsigned short test_CRF_common(char imf[]) {
  */
 static unsigned short test_CRF_engine(SSP test, double *times) {
 
-	unsigned short i;
+	unsigned short i, result = 1u;
+	CONTEXT *ctx = context_initialize();
 	for (i = 1u; i < TEST_N_TIMES; i++) {
-		if (CRF(test, times[i]) < CRF(test, times[i - 1ul])) return 0u;
+		if (CRF(test, times[i], ctx) < CRF(test, times[i - 1u], ctx)) {
+			result = 0u;
+			break;
+		} else {}
 	}
-	return 1u;
+	context_free(ctx);
+	return result;
 
 }
 
@@ -117,11 +117,16 @@ static unsigned short test_MSMF_common(char imf[]) {
  */
 static unsigned short test_MSMF_engine(SSP test, double *times) {
 
-	unsigned short i;
+	unsigned short i, result = 1u;
+	CONTEXT *ctx = context_initialize();
 	for (i = 1u; i < TEST_N_TIMES; i++) {
-		if (MSMF(test, times[i]) > MSMF(test, times[i - 1u])) return 0u;
+		if (MSMF(test, times[i], ctx) > MSMF(test, times[i - 1u], ctx)) {
+			result = 0u;
+			break;
+		} else {}
 	}
-	return 1u;
+	context_free(ctx);
+	return result;
 
 }
 
@@ -128,6 +128,8 @@ extern unsigned short test_simple_hash(void) {
 		simple_hash("midpoint") == MIDPOINT &&
 		simple_hash("trapezoid") == TRAPEZOID &&
 		simple_hash("simpson") == SIMPSON &&
+		simple_hash("romberg") == ROMBERG &&
+		simple_hash("gausskronrod") == GAUSS_KRONROD &&
 		simple_hash("gas") == GAS &&
 		simple_hash("ifr") == IFR &&
 		simple_hash("sfr") == SFR
@@ -0,0 +1,131 @@
+/*
+ * This file implements the star formation law adopted by Johnson et al.
+ * (2021), the default in the milkyway object. The python class
+ * vice.toolkit.J21_sf_law holds its parameters, and these functions evaluate
+ * it in the same manner, such that simulations need not call python to do so.
+ */
+
+#include <math.h>
+#include "J21_sf_law.h"
+
+
+/*
+ * Evaluate the star formation efficiency timescale tau_star according to the
+ * star formation law adopted by Johnson et al. (2021).
+ *
+ * Parameters
+ * ==========
+ * law: 		The J21_sf_law object holding the parameters of the law
+ * time: 		The simulation time in Gyr
+ * arg2: 		The gas supply in Msun, or the star formation rate in Msun/yr
+ * 				if the law is in star formation rate mode.
+ *
+ * Returns
+ * =======
+ * tau_star in Gyr, as computed by the __call__ function of
+ * vice.toolkit.J21_sf_law. This is inf for a gas supply of zero, and 1e-12
+ * for a star formation rate of zero.
+ *
+ * header: J21_sf_law.h
+ */
+extern double J21_sf_law_evaluate(J21_SF_LAW law, double time, double arg2) {
+
+	double molecular = J21_sf_law_molecular(law, time);
+	if (!law.sfr_mode) {
+		double Sigma_gas = arg2 / law.area;
+		if (Sigma_gas >= law.Sigma_g2) {
+			return molecular;
+		} else if (Sigma_gas >= law.Sigma_g1) {
+			return molecular * pow(Sigma_gas / law.Sigma_g2, law.index2);
+		} else if (Sigma_gas) {
+			return molecular * (
+				pow(law.Sigma_g1 / law.Sigma_g2, law.index2) *
+				pow(Sigma_gas / law.Sigma_g1, law.index1)
+			);
+		} else {
+			return INFINITY; /* force zero star formation */
+		}
+	} else {
+		double Sigma_sfr = arg2 / law.area;
+		Sigma_sfr *= 1e9; /* Msun yr^-1 -> Msun Gyr^-1 */
+
+		/*
+		 * The star formation rate surface densities corresponding to
+		 * Sigma_g1 and Sigma_g2
+		 */
+		double diff = law.index2 - law.index1;
+		double Sigma_sfr2 = law.Sigma_g2 / molecular;
+		double Sigma_sfr1 = pow(law.Sigma_g1 / law.Sigma_g2,
+			law.index2 * (1 - law.index2) / diff
+		) / molecular * pow(law.Sigma_g2,
+			law.index2 * (1 - law.index1) / diff
+		) * pow(law.Sigma_g1,
+			-law.index1 * (1 - law.index2) / diff
+		);
+
+		if (Sigma_sfr >= Sigma_sfr2) {
+			return molecular;
+		} else if (Sigma_sfr >= Sigma_sfr1) {
+			return pow(molecular, 1 / (1 - law.index2)) * pow(
+				Sigma_sfr / law.Sigma_g2, law.index2 / (1 - law.index2));
+		} else if (Sigma_sfr) {
+			return pow(law.Sigma_g1 / law.Sigma_g2,
+				law.index2 / (1 - law.index1)
+			) * pow(molecular, 1 / (1 - law.index1)) * pow(
+				Sigma_sfr / law.Sigma_g1, law.index1 / (1 - law.index1));
+		} else {
+			return 1.e-12; /* gas supply is zero regardless */
+		}
+	}
+
+}
+
+
+/*
+ * Calculate the depletion time of molecular gas at a given simulation time.
+ *
+ * Parameters
+ * ==========
+ * law: 		The J21_sf_law object holding the parameters of the law
+ * time: 		The simulation time in Gyr
+ *
+ * Returns
+ * =======
+ * The depletion time of molecular gas in Gyr, as computed by the molecular
+ * function of vice.toolkit.J21_sf_law.
+ *
+ * header: J21_sf_law.h
+ */
+extern double J21_sf_law_molecular(J21_SF_LAW law, double time) {
+
+	return law.present_day_molecular * pow((1.5 + time) / 13.7,
+		law.molecular_index);
+
+}
+
+
+/*
+ * Evaluate a J21_sf_law object as the callback function of a CALLBACK_2ARG
+ * object, without the python interpreter.
+ *
+ * Parameters
+ * ==========
+ * time: 		The simulation time in Gyr
+ * arg2: 		The gas supply or star formation rate, as in
+ * 				J21_sf_law_evaluate
+ * law: 		A void pointer to the J21_sf_law object
+ *
+ * Returns
+ * =======
+ * The value of J21_sf_law_evaluate, or 1e-12 if that is NaN or not positive,
+ * mirroring the no_nan and positive decorators in vice/core/callback.py.
+ *
+ * header: J21_sf_law.h
+ */
+extern double J21_sf_law_callback(double time, double arg2, void *law) {
+
+	double value = J21_sf_law_evaluate(*((J21_SF_LAW *) law), time, arg2);
+	return value > 0 ? value : 1e-12;
+
+}
+
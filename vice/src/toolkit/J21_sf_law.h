@@ -0,0 +1,74 @@
+
+#ifndef TOOLKIT_J21_SF_LAW_H
+#define TOOLKIT_J21_SF_LAW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "../objects.h"
+
+/*
+ * Evaluate the star formation efficiency timescale tau_star according to the
+ * star formation law adopted by Johnson et al. (2021).
+ *
+ * Parameters
+ * ==========
+ * law: 		The J21_sf_law object holding the parameters of the law
+ * time: 		The simulation time in Gyr
+ * arg2: 		The gas supply in Msun, or the star formation rate in Msun/yr
+ * 				if the law is in star formation rate mode.
+ *
+ * Returns
+ * =======
+ * tau_star in Gyr, as computed by the __call__ function of
+ * vice.toolkit.J21_sf_law. This is inf for a gas supply of zero, and 1e-12
+ * for a star formation rate of zero.
+ *
+ * source: J21_sf_law.c
+ */
+extern double J21_sf_law_evaluate(J21_SF_LAW law, double time, double arg2);
+
+/*
+ * Calculate the depletion time of molecular gas at a given simulation time.
+ *
+ * Parameters
+ * ==========
+ * law: 		The J21_sf_law object holding the parameters of the law
+ * time: 		The simulation time in Gyr
+ *
+ * Returns
+ * =======
+ * The depletion time of molecular gas in Gyr, as computed by the molecular
+ * function of vice.toolkit.J21_sf_law.
+ *
+ * source: J21_sf_law.c
+ */
+extern double J21_sf_law_molecular(J21_SF_LAW law, double time);
+
+/*
+ * Evaluate a J21_sf_law object as the callback function of a CALLBACK_2ARG
+ * object, without the python interpreter.
+ *
+ * Parameters
+ * ==========
+ * time: 		The simulation time in Gyr
+ * arg2: 		The gas supply or star formation rate, as in
+ * 				J21_sf_law_evaluate
+ * law: 		A void pointer to the J21_sf_law object
+ *
+ * Returns
+ * =======
+ * The value of J21_sf_law_evaluate, or 1e-12 if that is NaN or not positive,
+ * mirroring the no_nan and positive decorators in vice/core/callback.py.
+ *
+ * source: J21_sf_law.c
+ */
+extern double J21_sf_law_callback(double time, double arg2, void *law);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* TOOLKIT_J21_SF_LAW_H */
+
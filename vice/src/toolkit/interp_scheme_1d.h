@@ -25,6 +25,42 @@ extern "C" {
  */
 extern double interp_scheme_1d_evaluate(INTERP_SCHEME_1D is1d, double x);
 
+/*
+ * Evaluate an interp_scheme_1d object as the callback function of a
+ * CALLBACK_1ARG object, without the python interpreter.
+ *
+ * Parameters
+ * ==========
+ * x: 			The value of the x-coordinate to evaluate at.
+ * is1d: 		A void pointer to the interp_scheme_1d object
+ *
+ * Returns
+ * =======
+ * is1d(x), or 0 if it is not a finite number. This mirrors the callback1
+ * objects in vice/core/callback.py, which substitute 0 for NaN and inf.
+ *
+ * source: interp_scheme_1d.c
+ */
+extern double interp_scheme_1d_callback(double x, void *is1d);
+
+/*
+ * Evaluate an interp_scheme_1d object as the callback function of a
+ * CALLBACK_1ARG object for a quantity which must be positive.
+ *
+ * Parameters
+ * ==========
+ * x: 			The value of the x-coordinate to evaluate at.
+ * is1d: 		A void pointer to the interp_scheme_1d object
+ *
+ * Returns
+ * =======
+ * is1d(x) as in interp_scheme_1d_callback, or 1e-12 if that is not
+ * positive, mirroring the positive decorator in vice/core/callback.py.
+ *
+ * source: interp_scheme_1d.c
+ */
+extern double interp_scheme_1d_callback_positive(double x, void *is1d);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -76,3 +76,55 @@ extern double interp_scheme_2d_evaluate(INTERP_SCHEME_2D is2d, double x,
 
 }
 
+
+/*
+ * Evaluate an interp_scheme_2d object as the callback function of a
+ * CALLBACK_2ARG object, without the python interpreter.
+ *
+ * Parameters
+ * ==========
+ * x: 			The value of the x-coordinate to evaluate at.
+ * y: 			The value of the y-coordinate to evaluate at.
+ * is2d: 		A void pointer to the interp_scheme_2d object
+ *
+ * Returns
+ * =======
+ * is2d(x, y), or 0 if it is not a finite number. This mirrors the callback2
+ * objects in vice/core/callback.py, which substitute 0 for NaN and inf.
+ *
+ * header: interp_scheme_2d.h
+ */
+extern double interp_scheme_2d_callback(double x, double y, void *is2d) {
+
+	double value = interp_scheme_2d_evaluate(*((INTERP_SCHEME_2D *) is2d), x,
+		y);
+	return isfinite(value) ? value : 0;
+
+}
+
+
+/*
+ * Evaluate an interp_scheme_2d object as the callback function of a
+ * CALLBACK_2ARG object for a quantity which must be positive.
+ *
+ * Parameters
+ * ==========
+ * x: 			The value of the x-coordinate to evaluate at.
+ * y: 			The value of the y-coordinate to evaluate at.
+ * is2d: 		A void pointer to the interp_scheme_2d object
+ *
+ * Returns
+ * =======
+ * is2d(x, y) as in interp_scheme_2d_callback, or 1e-12 if that is not
+ * positive, mirroring the positive decorator in vice/core/callback.py.
+ *
+ * header: interp_scheme_2d.h
+ */
+extern double interp_scheme_2d_callback_positive(double x, double y,
+	void *is2d) {
+
+	double value = interp_scheme_2d_callback(x, y, is2d);
+	return value > 0 ? value : 1e-12;
+
+}
+
@@ -28,6 +28,45 @@ extern "C" {
 extern double interp_scheme_2d_evaluate(INTERP_SCHEME_2D is2d, double x,
 	double y);
 
+/*
+ * Evaluate an interp_scheme_2d object as the callback function of a
+ * CALLBACK_2ARG object, without the python interpreter.
+ *
+ * Parameters
+ * ==========
+ * x: 			The value of the x-coordinate to evaluate at.
+ * y: 			The value of the y-coordinate to evaluate at.
+ * is2d: 		A void pointer to the interp_scheme_2d object
+ *
+ * Returns
+ * =======
+ * is2d(x, y), or 0 if it is not a finite number. This mirrors the callback2
+ * objects in vice/core/callback.py, which substitute 0 for NaN and inf.
+ *
+ * source: interp_scheme_2d.c
+ */
+extern double interp_scheme_2d_callback(double x, double y, void *is2d);
+
+/*
+ * Evaluate an interp_scheme_2d object as the callback function of a
+ * CALLBACK_2ARG object for a quantity which must be positive.
+ *
+ * Parameters
+ * ==========
+ * x: 			The value of the x-coordinate to evaluate at.
+ * y: 			The value of the y-coordinate to evaluate at.
+ * is2d: 		A void pointer to the interp_scheme_2d object
+ *
+ * Returns
+ * =======
+ * is2d(x, y) as in interp_scheme_2d_callback, or 1e-12 if that is not
+ * positive, mirroring the positive decorator in vice/core/callback.py.
+ *
+ * source: interp_scheme_2d.c
+ */
+extern double interp_scheme_2d_callback_positive(double x, double y,
+	void *is2d);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
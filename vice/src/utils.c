@@ -352,22 +352,22 @@ extern long get_bin_number(double *binspace, unsigned long num_bins,
 extern double scale_metallicity(SINGLEZONE sz, unsigned long timestep) {
 
 	unsigned int i;
-	double solar_by_element = 0, z_by_element = 0;
+	double z_by_element = 0;
 
 	/*
-	 * Add up the solar abundance by mass of each element and the abundance
-	 * by mass in the ISM of each element for only those tracked by the
-	 * current simulation.
+	 * Add up the abundance by mass in the ISM of each element for only those
+	 * tracked by the current simulation. The sum of their solar abundances
+	 * is stored in the state of the elements, as is the metallicity of each
+	 * element at a given timestep, contiguously.
 	 */
+	ELEMENT_STATE state = *sz.state;
+	double *Z = state.Z + timestep * sz.n_elements;
 	for (i = 0; i < sz.n_elements; i++) {
 		/* Don't count helium as a metal */
-		if (strcmp((*sz.elements[i]).symbol, "he")) {
-			solar_by_element += (*sz.elements[i]).solar;
-			z_by_element += (*sz.elements[i]).Z[timestep];
-		} else {}
+		if (!state.helium[i]) z_by_element += Z[i];
 	}
 
-	return sz.Z_solar * z_by_element / solar_by_element;
+	return sz.Z_solar * z_by_element / state.solar;
 
 }
 
@@ -5,6 +5,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "../callback.h"
 #include "../yields.h"
 #include "../io.h"
@@ -14,73 +15,82 @@
 #include "../stats.h"
 #include "ccsne.h"
 
-/* ---------- static function comment headers not duplicated here ---------- */
-static void setup_calculation(IMF_ *imf, CALLBACK_1ARG *explodability,
-	char *path, const unsigned short wind, char *element);
-static void zero_wind_yield_grid(void);
-static double interpolate_yield(double m);
-static double y_cc_numerator(double m);
-static double y_cc_denominator(double m);
-
-
-/*
- * These variables are declared globally in this file because it is easier for
- * quadrature functions to be able to access them while still only taking one
- * parameter.
- *
- * GRID: 			The stellar mass - element yield from the explosion
- * WIND: 			The stellar mass - element yield from the wind
- * GRIDSIZE:		The number of stellar masses on which the yield grid is
- * 					sampled
- * IMF: 			The assumed stellar IMF's corresponding object
- * EXPLODABILITY: 	The fractions of stars that explode in those mass ranges
- * Z_PROGENITOR: 	Z_x of the progenitor stars for the element x.
- * WEIGHT_INITIAL: 	A boolean int describing whether or not to weight the
- * 					initial composition by explodability
- * TESTING: 		A global testing status: 1 if testing, 0 if not.
- */
-static double **GRID;
-static double **WIND;
-static unsigned int GRIDSIZE = 0;
-static IMF_ *IMF = NULL;
-static CALLBACK_1ARG *EXPLODABILITY = NULL;
-static double Z_PROGENITOR;
-static unsigned short WEIGHT_INITIAL;
+typedef struct cc_yield_calculation {
 
+	/*
+	 * The information needed by the integrand of the numerator and
+	 * denominator of an IMF-averaged yield from core collapse supernovae,
+	 * passed as the additional data of the integral object.
+	 *
+	 * grid: The stellar mass - element yield from the explosion
+	 * wind: The stellar mass - element yield from the wind
+	 * gridsize: The number of stellar masses on which the yield grid is
+	 * 		sampled
+	 * imf: The assumed stellar IMF's corresponding object
+	 * explodability: The fractions of stars that explode in those mass ranges
+	 * Z_progenitor: Z_x of the progenitor stars for the element x.
+	 * weight_initial: A boolean int describing whether or not to weight the
+	 * 		initial composition by explodability
+	 */
 
-/*
- * Weight the initial composition of each star by explodability. This ensures
- * that net yields are not reported as negative when the study did not
- * separate wind and explosive yields.
- *
- * Parameters
- * ==========
- * 1 to weight the initial composition by explodability, 0 to not.
- *
- * header: ccsne.h
- */
-extern void weight_initial_by_explodability(unsigned short weight) {
-
-	WEIGHT_INITIAL = weight;
+	double **grid;
+	double **wind;
+	unsigned int gridsize;
+	IMF_ *imf;
+	CALLBACK_1ARG *explodability;
+	double Z_progenitor;
+	unsigned short weight_initial;
 
-}
+} CC_YIELD_CALCULATION;
 
+typedef struct cc_yield_batch {
 
-/*
- * Set the value of the progenitor stars abundance by mass Z_x for the element
- * x whose net yield is being calculated.
- *
- * Parameters
- * ==========
- * Z: 		The initial abundance Z_x itself
- *
- * header: ccsne.h
- */
-extern void set_Z_progenitor(double Z) {
+	/*
+	 * A batch of numerators of IMF-averaged yields from core collapse
+	 * supernovae shared between threads. Every field below the mutex is only
+	 * modified while it is locked.
+	 *
+	 * numerators: The integral object for the numerator of each yield
+	 * n: The number of yields in the batch
+	 * imf: The assumed stellar IMF's corresponding object
+	 * explodability: The fractions of stars that explode as a function of
+	 * 		mass
+	 * paths: The directory holding the yield grids for each yield
+	 * wind: Boolean int describing whether or not to include winds
+	 * elements: The symbol of the element for each yield
+	 * Z_progenitor: Z_x of the progenitor stars for each yield
+	 * weight_initial: Whether or not to weight the initial composition by
+	 * 		explodability for each yield
+	 * status: The value returned by quad for each yield
+	 * lock: Serializes the following field between threads
+	 * next: The index of the next yield to integrate
+	 */
 
-	Z_PROGENITOR = Z;
+	INTEGRAL **numerators;
+	unsigned long n;
+	IMF_ *imf;
+	CALLBACK_1ARG *explodability;
+	char **paths;
+	unsigned short wind;
+	char **elements;
+	double *Z_progenitor;
+	unsigned short *weight_initial;
+	unsigned short *status;
+	pthread_mutex_t lock;
+	unsigned long next;
+
+} CC_YIELD_BATCH;
 
-}
+/* ---------- static function comment headers not duplicated here ---------- */
+static void *batch_worker(void *batch);
+static void setup_calculation(CC_YIELD_CALCULATION *calc, char *path,
+	const unsigned short wind, char *element);
+static void free_yield_grid(double **grid, unsigned int gridsize);
+static void zero_wind_yield_grid(CC_YIELD_CALCULATION *calc);
+static double interpolate_yield(double m, CC_YIELD_CALCULATION calc);
+static unsigned int grid_index(double m, double **grid, unsigned int n);
+static double y_cc_numerator(double m, void *calc);
+static double y_cc_denominator(double m, void *imf);
 
 
 /*
@@ -95,6 +105,12 @@ extern void set_Z_progenitor(double Z) {
  * path:			The nme of the data file containing the grid
  * wind: 			Boolean int describing whether or not to include winds
  * element: 		The symbol of the element
+ * Z_progenitor: 	The abundance by mass Z_x of the progenitor stars for the
+ * 					element x whose net yield is being calculated
+ * weight_initial: 	1 to weight the initial composition of each star by
+ * 					explodability, 0 to not. This ensures that net yields are
+ * 					not reported as negative when the study did not separate
+ * 					wind and explosive yields.
  *
  * Returns
  * =======
@@ -105,49 +121,155 @@ extern void set_Z_progenitor(double Z) {
  */
 extern unsigned short IMFintegrated_fractional_yield_numerator(
 	INTEGRAL *intgrl, IMF_ *imf, CALLBACK_1ARG *explodability,
-	char *path, const unsigned short wind, char *element) {
-
-	setup_calculation(imf, explodability, path, wind, element);
+	char *path, const unsigned short wind, char *element,
+	double Z_progenitor, unsigned short weight_initial) {
+
+	CC_YIELD_CALCULATION calc;
+	calc.imf = imf;
+	calc.explodability = explodability;
+	calc.Z_progenitor = Z_progenitor;
+	calc.weight_initial = weight_initial;
+	setup_calculation(&calc, path, wind, element);
 	intgrl -> func = &y_cc_numerator;
+	intgrl -> params = &calc;
 	int x = quad(intgrl);
-	free(GRID);
-	free(WIND);
+	free_yield_grid(calc.grid, calc.gridsize);
+	free_yield_grid(calc.wind, calc.gridsize);
 	intgrl -> func = NULL;
-	GRIDSIZE = 0;
-	IMF = NULL;
+	intgrl -> params = NULL;
 	return x;
 
 }
 
 
 /*
- * Setup the yield calculation by initializing all of the necessary global
- * variables.
+ * Determine the numerators of a batch of IMF-averaged yields from core
+ * collapse supernovae, integrating them across a pool of threads.
  *
  * Parameters
  * ==========
- * imf:				The associated IMF object
+ * numerators: 		The integral object for the numerator of each yield, with
+ * 					the bounds and the method of quadrature already set
+ * n: 				The number of yields in the batch
+ * imf: 			The associated IMF object
  * explodability: 	Stellar explodability as a function of mass
+ * paths: 			The directory holding the yield grids for each yield
+ * wind: 			Boolean int describing whether or not to include winds
+ * elements: 		The symbol of the element for each yield
+ * Z_progenitor: 	The abundance by mass Z_x of the progenitor stars for
+ * 					each yield
+ * weight_initial: 	Whether or not to weight the initial composition of each
+ * 					star by explodability for each yield
+ * status: 			Modified to store the value returned by
+ * 					IMFintegrated_fractional_yield_numerator for each yield
+ * n_threads: 		The number of threads to integrate across
+ *
+ * Notes
+ * =====
+ * Every yield is independent of the others, and each thread claims the next
+ * one until there are none left, reading in its grids and integrating it.
+ * If the IMF or the explodability are python functions, they can only be
+ * evaluated on the calling thread, which holds python's global interpreter
+ * lock, so the batch is integrated there. If any thread can't be created,
+ * the ones which were share the work.
+ *
+ * header: ccsne.h
+ */
+extern void IMFintegrated_fractional_yield_batch(INTEGRAL **numerators,
+	unsigned long n, IMF_ *imf, CALLBACK_1ARG *explodability, char **paths,
+	const unsigned short wind, char **elements, double *Z_progenitor,
+	unsigned short *weight_initial, unsigned short *status,
+	unsigned int n_threads) {
+
+	CC_YIELD_BATCH batch;
+	batch.numerators = numerators;
+	batch.n = n;
+	batch.imf = imf;
+	batch.explodability = explodability;
+	batch.paths = paths;
+	batch.wind = wind;
+	batch.elements = elements;
+	batch.Z_progenitor = Z_progenitor;
+	batch.weight_initial = weight_initial;
+	batch.status = status;
+	batch.next = 0ul;
+	pthread_mutex_init(&(batch.lock), NULL);
+
+	if (callback_1arg_calls_python(*explodability) ||
+		((*imf).custom_imf != NULL &&
+		callback_1arg_calls_python(*(*imf).custom_imf))) n_threads = 1u;
+	if (n_threads > n) n_threads = (unsigned int) n;
+
+	unsigned int i, n_started = 0u;
+	if (n_threads > 1u) {
+		pthread_t *threads = (pthread_t *) malloc (n_threads *
+			sizeof(pthread_t));
+		for (i = 0u; i < n_threads; i++) {
+			if (pthread_create(&threads[i], NULL, batch_worker, &batch)) break;
+			n_started++;
+		}
+		for (i = 0u; i < n_started; i++) pthread_join(threads[i], NULL);
+		free(threads);
+	} else {}
+
+	/* Does nothing if the threads have already integrated every yield */
+	batch_worker(&batch);
+	pthread_mutex_destroy(&(batch.lock));
+
+}
+
+
+/*
+ * Integrate yields in a batch until there are none left.
+ *
+ * Parameters
+ * ==========
+ * batch: 		A pointer to the CC_YIELD_BATCH
+ *
+ * Returns
+ * =======
+ * NULL, as required by pthread_create
+ */
+static void *batch_worker(void *batch) {
+
+	CC_YIELD_BATCH *b = (CC_YIELD_BATCH *) batch;
+	while (1) {
+		pthread_mutex_lock(&(b -> lock));
+		unsigned long i = b -> next++;
+		pthread_mutex_unlock(&(b -> lock));
+		if (i >= (*b).n) break;
+		b -> status[i] = IMFintegrated_fractional_yield_numerator(
+			(*b).numerators[i], (*b).imf, (*b).explodability, (*b).paths[i],
+			(*b).wind, (*b).elements[i], (*b).Z_progenitor[i],
+			(*b).weight_initial[i]);
+	}
+	return NULL;
+
+}
+
+
+/*
+ * Setup the yield calculation by reading in the yield grids.
+ *
+ * Parameters
+ * ==========
+ * calc: 			The calculation to read the grids into
  * path:			The nme of the data file containing the grid
  * wind: 			Boolean int describing whether or not to include winds
  * element: 		The symbol of the element
  */
-static void setup_calculation(IMF_ *imf, CALLBACK_1ARG *explodability,
-	char *path, const unsigned short wind, char *element) {
+static void setup_calculation(CC_YIELD_CALCULATION *calc, char *path,
+	const unsigned short wind, char *element) {
 
-	/*
-	 * Initialize these variables globally. This is such that the function
-	 * which executes numerical quadrature can accept only one parameter - the
-	 * ZAMS mass of the progenitor.
-	 */
 	char *file = (char *) malloc (MAX_FILENAME_SIZE * sizeof(char));
 	strcpy(file, path);
 	strcat(file, "explosive/");
 	strcat(file, element);
 	strcat(file, ".dat");
 
-	GRIDSIZE = line_count(file) - header_length(file);
-	GRID = cc_yield_grid(file);
+	calc -> gridsize = line_count(file) - header_length(file);
+	calc -> grid = cc_yield_grid(file);
+	free(file);
 
 	if (wind) {
 		char *wind = (char *) malloc (MAX_FILENAME_SIZE * sizeof(char));
@@ -155,14 +277,32 @@ static void setup_calculation(IMF_ *imf, CALLBACK_1ARG *explodability,
 		strcat(wind, "wind/");
 		strcat(wind, element);
 		strcat(wind, ".dat");
-		WIND = cc_yield_grid(wind);
+		calc -> wind = cc_yield_grid(wind);
 		free(wind);
 	} else {
-		zero_wind_yield_grid();
+		zero_wind_yield_grid(calc);
 	}
 
-	IMF = imf;
-	EXPLODABILITY = explodability;
+}
+
+
+/*
+ * Free up the memory stored in a stellar mass - element yield grid.
+ *
+ * Parameters
+ * ==========
+ * grid: 		The grid to free
+ * gridsize: 	The number of stellar masses on which the grid is sampled
+ */
+static void free_yield_grid(double **grid, unsigned int gridsize) {
+
+	if (grid != NULL) {
+		unsigned int i;
+		for (i = 0u; i < gridsize; i++) {
+			free(grid[i]);
+		}
+		free(grid);
+	} else {}
 
 }
 
@@ -186,11 +326,11 @@ static void setup_calculation(IMF_ *imf, CALLBACK_1ARG *explodability,
 extern unsigned short IMFintegrated_fractional_yield_denominator(
 	INTEGRAL *intgrl, IMF_ *imf) {
 
-	IMF = imf;
 	intgrl -> func = &y_cc_denominator;
+	intgrl -> params = imf;
 	int x = quad(intgrl);
 	intgrl -> func = NULL;
-	IMF = NULL;
+	intgrl -> params = NULL;
 	return x;
 
 }
@@ -199,15 +339,19 @@ extern unsigned short IMFintegrated_fractional_yield_denominator(
 /*
  * Initialize the wind yield to a grid of zeroes in the event that the user
  * is neglecting the wind yields in this calculation.
+ *
+ * Parameters
+ * ==========
+ * calc: 		The calculation whose explosive yield grid has been read in
  */
-static void zero_wind_yield_grid(void) {
+static void zero_wind_yield_grid(CC_YIELD_CALCULATION *calc) {
 
 	unsigned int i;
-	WIND = (double **) malloc (GRIDSIZE * sizeof(double *));
-	for (i = 0u; i < GRIDSIZE; i++) {
-		WIND[i] = (double *) malloc (2 * sizeof(double));
-		WIND[i][0] = GRID[i][0];
-		WIND[i][1] = 0.0;
+	calc -> wind = (double **) malloc ((*calc).gridsize * sizeof(double *));
+	for (i = 0u; i < (*calc).gridsize; i++) {
+		calc -> wind[i] = (double *) malloc (2 * sizeof(double));
+		calc -> wind[i][0] = (*calc).grid[i][0];
+		calc -> wind[i][1] = 0.0;
 	}
 
 }
@@ -221,12 +365,13 @@ static void zero_wind_yield_grid(void) {
  * Parameters
  * ==========
  * m: 		The mass of a star whose yield is to be interpolated
+ * calc: 	The yield calculation holding the grids
  *
  * Returns
  * =======
  * The interpolated yield in Msun
  */
-static double interpolate_yield(double m) {
+static double interpolate_yield(double m, CC_YIELD_CALCULATION calc) {
 
 	if (m < CC_MIN_STELLAR_MASS) {
 		return 0;
@@ -236,40 +381,30 @@ static double interpolate_yield(double m) {
 		 * The corrective term to subtract that accounts for initial abundances
 		 * in calculating net yields
 		 */
-		double initial = Z_PROGENITOR * m;
-		if (WEIGHT_INITIAL) initial *= callback_1arg_evaluate(
-			*EXPLODABILITY, m);
-
-		unsigned int i;
-		for (i = 0; i < GRIDSIZE; i++) {
-			/* if the mass itself is on the grid, just return that yield */
-			if (m == GRID[i][0]) {
-				return (
-					callback_1arg_evaluate(*EXPLODABILITY, m) * GRID[i][1] +
-					WIND[i][1] - initial
-				);
-			} else {
-				continue;
-			}
-		}
-
-		/*
-		 * Can't simply call get_bin_number because GRID is 2-dimensional
-		 */
-		for (i = 0; i < GRIDSIZE - 1; i++) {
-			if (GRID[i][0] < m && m < GRID[i + 1][0]) {
-				return (
-					callback_1arg_evaluate(*EXPLODABILITY, m) *
-					interpolate(GRID[i][0], GRID[i + 1][0], GRID[i][1],
-						GRID[i + 1][1], m) +
-					interpolate(WIND[i][0], WIND[i + 1][0], WIND[i][1],
-						WIND[i + 1][1], m) -
-					initial
-				);
-			} else {
-				continue;
-			}
-		}
+		double initial = calc.Z_progenitor * m;
+		if (calc.weight_initial) initial *= callback_1arg_evaluate(
+			*calc.explodability, m);
+		double **grid = calc.grid;
+		double **wind = calc.wind;
+		unsigned int n = calc.gridsize;
+		unsigned int i = grid_index(m, grid, n);
+
+		/* if the mass itself is on the grid, just return that yield */
+		if (m == grid[i][0]) {
+			return (
+				callback_1arg_evaluate(*calc.explodability, m) * grid[i][1] +
+				wind[i][1] - initial
+			);
+		} else if (i + 1u < n && grid[i][0] < m && m < grid[i + 1u][0]) {
+			return (
+				callback_1arg_evaluate(*calc.explodability, m) *
+				interpolate(grid[i][0], grid[i + 1u][0], grid[i][1],
+					grid[i + 1u][1], m) +
+				interpolate(wind[i][0], wind[i + 1u][0], wind[i][1],
+					wind[i + 1u][1], m) -
+				initial
+			);
+		} else {}
 
 		/*
 		 * If the code gets to this point, the mass is above the grid. In that
@@ -277,11 +412,11 @@ static double interpolate_yield(double m) {
 		 * yield linearly from the bottom two elements on the grid.
 		 */
 		return (
-			callback_1arg_evaluate(*EXPLODABILITY, m) *
-			interpolate(GRID[GRIDSIZE - 2][0], GRID[GRIDSIZE - 1][0],
-				GRID[GRIDSIZE - 2][1], GRID[GRIDSIZE - 1][1], m) +
-			interpolate(WIND[GRIDSIZE - 2][0], WIND[GRIDSIZE - 1][0],
-				WIND[GRIDSIZE - 2][1], WIND[GRIDSIZE - 1][1], m) -
+			callback_1arg_evaluate(*calc.explodability, m) *
+			interpolate(grid[n - 2][0], grid[n - 1][0],
+				grid[n - 2][1], grid[n - 1][1], m) +
+			interpolate(wind[n - 2][0], wind[n - 1][0],
+				wind[n - 2][1], wind[n - 1][1], m) -
 			initial
 		);
 	}
@@ -295,14 +430,16 @@ static double interpolate_yield(double m) {
  * Paremeters
  * ==========
  * m: 		A stellar mass in Msun
+ * calc: 	A pointer to the CC_YIELD_CALCULATION struct
  *
  * Returns
  * =======
  * The value of y(x) * dN/dm
  */
-static double y_cc_numerator(double m) {
+static double y_cc_numerator(double m, void *calc) {
 
-	return interpolate_yield(m) * imf_evaluate(*IMF, m);
+	CC_YIELD_CALCULATION c = *((CC_YIELD_CALCULATION *) calc);
+	return interpolate_yield(m, c) * imf_evaluate(*c.imf, m);
 
 }
 
@@ -313,14 +450,51 @@ static double y_cc_numerator(double m) {
  * Parameters
  * ==========
  * m: 		A stellar mass in Msun
+ * imf: 	A pointer to the associated IMF object
  *
  * Returns
  * =======
  * The value of m * dN/dm
  */
-static double y_cc_denominator(double m) {
+static double y_cc_denominator(double m, void *imf) {
+
+	return m * imf_evaluate(*((IMF_ *) imf), m);
+
+}
 
-	return m * imf_evaluate(*IMF, m);
+
+/*
+ * Find the bin of the mass grid containing a given stellar mass by
+ * bisection.
+ *
+ * Parameters
+ * ==========
+ * m: 		The stellar mass in Msun
+ * grid: 	The stellar mass - element yield grid, sorted by mass
+ * n: 		The number of stellar masses on the grid
+ *
+ * Returns
+ * =======
+ * The index i of the largest mass on the grid which is at most m, or 0 if m
+ * is below the grid
+ *
+ * Notes
+ * =====
+ * The integrand is evaluated at many masses for each yield, and this takes
+ * O(log n) time in place of the O(n) of scanning the grid.
+ */
+static unsigned int grid_index(double m, double **grid, unsigned int n) {
+
+	unsigned int lower = 0u, upper = n;
+	while (upper - lower > 1u) {
+		unsigned int center = lower + (upper - lower) / 2u;
+		if (grid[center][0] <= m) {
+			lower = center;
+		} else {
+			upper = center;
+		}
+	}
+	return lower;
 
 }
 
@@ -8,31 +8,6 @@ extern "C" {
 
 #include "../objects.h"
 
-/*
- * Weight the initial composition of each star by explodability. This ensures
- * that net yields are not reported as negative when the study did not
- * separate wind and explosive yields.
- *
- * Parameters
- * ==========
- * 1 to weight the initial composition by explodability, 0 to not.
- *
- * source: ccsne.c
- */
-extern void weight_initial_by_explodability(unsigned short weight);
-
-/*
- * Set the value of the progenitor stars abundance by mass Z_x for the element
- * x whose net yield is being calculated.
- *
- * Parameters
- * ==========
- * Z: 		The initial abundance Z_x itself
- *
- * source: ccsne.c
- */
-extern void set_Z_progenitor(double Z);
-
 /*
  * Determine the value of the integrated IMF weighted by the mass yield of a
  * given element, up to the normalization of the IMF.
@@ -45,6 +20,12 @@ extern void set_Z_progenitor(double Z);
  * path:			The nme of the data file containing the grid
  * wind: 			Boolean int describing whether or not to include winds
  * element: 		The symbol of the element
+ * Z_progenitor: 	The abundance by mass Z_x of the progenitor stars for the
+ * 					element x whose net yield is being calculated
+ * weight_initial: 	1 to weight the initial composition of each star by
+ * 					explodability, 0 to not. This ensures that net yields are
+ * 					not reported as negative when the study did not separate
+ * 					wind and explosive yields.
  *
  * Returns
  * =======
@@ -55,7 +36,43 @@ extern void set_Z_progenitor(double Z);
  */
 extern unsigned short IMFintegrated_fractional_yield_numerator(
 	INTEGRAL *intgrl, IMF_ *imf, CALLBACK_1ARG *explodability,
-	char *path, const unsigned short wind, char *element);
+	char *path, const unsigned short wind, char *element,
+	double Z_progenitor, unsigned short weight_initial);
+
+/*
+ * Determine the numerators of a batch of IMF-averaged yields from core
+ * collapse supernovae, integrating them across a pool of threads.
+ *
+ * Parameters
+ * ==========
+ * numerators: 		The integral object for the numerator of each yield, with
+ * 					the bounds and the method of quadrature already set
+ * n: 				The number of yields in the batch
+ * imf: 			The associated IMF object
+ * explodability: 	Stellar explodability as a function of mass
+ * paths: 			The directory holding the yield grids for each yield
+ * wind: 			Boolean int describing whether or not to include winds
+ * elements: 		The symbol of the element for each yield
+ * Z_progenitor: 	The abundance by mass Z_x of the progenitor stars for
+ * 					each yield
+ * weight_initial: 	Whether or not to weight the initial composition of each
+ * 					star by explodability for each yield
+ * status: 			Modified to store the value returned by
+ * 					IMFintegrated_fractional_yield_numerator for each yield
+ * n_threads: 		The number of threads to integrate across
+ *
+ * Notes
+ * =====
+ * If the IMF or the explodability are python functions, the batch is
+ * integrated on the calling thread.
+ *
+ * source: ccsne.c
+ */
+extern void IMFintegrated_fractional_yield_batch(INTEGRAL **numerators,
+	unsigned long n, IMF_ *imf, CALLBACK_1ARG *explodability, char **paths,
+	const unsigned short wind, char **elements, double *Z_progenitor,
+	unsigned short *weight_initial, unsigned short *status,
+	unsigned int n_threads);
 
 /*
  * Determine the value of the integrated IMF weighted by stellar mass, up to
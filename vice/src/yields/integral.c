@@ -6,14 +6,72 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <float.h>
 #include "../yields.h"
 #include "../utils.h"
 
+/*
+ * A subinterval of the range of integration in adaptive Gauss-Kronrod
+ * quadrature, with the Kronrod estimate of the integral over it and the
+ * absolute error on that estimate.
+ */
+typedef struct quadrature_interval {
+
+	double a;
+	double b;
+	double result;
+	double error;
+
+} QUADRATURE_INTERVAL;
+
+/*
+ * The abscissae and weights of the 15-point Kronrod rule and of the 7-point
+ * Gauss rule embedded within it on the interval [-1, 1], from QUADPACK
+ * (Piessens, de Doncker-Kapenga, Uberhuber & Kahaner 1983). Only the
+ * non-negative abscissae are listed; the odd-indexed Kronrod abscissae are
+ * the Gauss abscissae.
+ */
+static const double KRONROD_NODES[8] = {
+	0.991455371120812639206854697526329,
+	0.949107912342758524526189684047851,
+	0.864864423359769072789712788640926,
+	0.741531185599394439863864773280788,
+	0.586087235467691130294144845693013,
+	0.405845151377397166906606412076961,
+	0.207784955007898467600689403773245,
+	0.000000000000000000000000000000000
+};
+
+static const double KRONROD_WEIGHTS[8] = {
+	0.022935322010529224963732008058970,
+	0.063092092629978553290700663189204,
+	0.104790010322250183839876322541518,
+	0.140653259715525918745189590510238,
+	0.169004726639267902826583426598550,
+	0.190350578064785409913256402421014,
+	0.204432940075298892414161999234649,
+	0.209482141084727828012999174891714
+};
+
+static const double GAUSS_WEIGHTS[4] = {
+	0.129484966168869693270611432679082,
+	0.279705391489276667901467771423780,
+	0.381830050505118944950369775488975,
+	0.417959183673469387755102040816327
+};
+
 /* ---------- static function comment headers not duplicated here ---------- */
 static double euler(INTEGRAL intgrl, unsigned long N);
 static double trapzd(INTEGRAL intgrl, unsigned long N);
 static double midpt(INTEGRAL intgrl, unsigned long N);
-static double simp(INTEGRAL intgrl, unsigned long N);
+static double refine(INTEGRAL intgrl, double coarse, unsigned long N);
+static double richardson(double *row, double trapezoid, unsigned short level);
+static unsigned short gauss_kronrod(INTEGRAL *intgrl);
+static QUADRATURE_INTERVAL kronrod15(INTEGRAL intgrl, double a, double b);
+static void interval_heap_push(QUADRATURE_INTERVAL *heap, unsigned long n,
+	QUADRATURE_INTERVAL interval);
+static QUADRATURE_INTERVAL interval_heap_pop(QUADRATURE_INTERVAL *heap,
+	unsigned long n);
 
 
 /*
@@ -33,6 +91,8 @@ static double simp(INTEGRAL intgrl, unsigned long N);
  * The methods of numerical quadrature implemented in this function and its
  * subroutines are adopted from Chapter 4 of Numerical Recipes (Press,
  * Teukolsky, Vetterling & Flannery 2007), Cambridge University Press.
+ * Adaptive Gauss-Kronrod quadrature follows the QAG routine of QUADPACK
+ * (Piessens, de Doncker-Kapenga, Uberhuber & Kahaner 1983), Springer.
  *
  * header: integral.h
  */
@@ -46,49 +106,72 @@ extern unsigned short quad(INTEGRAL *intgrl) {
 	 * then said to converge when the error falls below the specified
 	 * tolerance.
 	 *
+	 * Doubling the number of bins only adds points at the centers of the
+	 * previous bins, so Euler's method, Trapezoid rule, Simpson's rule, and
+	 * Romberg integration carry the sum of the previous iteration forward
+	 * and evaluate the function only at the new points. Midpoint rule has no
+	 * points in common between iterations.
+	 *
 	 * Start with half the specified minimum b/c there will always be at least
 	 * two iterations. Ensure that the number of bins is even.
 	 */
 
+	if ((*intgrl).method == GAUSS_KRONROD) return gauss_kronrod(intgrl);
+
 	unsigned long N = (*intgrl).Nmin / 2l;
 	if (N % 2l != 0l) N += 1l;
 
-	double (*integrate)(INTEGRAL, unsigned long);
 	double old_int = 0;
 	double new_int;
+	double coarse = 0; 	/* the Euler or Trapezoid sum with N / 2 bins */
+	double fine; 		/* the Euler or Trapezoid sum with N bins */
+	double row[ROMBERG_MAX_ORDER];
+	unsigned short level = 0u;
 
+	do {
 
-	switch ((*intgrl).method) {
-
-		case EULER:
-			/* integrate according to Euler's method */
-			integrate = &euler;
-			break;
-
-		case TRAPEZOID:
-			/* integrate according to Trapezoid rule */
-			integrate = &trapzd;
-			break;
-
-		case MIDPOINT:
-			/* integrate according to midpoint rule */
-			integrate = &midpt;
-			break;
-
-		case SIMPSON:
-			/* integrate according to Simpson's rule */
-			integrate = &simp;
-			break;
-
-		default:
-			/* error handling */
-			return 2;
-
-	}
+		switch ((*intgrl).method) {
+
+			case EULER:
+				/* integrate according to Euler's method */
+				fine = level ? refine(*intgrl, coarse, N / 2l) : euler(
+					*intgrl, N);
+				new_int = fine;
+				break;
+
+			case TRAPEZOID:
+				/* integrate according to Trapezoid rule */
+				fine = level ? refine(*intgrl, coarse, N / 2l) : trapzd(
+					*intgrl, N);
+				new_int = fine;
+				break;
+
+			case MIDPOINT:
+				/* integrate according to midpoint rule */
+				fine = midpt(*intgrl, N);
+				new_int = fine;
+				break;
+
+			case SIMPSON:
+				/* Simpson's rule is a complication of Trapezoid rule */
+				if (!level) coarse = trapzd(*intgrl, N / 2l);
+				fine = refine(*intgrl, coarse, N / 2l);
+				new_int = (4 * fine - coarse) / 3;
+				break;
+
+			case ROMBERG:
+				/* extrapolate the Trapezoid sums to zero bin width */
+				fine = level ? refine(*intgrl, coarse, N / 2l) : trapzd(
+					*intgrl, N);
+				new_int = richardson(row, fine, level);
+				break;
+
+			default:
+				/* error handling */
+				return 2;
 
-	do {
+		}
 
-		new_int = integrate(*intgrl, N);
 		if (new_int) {
 			intgrl -> error = absval(old_int / new_int - 1);
 		} else {
@@ -101,6 +184,8 @@ extern unsigned short quad(INTEGRAL *intgrl) {
 
 		/* Store previous value and increment N */
 		old_int = new_int;
+		coarse = fine;
+		level++;
 		N *= 2l;
 
 	} while ((*intgrl).error > (*intgrl).tolerance && N < (*intgrl).Nmax);
@@ -141,7 +226,7 @@ static double euler(INTEGRAL intgrl, unsigned long N) {
 	 */
 	unsigned long i;
 	for (i = 0l; i < N; i++) {
-		eval[i] = intgrl.func(x[i]);
+		eval[i] = intgrl.func(x[i], intgrl.params);
 	}
 	double total = sum(eval, N);
 	free(eval);
@@ -180,7 +265,7 @@ static double trapzd(INTEGRAL intgrl, unsigned long N) {
 	 */
 	unsigned long i;
 	for (i = 0l; i <= N; i++) {
-		eval[i] = intgrl.func(x[i]);
+		eval[i] = intgrl.func(x[i], intgrl.params);
 	}
 	double total = sum(eval, N + 1l);
 	total -= 0.5 * (eval[0] + eval[N]);
@@ -220,7 +305,7 @@ static double midpt(INTEGRAL intgrl, unsigned long N) {
 	 */
 	unsigned long i;
 	for (i = 0l; i < N; i++) {
-		eval[i] = intgrl.func(mids[i]);
+		eval[i] = intgrl.func(mids[i], intgrl.params);
 	}
 	double total = sum(eval, N);
 	free(x);
@@ -232,25 +317,268 @@ static double midpt(INTEGRAL intgrl, unsigned long N) {
 
 
 /*
- * Approximates the integral of a function between two bounds using Simpson's
- * rule with a given number of bins.
+ * Refine an Euler or Trapezoid sum by doubling its number of bins.
  *
  * Parameters
  * ==========
  * intgrl: 		The integral object
- * N: 			The number of bins to use in evaluating the Riemann sum
+ * coarse: 		The sum with N bins
+ * N: 			The number of bins in the coarse sum
  *
  * Returns
  * =======
- * The approximate value of the integral with the given number of bins
+ * The sum with 2N bins
  *
- * For details on Simpson's rule, see chapter 4 of Numerical Recipes:
- * Press, Teukolsky, Vetterling, & Flannery (2007), Cambridge University Press
+ * Notes
+ * =====
+ * The new points are the centers of the bins of the coarse sum, at which
+ * the function is evaluated exactly as in Midpoint rule. The sum with 2N
+ * bins is then the mean of the coarse sum and Midpoint rule with N bins.
+ * See section 4.2 of Numerical Recipes.
+ */
+static double refine(INTEGRAL intgrl, double coarse, unsigned long N) {
+
+	return 0.5 * (coarse + midpt(intgrl, N));
+
+}
+
+
+/*
+ * Add a Trapezoid sum to the Romberg table, extrapolating the sums so far to
+ * zero bin width.
+ *
+ * Parameters
+ * ==========
+ * row: 		The most recent row of the Romberg table, overwritten with the
+ * 				next
+ * trapezoid: 	The Trapezoid sum with twice as many bins as the most recent
+ * level: 		The number of Trapezoid sums already added to the table
+ *
+ * Returns
+ * =======
+ * The highest order extrapolation in the new row
+ *
+ * Notes
+ * =====
+ * Each Trapezoid sum has an error which is a series in even powers of the
+ * bin width. The j'th column of the table cancels the first j terms of this
+ * series by Richardson extrapolation. The order is capped at
+ * ROMBERG_MAX_ORDER, beyond which roundoff error dominates. See section 4.3
+ * of Numerical Recipes.
+ */
+static double richardson(double *row, double trapezoid, unsigned short level) {
+
+	unsigned short j, order = level < ROMBERG_MAX_ORDER ? level :
+		ROMBERG_MAX_ORDER - 1u;
+	double previous = row[0], factor = 1;
+	row[0] = trapezoid;
+	for (j = 1u; j <= order; j++) {
+		/* previous holds element j - 1 of the old row */
+		double next = row[j];
+		factor *= 4;
+		row[j] = row[j - 1u] + (row[j - 1u] - previous) / (factor - 1);
+		previous = next;
+	}
+	return row[order];
+
+}
+
+
+/*
+ * Evaluate an integral from a to b using adaptive Gauss-Kronrod quadrature.
+ *
+ * Parameters
+ * ==========
+ * intgrl: 		The integral object
+ *
+ * Returns
+ * =======
+ * 0 on success, 1 on an error larger than the tolerance
+ *
+ * Notes
+ * =====
+ * The range of integration is first split into Nmin / 15 subintervals (at
+ * least one). The subinterval with the largest error estimate is then
+ * bisected until the fractional error on the sum falls below the tolerance,
+ * or until the next bisection would exceed Nmax function evaluations. Each
+ * subinterval is integrated with the 15-point Kronrod rule, taking the
+ * difference from the embedded 7-point Gauss rule as the error. The
+ * subintervals are kept in a max-heap on their errors. The number of
+ * function evaluations is stored as the number of iterations.
+ */
+static unsigned short gauss_kronrod(INTEGRAL *intgrl) {
+
+	unsigned long i, n = (*intgrl).Nmin / GAUSS_KRONROD_POINTS;
+	if (n < 1ul) n = 1ul;
+	unsigned long capacity = 2ul * n;
+	QUADRATURE_INTERVAL *heap = (QUADRATURE_INTERVAL *) malloc (
+		capacity * sizeof(QUADRATURE_INTERVAL));
+	if (heap == NULL) {
+		intgrl -> error = 1;
+		return 1u;
+	} else {}
+
+	double total = 0, error = 0;
+	double h = ((*intgrl).b - (*intgrl).a) / n;
+	for (i = 0ul; i < n; i++) {
+		QUADRATURE_INTERVAL interval = kronrod15(*intgrl,
+			(*intgrl).a + i * h, i == n - 1ul ? (*intgrl).b :
+				(*intgrl).a + (i + 1ul) * h);
+		interval_heap_push(heap, i, interval);
+		total += interval.result;
+		error += interval.error;
+	}
+	intgrl -> iters = n * GAUSS_KRONROD_POINTS;
+
+	while (error > (*intgrl).tolerance * absval(total) &&
+		(*intgrl).iters + 2ul * GAUSS_KRONROD_POINTS <= (*intgrl).Nmax) {
+
+		if (n == capacity) {
+			QUADRATURE_INTERVAL *larger = (QUADRATURE_INTERVAL *) realloc (
+				heap, 2ul * capacity * sizeof(QUADRATURE_INTERVAL));
+			if (larger == NULL) break;
+			heap = larger;
+			capacity *= 2ul;
+		} else {}
+
+		/* bisect the subinterval with the largest error */
+		QUADRATURE_INTERVAL worst = interval_heap_pop(heap, n--);
+		double center = 0.5 * (worst.a + worst.b);
+		QUADRATURE_INTERVAL left = kronrod15(*intgrl, worst.a, center);
+		QUADRATURE_INTERVAL right = kronrod15(*intgrl, center, worst.b);
+		interval_heap_push(heap, n++, left);
+		interval_heap_push(heap, n++, right);
+		total += left.result + right.result - worst.result;
+		error += left.error + right.error - worst.error;
+		intgrl -> iters += 2ul * GAUSS_KRONROD_POINTS;
+
+	}
+
+	/* sum over the subintervals again, free of the roundoff in the updates */
+	total = 0;
+	error = 0;
+	for (i = 0ul; i < n; i++) {
+		total += heap[i].result;
+		error += heap[i].error;
+	}
+	free(heap);
+
+	intgrl -> result = total;
+	if (total) {
+		intgrl -> error = error / absval(total);
+	} else {
+		intgrl -> error = error ? 1 : 0;
+	}
+	return ((*intgrl).error > (*intgrl).tolerance);
+
+}
+
+
+/*
+ * Integrate a function over a subinterval with the 15-point Kronrod rule.
+ *
+ * Parameters
+ * ==========
+ * intgrl: 		The integral object
+ * a: 			The lower bound of the subinterval
+ * b: 			The upper bound of the subinterval
+ *
+ * Returns
+ * =======
+ * The subinterval, with the Kronrod estimate of the integral and its
+ * absolute error
+ *
+ * Notes
+ * =====
+ * The error is the difference between the Kronrod and Gauss estimates,
+ * bounded from below by 50 times the machine epsilon times the Kronrod
+ * estimate of the integral of |f|, below which roundoff dominates. This is
+ * the bound adopted by QUADPACK.
  */
-static double simp(INTEGRAL intgrl, unsigned long N) {
+static QUADRATURE_INTERVAL kronrod15(INTEGRAL intgrl, double a, double b) {
+
+	double center = 0.5 * (a + b);
+	double half = 0.5 * (b - a);
+	double fc = intgrl.func(center, intgrl.params);
+	double kronrod = fc * KRONROD_WEIGHTS[7];
+	double gauss = fc * GAUSS_WEIGHTS[3];
+	double magnitude = absval(kronrod);
+
+	unsigned short i;
+	for (i = 0u; i < 7u; i++) {
+		double dx = half * KRONROD_NODES[i];
+		double f1 = intgrl.func(center - dx, intgrl.params);
+		double f2 = intgrl.func(center + dx, intgrl.params);
+		kronrod += KRONROD_WEIGHTS[i] * (f1 + f2);
+		magnitude += KRONROD_WEIGHTS[i] * (absval(f1) + absval(f2));
+		if (i % 2u) gauss += GAUSS_WEIGHTS[i / 2u] * (f1 + f2);
+	}
+
+	QUADRATURE_INTERVAL interval;
+	interval.a = a;
+	interval.b = b;
+	interval.result = kronrod * half;
+	interval.error = absval((kronrod - gauss) * half);
+	if (interval.error < 50 * DBL_EPSILON * magnitude * absval(half)) {
+		interval.error = 50 * DBL_EPSILON * magnitude * absval(half);
+	} else {}
+	return interval;
+
+}
+
+
+/*
+ * Add a subinterval to the max-heap on the errors of the subintervals in
+ * adaptive Gauss-Kronrod quadrature.
+ *
+ * Parameters
+ * ==========
+ * heap: 		The heap, with room for at least n + 1 subintervals
+ * n: 			The number of subintervals in the heap
+ * interval: 	The subinterval to add
+ */
+static void interval_heap_push(QUADRATURE_INTERVAL *heap, unsigned long n,
+	QUADRATURE_INTERVAL interval) {
+
+	unsigned long i = n;
+	while (i > 0ul && heap[(i - 1ul) / 2ul].error < interval.error) {
+		heap[i] = heap[(i - 1ul) / 2ul];
+		i = (i - 1ul) / 2ul;
+	}
+	heap[i] = interval;
 
-	/* Simpson's rule is essentially a complication of Trapezoid rule */
-	return (4 * trapzd(intgrl, N) - trapzd(intgrl, N / 2l)) / 3;
+}
+
+
+/*
+ * Remove the subinterval with the largest error from the max-heap on the
+ * errors of the subintervals in adaptive Gauss-Kronrod quadrature.
+ *
+ * Parameters
+ * ==========
+ * heap: 		The heap
+ * n: 			The number of subintervals in the heap, at least one
+ *
+ * Returns
+ * =======
+ * The subinterval with the largest error
+ */
+static QUADRATURE_INTERVAL interval_heap_pop(QUADRATURE_INTERVAL *heap,
+	unsigned long n) {
+
+	QUADRATURE_INTERVAL top = heap[0], last = heap[n - 1ul];
+	unsigned long i = 0ul, child;
+	n--;
+	while ((child = 2ul * i + 1ul) < n) {
+		if (child + 1ul < n && heap[child + 1ul].error > heap[child].error) {
+			child++;
+		} else {}
+		if (heap[child].error <= last.error) break;
+		heap[i] = heap[child];
+		i = child;
+	}
+	heap[i] = last;
+	return top;
 
 }
 
@@ -6,6 +6,19 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/*
+ * The maximum order of Richardson extrapolation in Romberg integration,
+ * beyond which roundoff error dominates.
+ */
+#ifndef ROMBERG_MAX_ORDER
+#define ROMBERG_MAX_ORDER 20u
+#endif /* ROMBERG_MAX_ORDER */
+
+/* The number of points in each subinterval in Gauss-Kronrod quadrature */
+#ifndef GAUSS_KRONROD_POINTS
+#define GAUSS_KRONROD_POINTS 15ul
+#endif /* GAUSS_KRONROD_POINTS */
+
 #include "../objects.h"
 
 /*
@@ -25,6 +38,8 @@ extern "C" {
  * The methods of numerical quadrature implemented in this function and its
  * subroutines are adopted from Chapter 4 of Numerical Recipes (Press,
  * Teukolsky, Vetterling & Flannery 2007), Cambridge University Press.
+ * Adaptive Gauss-Kronrod quadrature follows the QAG routine of QUADPACK
+ * (Piessens, de Doncker-Kapenga, Uberhuber & Kahaner 1983), Springer.
  *
  * source: integral.c
  */
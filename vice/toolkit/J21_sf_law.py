@@ -134,6 +134,12 @@ class J21_sf_law:
 	with the assumption that :math:`t_0` = 13.7 Gyr is the age of the universe
 	at the present day.
 
+	When an instance of this class is the ``tau_star`` attribute of a
+	``singlezone`` object or a zone of a ``milkyway`` object, VICE copies its
+	attributes when the simulation starts and evaluates this law in C, without
+	calling this object. Instances of subclasses which override ``__call__``
+	or ``molecular`` are called as usual.
+
 	.. [1] Johnson et al. (2021), arxiv:2103.09838
 	"""
 
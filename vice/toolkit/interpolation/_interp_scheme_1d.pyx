@@ -4,6 +4,7 @@ from __future__ import absolute_import
 import numbers
 from ...core import _pyutils
 from libc.stdlib cimport malloc
+from cpython.pycapsule cimport PyCapsule_New
 from . cimport _interp_scheme_1d
 
 
@@ -101,3 +102,19 @@ at must be a numerical value. Got: %s""" % (type(x)))
 		"""
 		return int(self._is1d[0].n_points)
 
+
+	@property
+	def _native(self):
+		r"""
+		**VICE Developer's Documentation**
+
+		Type : ``PyCapsule``
+
+		A capsule named "INTERP_SCHEME_1D" holding a pointer to the C object
+		underlying this interpolation scheme. VICE's C library evaluates it
+		directly when it is passed as a function.
+
+		.. seealso:: vice/core/_cutils.pyx
+		"""
+		return PyCapsule_New(<void *> self._is1d, "INTERP_SCHEME_1D", NULL)
+
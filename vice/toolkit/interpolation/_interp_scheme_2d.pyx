@@ -4,6 +4,7 @@ from __future__ import absolute_import
 import numbers
 from ...core import _pyutils
 from libc.stdlib cimport malloc
+from cpython.pycapsule cimport PyCapsule_New
 from . cimport _interp_scheme_2d
 
 
@@ -139,3 +140,19 @@ must be of the same length as 'xcoords'. Got: (%d, %d).""" % (
 		"""
 		return self._is2d[0].n_y_values
 
+
+	@property
+	def _native(self):
+		r"""
+		**VICE Developer's Documentation**
+
+		Type : ``PyCapsule``
+
+		A capsule named "INTERP_SCHEME_2D" holding a pointer to the C object
+		underlying this interpolation scheme. VICE's C library evaluates it
+		directly when it is passed as a function.
+
+		.. seealso:: vice/core/_cutils.pyx
+		"""
+		return PyCapsule_New(<void *> self._is2d, "INTERP_SCHEME_2D", NULL)
+
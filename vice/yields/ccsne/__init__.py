@@ -15,6 +15,9 @@ Contents
 --------
 fractional : <function>
 	Calculate an IMF-averaged yield for a given element.
+fractional_batch : <function>
+	Calculate IMF-averaged yields for many elements, studies, metallicities
+	and rotational velocities at once.
 table : <function>
 	Obtain the table of mass yields and progenitor masses for a given element
 	from a given study.
@@ -64,9 +67,11 @@ except NameError:
 
 if not __VICE_SETUP__:
 
-	__all__ = ["engines", "fractional", "settings", "table", "test"]
+	__all__ = ["engines", "fractional", "fractional_batch", "settings",
+		"table", "test"]
 	from . import engines
 	from ._yield_integrator import integrate as fractional
+	from ._yield_integrator import integrate_batch as fractional_batch
 	from .grid_reader import table
 	from .settings import settings
 	from .tests import test
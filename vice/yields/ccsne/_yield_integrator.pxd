@@ -11,11 +11,15 @@ cdef extern from "../../src/ccsne.h":
 
 
 cdef extern from "../../src/yields/ccsne.h":
-	void weight_initial_by_explodability(unsigned short weight)
-	void set_Z_progenitor(double Z)
 	unsigned short IMFintegrated_fractional_yield_numerator(
 		INTEGRAL *intgrl, IMF_ *imf, CALLBACK_1ARG *explodability,
-		char *path, const unsigned short wind, char *element)
+		char *path, const unsigned short wind, char *element,
+		double Z_progenitor, unsigned short weight_initial)
 	extern unsigned short IMFintegrated_fractional_yield_denominator(
 		INTEGRAL *intgrl, IMF_ *imf)
+	void IMFintegrated_fractional_yield_batch(INTEGRAL **numerators,
+		unsigned long n, IMF_ *imf, CALLBACK_1ARG *explodability,
+		char **paths, const unsigned short wind, char **elements,
+		double *Z_progenitor, unsigned short *weight_initial,
+		unsigned short *status, unsigned int n_threads) nogil
 
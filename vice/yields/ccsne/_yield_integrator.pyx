@@ -41,6 +41,7 @@ from ...core.objects cimport _integral
 from ...core.objects cimport _imf
 from ...core._cutils cimport copy_pylist
 from ...core._cutils cimport callback_1arg_setup
+from libc.stdlib cimport malloc, free
 from . cimport _yield_integrator
 _MINIMUM_MASS_ = float(_yield_integrator.CC_MIN_STELLAR_MASS)
 
@@ -180,9 +181,25 @@ def integrate(element, study = "LC18", MoverH = 0, rotation = 0,
 			- "trapezoid"
 			- "midpoint"
 			- "euler"
+			- "romberg"
+			- "gausskronrod"
+
+		.. versionadded:: 1.3.0
+			The "romberg" and "gausskronrod" methods.
 
 		.. note:: These methods of quadrature are implemented according to
 			Chapter 4 of Press, Teukolsky, Vetterling & Flannery (2007) [10]_.
+			Each doubling of the number of bins in Euler's method, trapezoid
+			rule, Simpson's rule, and Romberg integration evaluates the
+			integrand only at the new points.
+
+		.. note:: The "gausskronrod" method bisects the subinterval with the
+			largest error estimate from a 15-point Kronrod rule until the
+			tolerance is met, following the QAG routine of QUADPACK. For this
+			method, ``Nmin`` and ``Nmax`` bound the number of evaluations of
+			the integrand rather than the number of bins. It requires far
+			fewer evaluations than the others when the explodability or the
+			IMF is a python function.
 
 	m_lower : real number [default : 0.08]
 		The lower mass limit on star formation in :math:`M_\odot`.
@@ -314,40 +331,219 @@ def integrate(element, study = "LC18", MoverH = 0, rotation = 0,
 		Cambridge University Press
 	"""
 
-	# Type checking errors
 	if not isinstance(element, strcomp):
 		raise TypeError("First argument must be of type string. Got: %s" % (
 			type(element)))
 	else:
 		string_check(study, "study")
-		string_check(method, "method")
+		_check_quadrature(method, m_lower, m_upper, tolerance, Nmin, Nmax)
 		numeric_check(MoverH, "MoverH")
 		numeric_check(rotation, "rotation")
-		numeric_check(m_lower, "m_lower")
-		numeric_check(m_upper, "m_upper")
-		numeric_check(tolerance, "tolerance")
-		numeric_check(Nmin, "Nmin")
-		numeric_check(Nmax, "Nmax")
-		
-	if MoverH % 1 == 0:
-		MoverHstr = "%d" % (MoverH)
+	_check_element(element)
+	path = _study_directory(study, MoverH, rotation)
+	return _fractional_yields([[element, study, MoverH, rotation, path]],
+		explodability, wind, net, IMF, method, m_lower, m_upper, tolerance,
+		Nmin, Nmax, 1)[0]
+
+
+def integrate_batch(elements, studies = "LC18", MoverH = 0, rotation = 0,
+	explodability = None, wind = True, net = True, IMF = "kroupa",
+	method = "simpson", m_lower = 0.08, m_upper = 100,
+	tolerance = 1e-3, Nmin = 64, Nmax = 2e8, n_threads = 1):
+
+	r"""
+	Calculate IMF-integrated fractional nucleosynthetic yields from
+	core-collapse supernovae for many elements, studies, metallicities and
+	rotational velocities at once.
+
+	**Signature**: vice.yields.ccsne.fractional_batch(elements,
+	studies = "LC18", MoverH = 0, rotation = 0, explodability = None,
+	wind = True, net = True, IMF = "kroupa", method = "simpson",
+	m_lower = 0.08, m_upper = 100, tolerance = 1e-3, Nmin = 64,
+	Nmax = 2.0e+08, n_threads = 1)
+
+	.. versionadded:: 1.3.0
+
+	Parameters
+	----------
+	elements : ``str`` or array-like [elements of type ``str``]
+		The symbols of the elements to calculate yields for.
+	studies : ``str`` or array-like [elements of type ``str``]
+		[case-insensitive] [default : "LC18"]
+		The studies to adopt the yields from. See
+		``vice.yields.ccsne.fractional`` for the recognized studies.
+	MoverH : real number or array-like [elements are real numbers]
+		[default : 0]
+		The metallicities [M/H] of the exploding stars.
+	rotation : real number or array-like [elements are real numbers]
+		[default : 0]
+		The rotational velocities of the exploding stars in km/s.
+	n_threads : ``int`` [default : 1]
+		The number of threads to integrate the yields across.
+
+	All other keyword arguments are the same as in
+	``vice.yields.ccsne.fractional``, applied to every yield.
+
+	Returns
+	-------
+	yields : ``dict``
+		The yields keyed by the tuple (element, study, MoverH, rotation),
+		each one the list [y, err] which ``vice.yields.ccsne.fractional``
+		would return for the same arguments. Combinations of metallicity and
+		rotational velocity which a study did not report are omitted.
+
+	Raises
+	------
+	* TypeError
+		- Any element or study is not of type ``str``
+		- Any metallicity or rotational velocity is not a real number
+		- n_threads is not an integer
+		- The same conditions as ``vice.yields.ccsne.fractional``
+	* ValueError
+		- Any element or study is not recognized by VICE
+		- n_threads is not positive
+		- The same conditions as ``vice.yields.ccsne.fractional``
+	* LookupError
+		- None of the studies reported yields at any of the metallicities
+		  and rotational velocities
+
+	Warns
+	-----
+	* ScienceWarning
+		The same conditions as ``vice.yields.ccsne.fractional``, for each
+		yield.
+
+	Notes
+	-----
+	The mass-weighted integral of the IMF, which is the denominator of every
+	yield, is computed only once. The remaining integrals are independent of
+	one another and are shared between ``n_threads`` threads. If either
+	``explodability`` or ``IMF`` is a python function, it can only be
+	evaluated while holding python's global interpreter lock, and the yields
+	are integrated on one thread regardless of ``n_threads``.
+
+	Example Code
+	------------
+	>>> yields = vice.yields.ccsne.fractional_batch(["o", "mg", "fe"],
+		studies = ["LC18", "S16/W18"], MoverH = [-1, 0],
+		rotation = [0, 150], n_threads = 4)
+	>>> len(yields)
+		15
+	>>> yields[("o", "LC18", 0, 0)]
+		[0.0036512768277795968, 3.6882505956089717e-06]
+	"""
+	elements = _batch_list(elements, "elements")
+	studies = _batch_list(studies, "studies")
+	MoverH = _batch_list(MoverH, "MoverH")
+	rotation = _batch_list(rotation, "rotation")
+	for i in elements:
+		if isinstance(i, strcomp):
+			_check_element(i)
+		else:
+			raise TypeError("""Each element must be of type string. Got: \
+%s""" % (type(i)))
+	for i in studies: string_check(i, "study")
+	for i in MoverH: numeric_check(i, "MoverH")
+	for i in rotation: numeric_check(i, "rotation")
+	_check_quadrature(method, m_lower, m_upper, tolerance, Nmin, Nmax)
+	if isinstance(n_threads, numbers.Number):
+		if n_threads % 1 != 0:
+			raise ValueError("""Keyword arg 'n_threads' must be interpreted as \
+an integer. Got: %g""" % (n_threads))
+		elif n_threads <= 0:
+			raise ValueError("""Keyword arg 'n_threads' must be positive. Got: \
+%d""" % (n_threads))
+		else: pass
 	else:
-		MoverHstr = ("%.2f" % (MoverH)).replace('.', 'p')
+		raise TypeError("""Keyword arg 'n_threads' must be an integer. Got: \
+%s""" % (type(n_threads)))
+
+	# every combination the studies reported, each of which has a directory
+	combinations = []
+	for study in studies:
+		for i in MoverH:
+			for j in rotation:
+				try:
+					path = _study_directory(study, i, j)
+				except LookupError:
+					continue
+				combinations += [[element, study, i, j, path] for element in
+					elements]
+	if not len(combinations): raise LookupError("""None of the studies \
+reported yields at any of the metallicities and rotational velocities.""")
+
+	yields = _fractional_yields(combinations, explodability, wind, net, IMF,
+		method, m_lower, m_upper, tolerance, Nmin, Nmax, n_threads)
+	return dict(zip([tuple(i[:4]) for i in combinations], yields))
+
+
+def initial_abundance(filename, element):
+	r"""
+	Read in the table containing the initial abundances of each element.
+
+	Parameters
+	----------
+	filename : str
+		The full path to the file containing the initial abundances
+	element : str
+		The name of the element to find the initial abundance for.
 
-	# Value checking errors
+	Returns
+	-------
+	zprog : elemental_settings
+		A dataframe mapping elemental symbols to the initial abundance.
+	"""
+	with open(filename, 'r') as f:
+		while True:
+			line = f.readline()
+			element_, Z = line.split()
+			if element_.lower() == element.lower():
+				f.close()
+				return float(Z)
+			elif line == "":
+				break
+			else:
+				continue
+		f.close()
+	# integrator should return 0 before this function is called in this case.
+	raise SystemError("Internal Error.")
+
+
+def _batch_list(value, name):
+	"""
+	Interpret a positional or keyword argument to integrate_batch as a list
+	of values, allowing a single value in place of a list of one.
+	"""
+	if isinstance(value, strcomp) or isinstance(value, numbers.Number):
+		return [value]
+	else:
+		try:
+			return list(value)
+		except TypeError:
+			raise TypeError("""%s must be either a single value or an \
+array-like object. Got: %s""" % (name, type(value)))
+
+
+def _check_element(element):
+	"""
+	Raise a ValueError if an element is not recognized by VICE.
+	"""
 	if element.lower() not in _RECOGNIZED_ELEMENTS_:
 		raise ValueError("Unrecognized element: %s" % (element))
-	elif study.upper() not in _RECOGNIZED_STUDIES_:
-		raise ValueError("Unrecognized study: %s" % (study))
-	elif not os.path.exists("%syields/ccsne/%s/FeH%s" % (_DIRECTORY_,
-		study.upper(), MoverHstr)):
-		raise LookupError("The %s study does not have yields for [M/H] = %s" % (
-			_NAMES_[study.upper()], MoverHstr.replace('p', '.')))
-	elif not os.path.exists("%syields/ccsne/%s/FeH%s/v%d" % (_DIRECTORY_,
-		study.upper(), MoverHstr, rotation)):
-		raise LookupError("""The %s study did not report yields for v = %d \
-km/s and [M/H] = %g""" % (study, rotation, MoverH))
-	elif tolerance < 0 or tolerance > 1:
+	else: pass
+
+
+def _check_quadrature(method, m_lower, m_upper, tolerance, Nmin, Nmax):
+	"""
+	Type- and value-check the keyword arguments which specify the quadrature.
+	"""
+	string_check(method, "method")
+	numeric_check(m_lower, "m_lower")
+	numeric_check(m_upper, "m_upper")
+	numeric_check(tolerance, "tolerance")
+	numeric_check(Nmin, "Nmin")
+	numeric_check(Nmax, "Nmax")
+	if tolerance < 0 or tolerance > 1:
 		raise ValueError("Tolerance must be between 0 and 1.")
 	elif m_lower >= m_upper:
 		raise ValueError("Lower mass limit larger than upper mass limit.")
@@ -358,38 +554,40 @@ km/s and [M/H] = %g""" % (study, rotation, MoverH))
 smaller than maximum number of bins.""")
 	else: pass
 
+
+def _MoverH_string(MoverH):
 	"""
-	Explodability is either None of a callable function with one parameter.
+	The name of the directory holding a study's yields at a given [M/H],
+	following "FeH".
 	"""
-	cdef CALLBACK_1ARG *explodability_cb = callback_1arg_initialize()
-	if explodability is None:
-		# assume everything explodes
-		def uniform(m):
-			return 1.0
-		uniform_explodability = callback1_nan_inf(uniform)
-		callback_1arg_setup(explodability_cb, uniform_explodability)
-	elif callable(explodability):
-		exp_cb = callback1_nan_inf(explodability)
-		callback_1arg_setup(explodability_cb, exp_cb)
-		if study.upper() in ["LC18", "S16/N20", "S16/W18"]: warnings.warn("""\
-The %s yields are already reported under a given black hole landscape. Stellar \
-explodability is over-specified in this calculation.""" % (
-			_NAMES_[study.upper()]), ScienceWarning)
+	if MoverH % 1 == 0:
+		return "%d" % (MoverH)
 	else:
-		raise TypeError("""Explodability must be either NoneType or a callable \
-object. Got: %s""" % (type(explodability)))
+		return ("%.2f" % (MoverH)).replace('.', 'p')
 
 
+def _study_directory(study, MoverH, rotation):
 	"""
-	The IMF is either None or a callable function with one parameter. However,
-	it must be placed in an IMF_ object.
+	Determine the directory holding a study's yields at a given [M/H] and
+	rotational velocity, raising a LookupError if it did not report them.
 	"""
-	if callable(IMF):
-		imf_cb = callback1_nan_inf_positive(IMF)
+	MoverHstr = _MoverH_string(MoverH)
+	if study.upper() not in _RECOGNIZED_STUDIES_:
+		raise ValueError("Unrecognized study: %s" % (study))
+	elif not os.path.exists("%syields/ccsne/%s/FeH%s" % (_DIRECTORY_,
+		study.upper(), MoverHstr)):
+		raise LookupError("The %s study does not have yields for [M/H] = %s" % (
+			_NAMES_[study.upper()], MoverHstr.replace('p', '.')))
+	elif not os.path.exists("%syields/ccsne/%s/FeH%s/v%d" % (_DIRECTORY_,
+		study.upper(), MoverHstr, rotation)):
+		raise LookupError("""The %s study did not report yields for v = %d \
+km/s and [M/H] = %g""" % (study, rotation, MoverH))
 	else:
-		imf_cb = IMF
-	cdef IMF_ *imf_obj = imf_object(imf_cb, m_lower, m_upper)
+		return "%syields/ccsne/%s/FeH%s/v%d/" % (_DIRECTORY_, study.upper(),
+			MoverHstr, rotation)
 
+
+def _science_warnings(element, study, MoverH, wind, m_upper):
 	"""
 	Science Warnings
 	================
@@ -412,7 +610,8 @@ object. Got: %s""" % (type(explodability)))
 	4) If the user specifies explodability in combination with either the
 	Limongi & Chieffi (2018) or Sukhbold et al. (2016) yields, the
 	explodability is over-specified. The yields reported by these studies are
-	already masked by stellar explodability.
+	already masked by stellar explodability. This one is raised in
+	_fractional_yields.
 
 	5) If the user wants to separate the wind yields from explosive yields for
 	anything other than Limongi & Chieffi (2018) or Sukhbold et al. (2016),
@@ -459,134 +658,197 @@ For this reason, this calculation can only run including the wind yield.""" % (
 	else:
 		pass
 
-	path = "%syields/ccsne/%s/FeH%s/v%d/" % (_DIRECTORY_,
-		study.upper(),
-		MoverHstr,
-		rotation)
 
+def _progenitor_abundance(element, study, MoverH, net):
 	"""
-	VICE includes yields for every element that these studies reported.
-	However, if a study didn't report yields for a given element, that study
-	would suggest that the element is not produced in significant amounts by
-	CCSNe, so we can safely return a 0 and raise a ScienceWarning.
+	Determine the abundance of an element in the progenitor stars for a net
+	yield, and whether or not it should be weighted by explodability. Both
+	are zero for gross yields.
 	"""
-	if not os.path.exists("%sexplosive/%s.dat" % (path, element.lower())):
-		warnings.warn("""The %s study did not report yields for the element \
-%s. If adopting these yields for simulation, it is likely that this yield \
-can be approximated as zero at this metallicity. Users may exercise their \
-own discretion by modifying their CCSN yield settings directly.""" % (
-			_NAMES_[study.upper()], element), ScienceWarning)
-		return [0, float("nan")]
-	else:
-		pass
-
 	if net:
 		zprog = initial_abundance(
 			"%syields/ccsne/%s/FeH%s/birth_composition.dat" % (
-				_DIRECTORY_, study.upper(), MoverHstr), element.lower())
-		_yield_integrator.set_Z_progenitor(zprog)
-		if study.upper() not in ["S16/W18", "S16/W18F", "S16/N20", "LC18"]:
-			_yield_integrator.weight_initial_by_explodability(1)
-		else:
-			_yield_integrator.weight_initial_by_explodability(0)
+				_DIRECTORY_, study.upper(), _MoverH_string(MoverH)),
+			element.lower())
+		# weight the initial composition by explodability unless the study
+		# separated wind and explosive yields
+		weight_initial = int(study.upper() not in ["S16/W18", "S16/W18F",
+			"S16/N20", "LC18"])
 		if study.upper() == "WW95": warnings.warn("""\
 Woosley & Weaver (1995) did not report their birth abundances. VICE cannot \
 compute net yields for this study, only reporting gross yields.""",
 			ScienceWarning)
 	else:
-		_yield_integrator.set_Z_progenitor(0)
-		_yield_integrator.weight_initial_by_explodability(0)
+		zprog = 0
+		weight_initial = 0
 		if study.upper() == "NKT13": warnings.warn("""\
 Nomoto, Kobayashi & Tominaga (2013) reported net mass yields in their model \
 core collapse supernova ejecta. VICE cannot compute gross yields for this \
 study, only reporting net yields.""")
+	return [zprog, weight_initial]
 
-	# Compute the yield
-	cdef INTEGRAL *num = _integral.integral_initialize()
-	num[0].a = m_lower
-	num[0].b = m_upper
-	num[0].tolerance = tolerance
-	num[0].method = <unsigned long> sum([ord(i) for i in method.lower()])
-	num[0].Nmax = <unsigned long> Nmax
-	num[0].Nmin = <unsigned long> Nmin
-	try:
-		x = _yield_integrator.IMFintegrated_fractional_yield_numerator(num,
-			imf_obj, explodability_cb, path.encode("latin-1"),
-			int(wind), element.lower().encode("latin-1"))
-		if x == 1:
-			warnings.warn("""Yield-weighted IMF integration did not converge \
-for element: %s. Estimated fractional error: %.2e""" % (element.lower(),
-				num[0].error), ScienceWarning)
-		elif x:
-			raise SystemError("Internal Error")
+
+def _fractional_yields(combinations, explodability, wind, net, IMF, method,
+	m_lower, m_upper, tolerance, Nmin, Nmax, n_threads):
+	"""
+	Compute a set of IMF-integrated fractional yields from core collapse
+	supernovae, each specified by a list of its element, study, [M/H],
+	rotational velocity and the directory holding its yields. All arguments
+	are assumed to have been type- and value-checked. Returns a list of
+	[y, err] for each yield.
+	"""
+	cdef unsigned long i
+	cdef unsigned long n
+	cdef INTEGRAL **numerators = NULL
+	cdef char **paths = NULL
+	cdef char **elements = NULL
+	cdef double *Z_progenitor = NULL
+	cdef unsigned short *weight_initial = NULL
+	cdef unsigned short *status = NULL
+	cdef unsigned int threads = <unsigned int> n_threads
+	cdef unsigned short wind_ = <unsigned short> int(wind)
+	cdef CALLBACK_1ARG *explodability_cb
+	cdef IMF_ *imf_obj
+	cdef INTEGRAL *den
+
+	"""
+	Explodability is either None of a callable function with one parameter.
+	"""
+	if explodability is not None and not callable(explodability):
+		raise TypeError("""Explodability must be either NoneType or a callable \
+object. Got: %s""" % (type(explodability)))
+	else: pass
+	for study in set([j[1].upper() for j in combinations]):
+		if (callable(explodability) and
+			study in ["LC18", "S16/N20", "S16/W18"]): warnings.warn("""\
+The %s yields are already reported under a given black hole landscape. Stellar \
+explodability is over-specified in this calculation.""" % (_NAMES_[study]),
+			ScienceWarning)
+
+	"""
+	VICE includes yields for every element that these studies reported.
+	However, if a study didn't report yields for a given element, that study
+	would suggest that the element is not produced in significant amounts by
+	CCSNe, so we can safely return a 0 and raise a ScienceWarning.
+	"""
+	yields = len(combinations) * [None]
+	reported = []
+	for j in range(len(combinations)):
+		element, study, MoverH, rotation, path = combinations[j]
+		_science_warnings(element, study, MoverH, wind, m_upper)
+		if os.path.exists("%sexplosive/%s.dat" % (path, element.lower())):
+			reported.append(j)
 		else:
-			pass
-	finally:
-		numerator = [num[0].result, num[0].error, num[0].iters]
-		_integral.integral_free(num)
-		callback_1arg_free(explodability_cb)
+			warnings.warn("""The %s study did not report yields for the \
+element %s. If adopting these yields for simulation, it is likely that this \
+yield can be approximated as zero at this metallicity. Users may exercise \
+their own discretion by modifying their CCSN yield settings directly.""" % (
+				_NAMES_[study.upper()], element), ScienceWarning)
+			yields[j] = [0, float("nan")]
+	n = len(reported)
+	if not n: return yields
 
+	"""
+	The IMF is either None or a callable function with one parameter. However,
+	it must be placed in an IMF_ object.
+	"""
+	if callable(IMF):
+		imf_cb = callback1_nan_inf_positive(IMF)
+	else:
+		imf_cb = IMF
+	imf_obj = imf_object(imf_cb, m_lower, m_upper)
+	explodability_cb = callback_1arg_initialize()
+	if explodability is None:
+		# assume everything explodes, which doesn't need python
+		explodability_cb[0].assumed_constant = 1
+	else:
+		exp_cb = callback1_nan_inf(explodability)
+		callback_1arg_setup(explodability_cb, exp_cb)
 
-	cdef INTEGRAL *den = _integral.integral_initialize()
-	den[0].a = m_lower
-	den[0].b = m_upper
-	den[0].tolerance = tolerance
-	den[0].method = <unsigned long> sum([ord(i) for i in method.lower()])
-	den[0].Nmax = <unsigned long> Nmax
-	den[0].Nmin = <unsigned long> Nmin
+	# keep the encoded strings alive while C holds pointers to them
+	encoded = [[combinations[j][4].encode("latin-1"),
+		combinations[j][0].lower().encode("latin-1")] for j in reported]
 	try:
-		x = _yield_integrator.IMFintegrated_fractional_yield_denominator(den,
-			imf_obj)
-		if x == 1:
-			warnings.warn("""Mass-weighted IMF integration did not converge. \
-Estimated fractional error: %.2e""" % (den[0].error), ScienceWarning)
-		elif x:
-			raise SystemError("Internal Error")
-		else:
-			pass
+		# The denominator is the same for every yield
+		den = _integral.integral_initialize()
+		_quadrature_setup(den, method, m_lower, m_upper, tolerance, Nmin, Nmax)
+		try:
+			x = _yield_integrator.IMFintegrated_fractional_yield_denominator(
+				den, imf_obj)
+			if x == 1:
+				warnings.warn("""Mass-weighted IMF integration did not \
+converge. Estimated fractional error: %.2e""" % (den[0].error), ScienceWarning)
+			elif x:
+				raise SystemError("Internal Error")
+			else:
+				pass
+			denominator = [den[0].result, den[0].error]
+		finally:
+			_integral.integral_free(den)
+
+		numerators = <INTEGRAL **> malloc (n * sizeof(INTEGRAL *))
+		for i in range(n): numerators[i] = _integral.integral_initialize()
+		paths = <char **> malloc (n * sizeof(char *))
+		elements = <char **> malloc (n * sizeof(char *))
+		Z_progenitor = <double *> malloc (n * sizeof(double))
+		weight_initial = <unsigned short *> malloc (n * sizeof(unsigned short))
+		status = <unsigned short *> malloc (n * sizeof(unsigned short))
+		for i in range(n):
+			element, study, MoverH, rotation, path = combinations[reported[i]]
+			_quadrature_setup(numerators[i], method, m_lower, m_upper,
+				tolerance, Nmin, Nmax)
+			path_bytes, element_bytes = encoded[i]
+			paths[i] = path_bytes
+			elements[i] = element_bytes
+			zprog, weight = _progenitor_abundance(element, study, MoverH, net)
+			Z_progenitor[i] = zprog
+			weight_initial[i] = <unsigned short> weight
+		with nogil:
+			_yield_integrator.IMFintegrated_fractional_yield_batch(numerators,
+				n, imf_obj, explodability_cb, paths, wind_, elements,
+				Z_progenitor, weight_initial, status, threads)
+
+		for i in range(n):
+			if status[i] == 1:
+				warnings.warn("""Yield-weighted IMF integration did not \
+converge for element: %s. Estimated fractional error: %.2e""" % (
+					combinations[reported[i]][0].lower(),
+					numerators[i][0].error), ScienceWarning)
+			elif status[i]:
+				raise SystemError("Internal Error")
+			else:
+				pass
+			numerator = [numerators[i][0].result, numerators[i][0].error]
+			y = numerator[0] / denominator[0]
+			errnum = numerator[1] * numerator[0]
+			errden = denominator[1] * denominator[0]
+			err = m.sqrt(errnum**2 / denominator[0]**2 + numerator[0]**2 /
+				denominator[0]**4 * errden**2)
+			yields[reported[i]] = [y, err]
 	finally:
-		denominator = [den[0].result, den[0].error, den[0].iters]
-		_integral.integral_free(den)
+		if numerators is not NULL:
+			for i in range(n): _integral.integral_free(numerators[i])
+		else: pass
+		free(numerators)
+		free(paths)
+		free(elements)
+		free(Z_progenitor)
+		free(weight_initial)
+		free(status)
+		callback_1arg_free(explodability_cb)
 		_imf.imf_free(imf_obj)
+	return yields
 
-	y = numerator[0] / denominator[0]
-	errnum = numerator[1] * numerator[0]
-	errden = denominator[1] * denominator[0]
-	err = m.sqrt(errnum**2 / denominator[0]**2 + numerator[0]**2 /
-		denominator[0]**4 * errden**2)
-
-	return [y, err]
-
-
-def initial_abundance(filename, element):
-	r"""
-	Read in the table containing the initial abundances of each element.
 
-	Parameters
-	----------
-	filename : str
-		The full path to the file containing the initial abundances
-	element : str
-		The name of the element to find the initial abundance for.
-
-	Returns
-	-------
-	zprog : elemental_settings
-		A dataframe mapping elemental symbols to the initial abundance.
+cdef void _quadrature_setup(INTEGRAL *intgrl, method, m_lower, m_upper,
+	tolerance, Nmin, Nmax) except *:
 	"""
-	with open(filename, 'r') as f:
-		while True:
-			line = f.readline()
-			element_, Z = line.split()
-			if element_.lower() == element.lower():
-				f.close()
-				return float(Z)
-			elif line == "":
-				break
-			else:
-				continue
-		f.close()
-	# integrator should return 0 before this function is called in this case.
-	raise SystemError("Internal Error.")
-
+	Set the bounds and the method of quadrature of an integral object.
+	"""
+	intgrl[0].a = m_lower
+	intgrl[0].b = m_upper
+	intgrl[0].tolerance = tolerance
+	intgrl[0].method = <unsigned long> sum([ord(i) for i in method.lower()])
+	intgrl[0].Nmax = <unsigned long> Nmax
+	intgrl[0].Nmin = <unsigned long> Nmin
 
@@ -6,6 +6,7 @@ from __future__ import absolute_import
 __all__ = ["test" ]
 from ...._globals import _RECOGNIZED_ELEMENTS_
 from .._yield_integrator import integrate as fractional
+from .._yield_integrator import integrate_batch as fractional_batch
 from .._errors import _RECOGNIZED_STUDIES_ as _STUDY_
 from .._errors import _NAMES_
 from .._errors import _MOVERH_
@@ -124,5 +125,37 @@ def test():
 						"%s :: [M/H] = %g :: vrot = %g km/s :: IMF = %s" % (
 							_NAMES_[i], j, k, l),
 						**params)())
+	trials.append(test_batch())
 	return ["vice.yields.ccsne.fractional", trials]
 
+
+@unittest
+def test_batch():
+	"""
+	Test the batched yield integrator against the individual yields
+	"""
+	def test():
+		elements = ["o", "mg", "fe", "sr"]
+		kwargs = dict(method = "trapezoid", m_upper = 100)
+		try:
+			with warnings.catch_warnings():
+				warnings.simplefilter("ignore")
+				batch = fractional_batch(elements, studies = ["LC18", "CL04"],
+					MoverH = [-1, 0], rotation = [0, 150], n_threads = 4,
+					**kwargs)
+				success = True
+				for key in batch.keys():
+					element, study, MoverH, rotation = key
+					y, err = fractional(element, study = study,
+						MoverH = MoverH, rotation = rotation, **kwargs)
+					if y:
+						success &= abs(batch[key][0] - y) <= 1.e-12 * abs(y)
+					else:
+						success &= batch[key][0] == 0
+					if not success: break
+		except:
+			return False
+		# CL04 reported only non-rotating yields, at [M/H] = -1 but not 0
+		return success and len(batch) == 5 * len(elements)
+	return ["vice.yields.ccsne.fractional_batch", test]
+